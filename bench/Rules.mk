@@ -0,0 +1,12 @@
+# Begin standard header
+sp		:= $(sp).x
+dirstack_$(sp)	:= $(d)
+d		:= $(dir)
+# End standard header
+
+BENCH_SOURCES += $(call filelist,benchmark.cpp)
+
+# Begin standard footer
+d		:= $(dirstack_$(sp))
+sp		:= $(basename $(sp))
+# End standard footer
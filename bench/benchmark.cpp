@@ -0,0 +1,385 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+
+#include <boost/bind.hpp>
+#include <boost/thread.hpp>
+
+#include "parser/htmlparser.hpp"
+#include "parser/parsemany.hpp"
+#include "parser/fdinput.hpp"
+#include "parser/serializer.hpp"
+#include "parser/incrementalparser.hpp"
+#include "dom/document.hpp"
+#include "dom/element.hpp"
+#include "dom/text.hpp"
+
+using namespace frenzy;
+using namespace frenzy::dom;
+
+namespace
+{
+  // Snippets of the size a templating layer inserts
+  const char* const snippets[] = {
+    "<li class=item><a href=\"/items/1\">First item</a></li>",
+    "<p>Hello, <b>world</b> &amp; all</p>",
+    "<td>12.50</td><td><span class=currency>EUR</span></td>",
+    "<img src=a.png alt=\"\"><br>Caption text",
+    "<div class=\"card\"><h2>Title</h2><p>Body <em>text</em></p></div>"
+  };
+  const size_t snippetcount = sizeof(snippets) / sizeof(snippets[0]);
+
+  std::vector<bytestring> snippet_bytes()
+  {
+    std::vector<bytestring> ret;
+    for (size_t i = 0; i < snippetcount; ++i)
+    {
+      ret.push_back(bytestring(reinterpret_cast<const byte*>(snippets[i]), std::strlen(snippets[i])));
+    }
+    return ret;
+  }
+
+  // A document of the given number of snippets
+  bytestring document_bytes(size_t snippetsinbody)
+  {
+    std::string str = "<!DOCTYPE html><html><head><title>Benchmark</title></head><body>\n";
+    for (size_t i = 0; i < snippetsinbody; ++i)
+    {
+      str += "<div>";
+      str += snippets[i % snippetcount];
+      str += "</div>\n";
+    }
+    str += "</body></html>\n";
+
+    return bytestring(str.begin(), str.end());
+  }
+
+  const size_t iterations = 10000;
+
+  double now()
+  {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+  }
+
+  void report(const std::string& name, size_t count, const char* unit, double seconds)
+  {
+    std::cout << name << ": " << count << " " << unit << " in " << seconds << " s, "
+	      << static_cast<size_t>(count / seconds) << " " << unit << "/s\n";
+  }
+
+  // Parses each snippet with htmlparser::parse_fragment(), which
+  // creates the parser stages for every parse
+  void fragments_new_parser(Elementp context, const std::vector<bytestring>& input)
+  {
+    double start = now();
+    for (size_t i = 0; i < iterations; ++i)
+    {
+      htmlparser::parse_fragment(context, input[i % snippetcount]);
+    }
+    report("parse_fragment()", iterations, "parses", now() - start);
+  }
+
+  // Parses each snippet with a single parser that is reset in
+  // between
+  void fragments_reused_parser(Documentp doc, Elementp context,
+			       const std::vector<bytestring>& input)
+  {
+    double start = now();
+    htmlparser parser(context, doc->createDocumentFragment());
+    for (size_t i = 0; i < iterations; ++i)
+    {
+      parser.reset(context, doc->createDocumentFragment());
+      parser.pass_bytes(input[i % snippetcount]);
+      parser.pass_eof();
+    }
+    report("reused htmlparser", iterations, "parses", now() - start);
+  }
+
+  // Parses the same documents with parse_many() on 1, 2 and 4
+  // threads
+  void many_documents()
+  {
+    std::vector<bytestring> inputs(200, document_bytes(100));
+
+    for (size_t threads = 1; threads <= 4; threads *= 2)
+    {
+      double start = now();
+      parse_many(inputs, threads);
+
+      std::ostringstream name;
+      name << "parse_many(), " << threads << " threads";
+      report(name.str(), inputs.size(), "documents", now() - start);
+    }
+  }
+
+  // Parses a large document sequentially, and with speculative
+  // tokenization on 2 and 4 threads
+  void speculative_tokenization()
+  {
+    bytestring input = document_bytes(20000);
+    const size_t rounds = 5;
+
+    for (size_t threads = 1; threads <= 4; threads *= 2)
+    {
+      double start = now();
+      for (size_t i = 0; i < rounds; ++i)
+      {
+	htmlparser parser(Document::create());
+	if (threads > 1)
+	  parser.tokenize_in_parallel(threads);
+	parser.pass_bytes(input);
+	parser.pass_eof();
+      }
+
+      std::ostringstream name;
+      if (threads > 1)
+	name << "tokenize_in_parallel(), " << threads << " threads";
+      else
+	name << "sequential tokenization";
+      name << ", " << input.size() / 1000 << " kB document";
+      report(name.str(), rounds, "parses", now() - start);
+    }
+  }
+
+  // Writes the input to the socket in the given number of parts,
+  // waiting between them like a slow upstream, and closes the socket
+  void slow_writer(int fd, const bytestring& input, size_t parts)
+  {
+    size_t partsize = (input.size() + parts - 1) / parts;
+    for (size_t pos = 0; pos < input.size(); pos += partsize)
+    {
+      usleep(10000);
+
+      size_t end = std::min(pos + partsize, input.size());
+      for (size_t written = pos; written < end;)
+      {
+	ssize_t n = write(fd, input.data() + written, end - written);
+	if (n < 0)
+	  break;
+	written += n;
+      }
+    }
+
+    close(fd);
+  }
+
+  bool any_element(Elementp)
+  {
+    return true;
+  }
+
+  bool first_element(double* at, Elementp)
+  {
+    if (*at == 0)
+      *at = now();
+    return false;
+  }
+
+  void report_latency(const char* name, double start, double first, double done)
+  {
+    std::cout << name << ": first element after " << (first - start) * 1000
+	      << " ms, document after " << (done - start) * 1000 << " ms\n";
+  }
+
+  // Parses a document arriving slowly through a socket, as fdinput
+  // passes it on, and after reading all of it first
+  void socket_latency()
+  {
+    bytestring input = document_bytes(20000);
+    const size_t parts = 20;
+
+    for (int incremental = 1; incremental >= 0; --incremental)
+    {
+      int fds[2];
+      if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0)
+	return;
+
+      double first = 0;
+      htmlparser parser(Document::create());
+      parser.watch_if(&any_element, boost::bind(&first_element, &first, _1));
+
+      double start = now();
+      boost::thread writer(boost::bind(&slow_writer, fds[1], boost::cref(input), parts));
+
+      if (incremental)
+      {
+	fdinput in;
+	in.add(fds[0], parser);
+	in.run();
+      }
+      else
+      {
+	bytestring all;
+	byte buf[16384];
+	ssize_t n;
+	while ((n = read(fds[0], buf, sizeof(buf))) > 0)
+	  all.append(buf, n);
+
+	parser.pass_bytes(all);
+	parser.pass_eof();
+      }
+
+      double done = now();
+      writer.join();
+      close(fds[0]);
+
+      report_latency(incremental ? "fdinput" : "read all, then parse", start, first, done);
+    }
+  }
+
+  // Builds a node of 100000 children by inserting each one before
+  // the same child in the middle
+  void wide_node()
+  {
+    Documentp doc = Document::create();
+    const size_t count = 100000;
+
+    double start = now();
+    Elementp parent = doc->createElement("div");
+    parent->appendChild(doc->createTextNode("first"));
+    Nodep middle = parent->appendChild(doc->createTextNode("middle"));
+    parent->appendChild(doc->createTextNode("last"));
+    for (size_t i = 0; i < count; ++i)
+    {
+      parent->insertBefore(doc->createElement("p"), middle);
+    }
+    report("insertBefore() in the middle", count, "inserts", now() - start);
+  }
+
+  bool document_order(Nodep a, Nodep b)
+  {
+    return a->compareDocumentPosition(b) & Node::DOCUMENT_POSITION_FOLLOWING;
+  }
+
+  // Sorts 100000 nodes of nested lists into document order with
+  // compareDocumentPosition()
+  void document_order_sort()
+  {
+    Documentp doc = Document::create();
+    Elementp root = doc->createElement("div");
+    doc->appendChild(root);
+    for (size_t i = 0; i < 1000; ++i)
+    {
+      Elementp list = doc->createElement("ul");
+      root->appendChild(list);
+      for (size_t j = 0; j < 99; ++j)
+      {
+	list->appendChild(doc->createElement("li"));
+      }
+    }
+
+    std::vector<Nodep> nodes;
+    for (Nodep n = root; n; n = n->get_nextInTreeOrder(root))
+      nodes.push_back(n);
+    for (size_t i = 0; i < nodes.size(); ++i)
+      std::swap(nodes[i], nodes[(i * 7919) % nodes.size()]);
+
+    double start = now();
+    std::sort(nodes.begin(), nodes.end(), &document_order);
+    report("sort into document order", nodes.size(), "nodes", now() - start);
+  }
+
+  void count_bytes(size_t* count, const bytestring& str)
+  {
+    *count += str.size();
+  }
+
+  // Serializes a parsed document of the snippets, which have
+  // attributes, entities and void elements, to a byte counter
+  void serialize_document()
+  {
+    Documentp doc = Document::create();
+    htmlparser parser(doc);
+    parser.pass_bytes(document_bytes(20000));
+    parser.pass_eof();
+
+    const size_t rounds = 20;
+    size_t bytes = 0;
+
+    double start = now();
+    for (size_t i = 0; i < rounds; ++i)
+    {
+      serializer out(boost::bind(&count_bytes, &bytes, _1));
+      out.write_node(doc);
+      out.flush();
+    }
+
+    std::ostringstream name;
+    name << "serializer, " << bytes / rounds / 1000 << " kB document";
+    report(name.str(), rounds, "documents", now() - start);
+  }
+
+  // Edits a word in the middle of a document with incrementalparser,
+  // against parsing the edited document again
+  void incremental_edits()
+  {
+    const bytestring input = document_bytes(5000);
+    const std::string str(input.begin(), input.end());
+    const size_t pos = str.find("Hello", str.size() / 2);
+    const bytestring words[] = { bytestring(reinterpret_cast<const byte*>("Hallo"), 5),
+				 bytestring(reinterpret_cast<const byte*>("Hello"), 5) };
+    const size_t rounds = 20;
+
+    Documentp doc = Document::create();
+    incrementalparser parser(doc);
+    parser.parse(input);
+
+    double start = now();
+    for (size_t i = 0; i < rounds; ++i)
+    {
+      parser.edit(pos, 5, words[i % 2]);
+    }
+    report("incrementalparser, edit in 5000 snippets", rounds, "edits", now() - start);
+
+    start = now();
+    for (size_t i = 0; i < rounds; ++i)
+    {
+      Documentp full = Document::create();
+      htmlparser fullparser(full);
+      fullparser.pass_bytes(parser.input());
+      fullparser.pass_eof();
+    }
+    report("htmlparser, 5000 snippets", rounds, "parses", now() - start);
+  }
+}
+
+int main()
+{
+  Documentp doc = Document::create();
+  Elementp context = doc->createElement("div");
+
+  std::vector<bytestring> input = snippet_bytes();
+
+  fragments_new_parser(context, input);
+  fragments_reused_parser(doc, context, input);
+  many_documents();
+  speculative_tokenization();
+  socket_latency();
+  wide_node();
+  document_order_sort();
+  serialize_document();
+  incremental_edits();
+
+  return 0;
+}
@@ -0,0 +1,4551 @@
+/* This file is automatically generated. Do not edit! */
+#include "parser/htmlentitydb.hpp"
+
+namespace
+{
+  const frenzy::uchar AElig_name[] = { 'A', 'E', 'l', 'i', 'g' };
+  const frenzy::uchar AEligsc_name[] = { 'A', 'E', 'l', 'i', 'g', ';' };
+  const frenzy::uchar AMP_name[] = { 'A', 'M', 'P' };
+  const frenzy::uchar AMPsc_name[] = { 'A', 'M', 'P', ';' };
+  const frenzy::uchar Aacute_name[] = { 'A', 'a', 'c', 'u', 't', 'e' };
+  const frenzy::uchar Aacutesc_name[] = { 'A', 'a', 'c', 'u', 't', 'e', ';' };
+  const frenzy::uchar Abrevesc_name[] = { 'A', 'b', 'r', 'e', 'v', 'e', ';' };
+  const frenzy::uchar Acirc_name[] = { 'A', 'c', 'i', 'r', 'c' };
+  const frenzy::uchar Acircsc_name[] = { 'A', 'c', 'i', 'r', 'c', ';' };
+  const frenzy::uchar Acysc_name[] = { 'A', 'c', 'y', ';' };
+  const frenzy::uchar Afrsc_name[] = { 'A', 'f', 'r', ';' };
+  const frenzy::uchar Agrave_name[] = { 'A', 'g', 'r', 'a', 'v', 'e' };
+  const frenzy::uchar Agravesc_name[] = { 'A', 'g', 'r', 'a', 'v', 'e', ';' };
+  const frenzy::uchar Alphasc_name[] = { 'A', 'l', 'p', 'h', 'a', ';' };
+  const frenzy::uchar Amacrsc_name[] = { 'A', 'm', 'a', 'c', 'r', ';' };
+  const frenzy::uchar Andsc_name[] = { 'A', 'n', 'd', ';' };
+  const frenzy::uchar Aogonsc_name[] = { 'A', 'o', 'g', 'o', 'n', ';' };
+  const frenzy::uchar Aopfsc_name[] = { 'A', 'o', 'p', 'f', ';' };
+  const frenzy::uchar ApplyFunctionsc_name[] = { 'A', 'p', 'p', 'l', 'y', 'F', 'u', 'n', 'c', 't', 'i', 'o', 'n', ';' };
+  const frenzy::uchar Aring_name[] = { 'A', 'r', 'i', 'n', 'g' };
+  const frenzy::uchar Aringsc_name[] = { 'A', 'r', 'i', 'n', 'g', ';' };
+  const frenzy::uchar Ascrsc_name[] = { 'A', 's', 'c', 'r', ';' };
+  const frenzy::uchar Assignsc_name[] = { 'A', 's', 's', 'i', 'g', 'n', ';' };
+  const frenzy::uchar Atilde_name[] = { 'A', 't', 'i', 'l', 'd', 'e' };
+  const frenzy::uchar Atildesc_name[] = { 'A', 't', 'i', 'l', 'd', 'e', ';' };
+  const frenzy::uchar Auml_name[] = { 'A', 'u', 'm', 'l' };
+  const frenzy::uchar Aumlsc_name[] = { 'A', 'u', 'm', 'l', ';' };
+  const frenzy::uchar Backslashsc_name[] = { 'B', 'a', 'c', 'k', 's', 'l', 'a', 's', 'h', ';' };
+  const frenzy::uchar Barvsc_name[] = { 'B', 'a', 'r', 'v', ';' };
+  const frenzy::uchar Barwedsc_name[] = { 'B', 'a', 'r', 'w', 'e', 'd', ';' };
+  const frenzy::uchar Bcysc_name[] = { 'B', 'c', 'y', ';' };
+  const frenzy::uchar Becausesc_name[] = { 'B', 'e', 'c', 'a', 'u', 's', 'e', ';' };
+  const frenzy::uchar Bernoullissc_name[] = { 'B', 'e', 'r', 'n', 'o', 'u', 'l', 'l', 'i', 's', ';' };
+  const frenzy::uchar Betasc_name[] = { 'B', 'e', 't', 'a', ';' };
+  const frenzy::uchar Bfrsc_name[] = { 'B', 'f', 'r', ';' };
+  const frenzy::uchar Bopfsc_name[] = { 'B', 'o', 'p', 'f', ';' };
+  const frenzy::uchar Brevesc_name[] = { 'B', 'r', 'e', 'v', 'e', ';' };
+  const frenzy::uchar Bscrsc_name[] = { 'B', 's', 'c', 'r', ';' };
+  const frenzy::uchar Bumpeqsc_name[] = { 'B', 'u', 'm', 'p', 'e', 'q', ';' };
+  const frenzy::uchar CHcysc_name[] = { 'C', 'H', 'c', 'y', ';' };
+  const frenzy::uchar COPY_name[] = { 'C', 'O', 'P', 'Y' };
+  const frenzy::uchar COPYsc_name[] = { 'C', 'O', 'P', 'Y', ';' };
+  const frenzy::uchar Cacutesc_name[] = { 'C', 'a', 'c', 'u', 't', 'e', ';' };
+  const frenzy::uchar Capsc_name[] = { 'C', 'a', 'p', ';' };
+  const frenzy::uchar CapitalDifferentialDsc_name[] = { 'C', 'a', 'p', 'i', 't', 'a', 'l', 'D', 'i', 'f', 'f', 'e', 'r', 'e', 'n', 't', 'i', 'a', 'l', 'D', ';' };
+  const frenzy::uchar Cayleyssc_name[] = { 'C', 'a', 'y', 'l', 'e', 'y', 's', ';' };
+  const frenzy::uchar Ccaronsc_name[] = { 'C', 'c', 'a', 'r', 'o', 'n', ';' };
+  const frenzy::uchar Ccedil_name[] = { 'C', 'c', 'e', 'd', 'i', 'l' };
+  const frenzy::uchar Ccedilsc_name[] = { 'C', 'c', 'e', 'd', 'i', 'l', ';' };
+  const frenzy::uchar Ccircsc_name[] = { 'C', 'c', 'i', 'r', 'c', ';' };
+  const frenzy::uchar Cconintsc_name[] = { 'C', 'c', 'o', 'n', 'i', 'n', 't', ';' };
+  const frenzy::uchar Cdotsc_name[] = { 'C', 'd', 'o', 't', ';' };
+  const frenzy::uchar Cedillasc_name[] = { 'C', 'e', 'd', 'i', 'l', 'l', 'a', ';' };
+  const frenzy::uchar CenterDotsc_name[] = { 'C', 'e', 'n', 't', 'e', 'r', 'D', 'o', 't', ';' };
+  const frenzy::uchar Cfrsc_name[] = { 'C', 'f', 'r', ';' };
+  const frenzy::uchar Chisc_name[] = { 'C', 'h', 'i', ';' };
+  const frenzy::uchar CircleDotsc_name[] = { 'C', 'i', 'r', 'c', 'l', 'e', 'D', 'o', 't', ';' };
+  const frenzy::uchar CircleMinussc_name[] = { 'C', 'i', 'r', 'c', 'l', 'e', 'M', 'i', 'n', 'u', 's', ';' };
+  const frenzy::uchar CirclePlussc_name[] = { 'C', 'i', 'r', 'c', 'l', 'e', 'P', 'l', 'u', 's', ';' };
+  const frenzy::uchar CircleTimessc_name[] = { 'C', 'i', 'r', 'c', 'l', 'e', 'T', 'i', 'm', 'e', 's', ';' };
+  const frenzy::uchar ClockwiseContourIntegralsc_name[] = { 'C', 'l', 'o', 'c', 'k', 'w', 'i', 's', 'e', 'C', 'o', 'n', 't', 'o', 'u', 'r', 'I', 'n', 't', 'e', 'g', 'r', 'a', 'l', ';' };
+  const frenzy::uchar CloseCurlyDoubleQuotesc_name[] = { 'C', 'l', 'o', 's', 'e', 'C', 'u', 'r', 'l', 'y', 'D', 'o', 'u', 'b', 'l', 'e', 'Q', 'u', 'o', 't', 'e', ';' };
+  const frenzy::uchar CloseCurlyQuotesc_name[] = { 'C', 'l', 'o', 's', 'e', 'C', 'u', 'r', 'l', 'y', 'Q', 'u', 'o', 't', 'e', ';' };
+  const frenzy::uchar Colonsc_name[] = { 'C', 'o', 'l', 'o', 'n', ';' };
+  const frenzy::uchar Colonesc_name[] = { 'C', 'o', 'l', 'o', 'n', 'e', ';' };
+  const frenzy::uchar Congruentsc_name[] = { 'C', 'o', 'n', 'g', 'r', 'u', 'e', 'n', 't', ';' };
+  const frenzy::uchar Conintsc_name[] = { 'C', 'o', 'n', 'i', 'n', 't', ';' };
+  const frenzy::uchar ContourIntegralsc_name[] = { 'C', 'o', 'n', 't', 'o', 'u', 'r', 'I', 'n', 't', 'e', 'g', 'r', 'a', 'l', ';' };
+  const frenzy::uchar Copfsc_name[] = { 'C', 'o', 'p', 'f', ';' };
+  const frenzy::uchar Coproductsc_name[] = { 'C', 'o', 'p', 'r', 'o', 'd', 'u', 'c', 't', ';' };
+  const frenzy::uchar CounterClockwiseContourIntegralsc_name[] = { 'C', 'o', 'u', 'n', 't', 'e', 'r', 'C', 'l', 'o', 'c', 'k', 'w', 'i', 's', 'e', 'C', 'o', 'n', 't', 'o', 'u', 'r', 'I', 'n', 't', 'e', 'g', 'r', 'a', 'l', ';' };
+  const frenzy::uchar Crosssc_name[] = { 'C', 'r', 'o', 's', 's', ';' };
+  const frenzy::uchar Cscrsc_name[] = { 'C', 's', 'c', 'r', ';' };
+  const frenzy::uchar Cupsc_name[] = { 'C', 'u', 'p', ';' };
+  const frenzy::uchar CupCapsc_name[] = { 'C', 'u', 'p', 'C', 'a', 'p', ';' };
+  const frenzy::uchar DDsc_name[] = { 'D', 'D', ';' };
+  const frenzy::uchar DDotrahdsc_name[] = { 'D', 'D', 'o', 't', 'r', 'a', 'h', 'd', ';' };
+  const frenzy::uchar DJcysc_name[] = { 'D', 'J', 'c', 'y', ';' };
+  const frenzy::uchar DScysc_name[] = { 'D', 'S', 'c', 'y', ';' };
+  const frenzy::uchar DZcysc_name[] = { 'D', 'Z', 'c', 'y', ';' };
+  const frenzy::uchar Daggersc_name[] = { 'D', 'a', 'g', 'g', 'e', 'r', ';' };
+  const frenzy::uchar Darrsc_name[] = { 'D', 'a', 'r', 'r', ';' };
+  const frenzy::uchar Dashvsc_name[] = { 'D', 'a', 's', 'h', 'v', ';' };
+  const frenzy::uchar Dcaronsc_name[] = { 'D', 'c', 'a', 'r', 'o', 'n', ';' };
+  const frenzy::uchar Dcysc_name[] = { 'D', 'c', 'y', ';' };
+  const frenzy::uchar Delsc_name[] = { 'D', 'e', 'l', ';' };
+  const frenzy::uchar Deltasc_name[] = { 'D', 'e', 'l', 't', 'a', ';' };
+  const frenzy::uchar Dfrsc_name[] = { 'D', 'f', 'r', ';' };
+  const frenzy::uchar DiacriticalAcutesc_name[] = { 'D', 'i', 'a', 'c', 'r', 'i', 't', 'i', 'c', 'a', 'l', 'A', 'c', 'u', 't', 'e', ';' };
+  const frenzy::uchar DiacriticalDotsc_name[] = { 'D', 'i', 'a', 'c', 'r', 'i', 't', 'i', 'c', 'a', 'l', 'D', 'o', 't', ';' };
+  const frenzy::uchar DiacriticalDoubleAcutesc_name[] = { 'D', 'i', 'a', 'c', 'r', 'i', 't', 'i', 'c', 'a', 'l', 'D', 'o', 'u', 'b', 'l', 'e', 'A', 'c', 'u', 't', 'e', ';' };
+  const frenzy::uchar DiacriticalGravesc_name[] = { 'D', 'i', 'a', 'c', 'r', 'i', 't', 'i', 'c', 'a', 'l', 'G', 'r', 'a', 'v', 'e', ';' };
+  const frenzy::uchar DiacriticalTildesc_name[] = { 'D', 'i', 'a', 'c', 'r', 'i', 't', 'i', 'c', 'a', 'l', 'T', 'i', 'l', 'd', 'e', ';' };
+  const frenzy::uchar Diamondsc_name[] = { 'D', 'i', 'a', 'm', 'o', 'n', 'd', ';' };
+  const frenzy::uchar DifferentialDsc_name[] = { 'D', 'i', 'f', 'f', 'e', 'r', 'e', 'n', 't', 'i', 'a', 'l', 'D', ';' };
+  const frenzy::uchar Dopfsc_name[] = { 'D', 'o', 'p', 'f', ';' };
+  const frenzy::uchar Dotsc_name[] = { 'D', 'o', 't', ';' };
+  const frenzy::uchar DotDotsc_name[] = { 'D', 'o', 't', 'D', 'o', 't', ';' };
+  const frenzy::uchar DotEqualsc_name[] = { 'D', 'o', 't', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar DoubleContourIntegralsc_name[] = { 'D', 'o', 'u', 'b', 'l', 'e', 'C', 'o', 'n', 't', 'o', 'u', 'r', 'I', 'n', 't', 'e', 'g', 'r', 'a', 'l', ';' };
+  const frenzy::uchar DoubleDotsc_name[] = { 'D', 'o', 'u', 'b', 'l', 'e', 'D', 'o', 't', ';' };
+  const frenzy::uchar DoubleDownArrowsc_name[] = { 'D', 'o', 'u', 'b', 'l', 'e', 'D', 'o', 'w', 'n', 'A', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar DoubleLeftArrowsc_name[] = { 'D', 'o', 'u', 'b', 'l', 'e', 'L', 'e', 'f', 't', 'A', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar DoubleLeftRightArrowsc_name[] = { 'D', 'o', 'u', 'b', 'l', 'e', 'L', 'e', 'f', 't', 'R', 'i', 'g', 'h', 't', 'A', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar DoubleLeftTeesc_name[] = { 'D', 'o', 'u', 'b', 'l', 'e', 'L', 'e', 'f', 't', 'T', 'e', 'e', ';' };
+  const frenzy::uchar DoubleLongLeftArrowsc_name[] = { 'D', 'o', 'u', 'b', 'l', 'e', 'L', 'o', 'n', 'g', 'L', 'e', 'f', 't', 'A', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar DoubleLongLeftRightArrowsc_name[] = { 'D', 'o', 'u', 'b', 'l', 'e', 'L', 'o', 'n', 'g', 'L', 'e', 'f', 't', 'R', 'i', 'g', 'h', 't', 'A', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar DoubleLongRightArrowsc_name[] = { 'D', 'o', 'u', 'b', 'l', 'e', 'L', 'o', 'n', 'g', 'R', 'i', 'g', 'h', 't', 'A', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar DoubleRightArrowsc_name[] = { 'D', 'o', 'u', 'b', 'l', 'e', 'R', 'i', 'g', 'h', 't', 'A', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar DoubleRightTeesc_name[] = { 'D', 'o', 'u', 'b', 'l', 'e', 'R', 'i', 'g', 'h', 't', 'T', 'e', 'e', ';' };
+  const frenzy::uchar DoubleUpArrowsc_name[] = { 'D', 'o', 'u', 'b', 'l', 'e', 'U', 'p', 'A', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar DoubleUpDownArrowsc_name[] = { 'D', 'o', 'u', 'b', 'l', 'e', 'U', 'p', 'D', 'o', 'w', 'n', 'A', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar DoubleVerticalBarsc_name[] = { 'D', 'o', 'u', 'b', 'l', 'e', 'V', 'e', 'r', 't', 'i', 'c', 'a', 'l', 'B', 'a', 'r', ';' };
+  const frenzy::uchar DownArrowsc_name[] = { 'D', 'o', 'w', 'n', 'A', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar DownArrowBarsc_name[] = { 'D', 'o', 'w', 'n', 'A', 'r', 'r', 'o', 'w', 'B', 'a', 'r', ';' };
+  const frenzy::uchar DownArrowUpArrowsc_name[] = { 'D', 'o', 'w', 'n', 'A', 'r', 'r', 'o', 'w', 'U', 'p', 'A', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar DownBrevesc_name[] = { 'D', 'o', 'w', 'n', 'B', 'r', 'e', 'v', 'e', ';' };
+  const frenzy::uchar DownLeftRightVectorsc_name[] = { 'D', 'o', 'w', 'n', 'L', 'e', 'f', 't', 'R', 'i', 'g', 'h', 't', 'V', 'e', 'c', 't', 'o', 'r', ';' };
+  const frenzy::uchar DownLeftTeeVectorsc_name[] = { 'D', 'o', 'w', 'n', 'L', 'e', 'f', 't', 'T', 'e', 'e', 'V', 'e', 'c', 't', 'o', 'r', ';' };
+  const frenzy::uchar DownLeftVectorsc_name[] = { 'D', 'o', 'w', 'n', 'L', 'e', 'f', 't', 'V', 'e', 'c', 't', 'o', 'r', ';' };
+  const frenzy::uchar DownLeftVectorBarsc_name[] = { 'D', 'o', 'w', 'n', 'L', 'e', 'f', 't', 'V', 'e', 'c', 't', 'o', 'r', 'B', 'a', 'r', ';' };
+  const frenzy::uchar DownRightTeeVectorsc_name[] = { 'D', 'o', 'w', 'n', 'R', 'i', 'g', 'h', 't', 'T', 'e', 'e', 'V', 'e', 'c', 't', 'o', 'r', ';' };
+  const frenzy::uchar DownRightVectorsc_name[] = { 'D', 'o', 'w', 'n', 'R', 'i', 'g', 'h', 't', 'V', 'e', 'c', 't', 'o', 'r', ';' };
+  const frenzy::uchar DownRightVectorBarsc_name[] = { 'D', 'o', 'w', 'n', 'R', 'i', 'g', 'h', 't', 'V', 'e', 'c', 't', 'o', 'r', 'B', 'a', 'r', ';' };
+  const frenzy::uchar DownTeesc_name[] = { 'D', 'o', 'w', 'n', 'T', 'e', 'e', ';' };
+  const frenzy::uchar DownTeeArrowsc_name[] = { 'D', 'o', 'w', 'n', 'T', 'e', 'e', 'A', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar Downarrowsc_name[] = { 'D', 'o', 'w', 'n', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar Dscrsc_name[] = { 'D', 's', 'c', 'r', ';' };
+  const frenzy::uchar Dstroksc_name[] = { 'D', 's', 't', 'r', 'o', 'k', ';' };
+  const frenzy::uchar ENGsc_name[] = { 'E', 'N', 'G', ';' };
+  const frenzy::uchar ETH_name[] = { 'E', 'T', 'H' };
+  const frenzy::uchar ETHsc_name[] = { 'E', 'T', 'H', ';' };
+  const frenzy::uchar Eacute_name[] = { 'E', 'a', 'c', 'u', 't', 'e' };
+  const frenzy::uchar Eacutesc_name[] = { 'E', 'a', 'c', 'u', 't', 'e', ';' };
+  const frenzy::uchar Ecaronsc_name[] = { 'E', 'c', 'a', 'r', 'o', 'n', ';' };
+  const frenzy::uchar Ecirc_name[] = { 'E', 'c', 'i', 'r', 'c' };
+  const frenzy::uchar Ecircsc_name[] = { 'E', 'c', 'i', 'r', 'c', ';' };
+  const frenzy::uchar Ecysc_name[] = { 'E', 'c', 'y', ';' };
+  const frenzy::uchar Edotsc_name[] = { 'E', 'd', 'o', 't', ';' };
+  const frenzy::uchar Efrsc_name[] = { 'E', 'f', 'r', ';' };
+  const frenzy::uchar Egrave_name[] = { 'E', 'g', 'r', 'a', 'v', 'e' };
+  const frenzy::uchar Egravesc_name[] = { 'E', 'g', 'r', 'a', 'v', 'e', ';' };
+  const frenzy::uchar Elementsc_name[] = { 'E', 'l', 'e', 'm', 'e', 'n', 't', ';' };
+  const frenzy::uchar Emacrsc_name[] = { 'E', 'm', 'a', 'c', 'r', ';' };
+  const frenzy::uchar EmptySmallSquaresc_name[] = { 'E', 'm', 'p', 't', 'y', 'S', 'm', 'a', 'l', 'l', 'S', 'q', 'u', 'a', 'r', 'e', ';' };
+  const frenzy::uchar EmptyVerySmallSquaresc_name[] = { 'E', 'm', 'p', 't', 'y', 'V', 'e', 'r', 'y', 'S', 'm', 'a', 'l', 'l', 'S', 'q', 'u', 'a', 'r', 'e', ';' };
+  const frenzy::uchar Eogonsc_name[] = { 'E', 'o', 'g', 'o', 'n', ';' };
+  const frenzy::uchar Eopfsc_name[] = { 'E', 'o', 'p', 'f', ';' };
+  const frenzy::uchar Epsilonsc_name[] = { 'E', 'p', 's', 'i', 'l', 'o', 'n', ';' };
+  const frenzy::uchar Equalsc_name[] = { 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar EqualTildesc_name[] = { 'E', 'q', 'u', 'a', 'l', 'T', 'i', 'l', 'd', 'e', ';' };
+  const frenzy::uchar Equilibriumsc_name[] = { 'E', 'q', 'u', 'i', 'l', 'i', 'b', 'r', 'i', 'u', 'm', ';' };
+  const frenzy::uchar Escrsc_name[] = { 'E', 's', 'c', 'r', ';' };
+  const frenzy::uchar Esimsc_name[] = { 'E', 's', 'i', 'm', ';' };
+  const frenzy::uchar Etasc_name[] = { 'E', 't', 'a', ';' };
+  const frenzy::uchar Euml_name[] = { 'E', 'u', 'm', 'l' };
+  const frenzy::uchar Eumlsc_name[] = { 'E', 'u', 'm', 'l', ';' };
+  const frenzy::uchar Existssc_name[] = { 'E', 'x', 'i', 's', 't', 's', ';' };
+  const frenzy::uchar ExponentialEsc_name[] = { 'E', 'x', 'p', 'o', 'n', 'e', 'n', 't', 'i', 'a', 'l', 'E', ';' };
+  const frenzy::uchar Fcysc_name[] = { 'F', 'c', 'y', ';' };
+  const frenzy::uchar Ffrsc_name[] = { 'F', 'f', 'r', ';' };
+  const frenzy::uchar FilledSmallSquaresc_name[] = { 'F', 'i', 'l', 'l', 'e', 'd', 'S', 'm', 'a', 'l', 'l', 'S', 'q', 'u', 'a', 'r', 'e', ';' };
+  const frenzy::uchar FilledVerySmallSquaresc_name[] = { 'F', 'i', 'l', 'l', 'e', 'd', 'V', 'e', 'r', 'y', 'S', 'm', 'a', 'l', 'l', 'S', 'q', 'u', 'a', 'r', 'e', ';' };
+  const frenzy::uchar Fopfsc_name[] = { 'F', 'o', 'p', 'f', ';' };
+  const frenzy::uchar ForAllsc_name[] = { 'F', 'o', 'r', 'A', 'l', 'l', ';' };
+  const frenzy::uchar Fouriertrfsc_name[] = { 'F', 'o', 'u', 'r', 'i', 'e', 'r', 't', 'r', 'f', ';' };
+  const frenzy::uchar Fscrsc_name[] = { 'F', 's', 'c', 'r', ';' };
+  const frenzy::uchar GJcysc_name[] = { 'G', 'J', 'c', 'y', ';' };
+  const frenzy::uchar GT_name[] = { 'G', 'T' };
+  const frenzy::uchar GTsc_name[] = { 'G', 'T', ';' };
+  const frenzy::uchar Gammasc_name[] = { 'G', 'a', 'm', 'm', 'a', ';' };
+  const frenzy::uchar Gammadsc_name[] = { 'G', 'a', 'm', 'm', 'a', 'd', ';' };
+  const frenzy::uchar Gbrevesc_name[] = { 'G', 'b', 'r', 'e', 'v', 'e', ';' };
+  const frenzy::uchar Gcedilsc_name[] = { 'G', 'c', 'e', 'd', 'i', 'l', ';' };
+  const frenzy::uchar Gcircsc_name[] = { 'G', 'c', 'i', 'r', 'c', ';' };
+  const frenzy::uchar Gcysc_name[] = { 'G', 'c', 'y', ';' };
+  const frenzy::uchar Gdotsc_name[] = { 'G', 'd', 'o', 't', ';' };
+  const frenzy::uchar Gfrsc_name[] = { 'G', 'f', 'r', ';' };
+  const frenzy::uchar Ggsc_name[] = { 'G', 'g', ';' };
+  const frenzy::uchar Gopfsc_name[] = { 'G', 'o', 'p', 'f', ';' };
+  const frenzy::uchar GreaterEqualsc_name[] = { 'G', 'r', 'e', 'a', 't', 'e', 'r', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar GreaterEqualLesssc_name[] = { 'G', 'r', 'e', 'a', 't', 'e', 'r', 'E', 'q', 'u', 'a', 'l', 'L', 'e', 's', 's', ';' };
+  const frenzy::uchar GreaterFullEqualsc_name[] = { 'G', 'r', 'e', 'a', 't', 'e', 'r', 'F', 'u', 'l', 'l', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar GreaterGreatersc_name[] = { 'G', 'r', 'e', 'a', 't', 'e', 'r', 'G', 'r', 'e', 'a', 't', 'e', 'r', ';' };
+  const frenzy::uchar GreaterLesssc_name[] = { 'G', 'r', 'e', 'a', 't', 'e', 'r', 'L', 'e', 's', 's', ';' };
+  const frenzy::uchar GreaterSlantEqualsc_name[] = { 'G', 'r', 'e', 'a', 't', 'e', 'r', 'S', 'l', 'a', 'n', 't', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar GreaterTildesc_name[] = { 'G', 'r', 'e', 'a', 't', 'e', 'r', 'T', 'i', 'l', 'd', 'e', ';' };
+  const frenzy::uchar Gscrsc_name[] = { 'G', 's', 'c', 'r', ';' };
+  const frenzy::uchar Gtsc_name[] = { 'G', 't', ';' };
+  const frenzy::uchar HARDcysc_name[] = { 'H', 'A', 'R', 'D', 'c', 'y', ';' };
+  const frenzy::uchar Haceksc_name[] = { 'H', 'a', 'c', 'e', 'k', ';' };
+  const frenzy::uchar Hatsc_name[] = { 'H', 'a', 't', ';' };
+  const frenzy::uchar Hcircsc_name[] = { 'H', 'c', 'i', 'r', 'c', ';' };
+  const frenzy::uchar Hfrsc_name[] = { 'H', 'f', 'r', ';' };
+  const frenzy::uchar HilbertSpacesc_name[] = { 'H', 'i', 'l', 'b', 'e', 'r', 't', 'S', 'p', 'a', 'c', 'e', ';' };
+  const frenzy::uchar Hopfsc_name[] = { 'H', 'o', 'p', 'f', ';' };
+  const frenzy::uchar HorizontalLinesc_name[] = { 'H', 'o', 'r', 'i', 'z', 'o', 'n', 't', 'a', 'l', 'L', 'i', 'n', 'e', ';' };
+  const frenzy::uchar Hscrsc_name[] = { 'H', 's', 'c', 'r', ';' };
+  const frenzy::uchar Hstroksc_name[] = { 'H', 's', 't', 'r', 'o', 'k', ';' };
+  const frenzy::uchar HumpDownHumpsc_name[] = { 'H', 'u', 'm', 'p', 'D', 'o', 'w', 'n', 'H', 'u', 'm', 'p', ';' };
+  const frenzy::uchar HumpEqualsc_name[] = { 'H', 'u', 'm', 'p', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar IEcysc_name[] = { 'I', 'E', 'c', 'y', ';' };
+  const frenzy::uchar IJligsc_name[] = { 'I', 'J', 'l', 'i', 'g', ';' };
+  const frenzy::uchar IOcysc_name[] = { 'I', 'O', 'c', 'y', ';' };
+  const frenzy::uchar Iacute_name[] = { 'I', 'a', 'c', 'u', 't', 'e' };
+  const frenzy::uchar Iacutesc_name[] = { 'I', 'a', 'c', 'u', 't', 'e', ';' };
+  const frenzy::uchar Icirc_name[] = { 'I', 'c', 'i', 'r', 'c' };
+  const frenzy::uchar Icircsc_name[] = { 'I', 'c', 'i', 'r', 'c', ';' };
+  const frenzy::uchar Icysc_name[] = { 'I', 'c', 'y', ';' };
+  const frenzy::uchar Idotsc_name[] = { 'I', 'd', 'o', 't', ';' };
+  const frenzy::uchar Ifrsc_name[] = { 'I', 'f', 'r', ';' };
+  const frenzy::uchar Igrave_name[] = { 'I', 'g', 'r', 'a', 'v', 'e' };
+  const frenzy::uchar Igravesc_name[] = { 'I', 'g', 'r', 'a', 'v', 'e', ';' };
+  const frenzy::uchar Imsc_name[] = { 'I', 'm', ';' };
+  const frenzy::uchar Imacrsc_name[] = { 'I', 'm', 'a', 'c', 'r', ';' };
+  const frenzy::uchar ImaginaryIsc_name[] = { 'I', 'm', 'a', 'g', 'i', 'n', 'a', 'r', 'y', 'I', ';' };
+  const frenzy::uchar Impliessc_name[] = { 'I', 'm', 'p', 'l', 'i', 'e', 's', ';' };
+  const frenzy::uchar Intsc_name[] = { 'I', 'n', 't', ';' };
+  const frenzy::uchar Integralsc_name[] = { 'I', 'n', 't', 'e', 'g', 'r', 'a', 'l', ';' };
+  const frenzy::uchar Intersectionsc_name[] = { 'I', 'n', 't', 'e', 'r', 's', 'e', 'c', 't', 'i', 'o', 'n', ';' };
+  const frenzy::uchar InvisibleCommasc_name[] = { 'I', 'n', 'v', 'i', 's', 'i', 'b', 'l', 'e', 'C', 'o', 'm', 'm', 'a', ';' };
+  const frenzy::uchar InvisibleTimessc_name[] = { 'I', 'n', 'v', 'i', 's', 'i', 'b', 'l', 'e', 'T', 'i', 'm', 'e', 's', ';' };
+  const frenzy::uchar Iogonsc_name[] = { 'I', 'o', 'g', 'o', 'n', ';' };
+  const frenzy::uchar Iopfsc_name[] = { 'I', 'o', 'p', 'f', ';' };
+  const frenzy::uchar Iotasc_name[] = { 'I', 'o', 't', 'a', ';' };
+  const frenzy::uchar Iscrsc_name[] = { 'I', 's', 'c', 'r', ';' };
+  const frenzy::uchar Itildesc_name[] = { 'I', 't', 'i', 'l', 'd', 'e', ';' };
+  const frenzy::uchar Iukcysc_name[] = { 'I', 'u', 'k', 'c', 'y', ';' };
+  const frenzy::uchar Iuml_name[] = { 'I', 'u', 'm', 'l' };
+  const frenzy::uchar Iumlsc_name[] = { 'I', 'u', 'm', 'l', ';' };
+  const frenzy::uchar Jcircsc_name[] = { 'J', 'c', 'i', 'r', 'c', ';' };
+  const frenzy::uchar Jcysc_name[] = { 'J', 'c', 'y', ';' };
+  const frenzy::uchar Jfrsc_name[] = { 'J', 'f', 'r', ';' };
+  const frenzy::uchar Jopfsc_name[] = { 'J', 'o', 'p', 'f', ';' };
+  const frenzy::uchar Jscrsc_name[] = { 'J', 's', 'c', 'r', ';' };
+  const frenzy::uchar Jsercysc_name[] = { 'J', 's', 'e', 'r', 'c', 'y', ';' };
+  const frenzy::uchar Jukcysc_name[] = { 'J', 'u', 'k', 'c', 'y', ';' };
+  const frenzy::uchar KHcysc_name[] = { 'K', 'H', 'c', 'y', ';' };
+  const frenzy::uchar KJcysc_name[] = { 'K', 'J', 'c', 'y', ';' };
+  const frenzy::uchar Kappasc_name[] = { 'K', 'a', 'p', 'p', 'a', ';' };
+  const frenzy::uchar Kcedilsc_name[] = { 'K', 'c', 'e', 'd', 'i', 'l', ';' };
+  const frenzy::uchar Kcysc_name[] = { 'K', 'c', 'y', ';' };
+  const frenzy::uchar Kfrsc_name[] = { 'K', 'f', 'r', ';' };
+  const frenzy::uchar Kopfsc_name[] = { 'K', 'o', 'p', 'f', ';' };
+  const frenzy::uchar Kscrsc_name[] = { 'K', 's', 'c', 'r', ';' };
+  const frenzy::uchar LJcysc_name[] = { 'L', 'J', 'c', 'y', ';' };
+  const frenzy::uchar LT_name[] = { 'L', 'T' };
+  const frenzy::uchar LTsc_name[] = { 'L', 'T', ';' };
+  const frenzy::uchar Lacutesc_name[] = { 'L', 'a', 'c', 'u', 't', 'e', ';' };
+  const frenzy::uchar Lambdasc_name[] = { 'L', 'a', 'm', 'b', 'd', 'a', ';' };
+  const frenzy::uchar Langsc_name[] = { 'L', 'a', 'n', 'g', ';' };
+  const frenzy::uchar Laplacetrfsc_name[] = { 'L', 'a', 'p', 'l', 'a', 'c', 'e', 't', 'r', 'f', ';' };
+  const frenzy::uchar Larrsc_name[] = { 'L', 'a', 'r', 'r', ';' };
+  const frenzy::uchar Lcaronsc_name[] = { 'L', 'c', 'a', 'r', 'o', 'n', ';' };
+  const frenzy::uchar Lcedilsc_name[] = { 'L', 'c', 'e', 'd', 'i', 'l', ';' };
+  const frenzy::uchar Lcysc_name[] = { 'L', 'c', 'y', ';' };
+  const frenzy::uchar LeftAngleBracketsc_name[] = { 'L', 'e', 'f', 't', 'A', 'n', 'g', 'l', 'e', 'B', 'r', 'a', 'c', 'k', 'e', 't', ';' };
+  const frenzy::uchar LeftArrowsc_name[] = { 'L', 'e', 'f', 't', 'A', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar LeftArrowBarsc_name[] = { 'L', 'e', 'f', 't', 'A', 'r', 'r', 'o', 'w', 'B', 'a', 'r', ';' };
+  const frenzy::uchar LeftArrowRightArrowsc_name[] = { 'L', 'e', 'f', 't', 'A', 'r', 'r', 'o', 'w', 'R', 'i', 'g', 'h', 't', 'A', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar LeftCeilingsc_name[] = { 'L', 'e', 'f', 't', 'C', 'e', 'i', 'l', 'i', 'n', 'g', ';' };
+  const frenzy::uchar LeftDoubleBracketsc_name[] = { 'L', 'e', 'f', 't', 'D', 'o', 'u', 'b', 'l', 'e', 'B', 'r', 'a', 'c', 'k', 'e', 't', ';' };
+  const frenzy::uchar LeftDownTeeVectorsc_name[] = { 'L', 'e', 'f', 't', 'D', 'o', 'w', 'n', 'T', 'e', 'e', 'V', 'e', 'c', 't', 'o', 'r', ';' };
+  const frenzy::uchar LeftDownVectorsc_name[] = { 'L', 'e', 'f', 't', 'D', 'o', 'w', 'n', 'V', 'e', 'c', 't', 'o', 'r', ';' };
+  const frenzy::uchar LeftDownVectorBarsc_name[] = { 'L', 'e', 'f', 't', 'D', 'o', 'w', 'n', 'V', 'e', 'c', 't', 'o', 'r', 'B', 'a', 'r', ';' };
+  const frenzy::uchar LeftFloorsc_name[] = { 'L', 'e', 'f', 't', 'F', 'l', 'o', 'o', 'r', ';' };
+  const frenzy::uchar LeftRightArrowsc_name[] = { 'L', 'e', 'f', 't', 'R', 'i', 'g', 'h', 't', 'A', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar LeftRightVectorsc_name[] = { 'L', 'e', 'f', 't', 'R', 'i', 'g', 'h', 't', 'V', 'e', 'c', 't', 'o', 'r', ';' };
+  const frenzy::uchar LeftTeesc_name[] = { 'L', 'e', 'f', 't', 'T', 'e', 'e', ';' };
+  const frenzy::uchar LeftTeeArrowsc_name[] = { 'L', 'e', 'f', 't', 'T', 'e', 'e', 'A', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar LeftTeeVectorsc_name[] = { 'L', 'e', 'f', 't', 'T', 'e', 'e', 'V', 'e', 'c', 't', 'o', 'r', ';' };
+  const frenzy::uchar LeftTrianglesc_name[] = { 'L', 'e', 'f', 't', 'T', 'r', 'i', 'a', 'n', 'g', 'l', 'e', ';' };
+  const frenzy::uchar LeftTriangleBarsc_name[] = { 'L', 'e', 'f', 't', 'T', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'B', 'a', 'r', ';' };
+  const frenzy::uchar LeftTriangleEqualsc_name[] = { 'L', 'e', 'f', 't', 'T', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar LeftUpDownVectorsc_name[] = { 'L', 'e', 'f', 't', 'U', 'p', 'D', 'o', 'w', 'n', 'V', 'e', 'c', 't', 'o', 'r', ';' };
+  const frenzy::uchar LeftUpTeeVectorsc_name[] = { 'L', 'e', 'f', 't', 'U', 'p', 'T', 'e', 'e', 'V', 'e', 'c', 't', 'o', 'r', ';' };
+  const frenzy::uchar LeftUpVectorsc_name[] = { 'L', 'e', 'f', 't', 'U', 'p', 'V', 'e', 'c', 't', 'o', 'r', ';' };
+  const frenzy::uchar LeftUpVectorBarsc_name[] = { 'L', 'e', 'f', 't', 'U', 'p', 'V', 'e', 'c', 't', 'o', 'r', 'B', 'a', 'r', ';' };
+  const frenzy::uchar LeftVectorsc_name[] = { 'L', 'e', 'f', 't', 'V', 'e', 'c', 't', 'o', 'r', ';' };
+  const frenzy::uchar LeftVectorBarsc_name[] = { 'L', 'e', 'f', 't', 'V', 'e', 'c', 't', 'o', 'r', 'B', 'a', 'r', ';' };
+  const frenzy::uchar Leftarrowsc_name[] = { 'L', 'e', 'f', 't', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar Leftrightarrowsc_name[] = { 'L', 'e', 'f', 't', 'r', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar LessEqualGreatersc_name[] = { 'L', 'e', 's', 's', 'E', 'q', 'u', 'a', 'l', 'G', 'r', 'e', 'a', 't', 'e', 'r', ';' };
+  const frenzy::uchar LessFullEqualsc_name[] = { 'L', 'e', 's', 's', 'F', 'u', 'l', 'l', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar LessGreatersc_name[] = { 'L', 'e', 's', 's', 'G', 'r', 'e', 'a', 't', 'e', 'r', ';' };
+  const frenzy::uchar LessLesssc_name[] = { 'L', 'e', 's', 's', 'L', 'e', 's', 's', ';' };
+  const frenzy::uchar LessSlantEqualsc_name[] = { 'L', 'e', 's', 's', 'S', 'l', 'a', 'n', 't', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar LessTildesc_name[] = { 'L', 'e', 's', 's', 'T', 'i', 'l', 'd', 'e', ';' };
+  const frenzy::uchar Lfrsc_name[] = { 'L', 'f', 'r', ';' };
+  const frenzy::uchar Llsc_name[] = { 'L', 'l', ';' };
+  const frenzy::uchar Lleftarrowsc_name[] = { 'L', 'l', 'e', 'f', 't', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar Lmidotsc_name[] = { 'L', 'm', 'i', 'd', 'o', 't', ';' };
+  const frenzy::uchar LongLeftArrowsc_name[] = { 'L', 'o', 'n', 'g', 'L', 'e', 'f', 't', 'A', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar LongLeftRightArrowsc_name[] = { 'L', 'o', 'n', 'g', 'L', 'e', 'f', 't', 'R', 'i', 'g', 'h', 't', 'A', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar LongRightArrowsc_name[] = { 'L', 'o', 'n', 'g', 'R', 'i', 'g', 'h', 't', 'A', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar Longleftarrowsc_name[] = { 'L', 'o', 'n', 'g', 'l', 'e', 'f', 't', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar Longleftrightarrowsc_name[] = { 'L', 'o', 'n', 'g', 'l', 'e', 'f', 't', 'r', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar Longrightarrowsc_name[] = { 'L', 'o', 'n', 'g', 'r', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar Lopfsc_name[] = { 'L', 'o', 'p', 'f', ';' };
+  const frenzy::uchar LowerLeftArrowsc_name[] = { 'L', 'o', 'w', 'e', 'r', 'L', 'e', 'f', 't', 'A', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar LowerRightArrowsc_name[] = { 'L', 'o', 'w', 'e', 'r', 'R', 'i', 'g', 'h', 't', 'A', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar Lscrsc_name[] = { 'L', 's', 'c', 'r', ';' };
+  const frenzy::uchar Lshsc_name[] = { 'L', 's', 'h', ';' };
+  const frenzy::uchar Lstroksc_name[] = { 'L', 's', 't', 'r', 'o', 'k', ';' };
+  const frenzy::uchar Ltsc_name[] = { 'L', 't', ';' };
+  const frenzy::uchar Mapsc_name[] = { 'M', 'a', 'p', ';' };
+  const frenzy::uchar Mcysc_name[] = { 'M', 'c', 'y', ';' };
+  const frenzy::uchar MediumSpacesc_name[] = { 'M', 'e', 'd', 'i', 'u', 'm', 'S', 'p', 'a', 'c', 'e', ';' };
+  const frenzy::uchar Mellintrfsc_name[] = { 'M', 'e', 'l', 'l', 'i', 'n', 't', 'r', 'f', ';' };
+  const frenzy::uchar Mfrsc_name[] = { 'M', 'f', 'r', ';' };
+  const frenzy::uchar MinusPlussc_name[] = { 'M', 'i', 'n', 'u', 's', 'P', 'l', 'u', 's', ';' };
+  const frenzy::uchar Mopfsc_name[] = { 'M', 'o', 'p', 'f', ';' };
+  const frenzy::uchar Mscrsc_name[] = { 'M', 's', 'c', 'r', ';' };
+  const frenzy::uchar Musc_name[] = { 'M', 'u', ';' };
+  const frenzy::uchar NJcysc_name[] = { 'N', 'J', 'c', 'y', ';' };
+  const frenzy::uchar Nacutesc_name[] = { 'N', 'a', 'c', 'u', 't', 'e', ';' };
+  const frenzy::uchar Ncaronsc_name[] = { 'N', 'c', 'a', 'r', 'o', 'n', ';' };
+  const frenzy::uchar Ncedilsc_name[] = { 'N', 'c', 'e', 'd', 'i', 'l', ';' };
+  const frenzy::uchar Ncysc_name[] = { 'N', 'c', 'y', ';' };
+  const frenzy::uchar NegativeMediumSpacesc_name[] = { 'N', 'e', 'g', 'a', 't', 'i', 'v', 'e', 'M', 'e', 'd', 'i', 'u', 'm', 'S', 'p', 'a', 'c', 'e', ';' };
+  const frenzy::uchar NegativeThickSpacesc_name[] = { 'N', 'e', 'g', 'a', 't', 'i', 'v', 'e', 'T', 'h', 'i', 'c', 'k', 'S', 'p', 'a', 'c', 'e', ';' };
+  const frenzy::uchar NegativeThinSpacesc_name[] = { 'N', 'e', 'g', 'a', 't', 'i', 'v', 'e', 'T', 'h', 'i', 'n', 'S', 'p', 'a', 'c', 'e', ';' };
+  const frenzy::uchar NegativeVeryThinSpacesc_name[] = { 'N', 'e', 'g', 'a', 't', 'i', 'v', 'e', 'V', 'e', 'r', 'y', 'T', 'h', 'i', 'n', 'S', 'p', 'a', 'c', 'e', ';' };
+  const frenzy::uchar NestedGreaterGreatersc_name[] = { 'N', 'e', 's', 't', 'e', 'd', 'G', 'r', 'e', 'a', 't', 'e', 'r', 'G', 'r', 'e', 'a', 't', 'e', 'r', ';' };
+  const frenzy::uchar NestedLessLesssc_name[] = { 'N', 'e', 's', 't', 'e', 'd', 'L', 'e', 's', 's', 'L', 'e', 's', 's', ';' };
+  const frenzy::uchar NewLinesc_name[] = { 'N', 'e', 'w', 'L', 'i', 'n', 'e', ';' };
+  const frenzy::uchar Nfrsc_name[] = { 'N', 'f', 'r', ';' };
+  const frenzy::uchar NoBreaksc_name[] = { 'N', 'o', 'B', 'r', 'e', 'a', 'k', ';' };
+  const frenzy::uchar NonBreakingSpacesc_name[] = { 'N', 'o', 'n', 'B', 'r', 'e', 'a', 'k', 'i', 'n', 'g', 'S', 'p', 'a', 'c', 'e', ';' };
+  const frenzy::uchar Nopfsc_name[] = { 'N', 'o', 'p', 'f', ';' };
+  const frenzy::uchar Notsc_name[] = { 'N', 'o', 't', ';' };
+  const frenzy::uchar NotCongruentsc_name[] = { 'N', 'o', 't', 'C', 'o', 'n', 'g', 'r', 'u', 'e', 'n', 't', ';' };
+  const frenzy::uchar NotCupCapsc_name[] = { 'N', 'o', 't', 'C', 'u', 'p', 'C', 'a', 'p', ';' };
+  const frenzy::uchar NotDoubleVerticalBarsc_name[] = { 'N', 'o', 't', 'D', 'o', 'u', 'b', 'l', 'e', 'V', 'e', 'r', 't', 'i', 'c', 'a', 'l', 'B', 'a', 'r', ';' };
+  const frenzy::uchar NotElementsc_name[] = { 'N', 'o', 't', 'E', 'l', 'e', 'm', 'e', 'n', 't', ';' };
+  const frenzy::uchar NotEqualsc_name[] = { 'N', 'o', 't', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar NotEqualTildesc_name[] = { 'N', 'o', 't', 'E', 'q', 'u', 'a', 'l', 'T', 'i', 'l', 'd', 'e', ';' };
+  const frenzy::uchar NotExistssc_name[] = { 'N', 'o', 't', 'E', 'x', 'i', 's', 't', 's', ';' };
+  const frenzy::uchar NotGreatersc_name[] = { 'N', 'o', 't', 'G', 'r', 'e', 'a', 't', 'e', 'r', ';' };
+  const frenzy::uchar NotGreaterEqualsc_name[] = { 'N', 'o', 't', 'G', 'r', 'e', 'a', 't', 'e', 'r', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar NotGreaterFullEqualsc_name[] = { 'N', 'o', 't', 'G', 'r', 'e', 'a', 't', 'e', 'r', 'F', 'u', 'l', 'l', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar NotGreaterGreatersc_name[] = { 'N', 'o', 't', 'G', 'r', 'e', 'a', 't', 'e', 'r', 'G', 'r', 'e', 'a', 't', 'e', 'r', ';' };
+  const frenzy::uchar NotGreaterLesssc_name[] = { 'N', 'o', 't', 'G', 'r', 'e', 'a', 't', 'e', 'r', 'L', 'e', 's', 's', ';' };
+  const frenzy::uchar NotGreaterSlantEqualsc_name[] = { 'N', 'o', 't', 'G', 'r', 'e', 'a', 't', 'e', 'r', 'S', 'l', 'a', 'n', 't', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar NotGreaterTildesc_name[] = { 'N', 'o', 't', 'G', 'r', 'e', 'a', 't', 'e', 'r', 'T', 'i', 'l', 'd', 'e', ';' };
+  const frenzy::uchar NotHumpDownHumpsc_name[] = { 'N', 'o', 't', 'H', 'u', 'm', 'p', 'D', 'o', 'w', 'n', 'H', 'u', 'm', 'p', ';' };
+  const frenzy::uchar NotHumpEqualsc_name[] = { 'N', 'o', 't', 'H', 'u', 'm', 'p', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar NotLeftTrianglesc_name[] = { 'N', 'o', 't', 'L', 'e', 'f', 't', 'T', 'r', 'i', 'a', 'n', 'g', 'l', 'e', ';' };
+  const frenzy::uchar NotLeftTriangleBarsc_name[] = { 'N', 'o', 't', 'L', 'e', 'f', 't', 'T', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'B', 'a', 'r', ';' };
+  const frenzy::uchar NotLeftTriangleEqualsc_name[] = { 'N', 'o', 't', 'L', 'e', 'f', 't', 'T', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar NotLesssc_name[] = { 'N', 'o', 't', 'L', 'e', 's', 's', ';' };
+  const frenzy::uchar NotLessEqualsc_name[] = { 'N', 'o', 't', 'L', 'e', 's', 's', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar NotLessGreatersc_name[] = { 'N', 'o', 't', 'L', 'e', 's', 's', 'G', 'r', 'e', 'a', 't', 'e', 'r', ';' };
+  const frenzy::uchar NotLessLesssc_name[] = { 'N', 'o', 't', 'L', 'e', 's', 's', 'L', 'e', 's', 's', ';' };
+  const frenzy::uchar NotLessSlantEqualsc_name[] = { 'N', 'o', 't', 'L', 'e', 's', 's', 'S', 'l', 'a', 'n', 't', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar NotLessTildesc_name[] = { 'N', 'o', 't', 'L', 'e', 's', 's', 'T', 'i', 'l', 'd', 'e', ';' };
+  const frenzy::uchar NotNestedGreaterGreatersc_name[] = { 'N', 'o', 't', 'N', 'e', 's', 't', 'e', 'd', 'G', 'r', 'e', 'a', 't', 'e', 'r', 'G', 'r', 'e', 'a', 't', 'e', 'r', ';' };
+  const frenzy::uchar NotNestedLessLesssc_name[] = { 'N', 'o', 't', 'N', 'e', 's', 't', 'e', 'd', 'L', 'e', 's', 's', 'L', 'e', 's', 's', ';' };
+  const frenzy::uchar NotPrecedessc_name[] = { 'N', 'o', 't', 'P', 'r', 'e', 'c', 'e', 'd', 'e', 's', ';' };
+  const frenzy::uchar NotPrecedesEqualsc_name[] = { 'N', 'o', 't', 'P', 'r', 'e', 'c', 'e', 'd', 'e', 's', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar NotPrecedesSlantEqualsc_name[] = { 'N', 'o', 't', 'P', 'r', 'e', 'c', 'e', 'd', 'e', 's', 'S', 'l', 'a', 'n', 't', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar NotReverseElementsc_name[] = { 'N', 'o', 't', 'R', 'e', 'v', 'e', 'r', 's', 'e', 'E', 'l', 'e', 'm', 'e', 'n', 't', ';' };
+  const frenzy::uchar NotRightTrianglesc_name[] = { 'N', 'o', 't', 'R', 'i', 'g', 'h', 't', 'T', 'r', 'i', 'a', 'n', 'g', 'l', 'e', ';' };
+  const frenzy::uchar NotRightTriangleBarsc_name[] = { 'N', 'o', 't', 'R', 'i', 'g', 'h', 't', 'T', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'B', 'a', 'r', ';' };
+  const frenzy::uchar NotRightTriangleEqualsc_name[] = { 'N', 'o', 't', 'R', 'i', 'g', 'h', 't', 'T', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar NotSquareSubsetsc_name[] = { 'N', 'o', 't', 'S', 'q', 'u', 'a', 'r', 'e', 'S', 'u', 'b', 's', 'e', 't', ';' };
+  const frenzy::uchar NotSquareSubsetEqualsc_name[] = { 'N', 'o', 't', 'S', 'q', 'u', 'a', 'r', 'e', 'S', 'u', 'b', 's', 'e', 't', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar NotSquareSupersetsc_name[] = { 'N', 'o', 't', 'S', 'q', 'u', 'a', 'r', 'e', 'S', 'u', 'p', 'e', 'r', 's', 'e', 't', ';' };
+  const frenzy::uchar NotSquareSupersetEqualsc_name[] = { 'N', 'o', 't', 'S', 'q', 'u', 'a', 'r', 'e', 'S', 'u', 'p', 'e', 'r', 's', 'e', 't', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar NotSubsetsc_name[] = { 'N', 'o', 't', 'S', 'u', 'b', 's', 'e', 't', ';' };
+  const frenzy::uchar NotSubsetEqualsc_name[] = { 'N', 'o', 't', 'S', 'u', 'b', 's', 'e', 't', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar NotSucceedssc_name[] = { 'N', 'o', 't', 'S', 'u', 'c', 'c', 'e', 'e', 'd', 's', ';' };
+  const frenzy::uchar NotSucceedsEqualsc_name[] = { 'N', 'o', 't', 'S', 'u', 'c', 'c', 'e', 'e', 'd', 's', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar NotSucceedsSlantEqualsc_name[] = { 'N', 'o', 't', 'S', 'u', 'c', 'c', 'e', 'e', 'd', 's', 'S', 'l', 'a', 'n', 't', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar NotSucceedsTildesc_name[] = { 'N', 'o', 't', 'S', 'u', 'c', 'c', 'e', 'e', 'd', 's', 'T', 'i', 'l', 'd', 'e', ';' };
+  const frenzy::uchar NotSupersetsc_name[] = { 'N', 'o', 't', 'S', 'u', 'p', 'e', 'r', 's', 'e', 't', ';' };
+  const frenzy::uchar NotSupersetEqualsc_name[] = { 'N', 'o', 't', 'S', 'u', 'p', 'e', 'r', 's', 'e', 't', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar NotTildesc_name[] = { 'N', 'o', 't', 'T', 'i', 'l', 'd', 'e', ';' };
+  const frenzy::uchar NotTildeEqualsc_name[] = { 'N', 'o', 't', 'T', 'i', 'l', 'd', 'e', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar NotTildeFullEqualsc_name[] = { 'N', 'o', 't', 'T', 'i', 'l', 'd', 'e', 'F', 'u', 'l', 'l', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar NotTildeTildesc_name[] = { 'N', 'o', 't', 'T', 'i', 'l', 'd', 'e', 'T', 'i', 'l', 'd', 'e', ';' };
+  const frenzy::uchar NotVerticalBarsc_name[] = { 'N', 'o', 't', 'V', 'e', 'r', 't', 'i', 'c', 'a', 'l', 'B', 'a', 'r', ';' };
+  const frenzy::uchar Nscrsc_name[] = { 'N', 's', 'c', 'r', ';' };
+  const frenzy::uchar Ntilde_name[] = { 'N', 't', 'i', 'l', 'd', 'e' };
+  const frenzy::uchar Ntildesc_name[] = { 'N', 't', 'i', 'l', 'd', 'e', ';' };
+  const frenzy::uchar Nusc_name[] = { 'N', 'u', ';' };
+  const frenzy::uchar OEligsc_name[] = { 'O', 'E', 'l', 'i', 'g', ';' };
+  const frenzy::uchar Oacute_name[] = { 'O', 'a', 'c', 'u', 't', 'e' };
+  const frenzy::uchar Oacutesc_name[] = { 'O', 'a', 'c', 'u', 't', 'e', ';' };
+  const frenzy::uchar Ocirc_name[] = { 'O', 'c', 'i', 'r', 'c' };
+  const frenzy::uchar Ocircsc_name[] = { 'O', 'c', 'i', 'r', 'c', ';' };
+  const frenzy::uchar Ocysc_name[] = { 'O', 'c', 'y', ';' };
+  const frenzy::uchar Odblacsc_name[] = { 'O', 'd', 'b', 'l', 'a', 'c', ';' };
+  const frenzy::uchar Ofrsc_name[] = { 'O', 'f', 'r', ';' };
+  const frenzy::uchar Ograve_name[] = { 'O', 'g', 'r', 'a', 'v', 'e' };
+  const frenzy::uchar Ogravesc_name[] = { 'O', 'g', 'r', 'a', 'v', 'e', ';' };
+  const frenzy::uchar Omacrsc_name[] = { 'O', 'm', 'a', 'c', 'r', ';' };
+  const frenzy::uchar Omegasc_name[] = { 'O', 'm', 'e', 'g', 'a', ';' };
+  const frenzy::uchar Omicronsc_name[] = { 'O', 'm', 'i', 'c', 'r', 'o', 'n', ';' };
+  const frenzy::uchar Oopfsc_name[] = { 'O', 'o', 'p', 'f', ';' };
+  const frenzy::uchar OpenCurlyDoubleQuotesc_name[] = { 'O', 'p', 'e', 'n', 'C', 'u', 'r', 'l', 'y', 'D', 'o', 'u', 'b', 'l', 'e', 'Q', 'u', 'o', 't', 'e', ';' };
+  const frenzy::uchar OpenCurlyQuotesc_name[] = { 'O', 'p', 'e', 'n', 'C', 'u', 'r', 'l', 'y', 'Q', 'u', 'o', 't', 'e', ';' };
+  const frenzy::uchar Orsc_name[] = { 'O', 'r', ';' };
+  const frenzy::uchar Oscrsc_name[] = { 'O', 's', 'c', 'r', ';' };
+  const frenzy::uchar Oslash_name[] = { 'O', 's', 'l', 'a', 's', 'h' };
+  const frenzy::uchar Oslashsc_name[] = { 'O', 's', 'l', 'a', 's', 'h', ';' };
+  const frenzy::uchar Otilde_name[] = { 'O', 't', 'i', 'l', 'd', 'e' };
+  const frenzy::uchar Otildesc_name[] = { 'O', 't', 'i', 'l', 'd', 'e', ';' };
+  const frenzy::uchar Otimessc_name[] = { 'O', 't', 'i', 'm', 'e', 's', ';' };
+  const frenzy::uchar Ouml_name[] = { 'O', 'u', 'm', 'l' };
+  const frenzy::uchar Oumlsc_name[] = { 'O', 'u', 'm', 'l', ';' };
+  const frenzy::uchar OverBarsc_name[] = { 'O', 'v', 'e', 'r', 'B', 'a', 'r', ';' };
+  const frenzy::uchar OverBracesc_name[] = { 'O', 'v', 'e', 'r', 'B', 'r', 'a', 'c', 'e', ';' };
+  const frenzy::uchar OverBracketsc_name[] = { 'O', 'v', 'e', 'r', 'B', 'r', 'a', 'c', 'k', 'e', 't', ';' };
+  const frenzy::uchar OverParenthesissc_name[] = { 'O', 'v', 'e', 'r', 'P', 'a', 'r', 'e', 'n', 't', 'h', 'e', 's', 'i', 's', ';' };
+  const frenzy::uchar PartialDsc_name[] = { 'P', 'a', 'r', 't', 'i', 'a', 'l', 'D', ';' };
+  const frenzy::uchar Pcysc_name[] = { 'P', 'c', 'y', ';' };
+  const frenzy::uchar Pfrsc_name[] = { 'P', 'f', 'r', ';' };
+  const frenzy::uchar Phisc_name[] = { 'P', 'h', 'i', ';' };
+  const frenzy::uchar Pisc_name[] = { 'P', 'i', ';' };
+  const frenzy::uchar PlusMinussc_name[] = { 'P', 'l', 'u', 's', 'M', 'i', 'n', 'u', 's', ';' };
+  const frenzy::uchar Poincareplanesc_name[] = { 'P', 'o', 'i', 'n', 'c', 'a', 'r', 'e', 'p', 'l', 'a', 'n', 'e', ';' };
+  const frenzy::uchar Popfsc_name[] = { 'P', 'o', 'p', 'f', ';' };
+  const frenzy::uchar Prsc_name[] = { 'P', 'r', ';' };
+  const frenzy::uchar Precedessc_name[] = { 'P', 'r', 'e', 'c', 'e', 'd', 'e', 's', ';' };
+  const frenzy::uchar PrecedesEqualsc_name[] = { 'P', 'r', 'e', 'c', 'e', 'd', 'e', 's', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar PrecedesSlantEqualsc_name[] = { 'P', 'r', 'e', 'c', 'e', 'd', 'e', 's', 'S', 'l', 'a', 'n', 't', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar PrecedesTildesc_name[] = { 'P', 'r', 'e', 'c', 'e', 'd', 'e', 's', 'T', 'i', 'l', 'd', 'e', ';' };
+  const frenzy::uchar Primesc_name[] = { 'P', 'r', 'i', 'm', 'e', ';' };
+  const frenzy::uchar Productsc_name[] = { 'P', 'r', 'o', 'd', 'u', 'c', 't', ';' };
+  const frenzy::uchar Proportionsc_name[] = { 'P', 'r', 'o', 'p', 'o', 'r', 't', 'i', 'o', 'n', ';' };
+  const frenzy::uchar Proportionalsc_name[] = { 'P', 'r', 'o', 'p', 'o', 'r', 't', 'i', 'o', 'n', 'a', 'l', ';' };
+  const frenzy::uchar Pscrsc_name[] = { 'P', 's', 'c', 'r', ';' };
+  const frenzy::uchar Psisc_name[] = { 'P', 's', 'i', ';' };
+  const frenzy::uchar QUOT_name[] = { 'Q', 'U', 'O', 'T' };
+  const frenzy::uchar QUOTsc_name[] = { 'Q', 'U', 'O', 'T', ';' };
+  const frenzy::uchar Qfrsc_name[] = { 'Q', 'f', 'r', ';' };
+  const frenzy::uchar Qopfsc_name[] = { 'Q', 'o', 'p', 'f', ';' };
+  const frenzy::uchar Qscrsc_name[] = { 'Q', 's', 'c', 'r', ';' };
+  const frenzy::uchar RBarrsc_name[] = { 'R', 'B', 'a', 'r', 'r', ';' };
+  const frenzy::uchar REG_name[] = { 'R', 'E', 'G' };
+  const frenzy::uchar REGsc_name[] = { 'R', 'E', 'G', ';' };
+  const frenzy::uchar Racutesc_name[] = { 'R', 'a', 'c', 'u', 't', 'e', ';' };
+  const frenzy::uchar Rangsc_name[] = { 'R', 'a', 'n', 'g', ';' };
+  const frenzy::uchar Rarrsc_name[] = { 'R', 'a', 'r', 'r', ';' };
+  const frenzy::uchar Rarrtlsc_name[] = { 'R', 'a', 'r', 'r', 't', 'l', ';' };
+  const frenzy::uchar Rcaronsc_name[] = { 'R', 'c', 'a', 'r', 'o', 'n', ';' };
+  const frenzy::uchar Rcedilsc_name[] = { 'R', 'c', 'e', 'd', 'i', 'l', ';' };
+  const frenzy::uchar Rcysc_name[] = { 'R', 'c', 'y', ';' };
+  const frenzy::uchar Resc_name[] = { 'R', 'e', ';' };
+  const frenzy::uchar ReverseElementsc_name[] = { 'R', 'e', 'v', 'e', 'r', 's', 'e', 'E', 'l', 'e', 'm', 'e', 'n', 't', ';' };
+  const frenzy::uchar ReverseEquilibriumsc_name[] = { 'R', 'e', 'v', 'e', 'r', 's', 'e', 'E', 'q', 'u', 'i', 'l', 'i', 'b', 'r', 'i', 'u', 'm', ';' };
+  const frenzy::uchar ReverseUpEquilibriumsc_name[] = { 'R', 'e', 'v', 'e', 'r', 's', 'e', 'U', 'p', 'E', 'q', 'u', 'i', 'l', 'i', 'b', 'r', 'i', 'u', 'm', ';' };
+  const frenzy::uchar Rfrsc_name[] = { 'R', 'f', 'r', ';' };
+  const frenzy::uchar Rhosc_name[] = { 'R', 'h', 'o', ';' };
+  const frenzy::uchar RightAngleBracketsc_name[] = { 'R', 'i', 'g', 'h', 't', 'A', 'n', 'g', 'l', 'e', 'B', 'r', 'a', 'c', 'k', 'e', 't', ';' };
+  const frenzy::uchar RightArrowsc_name[] = { 'R', 'i', 'g', 'h', 't', 'A', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar RightArrowBarsc_name[] = { 'R', 'i', 'g', 'h', 't', 'A', 'r', 'r', 'o', 'w', 'B', 'a', 'r', ';' };
+  const frenzy::uchar RightArrowLeftArrowsc_name[] = { 'R', 'i', 'g', 'h', 't', 'A', 'r', 'r', 'o', 'w', 'L', 'e', 'f', 't', 'A', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar RightCeilingsc_name[] = { 'R', 'i', 'g', 'h', 't', 'C', 'e', 'i', 'l', 'i', 'n', 'g', ';' };
+  const frenzy::uchar RightDoubleBracketsc_name[] = { 'R', 'i', 'g', 'h', 't', 'D', 'o', 'u', 'b', 'l', 'e', 'B', 'r', 'a', 'c', 'k', 'e', 't', ';' };
+  const frenzy::uchar RightDownTeeVectorsc_name[] = { 'R', 'i', 'g', 'h', 't', 'D', 'o', 'w', 'n', 'T', 'e', 'e', 'V', 'e', 'c', 't', 'o', 'r', ';' };
+  const frenzy::uchar RightDownVectorsc_name[] = { 'R', 'i', 'g', 'h', 't', 'D', 'o', 'w', 'n', 'V', 'e', 'c', 't', 'o', 'r', ';' };
+  const frenzy::uchar RightDownVectorBarsc_name[] = { 'R', 'i', 'g', 'h', 't', 'D', 'o', 'w', 'n', 'V', 'e', 'c', 't', 'o', 'r', 'B', 'a', 'r', ';' };
+  const frenzy::uchar RightFloorsc_name[] = { 'R', 'i', 'g', 'h', 't', 'F', 'l', 'o', 'o', 'r', ';' };
+  const frenzy::uchar RightTeesc_name[] = { 'R', 'i', 'g', 'h', 't', 'T', 'e', 'e', ';' };
+  const frenzy::uchar RightTeeArrowsc_name[] = { 'R', 'i', 'g', 'h', 't', 'T', 'e', 'e', 'A', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar RightTeeVectorsc_name[] = { 'R', 'i', 'g', 'h', 't', 'T', 'e', 'e', 'V', 'e', 'c', 't', 'o', 'r', ';' };
+  const frenzy::uchar RightTrianglesc_name[] = { 'R', 'i', 'g', 'h', 't', 'T', 'r', 'i', 'a', 'n', 'g', 'l', 'e', ';' };
+  const frenzy::uchar RightTriangleBarsc_name[] = { 'R', 'i', 'g', 'h', 't', 'T', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'B', 'a', 'r', ';' };
+  const frenzy::uchar RightTriangleEqualsc_name[] = { 'R', 'i', 'g', 'h', 't', 'T', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar RightUpDownVectorsc_name[] = { 'R', 'i', 'g', 'h', 't', 'U', 'p', 'D', 'o', 'w', 'n', 'V', 'e', 'c', 't', 'o', 'r', ';' };
+  const frenzy::uchar RightUpTeeVectorsc_name[] = { 'R', 'i', 'g', 'h', 't', 'U', 'p', 'T', 'e', 'e', 'V', 'e', 'c', 't', 'o', 'r', ';' };
+  const frenzy::uchar RightUpVectorsc_name[] = { 'R', 'i', 'g', 'h', 't', 'U', 'p', 'V', 'e', 'c', 't', 'o', 'r', ';' };
+  const frenzy::uchar RightUpVectorBarsc_name[] = { 'R', 'i', 'g', 'h', 't', 'U', 'p', 'V', 'e', 'c', 't', 'o', 'r', 'B', 'a', 'r', ';' };
+  const frenzy::uchar RightVectorsc_name[] = { 'R', 'i', 'g', 'h', 't', 'V', 'e', 'c', 't', 'o', 'r', ';' };
+  const frenzy::uchar RightVectorBarsc_name[] = { 'R', 'i', 'g', 'h', 't', 'V', 'e', 'c', 't', 'o', 'r', 'B', 'a', 'r', ';' };
+  const frenzy::uchar Rightarrowsc_name[] = { 'R', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar Ropfsc_name[] = { 'R', 'o', 'p', 'f', ';' };
+  const frenzy::uchar RoundImpliessc_name[] = { 'R', 'o', 'u', 'n', 'd', 'I', 'm', 'p', 'l', 'i', 'e', 's', ';' };
+  const frenzy::uchar Rrightarrowsc_name[] = { 'R', 'r', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar Rscrsc_name[] = { 'R', 's', 'c', 'r', ';' };
+  const frenzy::uchar Rshsc_name[] = { 'R', 's', 'h', ';' };
+  const frenzy::uchar RuleDelayedsc_name[] = { 'R', 'u', 'l', 'e', 'D', 'e', 'l', 'a', 'y', 'e', 'd', ';' };
+  const frenzy::uchar SHCHcysc_name[] = { 'S', 'H', 'C', 'H', 'c', 'y', ';' };
+  const frenzy::uchar SHcysc_name[] = { 'S', 'H', 'c', 'y', ';' };
+  const frenzy::uchar SOFTcysc_name[] = { 'S', 'O', 'F', 'T', 'c', 'y', ';' };
+  const frenzy::uchar Sacutesc_name[] = { 'S', 'a', 'c', 'u', 't', 'e', ';' };
+  const frenzy::uchar Scsc_name[] = { 'S', 'c', ';' };
+  const frenzy::uchar Scaronsc_name[] = { 'S', 'c', 'a', 'r', 'o', 'n', ';' };
+  const frenzy::uchar Scedilsc_name[] = { 'S', 'c', 'e', 'd', 'i', 'l', ';' };
+  const frenzy::uchar Scircsc_name[] = { 'S', 'c', 'i', 'r', 'c', ';' };
+  const frenzy::uchar Scysc_name[] = { 'S', 'c', 'y', ';' };
+  const frenzy::uchar Sfrsc_name[] = { 'S', 'f', 'r', ';' };
+  const frenzy::uchar ShortDownArrowsc_name[] = { 'S', 'h', 'o', 'r', 't', 'D', 'o', 'w', 'n', 'A', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar ShortLeftArrowsc_name[] = { 'S', 'h', 'o', 'r', 't', 'L', 'e', 'f', 't', 'A', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar ShortRightArrowsc_name[] = { 'S', 'h', 'o', 'r', 't', 'R', 'i', 'g', 'h', 't', 'A', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar ShortUpArrowsc_name[] = { 'S', 'h', 'o', 'r', 't', 'U', 'p', 'A', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar Sigmasc_name[] = { 'S', 'i', 'g', 'm', 'a', ';' };
+  const frenzy::uchar SmallCirclesc_name[] = { 'S', 'm', 'a', 'l', 'l', 'C', 'i', 'r', 'c', 'l', 'e', ';' };
+  const frenzy::uchar Sopfsc_name[] = { 'S', 'o', 'p', 'f', ';' };
+  const frenzy::uchar Sqrtsc_name[] = { 'S', 'q', 'r', 't', ';' };
+  const frenzy::uchar Squaresc_name[] = { 'S', 'q', 'u', 'a', 'r', 'e', ';' };
+  const frenzy::uchar SquareIntersectionsc_name[] = { 'S', 'q', 'u', 'a', 'r', 'e', 'I', 'n', 't', 'e', 'r', 's', 'e', 'c', 't', 'i', 'o', 'n', ';' };
+  const frenzy::uchar SquareSubsetsc_name[] = { 'S', 'q', 'u', 'a', 'r', 'e', 'S', 'u', 'b', 's', 'e', 't', ';' };
+  const frenzy::uchar SquareSubsetEqualsc_name[] = { 'S', 'q', 'u', 'a', 'r', 'e', 'S', 'u', 'b', 's', 'e', 't', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar SquareSupersetsc_name[] = { 'S', 'q', 'u', 'a', 'r', 'e', 'S', 'u', 'p', 'e', 'r', 's', 'e', 't', ';' };
+  const frenzy::uchar SquareSupersetEqualsc_name[] = { 'S', 'q', 'u', 'a', 'r', 'e', 'S', 'u', 'p', 'e', 'r', 's', 'e', 't', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar SquareUnionsc_name[] = { 'S', 'q', 'u', 'a', 'r', 'e', 'U', 'n', 'i', 'o', 'n', ';' };
+  const frenzy::uchar Sscrsc_name[] = { 'S', 's', 'c', 'r', ';' };
+  const frenzy::uchar Starsc_name[] = { 'S', 't', 'a', 'r', ';' };
+  const frenzy::uchar Subsc_name[] = { 'S', 'u', 'b', ';' };
+  const frenzy::uchar Subsetsc_name[] = { 'S', 'u', 'b', 's', 'e', 't', ';' };
+  const frenzy::uchar SubsetEqualsc_name[] = { 'S', 'u', 'b', 's', 'e', 't', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar Succeedssc_name[] = { 'S', 'u', 'c', 'c', 'e', 'e', 'd', 's', ';' };
+  const frenzy::uchar SucceedsEqualsc_name[] = { 'S', 'u', 'c', 'c', 'e', 'e', 'd', 's', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar SucceedsSlantEqualsc_name[] = { 'S', 'u', 'c', 'c', 'e', 'e', 'd', 's', 'S', 'l', 'a', 'n', 't', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar SucceedsTildesc_name[] = { 'S', 'u', 'c', 'c', 'e', 'e', 'd', 's', 'T', 'i', 'l', 'd', 'e', ';' };
+  const frenzy::uchar SuchThatsc_name[] = { 'S', 'u', 'c', 'h', 'T', 'h', 'a', 't', ';' };
+  const frenzy::uchar Sumsc_name[] = { 'S', 'u', 'm', ';' };
+  const frenzy::uchar Supsc_name[] = { 'S', 'u', 'p', ';' };
+  const frenzy::uchar Supersetsc_name[] = { 'S', 'u', 'p', 'e', 'r', 's', 'e', 't', ';' };
+  const frenzy::uchar SupersetEqualsc_name[] = { 'S', 'u', 'p', 'e', 'r', 's', 'e', 't', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar Supsetsc_name[] = { 'S', 'u', 'p', 's', 'e', 't', ';' };
+  const frenzy::uchar THORN_name[] = { 'T', 'H', 'O', 'R', 'N' };
+  const frenzy::uchar THORNsc_name[] = { 'T', 'H', 'O', 'R', 'N', ';' };
+  const frenzy::uchar TRADEsc_name[] = { 'T', 'R', 'A', 'D', 'E', ';' };
+  const frenzy::uchar TSHcysc_name[] = { 'T', 'S', 'H', 'c', 'y', ';' };
+  const frenzy::uchar TScysc_name[] = { 'T', 'S', 'c', 'y', ';' };
+  const frenzy::uchar Tabsc_name[] = { 'T', 'a', 'b', ';' };
+  const frenzy::uchar Tausc_name[] = { 'T', 'a', 'u', ';' };
+  const frenzy::uchar Tcaronsc_name[] = { 'T', 'c', 'a', 'r', 'o', 'n', ';' };
+  const frenzy::uchar Tcedilsc_name[] = { 'T', 'c', 'e', 'd', 'i', 'l', ';' };
+  const frenzy::uchar Tcysc_name[] = { 'T', 'c', 'y', ';' };
+  const frenzy::uchar Tfrsc_name[] = { 'T', 'f', 'r', ';' };
+  const frenzy::uchar Thereforesc_name[] = { 'T', 'h', 'e', 'r', 'e', 'f', 'o', 'r', 'e', ';' };
+  const frenzy::uchar Thetasc_name[] = { 'T', 'h', 'e', 't', 'a', ';' };
+  const frenzy::uchar ThickSpacesc_name[] = { 'T', 'h', 'i', 'c', 'k', 'S', 'p', 'a', 'c', 'e', ';' };
+  const frenzy::uchar ThinSpacesc_name[] = { 'T', 'h', 'i', 'n', 'S', 'p', 'a', 'c', 'e', ';' };
+  const frenzy::uchar Tildesc_name[] = { 'T', 'i', 'l', 'd', 'e', ';' };
+  const frenzy::uchar TildeEqualsc_name[] = { 'T', 'i', 'l', 'd', 'e', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar TildeFullEqualsc_name[] = { 'T', 'i', 'l', 'd', 'e', 'F', 'u', 'l', 'l', 'E', 'q', 'u', 'a', 'l', ';' };
+  const frenzy::uchar TildeTildesc_name[] = { 'T', 'i', 'l', 'd', 'e', 'T', 'i', 'l', 'd', 'e', ';' };
+  const frenzy::uchar Topfsc_name[] = { 'T', 'o', 'p', 'f', ';' };
+  const frenzy::uchar TripleDotsc_name[] = { 'T', 'r', 'i', 'p', 'l', 'e', 'D', 'o', 't', ';' };
+  const frenzy::uchar Tscrsc_name[] = { 'T', 's', 'c', 'r', ';' };
+  const frenzy::uchar Tstroksc_name[] = { 'T', 's', 't', 'r', 'o', 'k', ';' };
+  const frenzy::uchar Uacute_name[] = { 'U', 'a', 'c', 'u', 't', 'e' };
+  const frenzy::uchar Uacutesc_name[] = { 'U', 'a', 'c', 'u', 't', 'e', ';' };
+  const frenzy::uchar Uarrsc_name[] = { 'U', 'a', 'r', 'r', ';' };
+  const frenzy::uchar Uarrocirsc_name[] = { 'U', 'a', 'r', 'r', 'o', 'c', 'i', 'r', ';' };
+  const frenzy::uchar Ubrcysc_name[] = { 'U', 'b', 'r', 'c', 'y', ';' };
+  const frenzy::uchar Ubrevesc_name[] = { 'U', 'b', 'r', 'e', 'v', 'e', ';' };
+  const frenzy::uchar Ucirc_name[] = { 'U', 'c', 'i', 'r', 'c' };
+  const frenzy::uchar Ucircsc_name[] = { 'U', 'c', 'i', 'r', 'c', ';' };
+  const frenzy::uchar Ucysc_name[] = { 'U', 'c', 'y', ';' };
+  const frenzy::uchar Udblacsc_name[] = { 'U', 'd', 'b', 'l', 'a', 'c', ';' };
+  const frenzy::uchar Ufrsc_name[] = { 'U', 'f', 'r', ';' };
+  const frenzy::uchar Ugrave_name[] = { 'U', 'g', 'r', 'a', 'v', 'e' };
+  const frenzy::uchar Ugravesc_name[] = { 'U', 'g', 'r', 'a', 'v', 'e', ';' };
+  const frenzy::uchar Umacrsc_name[] = { 'U', 'm', 'a', 'c', 'r', ';' };
+  const frenzy::uchar UnderBarsc_name[] = { 'U', 'n', 'd', 'e', 'r', 'B', 'a', 'r', ';' };
+  const frenzy::uchar UnderBracesc_name[] = { 'U', 'n', 'd', 'e', 'r', 'B', 'r', 'a', 'c', 'e', ';' };
+  const frenzy::uchar UnderBracketsc_name[] = { 'U', 'n', 'd', 'e', 'r', 'B', 'r', 'a', 'c', 'k', 'e', 't', ';' };
+  const frenzy::uchar UnderParenthesissc_name[] = { 'U', 'n', 'd', 'e', 'r', 'P', 'a', 'r', 'e', 'n', 't', 'h', 'e', 's', 'i', 's', ';' };
+  const frenzy::uchar Unionsc_name[] = { 'U', 'n', 'i', 'o', 'n', ';' };
+  const frenzy::uchar UnionPlussc_name[] = { 'U', 'n', 'i', 'o', 'n', 'P', 'l', 'u', 's', ';' };
+  const frenzy::uchar Uogonsc_name[] = { 'U', 'o', 'g', 'o', 'n', ';' };
+  const frenzy::uchar Uopfsc_name[] = { 'U', 'o', 'p', 'f', ';' };
+  const frenzy::uchar UpArrowsc_name[] = { 'U', 'p', 'A', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar UpArrowBarsc_name[] = { 'U', 'p', 'A', 'r', 'r', 'o', 'w', 'B', 'a', 'r', ';' };
+  const frenzy::uchar UpArrowDownArrowsc_name[] = { 'U', 'p', 'A', 'r', 'r', 'o', 'w', 'D', 'o', 'w', 'n', 'A', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar UpDownArrowsc_name[] = { 'U', 'p', 'D', 'o', 'w', 'n', 'A', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar UpEquilibriumsc_name[] = { 'U', 'p', 'E', 'q', 'u', 'i', 'l', 'i', 'b', 'r', 'i', 'u', 'm', ';' };
+  const frenzy::uchar UpTeesc_name[] = { 'U', 'p', 'T', 'e', 'e', ';' };
+  const frenzy::uchar UpTeeArrowsc_name[] = { 'U', 'p', 'T', 'e', 'e', 'A', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar Uparrowsc_name[] = { 'U', 'p', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar Updownarrowsc_name[] = { 'U', 'p', 'd', 'o', 'w', 'n', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar UpperLeftArrowsc_name[] = { 'U', 'p', 'p', 'e', 'r', 'L', 'e', 'f', 't', 'A', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar UpperRightArrowsc_name[] = { 'U', 'p', 'p', 'e', 'r', 'R', 'i', 'g', 'h', 't', 'A', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar Upsisc_name[] = { 'U', 'p', 's', 'i', ';' };
+  const frenzy::uchar Upsilonsc_name[] = { 'U', 'p', 's', 'i', 'l', 'o', 'n', ';' };
+  const frenzy::uchar Uringsc_name[] = { 'U', 'r', 'i', 'n', 'g', ';' };
+  const frenzy::uchar Uscrsc_name[] = { 'U', 's', 'c', 'r', ';' };
+  const frenzy::uchar Utildesc_name[] = { 'U', 't', 'i', 'l', 'd', 'e', ';' };
+  const frenzy::uchar Uuml_name[] = { 'U', 'u', 'm', 'l' };
+  const frenzy::uchar Uumlsc_name[] = { 'U', 'u', 'm', 'l', ';' };
+  const frenzy::uchar VDashsc_name[] = { 'V', 'D', 'a', 's', 'h', ';' };
+  const frenzy::uchar Vbarsc_name[] = { 'V', 'b', 'a', 'r', ';' };
+  const frenzy::uchar Vcysc_name[] = { 'V', 'c', 'y', ';' };
+  const frenzy::uchar Vdashsc_name[] = { 'V', 'd', 'a', 's', 'h', ';' };
+  const frenzy::uchar Vdashlsc_name[] = { 'V', 'd', 'a', 's', 'h', 'l', ';' };
+  const frenzy::uchar Veesc_name[] = { 'V', 'e', 'e', ';' };
+  const frenzy::uchar Verbarsc_name[] = { 'V', 'e', 'r', 'b', 'a', 'r', ';' };
+  const frenzy::uchar Vertsc_name[] = { 'V', 'e', 'r', 't', ';' };
+  const frenzy::uchar VerticalBarsc_name[] = { 'V', 'e', 'r', 't', 'i', 'c', 'a', 'l', 'B', 'a', 'r', ';' };
+  const frenzy::uchar VerticalLinesc_name[] = { 'V', 'e', 'r', 't', 'i', 'c', 'a', 'l', 'L', 'i', 'n', 'e', ';' };
+  const frenzy::uchar VerticalSeparatorsc_name[] = { 'V', 'e', 'r', 't', 'i', 'c', 'a', 'l', 'S', 'e', 'p', 'a', 'r', 'a', 't', 'o', 'r', ';' };
+  const frenzy::uchar VerticalTildesc_name[] = { 'V', 'e', 'r', 't', 'i', 'c', 'a', 'l', 'T', 'i', 'l', 'd', 'e', ';' };
+  const frenzy::uchar VeryThinSpacesc_name[] = { 'V', 'e', 'r', 'y', 'T', 'h', 'i', 'n', 'S', 'p', 'a', 'c', 'e', ';' };
+  const frenzy::uchar Vfrsc_name[] = { 'V', 'f', 'r', ';' };
+  const frenzy::uchar Vopfsc_name[] = { 'V', 'o', 'p', 'f', ';' };
+  const frenzy::uchar Vscrsc_name[] = { 'V', 's', 'c', 'r', ';' };
+  const frenzy::uchar Vvdashsc_name[] = { 'V', 'v', 'd', 'a', 's', 'h', ';' };
+  const frenzy::uchar Wcircsc_name[] = { 'W', 'c', 'i', 'r', 'c', ';' };
+  const frenzy::uchar Wedgesc_name[] = { 'W', 'e', 'd', 'g', 'e', ';' };
+  const frenzy::uchar Wfrsc_name[] = { 'W', 'f', 'r', ';' };
+  const frenzy::uchar Wopfsc_name[] = { 'W', 'o', 'p', 'f', ';' };
+  const frenzy::uchar Wscrsc_name[] = { 'W', 's', 'c', 'r', ';' };
+  const frenzy::uchar Xfrsc_name[] = { 'X', 'f', 'r', ';' };
+  const frenzy::uchar Xisc_name[] = { 'X', 'i', ';' };
+  const frenzy::uchar Xopfsc_name[] = { 'X', 'o', 'p', 'f', ';' };
+  const frenzy::uchar Xscrsc_name[] = { 'X', 's', 'c', 'r', ';' };
+  const frenzy::uchar YAcysc_name[] = { 'Y', 'A', 'c', 'y', ';' };
+  const frenzy::uchar YIcysc_name[] = { 'Y', 'I', 'c', 'y', ';' };
+  const frenzy::uchar YUcysc_name[] = { 'Y', 'U', 'c', 'y', ';' };
+  const frenzy::uchar Yacute_name[] = { 'Y', 'a', 'c', 'u', 't', 'e' };
+  const frenzy::uchar Yacutesc_name[] = { 'Y', 'a', 'c', 'u', 't', 'e', ';' };
+  const frenzy::uchar Ycircsc_name[] = { 'Y', 'c', 'i', 'r', 'c', ';' };
+  const frenzy::uchar Ycysc_name[] = { 'Y', 'c', 'y', ';' };
+  const frenzy::uchar Yfrsc_name[] = { 'Y', 'f', 'r', ';' };
+  const frenzy::uchar Yopfsc_name[] = { 'Y', 'o', 'p', 'f', ';' };
+  const frenzy::uchar Yscrsc_name[] = { 'Y', 's', 'c', 'r', ';' };
+  const frenzy::uchar Yumlsc_name[] = { 'Y', 'u', 'm', 'l', ';' };
+  const frenzy::uchar ZHcysc_name[] = { 'Z', 'H', 'c', 'y', ';' };
+  const frenzy::uchar Zacutesc_name[] = { 'Z', 'a', 'c', 'u', 't', 'e', ';' };
+  const frenzy::uchar Zcaronsc_name[] = { 'Z', 'c', 'a', 'r', 'o', 'n', ';' };
+  const frenzy::uchar Zcysc_name[] = { 'Z', 'c', 'y', ';' };
+  const frenzy::uchar Zdotsc_name[] = { 'Z', 'd', 'o', 't', ';' };
+  const frenzy::uchar ZeroWidthSpacesc_name[] = { 'Z', 'e', 'r', 'o', 'W', 'i', 'd', 't', 'h', 'S', 'p', 'a', 'c', 'e', ';' };
+  const frenzy::uchar Zetasc_name[] = { 'Z', 'e', 't', 'a', ';' };
+  const frenzy::uchar Zfrsc_name[] = { 'Z', 'f', 'r', ';' };
+  const frenzy::uchar Zopfsc_name[] = { 'Z', 'o', 'p', 'f', ';' };
+  const frenzy::uchar Zscrsc_name[] = { 'Z', 's', 'c', 'r', ';' };
+  const frenzy::uchar aacute_name[] = { 'a', 'a', 'c', 'u', 't', 'e' };
+  const frenzy::uchar aacutesc_name[] = { 'a', 'a', 'c', 'u', 't', 'e', ';' };
+  const frenzy::uchar abrevesc_name[] = { 'a', 'b', 'r', 'e', 'v', 'e', ';' };
+  const frenzy::uchar acsc_name[] = { 'a', 'c', ';' };
+  const frenzy::uchar acEsc_name[] = { 'a', 'c', 'E', ';' };
+  const frenzy::uchar acdsc_name[] = { 'a', 'c', 'd', ';' };
+  const frenzy::uchar acirc_name[] = { 'a', 'c', 'i', 'r', 'c' };
+  const frenzy::uchar acircsc_name[] = { 'a', 'c', 'i', 'r', 'c', ';' };
+  const frenzy::uchar acute_name[] = { 'a', 'c', 'u', 't', 'e' };
+  const frenzy::uchar acutesc_name[] = { 'a', 'c', 'u', 't', 'e', ';' };
+  const frenzy::uchar acysc_name[] = { 'a', 'c', 'y', ';' };
+  const frenzy::uchar aelig_name[] = { 'a', 'e', 'l', 'i', 'g' };
+  const frenzy::uchar aeligsc_name[] = { 'a', 'e', 'l', 'i', 'g', ';' };
+  const frenzy::uchar afsc_name[] = { 'a', 'f', ';' };
+  const frenzy::uchar afrsc_name[] = { 'a', 'f', 'r', ';' };
+  const frenzy::uchar agrave_name[] = { 'a', 'g', 'r', 'a', 'v', 'e' };
+  const frenzy::uchar agravesc_name[] = { 'a', 'g', 'r', 'a', 'v', 'e', ';' };
+  const frenzy::uchar alefsymsc_name[] = { 'a', 'l', 'e', 'f', 's', 'y', 'm', ';' };
+  const frenzy::uchar alephsc_name[] = { 'a', 'l', 'e', 'p', 'h', ';' };
+  const frenzy::uchar alphasc_name[] = { 'a', 'l', 'p', 'h', 'a', ';' };
+  const frenzy::uchar amacrsc_name[] = { 'a', 'm', 'a', 'c', 'r', ';' };
+  const frenzy::uchar amalgsc_name[] = { 'a', 'm', 'a', 'l', 'g', ';' };
+  const frenzy::uchar amp_name[] = { 'a', 'm', 'p' };
+  const frenzy::uchar ampsc_name[] = { 'a', 'm', 'p', ';' };
+  const frenzy::uchar andsc_name[] = { 'a', 'n', 'd', ';' };
+  const frenzy::uchar andandsc_name[] = { 'a', 'n', 'd', 'a', 'n', 'd', ';' };
+  const frenzy::uchar anddsc_name[] = { 'a', 'n', 'd', 'd', ';' };
+  const frenzy::uchar andslopesc_name[] = { 'a', 'n', 'd', 's', 'l', 'o', 'p', 'e', ';' };
+  const frenzy::uchar andvsc_name[] = { 'a', 'n', 'd', 'v', ';' };
+  const frenzy::uchar angsc_name[] = { 'a', 'n', 'g', ';' };
+  const frenzy::uchar angesc_name[] = { 'a', 'n', 'g', 'e', ';' };
+  const frenzy::uchar anglesc_name[] = { 'a', 'n', 'g', 'l', 'e', ';' };
+  const frenzy::uchar angmsdsc_name[] = { 'a', 'n', 'g', 'm', 's', 'd', ';' };
+  const frenzy::uchar angmsdaasc_name[] = { 'a', 'n', 'g', 'm', 's', 'd', 'a', 'a', ';' };
+  const frenzy::uchar angmsdabsc_name[] = { 'a', 'n', 'g', 'm', 's', 'd', 'a', 'b', ';' };
+  const frenzy::uchar angmsdacsc_name[] = { 'a', 'n', 'g', 'm', 's', 'd', 'a', 'c', ';' };
+  const frenzy::uchar angmsdadsc_name[] = { 'a', 'n', 'g', 'm', 's', 'd', 'a', 'd', ';' };
+  const frenzy::uchar angmsdaesc_name[] = { 'a', 'n', 'g', 'm', 's', 'd', 'a', 'e', ';' };
+  const frenzy::uchar angmsdafsc_name[] = { 'a', 'n', 'g', 'm', 's', 'd', 'a', 'f', ';' };
+  const frenzy::uchar angmsdagsc_name[] = { 'a', 'n', 'g', 'm', 's', 'd', 'a', 'g', ';' };
+  const frenzy::uchar angmsdahsc_name[] = { 'a', 'n', 'g', 'm', 's', 'd', 'a', 'h', ';' };
+  const frenzy::uchar angrtsc_name[] = { 'a', 'n', 'g', 'r', 't', ';' };
+  const frenzy::uchar angrtvbsc_name[] = { 'a', 'n', 'g', 'r', 't', 'v', 'b', ';' };
+  const frenzy::uchar angrtvbdsc_name[] = { 'a', 'n', 'g', 'r', 't', 'v', 'b', 'd', ';' };
+  const frenzy::uchar angsphsc_name[] = { 'a', 'n', 'g', 's', 'p', 'h', ';' };
+  const frenzy::uchar angstsc_name[] = { 'a', 'n', 'g', 's', 't', ';' };
+  const frenzy::uchar angzarrsc_name[] = { 'a', 'n', 'g', 'z', 'a', 'r', 'r', ';' };
+  const frenzy::uchar aogonsc_name[] = { 'a', 'o', 'g', 'o', 'n', ';' };
+  const frenzy::uchar aopfsc_name[] = { 'a', 'o', 'p', 'f', ';' };
+  const frenzy::uchar apsc_name[] = { 'a', 'p', ';' };
+  const frenzy::uchar apEsc_name[] = { 'a', 'p', 'E', ';' };
+  const frenzy::uchar apacirsc_name[] = { 'a', 'p', 'a', 'c', 'i', 'r', ';' };
+  const frenzy::uchar apesc_name[] = { 'a', 'p', 'e', ';' };
+  const frenzy::uchar apidsc_name[] = { 'a', 'p', 'i', 'd', ';' };
+  const frenzy::uchar apossc_name[] = { 'a', 'p', 'o', 's', ';' };
+  const frenzy::uchar approxsc_name[] = { 'a', 'p', 'p', 'r', 'o', 'x', ';' };
+  const frenzy::uchar approxeqsc_name[] = { 'a', 'p', 'p', 'r', 'o', 'x', 'e', 'q', ';' };
+  const frenzy::uchar aring_name[] = { 'a', 'r', 'i', 'n', 'g' };
+  const frenzy::uchar aringsc_name[] = { 'a', 'r', 'i', 'n', 'g', ';' };
+  const frenzy::uchar ascrsc_name[] = { 'a', 's', 'c', 'r', ';' };
+  const frenzy::uchar astsc_name[] = { 'a', 's', 't', ';' };
+  const frenzy::uchar asympsc_name[] = { 'a', 's', 'y', 'm', 'p', ';' };
+  const frenzy::uchar asympeqsc_name[] = { 'a', 's', 'y', 'm', 'p', 'e', 'q', ';' };
+  const frenzy::uchar atilde_name[] = { 'a', 't', 'i', 'l', 'd', 'e' };
+  const frenzy::uchar atildesc_name[] = { 'a', 't', 'i', 'l', 'd', 'e', ';' };
+  const frenzy::uchar auml_name[] = { 'a', 'u', 'm', 'l' };
+  const frenzy::uchar aumlsc_name[] = { 'a', 'u', 'm', 'l', ';' };
+  const frenzy::uchar awconintsc_name[] = { 'a', 'w', 'c', 'o', 'n', 'i', 'n', 't', ';' };
+  const frenzy::uchar awintsc_name[] = { 'a', 'w', 'i', 'n', 't', ';' };
+  const frenzy::uchar bNotsc_name[] = { 'b', 'N', 'o', 't', ';' };
+  const frenzy::uchar backcongsc_name[] = { 'b', 'a', 'c', 'k', 'c', 'o', 'n', 'g', ';' };
+  const frenzy::uchar backepsilonsc_name[] = { 'b', 'a', 'c', 'k', 'e', 'p', 's', 'i', 'l', 'o', 'n', ';' };
+  const frenzy::uchar backprimesc_name[] = { 'b', 'a', 'c', 'k', 'p', 'r', 'i', 'm', 'e', ';' };
+  const frenzy::uchar backsimsc_name[] = { 'b', 'a', 'c', 'k', 's', 'i', 'm', ';' };
+  const frenzy::uchar backsimeqsc_name[] = { 'b', 'a', 'c', 'k', 's', 'i', 'm', 'e', 'q', ';' };
+  const frenzy::uchar barveesc_name[] = { 'b', 'a', 'r', 'v', 'e', 'e', ';' };
+  const frenzy::uchar barwedsc_name[] = { 'b', 'a', 'r', 'w', 'e', 'd', ';' };
+  const frenzy::uchar barwedgesc_name[] = { 'b', 'a', 'r', 'w', 'e', 'd', 'g', 'e', ';' };
+  const frenzy::uchar bbrksc_name[] = { 'b', 'b', 'r', 'k', ';' };
+  const frenzy::uchar bbrktbrksc_name[] = { 'b', 'b', 'r', 'k', 't', 'b', 'r', 'k', ';' };
+  const frenzy::uchar bcongsc_name[] = { 'b', 'c', 'o', 'n', 'g', ';' };
+  const frenzy::uchar bcysc_name[] = { 'b', 'c', 'y', ';' };
+  const frenzy::uchar bdquosc_name[] = { 'b', 'd', 'q', 'u', 'o', ';' };
+  const frenzy::uchar becaussc_name[] = { 'b', 'e', 'c', 'a', 'u', 's', ';' };
+  const frenzy::uchar becausesc_name[] = { 'b', 'e', 'c', 'a', 'u', 's', 'e', ';' };
+  const frenzy::uchar bemptyvsc_name[] = { 'b', 'e', 'm', 'p', 't', 'y', 'v', ';' };
+  const frenzy::uchar bepsisc_name[] = { 'b', 'e', 'p', 's', 'i', ';' };
+  const frenzy::uchar bernousc_name[] = { 'b', 'e', 'r', 'n', 'o', 'u', ';' };
+  const frenzy::uchar betasc_name[] = { 'b', 'e', 't', 'a', ';' };
+  const frenzy::uchar bethsc_name[] = { 'b', 'e', 't', 'h', ';' };
+  const frenzy::uchar betweensc_name[] = { 'b', 'e', 't', 'w', 'e', 'e', 'n', ';' };
+  const frenzy::uchar bfrsc_name[] = { 'b', 'f', 'r', ';' };
+  const frenzy::uchar bigcapsc_name[] = { 'b', 'i', 'g', 'c', 'a', 'p', ';' };
+  const frenzy::uchar bigcircsc_name[] = { 'b', 'i', 'g', 'c', 'i', 'r', 'c', ';' };
+  const frenzy::uchar bigcupsc_name[] = { 'b', 'i', 'g', 'c', 'u', 'p', ';' };
+  const frenzy::uchar bigodotsc_name[] = { 'b', 'i', 'g', 'o', 'd', 'o', 't', ';' };
+  const frenzy::uchar bigoplussc_name[] = { 'b', 'i', 'g', 'o', 'p', 'l', 'u', 's', ';' };
+  const frenzy::uchar bigotimessc_name[] = { 'b', 'i', 'g', 'o', 't', 'i', 'm', 'e', 's', ';' };
+  const frenzy::uchar bigsqcupsc_name[] = { 'b', 'i', 'g', 's', 'q', 'c', 'u', 'p', ';' };
+  const frenzy::uchar bigstarsc_name[] = { 'b', 'i', 'g', 's', 't', 'a', 'r', ';' };
+  const frenzy::uchar bigtriangledownsc_name[] = { 'b', 'i', 'g', 't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'd', 'o', 'w', 'n', ';' };
+  const frenzy::uchar bigtriangleupsc_name[] = { 'b', 'i', 'g', 't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'u', 'p', ';' };
+  const frenzy::uchar biguplussc_name[] = { 'b', 'i', 'g', 'u', 'p', 'l', 'u', 's', ';' };
+  const frenzy::uchar bigveesc_name[] = { 'b', 'i', 'g', 'v', 'e', 'e', ';' };
+  const frenzy::uchar bigwedgesc_name[] = { 'b', 'i', 'g', 'w', 'e', 'd', 'g', 'e', ';' };
+  const frenzy::uchar bkarowsc_name[] = { 'b', 'k', 'a', 'r', 'o', 'w', ';' };
+  const frenzy::uchar blacklozengesc_name[] = { 'b', 'l', 'a', 'c', 'k', 'l', 'o', 'z', 'e', 'n', 'g', 'e', ';' };
+  const frenzy::uchar blacksquaresc_name[] = { 'b', 'l', 'a', 'c', 'k', 's', 'q', 'u', 'a', 'r', 'e', ';' };
+  const frenzy::uchar blacktrianglesc_name[] = { 'b', 'l', 'a', 'c', 'k', 't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', ';' };
+  const frenzy::uchar blacktriangledownsc_name[] = { 'b', 'l', 'a', 'c', 'k', 't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'd', 'o', 'w', 'n', ';' };
+  const frenzy::uchar blacktriangleleftsc_name[] = { 'b', 'l', 'a', 'c', 'k', 't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'l', 'e', 'f', 't', ';' };
+  const frenzy::uchar blacktrianglerightsc_name[] = { 'b', 'l', 'a', 'c', 'k', 't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'r', 'i', 'g', 'h', 't', ';' };
+  const frenzy::uchar blanksc_name[] = { 'b', 'l', 'a', 'n', 'k', ';' };
+  const frenzy::uchar blk12sc_name[] = { 'b', 'l', 'k', '1', '2', ';' };
+  const frenzy::uchar blk14sc_name[] = { 'b', 'l', 'k', '1', '4', ';' };
+  const frenzy::uchar blk34sc_name[] = { 'b', 'l', 'k', '3', '4', ';' };
+  const frenzy::uchar blocksc_name[] = { 'b', 'l', 'o', 'c', 'k', ';' };
+  const frenzy::uchar bnesc_name[] = { 'b', 'n', 'e', ';' };
+  const frenzy::uchar bnequivsc_name[] = { 'b', 'n', 'e', 'q', 'u', 'i', 'v', ';' };
+  const frenzy::uchar bnotsc_name[] = { 'b', 'n', 'o', 't', ';' };
+  const frenzy::uchar bopfsc_name[] = { 'b', 'o', 'p', 'f', ';' };
+  const frenzy::uchar botsc_name[] = { 'b', 'o', 't', ';' };
+  const frenzy::uchar bottomsc_name[] = { 'b', 'o', 't', 't', 'o', 'm', ';' };
+  const frenzy::uchar bowtiesc_name[] = { 'b', 'o', 'w', 't', 'i', 'e', ';' };
+  const frenzy::uchar boxDLsc_name[] = { 'b', 'o', 'x', 'D', 'L', ';' };
+  const frenzy::uchar boxDRsc_name[] = { 'b', 'o', 'x', 'D', 'R', ';' };
+  const frenzy::uchar boxDlsc_name[] = { 'b', 'o', 'x', 'D', 'l', ';' };
+  const frenzy::uchar boxDrsc_name[] = { 'b', 'o', 'x', 'D', 'r', ';' };
+  const frenzy::uchar boxHsc_name[] = { 'b', 'o', 'x', 'H', ';' };
+  const frenzy::uchar boxHDsc_name[] = { 'b', 'o', 'x', 'H', 'D', ';' };
+  const frenzy::uchar boxHUsc_name[] = { 'b', 'o', 'x', 'H', 'U', ';' };
+  const frenzy::uchar boxHdsc_name[] = { 'b', 'o', 'x', 'H', 'd', ';' };
+  const frenzy::uchar boxHusc_name[] = { 'b', 'o', 'x', 'H', 'u', ';' };
+  const frenzy::uchar boxULsc_name[] = { 'b', 'o', 'x', 'U', 'L', ';' };
+  const frenzy::uchar boxURsc_name[] = { 'b', 'o', 'x', 'U', 'R', ';' };
+  const frenzy::uchar boxUlsc_name[] = { 'b', 'o', 'x', 'U', 'l', ';' };
+  const frenzy::uchar boxUrsc_name[] = { 'b', 'o', 'x', 'U', 'r', ';' };
+  const frenzy::uchar boxVsc_name[] = { 'b', 'o', 'x', 'V', ';' };
+  const frenzy::uchar boxVHsc_name[] = { 'b', 'o', 'x', 'V', 'H', ';' };
+  const frenzy::uchar boxVLsc_name[] = { 'b', 'o', 'x', 'V', 'L', ';' };
+  const frenzy::uchar boxVRsc_name[] = { 'b', 'o', 'x', 'V', 'R', ';' };
+  const frenzy::uchar boxVhsc_name[] = { 'b', 'o', 'x', 'V', 'h', ';' };
+  const frenzy::uchar boxVlsc_name[] = { 'b', 'o', 'x', 'V', 'l', ';' };
+  const frenzy::uchar boxVrsc_name[] = { 'b', 'o', 'x', 'V', 'r', ';' };
+  const frenzy::uchar boxboxsc_name[] = { 'b', 'o', 'x', 'b', 'o', 'x', ';' };
+  const frenzy::uchar boxdLsc_name[] = { 'b', 'o', 'x', 'd', 'L', ';' };
+  const frenzy::uchar boxdRsc_name[] = { 'b', 'o', 'x', 'd', 'R', ';' };
+  const frenzy::uchar boxdlsc_name[] = { 'b', 'o', 'x', 'd', 'l', ';' };
+  const frenzy::uchar boxdrsc_name[] = { 'b', 'o', 'x', 'd', 'r', ';' };
+  const frenzy::uchar boxhsc_name[] = { 'b', 'o', 'x', 'h', ';' };
+  const frenzy::uchar boxhDsc_name[] = { 'b', 'o', 'x', 'h', 'D', ';' };
+  const frenzy::uchar boxhUsc_name[] = { 'b', 'o', 'x', 'h', 'U', ';' };
+  const frenzy::uchar boxhdsc_name[] = { 'b', 'o', 'x', 'h', 'd', ';' };
+  const frenzy::uchar boxhusc_name[] = { 'b', 'o', 'x', 'h', 'u', ';' };
+  const frenzy::uchar boxminussc_name[] = { 'b', 'o', 'x', 'm', 'i', 'n', 'u', 's', ';' };
+  const frenzy::uchar boxplussc_name[] = { 'b', 'o', 'x', 'p', 'l', 'u', 's', ';' };
+  const frenzy::uchar boxtimessc_name[] = { 'b', 'o', 'x', 't', 'i', 'm', 'e', 's', ';' };
+  const frenzy::uchar boxuLsc_name[] = { 'b', 'o', 'x', 'u', 'L', ';' };
+  const frenzy::uchar boxuRsc_name[] = { 'b', 'o', 'x', 'u', 'R', ';' };
+  const frenzy::uchar boxulsc_name[] = { 'b', 'o', 'x', 'u', 'l', ';' };
+  const frenzy::uchar boxursc_name[] = { 'b', 'o', 'x', 'u', 'r', ';' };
+  const frenzy::uchar boxvsc_name[] = { 'b', 'o', 'x', 'v', ';' };
+  const frenzy::uchar boxvHsc_name[] = { 'b', 'o', 'x', 'v', 'H', ';' };
+  const frenzy::uchar boxvLsc_name[] = { 'b', 'o', 'x', 'v', 'L', ';' };
+  const frenzy::uchar boxvRsc_name[] = { 'b', 'o', 'x', 'v', 'R', ';' };
+  const frenzy::uchar boxvhsc_name[] = { 'b', 'o', 'x', 'v', 'h', ';' };
+  const frenzy::uchar boxvlsc_name[] = { 'b', 'o', 'x', 'v', 'l', ';' };
+  const frenzy::uchar boxvrsc_name[] = { 'b', 'o', 'x', 'v', 'r', ';' };
+  const frenzy::uchar bprimesc_name[] = { 'b', 'p', 'r', 'i', 'm', 'e', ';' };
+  const frenzy::uchar brevesc_name[] = { 'b', 'r', 'e', 'v', 'e', ';' };
+  const frenzy::uchar brvbar_name[] = { 'b', 'r', 'v', 'b', 'a', 'r' };
+  const frenzy::uchar brvbarsc_name[] = { 'b', 'r', 'v', 'b', 'a', 'r', ';' };
+  const frenzy::uchar bscrsc_name[] = { 'b', 's', 'c', 'r', ';' };
+  const frenzy::uchar bsemisc_name[] = { 'b', 's', 'e', 'm', 'i', ';' };
+  const frenzy::uchar bsimsc_name[] = { 'b', 's', 'i', 'm', ';' };
+  const frenzy::uchar bsimesc_name[] = { 'b', 's', 'i', 'm', 'e', ';' };
+  const frenzy::uchar bsolsc_name[] = { 'b', 's', 'o', 'l', ';' };
+  const frenzy::uchar bsolbsc_name[] = { 'b', 's', 'o', 'l', 'b', ';' };
+  const frenzy::uchar bsolhsubsc_name[] = { 'b', 's', 'o', 'l', 'h', 's', 'u', 'b', ';' };
+  const frenzy::uchar bullsc_name[] = { 'b', 'u', 'l', 'l', ';' };
+  const frenzy::uchar bulletsc_name[] = { 'b', 'u', 'l', 'l', 'e', 't', ';' };
+  const frenzy::uchar bumpsc_name[] = { 'b', 'u', 'm', 'p', ';' };
+  const frenzy::uchar bumpEsc_name[] = { 'b', 'u', 'm', 'p', 'E', ';' };
+  const frenzy::uchar bumpesc_name[] = { 'b', 'u', 'm', 'p', 'e', ';' };
+  const frenzy::uchar bumpeqsc_name[] = { 'b', 'u', 'm', 'p', 'e', 'q', ';' };
+  const frenzy::uchar cacutesc_name[] = { 'c', 'a', 'c', 'u', 't', 'e', ';' };
+  const frenzy::uchar capsc_name[] = { 'c', 'a', 'p', ';' };
+  const frenzy::uchar capandsc_name[] = { 'c', 'a', 'p', 'a', 'n', 'd', ';' };
+  const frenzy::uchar capbrcupsc_name[] = { 'c', 'a', 'p', 'b', 'r', 'c', 'u', 'p', ';' };
+  const frenzy::uchar capcapsc_name[] = { 'c', 'a', 'p', 'c', 'a', 'p', ';' };
+  const frenzy::uchar capcupsc_name[] = { 'c', 'a', 'p', 'c', 'u', 'p', ';' };
+  const frenzy::uchar capdotsc_name[] = { 'c', 'a', 'p', 'd', 'o', 't', ';' };
+  const frenzy::uchar capssc_name[] = { 'c', 'a', 'p', 's', ';' };
+  const frenzy::uchar caretsc_name[] = { 'c', 'a', 'r', 'e', 't', ';' };
+  const frenzy::uchar caronsc_name[] = { 'c', 'a', 'r', 'o', 'n', ';' };
+  const frenzy::uchar ccapssc_name[] = { 'c', 'c', 'a', 'p', 's', ';' };
+  const frenzy::uchar ccaronsc_name[] = { 'c', 'c', 'a', 'r', 'o', 'n', ';' };
+  const frenzy::uchar ccedil_name[] = { 'c', 'c', 'e', 'd', 'i', 'l' };
+  const frenzy::uchar ccedilsc_name[] = { 'c', 'c', 'e', 'd', 'i', 'l', ';' };
+  const frenzy::uchar ccircsc_name[] = { 'c', 'c', 'i', 'r', 'c', ';' };
+  const frenzy::uchar ccupssc_name[] = { 'c', 'c', 'u', 'p', 's', ';' };
+  const frenzy::uchar ccupssmsc_name[] = { 'c', 'c', 'u', 'p', 's', 's', 'm', ';' };
+  const frenzy::uchar cdotsc_name[] = { 'c', 'd', 'o', 't', ';' };
+  const frenzy::uchar cedil_name[] = { 'c', 'e', 'd', 'i', 'l' };
+  const frenzy::uchar cedilsc_name[] = { 'c', 'e', 'd', 'i', 'l', ';' };
+  const frenzy::uchar cemptyvsc_name[] = { 'c', 'e', 'm', 'p', 't', 'y', 'v', ';' };
+  const frenzy::uchar cent_name[] = { 'c', 'e', 'n', 't' };
+  const frenzy::uchar centsc_name[] = { 'c', 'e', 'n', 't', ';' };
+  const frenzy::uchar centerdotsc_name[] = { 'c', 'e', 'n', 't', 'e', 'r', 'd', 'o', 't', ';' };
+  const frenzy::uchar cfrsc_name[] = { 'c', 'f', 'r', ';' };
+  const frenzy::uchar chcysc_name[] = { 'c', 'h', 'c', 'y', ';' };
+  const frenzy::uchar checksc_name[] = { 'c', 'h', 'e', 'c', 'k', ';' };
+  const frenzy::uchar checkmarksc_name[] = { 'c', 'h', 'e', 'c', 'k', 'm', 'a', 'r', 'k', ';' };
+  const frenzy::uchar chisc_name[] = { 'c', 'h', 'i', ';' };
+  const frenzy::uchar cirsc_name[] = { 'c', 'i', 'r', ';' };
+  const frenzy::uchar cirEsc_name[] = { 'c', 'i', 'r', 'E', ';' };
+  const frenzy::uchar circsc_name[] = { 'c', 'i', 'r', 'c', ';' };
+  const frenzy::uchar circeqsc_name[] = { 'c', 'i', 'r', 'c', 'e', 'q', ';' };
+  const frenzy::uchar circlearrowleftsc_name[] = { 'c', 'i', 'r', 'c', 'l', 'e', 'a', 'r', 'r', 'o', 'w', 'l', 'e', 'f', 't', ';' };
+  const frenzy::uchar circlearrowrightsc_name[] = { 'c', 'i', 'r', 'c', 'l', 'e', 'a', 'r', 'r', 'o', 'w', 'r', 'i', 'g', 'h', 't', ';' };
+  const frenzy::uchar circledRsc_name[] = { 'c', 'i', 'r', 'c', 'l', 'e', 'd', 'R', ';' };
+  const frenzy::uchar circledSsc_name[] = { 'c', 'i', 'r', 'c', 'l', 'e', 'd', 'S', ';' };
+  const frenzy::uchar circledastsc_name[] = { 'c', 'i', 'r', 'c', 'l', 'e', 'd', 'a', 's', 't', ';' };
+  const frenzy::uchar circledcircsc_name[] = { 'c', 'i', 'r', 'c', 'l', 'e', 'd', 'c', 'i', 'r', 'c', ';' };
+  const frenzy::uchar circleddashsc_name[] = { 'c', 'i', 'r', 'c', 'l', 'e', 'd', 'd', 'a', 's', 'h', ';' };
+  const frenzy::uchar ciresc_name[] = { 'c', 'i', 'r', 'e', ';' };
+  const frenzy::uchar cirfnintsc_name[] = { 'c', 'i', 'r', 'f', 'n', 'i', 'n', 't', ';' };
+  const frenzy::uchar cirmidsc_name[] = { 'c', 'i', 'r', 'm', 'i', 'd', ';' };
+  const frenzy::uchar cirscirsc_name[] = { 'c', 'i', 'r', 's', 'c', 'i', 'r', ';' };
+  const frenzy::uchar clubssc_name[] = { 'c', 'l', 'u', 'b', 's', ';' };
+  const frenzy::uchar clubsuitsc_name[] = { 'c', 'l', 'u', 'b', 's', 'u', 'i', 't', ';' };
+  const frenzy::uchar colonsc_name[] = { 'c', 'o', 'l', 'o', 'n', ';' };
+  const frenzy::uchar colonesc_name[] = { 'c', 'o', 'l', 'o', 'n', 'e', ';' };
+  const frenzy::uchar coloneqsc_name[] = { 'c', 'o', 'l', 'o', 'n', 'e', 'q', ';' };
+  const frenzy::uchar commasc_name[] = { 'c', 'o', 'm', 'm', 'a', ';' };
+  const frenzy::uchar commatsc_name[] = { 'c', 'o', 'm', 'm', 'a', 't', ';' };
+  const frenzy::uchar compsc_name[] = { 'c', 'o', 'm', 'p', ';' };
+  const frenzy::uchar compfnsc_name[] = { 'c', 'o', 'm', 'p', 'f', 'n', ';' };
+  const frenzy::uchar complementsc_name[] = { 'c', 'o', 'm', 'p', 'l', 'e', 'm', 'e', 'n', 't', ';' };
+  const frenzy::uchar complexessc_name[] = { 'c', 'o', 'm', 'p', 'l', 'e', 'x', 'e', 's', ';' };
+  const frenzy::uchar congsc_name[] = { 'c', 'o', 'n', 'g', ';' };
+  const frenzy::uchar congdotsc_name[] = { 'c', 'o', 'n', 'g', 'd', 'o', 't', ';' };
+  const frenzy::uchar conintsc_name[] = { 'c', 'o', 'n', 'i', 'n', 't', ';' };
+  const frenzy::uchar copfsc_name[] = { 'c', 'o', 'p', 'f', ';' };
+  const frenzy::uchar coprodsc_name[] = { 'c', 'o', 'p', 'r', 'o', 'd', ';' };
+  const frenzy::uchar copy_name[] = { 'c', 'o', 'p', 'y' };
+  const frenzy::uchar copysc_name[] = { 'c', 'o', 'p', 'y', ';' };
+  const frenzy::uchar copysrsc_name[] = { 'c', 'o', 'p', 'y', 's', 'r', ';' };
+  const frenzy::uchar crarrsc_name[] = { 'c', 'r', 'a', 'r', 'r', ';' };
+  const frenzy::uchar crosssc_name[] = { 'c', 'r', 'o', 's', 's', ';' };
+  const frenzy::uchar cscrsc_name[] = { 'c', 's', 'c', 'r', ';' };
+  const frenzy::uchar csubsc_name[] = { 'c', 's', 'u', 'b', ';' };
+  const frenzy::uchar csubesc_name[] = { 'c', 's', 'u', 'b', 'e', ';' };
+  const frenzy::uchar csupsc_name[] = { 'c', 's', 'u', 'p', ';' };
+  const frenzy::uchar csupesc_name[] = { 'c', 's', 'u', 'p', 'e', ';' };
+  const frenzy::uchar ctdotsc_name[] = { 'c', 't', 'd', 'o', 't', ';' };
+  const frenzy::uchar cudarrlsc_name[] = { 'c', 'u', 'd', 'a', 'r', 'r', 'l', ';' };
+  const frenzy::uchar cudarrrsc_name[] = { 'c', 'u', 'd', 'a', 'r', 'r', 'r', ';' };
+  const frenzy::uchar cueprsc_name[] = { 'c', 'u', 'e', 'p', 'r', ';' };
+  const frenzy::uchar cuescsc_name[] = { 'c', 'u', 'e', 's', 'c', ';' };
+  const frenzy::uchar cularrsc_name[] = { 'c', 'u', 'l', 'a', 'r', 'r', ';' };
+  const frenzy::uchar cularrpsc_name[] = { 'c', 'u', 'l', 'a', 'r', 'r', 'p', ';' };
+  const frenzy::uchar cupsc_name[] = { 'c', 'u', 'p', ';' };
+  const frenzy::uchar cupbrcapsc_name[] = { 'c', 'u', 'p', 'b', 'r', 'c', 'a', 'p', ';' };
+  const frenzy::uchar cupcapsc_name[] = { 'c', 'u', 'p', 'c', 'a', 'p', ';' };
+  const frenzy::uchar cupcupsc_name[] = { 'c', 'u', 'p', 'c', 'u', 'p', ';' };
+  const frenzy::uchar cupdotsc_name[] = { 'c', 'u', 'p', 'd', 'o', 't', ';' };
+  const frenzy::uchar cuporsc_name[] = { 'c', 'u', 'p', 'o', 'r', ';' };
+  const frenzy::uchar cupssc_name[] = { 'c', 'u', 'p', 's', ';' };
+  const frenzy::uchar curarrsc_name[] = { 'c', 'u', 'r', 'a', 'r', 'r', ';' };
+  const frenzy::uchar curarrmsc_name[] = { 'c', 'u', 'r', 'a', 'r', 'r', 'm', ';' };
+  const frenzy::uchar curlyeqprecsc_name[] = { 'c', 'u', 'r', 'l', 'y', 'e', 'q', 'p', 'r', 'e', 'c', ';' };
+  const frenzy::uchar curlyeqsuccsc_name[] = { 'c', 'u', 'r', 'l', 'y', 'e', 'q', 's', 'u', 'c', 'c', ';' };
+  const frenzy::uchar curlyveesc_name[] = { 'c', 'u', 'r', 'l', 'y', 'v', 'e', 'e', ';' };
+  const frenzy::uchar curlywedgesc_name[] = { 'c', 'u', 'r', 'l', 'y', 'w', 'e', 'd', 'g', 'e', ';' };
+  const frenzy::uchar curren_name[] = { 'c', 'u', 'r', 'r', 'e', 'n' };
+  const frenzy::uchar currensc_name[] = { 'c', 'u', 'r', 'r', 'e', 'n', ';' };
+  const frenzy::uchar curvearrowleftsc_name[] = { 'c', 'u', 'r', 'v', 'e', 'a', 'r', 'r', 'o', 'w', 'l', 'e', 'f', 't', ';' };
+  const frenzy::uchar curvearrowrightsc_name[] = { 'c', 'u', 'r', 'v', 'e', 'a', 'r', 'r', 'o', 'w', 'r', 'i', 'g', 'h', 't', ';' };
+  const frenzy::uchar cuveesc_name[] = { 'c', 'u', 'v', 'e', 'e', ';' };
+  const frenzy::uchar cuwedsc_name[] = { 'c', 'u', 'w', 'e', 'd', ';' };
+  const frenzy::uchar cwconintsc_name[] = { 'c', 'w', 'c', 'o', 'n', 'i', 'n', 't', ';' };
+  const frenzy::uchar cwintsc_name[] = { 'c', 'w', 'i', 'n', 't', ';' };
+  const frenzy::uchar cylctysc_name[] = { 'c', 'y', 'l', 'c', 't', 'y', ';' };
+  const frenzy::uchar dArrsc_name[] = { 'd', 'A', 'r', 'r', ';' };
+  const frenzy::uchar dHarsc_name[] = { 'd', 'H', 'a', 'r', ';' };
+  const frenzy::uchar daggersc_name[] = { 'd', 'a', 'g', 'g', 'e', 'r', ';' };
+  const frenzy::uchar dalethsc_name[] = { 'd', 'a', 'l', 'e', 't', 'h', ';' };
+  const frenzy::uchar darrsc_name[] = { 'd', 'a', 'r', 'r', ';' };
+  const frenzy::uchar dashsc_name[] = { 'd', 'a', 's', 'h', ';' };
+  const frenzy::uchar dashvsc_name[] = { 'd', 'a', 's', 'h', 'v', ';' };
+  const frenzy::uchar dbkarowsc_name[] = { 'd', 'b', 'k', 'a', 'r', 'o', 'w', ';' };
+  const frenzy::uchar dblacsc_name[] = { 'd', 'b', 'l', 'a', 'c', ';' };
+  const frenzy::uchar dcaronsc_name[] = { 'd', 'c', 'a', 'r', 'o', 'n', ';' };
+  const frenzy::uchar dcysc_name[] = { 'd', 'c', 'y', ';' };
+  const frenzy::uchar ddsc_name[] = { 'd', 'd', ';' };
+  const frenzy::uchar ddaggersc_name[] = { 'd', 'd', 'a', 'g', 'g', 'e', 'r', ';' };
+  const frenzy::uchar ddarrsc_name[] = { 'd', 'd', 'a', 'r', 'r', ';' };
+  const frenzy::uchar ddotseqsc_name[] = { 'd', 'd', 'o', 't', 's', 'e', 'q', ';' };
+  const frenzy::uchar deg_name[] = { 'd', 'e', 'g' };
+  const frenzy::uchar degsc_name[] = { 'd', 'e', 'g', ';' };
+  const frenzy::uchar deltasc_name[] = { 'd', 'e', 'l', 't', 'a', ';' };
+  const frenzy::uchar demptyvsc_name[] = { 'd', 'e', 'm', 'p', 't', 'y', 'v', ';' };
+  const frenzy::uchar dfishtsc_name[] = { 'd', 'f', 'i', 's', 'h', 't', ';' };
+  const frenzy::uchar dfrsc_name[] = { 'd', 'f', 'r', ';' };
+  const frenzy::uchar dharlsc_name[] = { 'd', 'h', 'a', 'r', 'l', ';' };
+  const frenzy::uchar dharrsc_name[] = { 'd', 'h', 'a', 'r', 'r', ';' };
+  const frenzy::uchar diamsc_name[] = { 'd', 'i', 'a', 'm', ';' };
+  const frenzy::uchar diamondsc_name[] = { 'd', 'i', 'a', 'm', 'o', 'n', 'd', ';' };
+  const frenzy::uchar diamondsuitsc_name[] = { 'd', 'i', 'a', 'm', 'o', 'n', 'd', 's', 'u', 'i', 't', ';' };
+  const frenzy::uchar diamssc_name[] = { 'd', 'i', 'a', 'm', 's', ';' };
+  const frenzy::uchar diesc_name[] = { 'd', 'i', 'e', ';' };
+  const frenzy::uchar digammasc_name[] = { 'd', 'i', 'g', 'a', 'm', 'm', 'a', ';' };
+  const frenzy::uchar disinsc_name[] = { 'd', 'i', 's', 'i', 'n', ';' };
+  const frenzy::uchar divsc_name[] = { 'd', 'i', 'v', ';' };
+  const frenzy::uchar divide_name[] = { 'd', 'i', 'v', 'i', 'd', 'e' };
+  const frenzy::uchar dividesc_name[] = { 'd', 'i', 'v', 'i', 'd', 'e', ';' };
+  const frenzy::uchar divideontimessc_name[] = { 'd', 'i', 'v', 'i', 'd', 'e', 'o', 'n', 't', 'i', 'm', 'e', 's', ';' };
+  const frenzy::uchar divonxsc_name[] = { 'd', 'i', 'v', 'o', 'n', 'x', ';' };
+  const frenzy::uchar djcysc_name[] = { 'd', 'j', 'c', 'y', ';' };
+  const frenzy::uchar dlcornsc_name[] = { 'd', 'l', 'c', 'o', 'r', 'n', ';' };
+  const frenzy::uchar dlcropsc_name[] = { 'd', 'l', 'c', 'r', 'o', 'p', ';' };
+  const frenzy::uchar dollarsc_name[] = { 'd', 'o', 'l', 'l', 'a', 'r', ';' };
+  const frenzy::uchar dopfsc_name[] = { 'd', 'o', 'p', 'f', ';' };
+  const frenzy::uchar dotsc_name[] = { 'd', 'o', 't', ';' };
+  const frenzy::uchar doteqsc_name[] = { 'd', 'o', 't', 'e', 'q', ';' };
+  const frenzy::uchar doteqdotsc_name[] = { 'd', 'o', 't', 'e', 'q', 'd', 'o', 't', ';' };
+  const frenzy::uchar dotminussc_name[] = { 'd', 'o', 't', 'm', 'i', 'n', 'u', 's', ';' };
+  const frenzy::uchar dotplussc_name[] = { 'd', 'o', 't', 'p', 'l', 'u', 's', ';' };
+  const frenzy::uchar dotsquaresc_name[] = { 'd', 'o', 't', 's', 'q', 'u', 'a', 'r', 'e', ';' };
+  const frenzy::uchar doublebarwedgesc_name[] = { 'd', 'o', 'u', 'b', 'l', 'e', 'b', 'a', 'r', 'w', 'e', 'd', 'g', 'e', ';' };
+  const frenzy::uchar downarrowsc_name[] = { 'd', 'o', 'w', 'n', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar downdownarrowssc_name[] = { 'd', 'o', 'w', 'n', 'd', 'o', 'w', 'n', 'a', 'r', 'r', 'o', 'w', 's', ';' };
+  const frenzy::uchar downharpoonleftsc_name[] = { 'd', 'o', 'w', 'n', 'h', 'a', 'r', 'p', 'o', 'o', 'n', 'l', 'e', 'f', 't', ';' };
+  const frenzy::uchar downharpoonrightsc_name[] = { 'd', 'o', 'w', 'n', 'h', 'a', 'r', 'p', 'o', 'o', 'n', 'r', 'i', 'g', 'h', 't', ';' };
+  const frenzy::uchar drbkarowsc_name[] = { 'd', 'r', 'b', 'k', 'a', 'r', 'o', 'w', ';' };
+  const frenzy::uchar drcornsc_name[] = { 'd', 'r', 'c', 'o', 'r', 'n', ';' };
+  const frenzy::uchar drcropsc_name[] = { 'd', 'r', 'c', 'r', 'o', 'p', ';' };
+  const frenzy::uchar dscrsc_name[] = { 'd', 's', 'c', 'r', ';' };
+  const frenzy::uchar dscysc_name[] = { 'd', 's', 'c', 'y', ';' };
+  const frenzy::uchar dsolsc_name[] = { 'd', 's', 'o', 'l', ';' };
+  const frenzy::uchar dstroksc_name[] = { 'd', 's', 't', 'r', 'o', 'k', ';' };
+  const frenzy::uchar dtdotsc_name[] = { 'd', 't', 'd', 'o', 't', ';' };
+  const frenzy::uchar dtrisc_name[] = { 'd', 't', 'r', 'i', ';' };
+  const frenzy::uchar dtrifsc_name[] = { 'd', 't', 'r', 'i', 'f', ';' };
+  const frenzy::uchar duarrsc_name[] = { 'd', 'u', 'a', 'r', 'r', ';' };
+  const frenzy::uchar duharsc_name[] = { 'd', 'u', 'h', 'a', 'r', ';' };
+  const frenzy::uchar dwanglesc_name[] = { 'd', 'w', 'a', 'n', 'g', 'l', 'e', ';' };
+  const frenzy::uchar dzcysc_name[] = { 'd', 'z', 'c', 'y', ';' };
+  const frenzy::uchar dzigrarrsc_name[] = { 'd', 'z', 'i', 'g', 'r', 'a', 'r', 'r', ';' };
+  const frenzy::uchar eDDotsc_name[] = { 'e', 'D', 'D', 'o', 't', ';' };
+  const frenzy::uchar eDotsc_name[] = { 'e', 'D', 'o', 't', ';' };
+  const frenzy::uchar eacute_name[] = { 'e', 'a', 'c', 'u', 't', 'e' };
+  const frenzy::uchar eacutesc_name[] = { 'e', 'a', 'c', 'u', 't', 'e', ';' };
+  const frenzy::uchar eastersc_name[] = { 'e', 'a', 's', 't', 'e', 'r', ';' };
+  const frenzy::uchar ecaronsc_name[] = { 'e', 'c', 'a', 'r', 'o', 'n', ';' };
+  const frenzy::uchar ecirsc_name[] = { 'e', 'c', 'i', 'r', ';' };
+  const frenzy::uchar ecirc_name[] = { 'e', 'c', 'i', 'r', 'c' };
+  const frenzy::uchar ecircsc_name[] = { 'e', 'c', 'i', 'r', 'c', ';' };
+  const frenzy::uchar ecolonsc_name[] = { 'e', 'c', 'o', 'l', 'o', 'n', ';' };
+  const frenzy::uchar ecysc_name[] = { 'e', 'c', 'y', ';' };
+  const frenzy::uchar edotsc_name[] = { 'e', 'd', 'o', 't', ';' };
+  const frenzy::uchar eesc_name[] = { 'e', 'e', ';' };
+  const frenzy::uchar efDotsc_name[] = { 'e', 'f', 'D', 'o', 't', ';' };
+  const frenzy::uchar efrsc_name[] = { 'e', 'f', 'r', ';' };
+  const frenzy::uchar egsc_name[] = { 'e', 'g', ';' };
+  const frenzy::uchar egrave_name[] = { 'e', 'g', 'r', 'a', 'v', 'e' };
+  const frenzy::uchar egravesc_name[] = { 'e', 'g', 'r', 'a', 'v', 'e', ';' };
+  const frenzy::uchar egssc_name[] = { 'e', 'g', 's', ';' };
+  const frenzy::uchar egsdotsc_name[] = { 'e', 'g', 's', 'd', 'o', 't', ';' };
+  const frenzy::uchar elsc_name[] = { 'e', 'l', ';' };
+  const frenzy::uchar elinterssc_name[] = { 'e', 'l', 'i', 'n', 't', 'e', 'r', 's', ';' };
+  const frenzy::uchar ellsc_name[] = { 'e', 'l', 'l', ';' };
+  const frenzy::uchar elssc_name[] = { 'e', 'l', 's', ';' };
+  const frenzy::uchar elsdotsc_name[] = { 'e', 'l', 's', 'd', 'o', 't', ';' };
+  const frenzy::uchar emacrsc_name[] = { 'e', 'm', 'a', 'c', 'r', ';' };
+  const frenzy::uchar emptysc_name[] = { 'e', 'm', 'p', 't', 'y', ';' };
+  const frenzy::uchar emptysetsc_name[] = { 'e', 'm', 'p', 't', 'y', 's', 'e', 't', ';' };
+  const frenzy::uchar emptyvsc_name[] = { 'e', 'm', 'p', 't', 'y', 'v', ';' };
+  const frenzy::uchar emsp13sc_name[] = { 'e', 'm', 's', 'p', '1', '3', ';' };
+  const frenzy::uchar emsp14sc_name[] = { 'e', 'm', 's', 'p', '1', '4', ';' };
+  const frenzy::uchar emspsc_name[] = { 'e', 'm', 's', 'p', ';' };
+  const frenzy::uchar engsc_name[] = { 'e', 'n', 'g', ';' };
+  const frenzy::uchar enspsc_name[] = { 'e', 'n', 's', 'p', ';' };
+  const frenzy::uchar eogonsc_name[] = { 'e', 'o', 'g', 'o', 'n', ';' };
+  const frenzy::uchar eopfsc_name[] = { 'e', 'o', 'p', 'f', ';' };
+  const frenzy::uchar eparsc_name[] = { 'e', 'p', 'a', 'r', ';' };
+  const frenzy::uchar eparslsc_name[] = { 'e', 'p', 'a', 'r', 's', 'l', ';' };
+  const frenzy::uchar eplussc_name[] = { 'e', 'p', 'l', 'u', 's', ';' };
+  const frenzy::uchar epsisc_name[] = { 'e', 'p', 's', 'i', ';' };
+  const frenzy::uchar epsilonsc_name[] = { 'e', 'p', 's', 'i', 'l', 'o', 'n', ';' };
+  const frenzy::uchar epsivsc_name[] = { 'e', 'p', 's', 'i', 'v', ';' };
+  const frenzy::uchar eqcircsc_name[] = { 'e', 'q', 'c', 'i', 'r', 'c', ';' };
+  const frenzy::uchar eqcolonsc_name[] = { 'e', 'q', 'c', 'o', 'l', 'o', 'n', ';' };
+  const frenzy::uchar eqsimsc_name[] = { 'e', 'q', 's', 'i', 'm', ';' };
+  const frenzy::uchar eqslantgtrsc_name[] = { 'e', 'q', 's', 'l', 'a', 'n', 't', 'g', 't', 'r', ';' };
+  const frenzy::uchar eqslantlesssc_name[] = { 'e', 'q', 's', 'l', 'a', 'n', 't', 'l', 'e', 's', 's', ';' };
+  const frenzy::uchar equalssc_name[] = { 'e', 'q', 'u', 'a', 'l', 's', ';' };
+  const frenzy::uchar equestsc_name[] = { 'e', 'q', 'u', 'e', 's', 't', ';' };
+  const frenzy::uchar equivsc_name[] = { 'e', 'q', 'u', 'i', 'v', ';' };
+  const frenzy::uchar equivDDsc_name[] = { 'e', 'q', 'u', 'i', 'v', 'D', 'D', ';' };
+  const frenzy::uchar eqvparslsc_name[] = { 'e', 'q', 'v', 'p', 'a', 'r', 's', 'l', ';' };
+  const frenzy::uchar erDotsc_name[] = { 'e', 'r', 'D', 'o', 't', ';' };
+  const frenzy::uchar erarrsc_name[] = { 'e', 'r', 'a', 'r', 'r', ';' };
+  const frenzy::uchar escrsc_name[] = { 'e', 's', 'c', 'r', ';' };
+  const frenzy::uchar esdotsc_name[] = { 'e', 's', 'd', 'o', 't', ';' };
+  const frenzy::uchar esimsc_name[] = { 'e', 's', 'i', 'm', ';' };
+  const frenzy::uchar etasc_name[] = { 'e', 't', 'a', ';' };
+  const frenzy::uchar eth_name[] = { 'e', 't', 'h' };
+  const frenzy::uchar ethsc_name[] = { 'e', 't', 'h', ';' };
+  const frenzy::uchar euml_name[] = { 'e', 'u', 'm', 'l' };
+  const frenzy::uchar eumlsc_name[] = { 'e', 'u', 'm', 'l', ';' };
+  const frenzy::uchar eurosc_name[] = { 'e', 'u', 'r', 'o', ';' };
+  const frenzy::uchar exclsc_name[] = { 'e', 'x', 'c', 'l', ';' };
+  const frenzy::uchar existsc_name[] = { 'e', 'x', 'i', 's', 't', ';' };
+  const frenzy::uchar expectationsc_name[] = { 'e', 'x', 'p', 'e', 'c', 't', 'a', 't', 'i', 'o', 'n', ';' };
+  const frenzy::uchar exponentialesc_name[] = { 'e', 'x', 'p', 'o', 'n', 'e', 'n', 't', 'i', 'a', 'l', 'e', ';' };
+  const frenzy::uchar fallingdotseqsc_name[] = { 'f', 'a', 'l', 'l', 'i', 'n', 'g', 'd', 'o', 't', 's', 'e', 'q', ';' };
+  const frenzy::uchar fcysc_name[] = { 'f', 'c', 'y', ';' };
+  const frenzy::uchar femalesc_name[] = { 'f', 'e', 'm', 'a', 'l', 'e', ';' };
+  const frenzy::uchar ffiligsc_name[] = { 'f', 'f', 'i', 'l', 'i', 'g', ';' };
+  const frenzy::uchar ffligsc_name[] = { 'f', 'f', 'l', 'i', 'g', ';' };
+  const frenzy::uchar fflligsc_name[] = { 'f', 'f', 'l', 'l', 'i', 'g', ';' };
+  const frenzy::uchar ffrsc_name[] = { 'f', 'f', 'r', ';' };
+  const frenzy::uchar filigsc_name[] = { 'f', 'i', 'l', 'i', 'g', ';' };
+  const frenzy::uchar fjligsc_name[] = { 'f', 'j', 'l', 'i', 'g', ';' };
+  const frenzy::uchar flatsc_name[] = { 'f', 'l', 'a', 't', ';' };
+  const frenzy::uchar flligsc_name[] = { 'f', 'l', 'l', 'i', 'g', ';' };
+  const frenzy::uchar fltnssc_name[] = { 'f', 'l', 't', 'n', 's', ';' };
+  const frenzy::uchar fnofsc_name[] = { 'f', 'n', 'o', 'f', ';' };
+  const frenzy::uchar fopfsc_name[] = { 'f', 'o', 'p', 'f', ';' };
+  const frenzy::uchar forallsc_name[] = { 'f', 'o', 'r', 'a', 'l', 'l', ';' };
+  const frenzy::uchar forksc_name[] = { 'f', 'o', 'r', 'k', ';' };
+  const frenzy::uchar forkvsc_name[] = { 'f', 'o', 'r', 'k', 'v', ';' };
+  const frenzy::uchar fpartintsc_name[] = { 'f', 'p', 'a', 'r', 't', 'i', 'n', 't', ';' };
+  const frenzy::uchar frac12_name[] = { 'f', 'r', 'a', 'c', '1', '2' };
+  const frenzy::uchar frac12sc_name[] = { 'f', 'r', 'a', 'c', '1', '2', ';' };
+  const frenzy::uchar frac13sc_name[] = { 'f', 'r', 'a', 'c', '1', '3', ';' };
+  const frenzy::uchar frac14_name[] = { 'f', 'r', 'a', 'c', '1', '4' };
+  const frenzy::uchar frac14sc_name[] = { 'f', 'r', 'a', 'c', '1', '4', ';' };
+  const frenzy::uchar frac15sc_name[] = { 'f', 'r', 'a', 'c', '1', '5', ';' };
+  const frenzy::uchar frac16sc_name[] = { 'f', 'r', 'a', 'c', '1', '6', ';' };
+  const frenzy::uchar frac18sc_name[] = { 'f', 'r', 'a', 'c', '1', '8', ';' };
+  const frenzy::uchar frac23sc_name[] = { 'f', 'r', 'a', 'c', '2', '3', ';' };
+  const frenzy::uchar frac25sc_name[] = { 'f', 'r', 'a', 'c', '2', '5', ';' };
+  const frenzy::uchar frac34_name[] = { 'f', 'r', 'a', 'c', '3', '4' };
+  const frenzy::uchar frac34sc_name[] = { 'f', 'r', 'a', 'c', '3', '4', ';' };
+  const frenzy::uchar frac35sc_name[] = { 'f', 'r', 'a', 'c', '3', '5', ';' };
+  const frenzy::uchar frac38sc_name[] = { 'f', 'r', 'a', 'c', '3', '8', ';' };
+  const frenzy::uchar frac45sc_name[] = { 'f', 'r', 'a', 'c', '4', '5', ';' };
+  const frenzy::uchar frac56sc_name[] = { 'f', 'r', 'a', 'c', '5', '6', ';' };
+  const frenzy::uchar frac58sc_name[] = { 'f', 'r', 'a', 'c', '5', '8', ';' };
+  const frenzy::uchar frac78sc_name[] = { 'f', 'r', 'a', 'c', '7', '8', ';' };
+  const frenzy::uchar fraslsc_name[] = { 'f', 'r', 'a', 's', 'l', ';' };
+  const frenzy::uchar frownsc_name[] = { 'f', 'r', 'o', 'w', 'n', ';' };
+  const frenzy::uchar fscrsc_name[] = { 'f', 's', 'c', 'r', ';' };
+  const frenzy::uchar gEsc_name[] = { 'g', 'E', ';' };
+  const frenzy::uchar gElsc_name[] = { 'g', 'E', 'l', ';' };
+  const frenzy::uchar gacutesc_name[] = { 'g', 'a', 'c', 'u', 't', 'e', ';' };
+  const frenzy::uchar gammasc_name[] = { 'g', 'a', 'm', 'm', 'a', ';' };
+  const frenzy::uchar gammadsc_name[] = { 'g', 'a', 'm', 'm', 'a', 'd', ';' };
+  const frenzy::uchar gapsc_name[] = { 'g', 'a', 'p', ';' };
+  const frenzy::uchar gbrevesc_name[] = { 'g', 'b', 'r', 'e', 'v', 'e', ';' };
+  const frenzy::uchar gcircsc_name[] = { 'g', 'c', 'i', 'r', 'c', ';' };
+  const frenzy::uchar gcysc_name[] = { 'g', 'c', 'y', ';' };
+  const frenzy::uchar gdotsc_name[] = { 'g', 'd', 'o', 't', ';' };
+  const frenzy::uchar gesc_name[] = { 'g', 'e', ';' };
+  const frenzy::uchar gelsc_name[] = { 'g', 'e', 'l', ';' };
+  const frenzy::uchar geqsc_name[] = { 'g', 'e', 'q', ';' };
+  const frenzy::uchar geqqsc_name[] = { 'g', 'e', 'q', 'q', ';' };
+  const frenzy::uchar geqslantsc_name[] = { 'g', 'e', 'q', 's', 'l', 'a', 'n', 't', ';' };
+  const frenzy::uchar gessc_name[] = { 'g', 'e', 's', ';' };
+  const frenzy::uchar gesccsc_name[] = { 'g', 'e', 's', 'c', 'c', ';' };
+  const frenzy::uchar gesdotsc_name[] = { 'g', 'e', 's', 'd', 'o', 't', ';' };
+  const frenzy::uchar gesdotosc_name[] = { 'g', 'e', 's', 'd', 'o', 't', 'o', ';' };
+  const frenzy::uchar gesdotolsc_name[] = { 'g', 'e', 's', 'd', 'o', 't', 'o', 'l', ';' };
+  const frenzy::uchar geslsc_name[] = { 'g', 'e', 's', 'l', ';' };
+  const frenzy::uchar geslessc_name[] = { 'g', 'e', 's', 'l', 'e', 's', ';' };
+  const frenzy::uchar gfrsc_name[] = { 'g', 'f', 'r', ';' };
+  const frenzy::uchar ggsc_name[] = { 'g', 'g', ';' };
+  const frenzy::uchar gggsc_name[] = { 'g', 'g', 'g', ';' };
+  const frenzy::uchar gimelsc_name[] = { 'g', 'i', 'm', 'e', 'l', ';' };
+  const frenzy::uchar gjcysc_name[] = { 'g', 'j', 'c', 'y', ';' };
+  const frenzy::uchar glsc_name[] = { 'g', 'l', ';' };
+  const frenzy::uchar glEsc_name[] = { 'g', 'l', 'E', ';' };
+  const frenzy::uchar glasc_name[] = { 'g', 'l', 'a', ';' };
+  const frenzy::uchar gljsc_name[] = { 'g', 'l', 'j', ';' };
+  const frenzy::uchar gnEsc_name[] = { 'g', 'n', 'E', ';' };
+  const frenzy::uchar gnapsc_name[] = { 'g', 'n', 'a', 'p', ';' };
+  const frenzy::uchar gnapproxsc_name[] = { 'g', 'n', 'a', 'p', 'p', 'r', 'o', 'x', ';' };
+  const frenzy::uchar gnesc_name[] = { 'g', 'n', 'e', ';' };
+  const frenzy::uchar gneqsc_name[] = { 'g', 'n', 'e', 'q', ';' };
+  const frenzy::uchar gneqqsc_name[] = { 'g', 'n', 'e', 'q', 'q', ';' };
+  const frenzy::uchar gnsimsc_name[] = { 'g', 'n', 's', 'i', 'm', ';' };
+  const frenzy::uchar gopfsc_name[] = { 'g', 'o', 'p', 'f', ';' };
+  const frenzy::uchar gravesc_name[] = { 'g', 'r', 'a', 'v', 'e', ';' };
+  const frenzy::uchar gscrsc_name[] = { 'g', 's', 'c', 'r', ';' };
+  const frenzy::uchar gsimsc_name[] = { 'g', 's', 'i', 'm', ';' };
+  const frenzy::uchar gsimesc_name[] = { 'g', 's', 'i', 'm', 'e', ';' };
+  const frenzy::uchar gsimlsc_name[] = { 'g', 's', 'i', 'm', 'l', ';' };
+  const frenzy::uchar gt_name[] = { 'g', 't' };
+  const frenzy::uchar gtsc_name[] = { 'g', 't', ';' };
+  const frenzy::uchar gtccsc_name[] = { 'g', 't', 'c', 'c', ';' };
+  const frenzy::uchar gtcirsc_name[] = { 'g', 't', 'c', 'i', 'r', ';' };
+  const frenzy::uchar gtdotsc_name[] = { 'g', 't', 'd', 'o', 't', ';' };
+  const frenzy::uchar gtlParsc_name[] = { 'g', 't', 'l', 'P', 'a', 'r', ';' };
+  const frenzy::uchar gtquestsc_name[] = { 'g', 't', 'q', 'u', 'e', 's', 't', ';' };
+  const frenzy::uchar gtrapproxsc_name[] = { 'g', 't', 'r', 'a', 'p', 'p', 'r', 'o', 'x', ';' };
+  const frenzy::uchar gtrarrsc_name[] = { 'g', 't', 'r', 'a', 'r', 'r', ';' };
+  const frenzy::uchar gtrdotsc_name[] = { 'g', 't', 'r', 'd', 'o', 't', ';' };
+  const frenzy::uchar gtreqlesssc_name[] = { 'g', 't', 'r', 'e', 'q', 'l', 'e', 's', 's', ';' };
+  const frenzy::uchar gtreqqlesssc_name[] = { 'g', 't', 'r', 'e', 'q', 'q', 'l', 'e', 's', 's', ';' };
+  const frenzy::uchar gtrlesssc_name[] = { 'g', 't', 'r', 'l', 'e', 's', 's', ';' };
+  const frenzy::uchar gtrsimsc_name[] = { 'g', 't', 'r', 's', 'i', 'm', ';' };
+  const frenzy::uchar gvertneqqsc_name[] = { 'g', 'v', 'e', 'r', 't', 'n', 'e', 'q', 'q', ';' };
+  const frenzy::uchar gvnEsc_name[] = { 'g', 'v', 'n', 'E', ';' };
+  const frenzy::uchar hArrsc_name[] = { 'h', 'A', 'r', 'r', ';' };
+  const frenzy::uchar hairspsc_name[] = { 'h', 'a', 'i', 'r', 's', 'p', ';' };
+  const frenzy::uchar halfsc_name[] = { 'h', 'a', 'l', 'f', ';' };
+  const frenzy::uchar hamiltsc_name[] = { 'h', 'a', 'm', 'i', 'l', 't', ';' };
+  const frenzy::uchar hardcysc_name[] = { 'h', 'a', 'r', 'd', 'c', 'y', ';' };
+  const frenzy::uchar harrsc_name[] = { 'h', 'a', 'r', 'r', ';' };
+  const frenzy::uchar harrcirsc_name[] = { 'h', 'a', 'r', 'r', 'c', 'i', 'r', ';' };
+  const frenzy::uchar harrwsc_name[] = { 'h', 'a', 'r', 'r', 'w', ';' };
+  const frenzy::uchar hbarsc_name[] = { 'h', 'b', 'a', 'r', ';' };
+  const frenzy::uchar hcircsc_name[] = { 'h', 'c', 'i', 'r', 'c', ';' };
+  const frenzy::uchar heartssc_name[] = { 'h', 'e', 'a', 'r', 't', 's', ';' };
+  const frenzy::uchar heartsuitsc_name[] = { 'h', 'e', 'a', 'r', 't', 's', 'u', 'i', 't', ';' };
+  const frenzy::uchar hellipsc_name[] = { 'h', 'e', 'l', 'l', 'i', 'p', ';' };
+  const frenzy::uchar herconsc_name[] = { 'h', 'e', 'r', 'c', 'o', 'n', ';' };
+  const frenzy::uchar hfrsc_name[] = { 'h', 'f', 'r', ';' };
+  const frenzy::uchar hksearowsc_name[] = { 'h', 'k', 's', 'e', 'a', 'r', 'o', 'w', ';' };
+  const frenzy::uchar hkswarowsc_name[] = { 'h', 'k', 's', 'w', 'a', 'r', 'o', 'w', ';' };
+  const frenzy::uchar hoarrsc_name[] = { 'h', 'o', 'a', 'r', 'r', ';' };
+  const frenzy::uchar homthtsc_name[] = { 'h', 'o', 'm', 't', 'h', 't', ';' };
+  const frenzy::uchar hookleftarrowsc_name[] = { 'h', 'o', 'o', 'k', 'l', 'e', 'f', 't', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar hookrightarrowsc_name[] = { 'h', 'o', 'o', 'k', 'r', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar hopfsc_name[] = { 'h', 'o', 'p', 'f', ';' };
+  const frenzy::uchar horbarsc_name[] = { 'h', 'o', 'r', 'b', 'a', 'r', ';' };
+  const frenzy::uchar hscrsc_name[] = { 'h', 's', 'c', 'r', ';' };
+  const frenzy::uchar hslashsc_name[] = { 'h', 's', 'l', 'a', 's', 'h', ';' };
+  const frenzy::uchar hstroksc_name[] = { 'h', 's', 't', 'r', 'o', 'k', ';' };
+  const frenzy::uchar hybullsc_name[] = { 'h', 'y', 'b', 'u', 'l', 'l', ';' };
+  const frenzy::uchar hyphensc_name[] = { 'h', 'y', 'p', 'h', 'e', 'n', ';' };
+  const frenzy::uchar iacute_name[] = { 'i', 'a', 'c', 'u', 't', 'e' };
+  const frenzy::uchar iacutesc_name[] = { 'i', 'a', 'c', 'u', 't', 'e', ';' };
+  const frenzy::uchar icsc_name[] = { 'i', 'c', ';' };
+  const frenzy::uchar icirc_name[] = { 'i', 'c', 'i', 'r', 'c' };
+  const frenzy::uchar icircsc_name[] = { 'i', 'c', 'i', 'r', 'c', ';' };
+  const frenzy::uchar icysc_name[] = { 'i', 'c', 'y', ';' };
+  const frenzy::uchar iecysc_name[] = { 'i', 'e', 'c', 'y', ';' };
+  const frenzy::uchar iexcl_name[] = { 'i', 'e', 'x', 'c', 'l' };
+  const frenzy::uchar iexclsc_name[] = { 'i', 'e', 'x', 'c', 'l', ';' };
+  const frenzy::uchar iffsc_name[] = { 'i', 'f', 'f', ';' };
+  const frenzy::uchar ifrsc_name[] = { 'i', 'f', 'r', ';' };
+  const frenzy::uchar igrave_name[] = { 'i', 'g', 'r', 'a', 'v', 'e' };
+  const frenzy::uchar igravesc_name[] = { 'i', 'g', 'r', 'a', 'v', 'e', ';' };
+  const frenzy::uchar iisc_name[] = { 'i', 'i', ';' };
+  const frenzy::uchar iiiintsc_name[] = { 'i', 'i', 'i', 'i', 'n', 't', ';' };
+  const frenzy::uchar iiintsc_name[] = { 'i', 'i', 'i', 'n', 't', ';' };
+  const frenzy::uchar iinfinsc_name[] = { 'i', 'i', 'n', 'f', 'i', 'n', ';' };
+  const frenzy::uchar iiotasc_name[] = { 'i', 'i', 'o', 't', 'a', ';' };
+  const frenzy::uchar ijligsc_name[] = { 'i', 'j', 'l', 'i', 'g', ';' };
+  const frenzy::uchar imacrsc_name[] = { 'i', 'm', 'a', 'c', 'r', ';' };
+  const frenzy::uchar imagesc_name[] = { 'i', 'm', 'a', 'g', 'e', ';' };
+  const frenzy::uchar imaglinesc_name[] = { 'i', 'm', 'a', 'g', 'l', 'i', 'n', 'e', ';' };
+  const frenzy::uchar imagpartsc_name[] = { 'i', 'm', 'a', 'g', 'p', 'a', 'r', 't', ';' };
+  const frenzy::uchar imathsc_name[] = { 'i', 'm', 'a', 't', 'h', ';' };
+  const frenzy::uchar imofsc_name[] = { 'i', 'm', 'o', 'f', ';' };
+  const frenzy::uchar impedsc_name[] = { 'i', 'm', 'p', 'e', 'd', ';' };
+  const frenzy::uchar insc_name[] = { 'i', 'n', ';' };
+  const frenzy::uchar incaresc_name[] = { 'i', 'n', 'c', 'a', 'r', 'e', ';' };
+  const frenzy::uchar infinsc_name[] = { 'i', 'n', 'f', 'i', 'n', ';' };
+  const frenzy::uchar infintiesc_name[] = { 'i', 'n', 'f', 'i', 'n', 't', 'i', 'e', ';' };
+  const frenzy::uchar inodotsc_name[] = { 'i', 'n', 'o', 'd', 'o', 't', ';' };
+  const frenzy::uchar intsc_name[] = { 'i', 'n', 't', ';' };
+  const frenzy::uchar intcalsc_name[] = { 'i', 'n', 't', 'c', 'a', 'l', ';' };
+  const frenzy::uchar integerssc_name[] = { 'i', 'n', 't', 'e', 'g', 'e', 'r', 's', ';' };
+  const frenzy::uchar intercalsc_name[] = { 'i', 'n', 't', 'e', 'r', 'c', 'a', 'l', ';' };
+  const frenzy::uchar intlarhksc_name[] = { 'i', 'n', 't', 'l', 'a', 'r', 'h', 'k', ';' };
+  const frenzy::uchar intprodsc_name[] = { 'i', 'n', 't', 'p', 'r', 'o', 'd', ';' };
+  const frenzy::uchar iocysc_name[] = { 'i', 'o', 'c', 'y', ';' };
+  const frenzy::uchar iogonsc_name[] = { 'i', 'o', 'g', 'o', 'n', ';' };
+  const frenzy::uchar iopfsc_name[] = { 'i', 'o', 'p', 'f', ';' };
+  const frenzy::uchar iotasc_name[] = { 'i', 'o', 't', 'a', ';' };
+  const frenzy::uchar iprodsc_name[] = { 'i', 'p', 'r', 'o', 'd', ';' };
+  const frenzy::uchar iquest_name[] = { 'i', 'q', 'u', 'e', 's', 't' };
+  const frenzy::uchar iquestsc_name[] = { 'i', 'q', 'u', 'e', 's', 't', ';' };
+  const frenzy::uchar iscrsc_name[] = { 'i', 's', 'c', 'r', ';' };
+  const frenzy::uchar isinsc_name[] = { 'i', 's', 'i', 'n', ';' };
+  const frenzy::uchar isinEsc_name[] = { 'i', 's', 'i', 'n', 'E', ';' };
+  const frenzy::uchar isindotsc_name[] = { 'i', 's', 'i', 'n', 'd', 'o', 't', ';' };
+  const frenzy::uchar isinssc_name[] = { 'i', 's', 'i', 'n', 's', ';' };
+  const frenzy::uchar isinsvsc_name[] = { 'i', 's', 'i', 'n', 's', 'v', ';' };
+  const frenzy::uchar isinvsc_name[] = { 'i', 's', 'i', 'n', 'v', ';' };
+  const frenzy::uchar itsc_name[] = { 'i', 't', ';' };
+  const frenzy::uchar itildesc_name[] = { 'i', 't', 'i', 'l', 'd', 'e', ';' };
+  const frenzy::uchar iukcysc_name[] = { 'i', 'u', 'k', 'c', 'y', ';' };
+  const frenzy::uchar iuml_name[] = { 'i', 'u', 'm', 'l' };
+  const frenzy::uchar iumlsc_name[] = { 'i', 'u', 'm', 'l', ';' };
+  const frenzy::uchar jcircsc_name[] = { 'j', 'c', 'i', 'r', 'c', ';' };
+  const frenzy::uchar jcysc_name[] = { 'j', 'c', 'y', ';' };
+  const frenzy::uchar jfrsc_name[] = { 'j', 'f', 'r', ';' };
+  const frenzy::uchar jmathsc_name[] = { 'j', 'm', 'a', 't', 'h', ';' };
+  const frenzy::uchar jopfsc_name[] = { 'j', 'o', 'p', 'f', ';' };
+  const frenzy::uchar jscrsc_name[] = { 'j', 's', 'c', 'r', ';' };
+  const frenzy::uchar jsercysc_name[] = { 'j', 's', 'e', 'r', 'c', 'y', ';' };
+  const frenzy::uchar jukcysc_name[] = { 'j', 'u', 'k', 'c', 'y', ';' };
+  const frenzy::uchar kappasc_name[] = { 'k', 'a', 'p', 'p', 'a', ';' };
+  const frenzy::uchar kappavsc_name[] = { 'k', 'a', 'p', 'p', 'a', 'v', ';' };
+  const frenzy::uchar kcedilsc_name[] = { 'k', 'c', 'e', 'd', 'i', 'l', ';' };
+  const frenzy::uchar kcysc_name[] = { 'k', 'c', 'y', ';' };
+  const frenzy::uchar kfrsc_name[] = { 'k', 'f', 'r', ';' };
+  const frenzy::uchar kgreensc_name[] = { 'k', 'g', 'r', 'e', 'e', 'n', ';' };
+  const frenzy::uchar khcysc_name[] = { 'k', 'h', 'c', 'y', ';' };
+  const frenzy::uchar kjcysc_name[] = { 'k', 'j', 'c', 'y', ';' };
+  const frenzy::uchar kopfsc_name[] = { 'k', 'o', 'p', 'f', ';' };
+  const frenzy::uchar kscrsc_name[] = { 'k', 's', 'c', 'r', ';' };
+  const frenzy::uchar lAarrsc_name[] = { 'l', 'A', 'a', 'r', 'r', ';' };
+  const frenzy::uchar lArrsc_name[] = { 'l', 'A', 'r', 'r', ';' };
+  const frenzy::uchar lAtailsc_name[] = { 'l', 'A', 't', 'a', 'i', 'l', ';' };
+  const frenzy::uchar lBarrsc_name[] = { 'l', 'B', 'a', 'r', 'r', ';' };
+  const frenzy::uchar lEsc_name[] = { 'l', 'E', ';' };
+  const frenzy::uchar lEgsc_name[] = { 'l', 'E', 'g', ';' };
+  const frenzy::uchar lHarsc_name[] = { 'l', 'H', 'a', 'r', ';' };
+  const frenzy::uchar lacutesc_name[] = { 'l', 'a', 'c', 'u', 't', 'e', ';' };
+  const frenzy::uchar laemptyvsc_name[] = { 'l', 'a', 'e', 'm', 'p', 't', 'y', 'v', ';' };
+  const frenzy::uchar lagransc_name[] = { 'l', 'a', 'g', 'r', 'a', 'n', ';' };
+  const frenzy::uchar lambdasc_name[] = { 'l', 'a', 'm', 'b', 'd', 'a', ';' };
+  const frenzy::uchar langsc_name[] = { 'l', 'a', 'n', 'g', ';' };
+  const frenzy::uchar langdsc_name[] = { 'l', 'a', 'n', 'g', 'd', ';' };
+  const frenzy::uchar langlesc_name[] = { 'l', 'a', 'n', 'g', 'l', 'e', ';' };
+  const frenzy::uchar lapsc_name[] = { 'l', 'a', 'p', ';' };
+  const frenzy::uchar laquo_name[] = { 'l', 'a', 'q', 'u', 'o' };
+  const frenzy::uchar laquosc_name[] = { 'l', 'a', 'q', 'u', 'o', ';' };
+  const frenzy::uchar larrsc_name[] = { 'l', 'a', 'r', 'r', ';' };
+  const frenzy::uchar larrbsc_name[] = { 'l', 'a', 'r', 'r', 'b', ';' };
+  const frenzy::uchar larrbfssc_name[] = { 'l', 'a', 'r', 'r', 'b', 'f', 's', ';' };
+  const frenzy::uchar larrfssc_name[] = { 'l', 'a', 'r', 'r', 'f', 's', ';' };
+  const frenzy::uchar larrhksc_name[] = { 'l', 'a', 'r', 'r', 'h', 'k', ';' };
+  const frenzy::uchar larrlpsc_name[] = { 'l', 'a', 'r', 'r', 'l', 'p', ';' };
+  const frenzy::uchar larrplsc_name[] = { 'l', 'a', 'r', 'r', 'p', 'l', ';' };
+  const frenzy::uchar larrsimsc_name[] = { 'l', 'a', 'r', 'r', 's', 'i', 'm', ';' };
+  const frenzy::uchar larrtlsc_name[] = { 'l', 'a', 'r', 'r', 't', 'l', ';' };
+  const frenzy::uchar latsc_name[] = { 'l', 'a', 't', ';' };
+  const frenzy::uchar latailsc_name[] = { 'l', 'a', 't', 'a', 'i', 'l', ';' };
+  const frenzy::uchar latesc_name[] = { 'l', 'a', 't', 'e', ';' };
+  const frenzy::uchar latessc_name[] = { 'l', 'a', 't', 'e', 's', ';' };
+  const frenzy::uchar lbarrsc_name[] = { 'l', 'b', 'a', 'r', 'r', ';' };
+  const frenzy::uchar lbbrksc_name[] = { 'l', 'b', 'b', 'r', 'k', ';' };
+  const frenzy::uchar lbracesc_name[] = { 'l', 'b', 'r', 'a', 'c', 'e', ';' };
+  const frenzy::uchar lbracksc_name[] = { 'l', 'b', 'r', 'a', 'c', 'k', ';' };
+  const frenzy::uchar lbrkesc_name[] = { 'l', 'b', 'r', 'k', 'e', ';' };
+  const frenzy::uchar lbrksldsc_name[] = { 'l', 'b', 'r', 'k', 's', 'l', 'd', ';' };
+  const frenzy::uchar lbrkslusc_name[] = { 'l', 'b', 'r', 'k', 's', 'l', 'u', ';' };
+  const frenzy::uchar lcaronsc_name[] = { 'l', 'c', 'a', 'r', 'o', 'n', ';' };
+  const frenzy::uchar lcedilsc_name[] = { 'l', 'c', 'e', 'd', 'i', 'l', ';' };
+  const frenzy::uchar lceilsc_name[] = { 'l', 'c', 'e', 'i', 'l', ';' };
+  const frenzy::uchar lcubsc_name[] = { 'l', 'c', 'u', 'b', ';' };
+  const frenzy::uchar lcysc_name[] = { 'l', 'c', 'y', ';' };
+  const frenzy::uchar ldcasc_name[] = { 'l', 'd', 'c', 'a', ';' };
+  const frenzy::uchar ldquosc_name[] = { 'l', 'd', 'q', 'u', 'o', ';' };
+  const frenzy::uchar ldquorsc_name[] = { 'l', 'd', 'q', 'u', 'o', 'r', ';' };
+  const frenzy::uchar ldrdharsc_name[] = { 'l', 'd', 'r', 'd', 'h', 'a', 'r', ';' };
+  const frenzy::uchar ldrusharsc_name[] = { 'l', 'd', 'r', 'u', 's', 'h', 'a', 'r', ';' };
+  const frenzy::uchar ldshsc_name[] = { 'l', 'd', 's', 'h', ';' };
+  const frenzy::uchar lesc_name[] = { 'l', 'e', ';' };
+  const frenzy::uchar leftarrowsc_name[] = { 'l', 'e', 'f', 't', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar leftarrowtailsc_name[] = { 'l', 'e', 'f', 't', 'a', 'r', 'r', 'o', 'w', 't', 'a', 'i', 'l', ';' };
+  const frenzy::uchar leftharpoondownsc_name[] = { 'l', 'e', 'f', 't', 'h', 'a', 'r', 'p', 'o', 'o', 'n', 'd', 'o', 'w', 'n', ';' };
+  const frenzy::uchar leftharpoonupsc_name[] = { 'l', 'e', 'f', 't', 'h', 'a', 'r', 'p', 'o', 'o', 'n', 'u', 'p', ';' };
+  const frenzy::uchar leftleftarrowssc_name[] = { 'l', 'e', 'f', 't', 'l', 'e', 'f', 't', 'a', 'r', 'r', 'o', 'w', 's', ';' };
+  const frenzy::uchar leftrightarrowsc_name[] = { 'l', 'e', 'f', 't', 'r', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar leftrightarrowssc_name[] = { 'l', 'e', 'f', 't', 'r', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', 's', ';' };
+  const frenzy::uchar leftrightharpoonssc_name[] = { 'l', 'e', 'f', 't', 'r', 'i', 'g', 'h', 't', 'h', 'a', 'r', 'p', 'o', 'o', 'n', 's', ';' };
+  const frenzy::uchar leftrightsquigarrowsc_name[] = { 'l', 'e', 'f', 't', 'r', 'i', 'g', 'h', 't', 's', 'q', 'u', 'i', 'g', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar leftthreetimessc_name[] = { 'l', 'e', 'f', 't', 't', 'h', 'r', 'e', 'e', 't', 'i', 'm', 'e', 's', ';' };
+  const frenzy::uchar legsc_name[] = { 'l', 'e', 'g', ';' };
+  const frenzy::uchar leqsc_name[] = { 'l', 'e', 'q', ';' };
+  const frenzy::uchar leqqsc_name[] = { 'l', 'e', 'q', 'q', ';' };
+  const frenzy::uchar leqslantsc_name[] = { 'l', 'e', 'q', 's', 'l', 'a', 'n', 't', ';' };
+  const frenzy::uchar lessc_name[] = { 'l', 'e', 's', ';' };
+  const frenzy::uchar lesccsc_name[] = { 'l', 'e', 's', 'c', 'c', ';' };
+  const frenzy::uchar lesdotsc_name[] = { 'l', 'e', 's', 'd', 'o', 't', ';' };
+  const frenzy::uchar lesdotosc_name[] = { 'l', 'e', 's', 'd', 'o', 't', 'o', ';' };
+  const frenzy::uchar lesdotorsc_name[] = { 'l', 'e', 's', 'd', 'o', 't', 'o', 'r', ';' };
+  const frenzy::uchar lesgsc_name[] = { 'l', 'e', 's', 'g', ';' };
+  const frenzy::uchar lesgessc_name[] = { 'l', 'e', 's', 'g', 'e', 's', ';' };
+  const frenzy::uchar lessapproxsc_name[] = { 'l', 'e', 's', 's', 'a', 'p', 'p', 'r', 'o', 'x', ';' };
+  const frenzy::uchar lessdotsc_name[] = { 'l', 'e', 's', 's', 'd', 'o', 't', ';' };
+  const frenzy::uchar lesseqgtrsc_name[] = { 'l', 'e', 's', 's', 'e', 'q', 'g', 't', 'r', ';' };
+  const frenzy::uchar lesseqqgtrsc_name[] = { 'l', 'e', 's', 's', 'e', 'q', 'q', 'g', 't', 'r', ';' };
+  const frenzy::uchar lessgtrsc_name[] = { 'l', 'e', 's', 's', 'g', 't', 'r', ';' };
+  const frenzy::uchar lesssimsc_name[] = { 'l', 'e', 's', 's', 's', 'i', 'm', ';' };
+  const frenzy::uchar lfishtsc_name[] = { 'l', 'f', 'i', 's', 'h', 't', ';' };
+  const frenzy::uchar lfloorsc_name[] = { 'l', 'f', 'l', 'o', 'o', 'r', ';' };
+  const frenzy::uchar lfrsc_name[] = { 'l', 'f', 'r', ';' };
+  const frenzy::uchar lgsc_name[] = { 'l', 'g', ';' };
+  const frenzy::uchar lgEsc_name[] = { 'l', 'g', 'E', ';' };
+  const frenzy::uchar lhardsc_name[] = { 'l', 'h', 'a', 'r', 'd', ';' };
+  const frenzy::uchar lharusc_name[] = { 'l', 'h', 'a', 'r', 'u', ';' };
+  const frenzy::uchar lharulsc_name[] = { 'l', 'h', 'a', 'r', 'u', 'l', ';' };
+  const frenzy::uchar lhblksc_name[] = { 'l', 'h', 'b', 'l', 'k', ';' };
+  const frenzy::uchar ljcysc_name[] = { 'l', 'j', 'c', 'y', ';' };
+  const frenzy::uchar llsc_name[] = { 'l', 'l', ';' };
+  const frenzy::uchar llarrsc_name[] = { 'l', 'l', 'a', 'r', 'r', ';' };
+  const frenzy::uchar llcornersc_name[] = { 'l', 'l', 'c', 'o', 'r', 'n', 'e', 'r', ';' };
+  const frenzy::uchar llhardsc_name[] = { 'l', 'l', 'h', 'a', 'r', 'd', ';' };
+  const frenzy::uchar lltrisc_name[] = { 'l', 'l', 't', 'r', 'i', ';' };
+  const frenzy::uchar lmidotsc_name[] = { 'l', 'm', 'i', 'd', 'o', 't', ';' };
+  const frenzy::uchar lmoustsc_name[] = { 'l', 'm', 'o', 'u', 's', 't', ';' };
+  const frenzy::uchar lmoustachesc_name[] = { 'l', 'm', 'o', 'u', 's', 't', 'a', 'c', 'h', 'e', ';' };
+  const frenzy::uchar lnEsc_name[] = { 'l', 'n', 'E', ';' };
+  const frenzy::uchar lnapsc_name[] = { 'l', 'n', 'a', 'p', ';' };
+  const frenzy::uchar lnapproxsc_name[] = { 'l', 'n', 'a', 'p', 'p', 'r', 'o', 'x', ';' };
+  const frenzy::uchar lnesc_name[] = { 'l', 'n', 'e', ';' };
+  const frenzy::uchar lneqsc_name[] = { 'l', 'n', 'e', 'q', ';' };
+  const frenzy::uchar lneqqsc_name[] = { 'l', 'n', 'e', 'q', 'q', ';' };
+  const frenzy::uchar lnsimsc_name[] = { 'l', 'n', 's', 'i', 'm', ';' };
+  const frenzy::uchar loangsc_name[] = { 'l', 'o', 'a', 'n', 'g', ';' };
+  const frenzy::uchar loarrsc_name[] = { 'l', 'o', 'a', 'r', 'r', ';' };
+  const frenzy::uchar lobrksc_name[] = { 'l', 'o', 'b', 'r', 'k', ';' };
+  const frenzy::uchar longleftarrowsc_name[] = { 'l', 'o', 'n', 'g', 'l', 'e', 'f', 't', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar longleftrightarrowsc_name[] = { 'l', 'o', 'n', 'g', 'l', 'e', 'f', 't', 'r', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar longmapstosc_name[] = { 'l', 'o', 'n', 'g', 'm', 'a', 'p', 's', 't', 'o', ';' };
+  const frenzy::uchar longrightarrowsc_name[] = { 'l', 'o', 'n', 'g', 'r', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar looparrowleftsc_name[] = { 'l', 'o', 'o', 'p', 'a', 'r', 'r', 'o', 'w', 'l', 'e', 'f', 't', ';' };
+  const frenzy::uchar looparrowrightsc_name[] = { 'l', 'o', 'o', 'p', 'a', 'r', 'r', 'o', 'w', 'r', 'i', 'g', 'h', 't', ';' };
+  const frenzy::uchar loparsc_name[] = { 'l', 'o', 'p', 'a', 'r', ';' };
+  const frenzy::uchar lopfsc_name[] = { 'l', 'o', 'p', 'f', ';' };
+  const frenzy::uchar loplussc_name[] = { 'l', 'o', 'p', 'l', 'u', 's', ';' };
+  const frenzy::uchar lotimessc_name[] = { 'l', 'o', 't', 'i', 'm', 'e', 's', ';' };
+  const frenzy::uchar lowastsc_name[] = { 'l', 'o', 'w', 'a', 's', 't', ';' };
+  const frenzy::uchar lowbarsc_name[] = { 'l', 'o', 'w', 'b', 'a', 'r', ';' };
+  const frenzy::uchar lozsc_name[] = { 'l', 'o', 'z', ';' };
+  const frenzy::uchar lozengesc_name[] = { 'l', 'o', 'z', 'e', 'n', 'g', 'e', ';' };
+  const frenzy::uchar lozfsc_name[] = { 'l', 'o', 'z', 'f', ';' };
+  const frenzy::uchar lparsc_name[] = { 'l', 'p', 'a', 'r', ';' };
+  const frenzy::uchar lparltsc_name[] = { 'l', 'p', 'a', 'r', 'l', 't', ';' };
+  const frenzy::uchar lrarrsc_name[] = { 'l', 'r', 'a', 'r', 'r', ';' };
+  const frenzy::uchar lrcornersc_name[] = { 'l', 'r', 'c', 'o', 'r', 'n', 'e', 'r', ';' };
+  const frenzy::uchar lrharsc_name[] = { 'l', 'r', 'h', 'a', 'r', ';' };
+  const frenzy::uchar lrhardsc_name[] = { 'l', 'r', 'h', 'a', 'r', 'd', ';' };
+  const frenzy::uchar lrmsc_name[] = { 'l', 'r', 'm', ';' };
+  const frenzy::uchar lrtrisc_name[] = { 'l', 'r', 't', 'r', 'i', ';' };
+  const frenzy::uchar lsaquosc_name[] = { 'l', 's', 'a', 'q', 'u', 'o', ';' };
+  const frenzy::uchar lscrsc_name[] = { 'l', 's', 'c', 'r', ';' };
+  const frenzy::uchar lshsc_name[] = { 'l', 's', 'h', ';' };
+  const frenzy::uchar lsimsc_name[] = { 'l', 's', 'i', 'm', ';' };
+  const frenzy::uchar lsimesc_name[] = { 'l', 's', 'i', 'm', 'e', ';' };
+  const frenzy::uchar lsimgsc_name[] = { 'l', 's', 'i', 'm', 'g', ';' };
+  const frenzy::uchar lsqbsc_name[] = { 'l', 's', 'q', 'b', ';' };
+  const frenzy::uchar lsquosc_name[] = { 'l', 's', 'q', 'u', 'o', ';' };
+  const frenzy::uchar lsquorsc_name[] = { 'l', 's', 'q', 'u', 'o', 'r', ';' };
+  const frenzy::uchar lstroksc_name[] = { 'l', 's', 't', 'r', 'o', 'k', ';' };
+  const frenzy::uchar lt_name[] = { 'l', 't' };
+  const frenzy::uchar ltsc_name[] = { 'l', 't', ';' };
+  const frenzy::uchar ltccsc_name[] = { 'l', 't', 'c', 'c', ';' };
+  const frenzy::uchar ltcirsc_name[] = { 'l', 't', 'c', 'i', 'r', ';' };
+  const frenzy::uchar ltdotsc_name[] = { 'l', 't', 'd', 'o', 't', ';' };
+  const frenzy::uchar lthreesc_name[] = { 'l', 't', 'h', 'r', 'e', 'e', ';' };
+  const frenzy::uchar ltimessc_name[] = { 'l', 't', 'i', 'm', 'e', 's', ';' };
+  const frenzy::uchar ltlarrsc_name[] = { 'l', 't', 'l', 'a', 'r', 'r', ';' };
+  const frenzy::uchar ltquestsc_name[] = { 'l', 't', 'q', 'u', 'e', 's', 't', ';' };
+  const frenzy::uchar ltrParsc_name[] = { 'l', 't', 'r', 'P', 'a', 'r', ';' };
+  const frenzy::uchar ltrisc_name[] = { 'l', 't', 'r', 'i', ';' };
+  const frenzy::uchar ltriesc_name[] = { 'l', 't', 'r', 'i', 'e', ';' };
+  const frenzy::uchar ltrifsc_name[] = { 'l', 't', 'r', 'i', 'f', ';' };
+  const frenzy::uchar lurdsharsc_name[] = { 'l', 'u', 'r', 'd', 's', 'h', 'a', 'r', ';' };
+  const frenzy::uchar luruharsc_name[] = { 'l', 'u', 'r', 'u', 'h', 'a', 'r', ';' };
+  const frenzy::uchar lvertneqqsc_name[] = { 'l', 'v', 'e', 'r', 't', 'n', 'e', 'q', 'q', ';' };
+  const frenzy::uchar lvnEsc_name[] = { 'l', 'v', 'n', 'E', ';' };
+  const frenzy::uchar mDDotsc_name[] = { 'm', 'D', 'D', 'o', 't', ';' };
+  const frenzy::uchar macr_name[] = { 'm', 'a', 'c', 'r' };
+  const frenzy::uchar macrsc_name[] = { 'm', 'a', 'c', 'r', ';' };
+  const frenzy::uchar malesc_name[] = { 'm', 'a', 'l', 'e', ';' };
+  const frenzy::uchar maltsc_name[] = { 'm', 'a', 'l', 't', ';' };
+  const frenzy::uchar maltesesc_name[] = { 'm', 'a', 'l', 't', 'e', 's', 'e', ';' };
+  const frenzy::uchar mapsc_name[] = { 'm', 'a', 'p', ';' };
+  const frenzy::uchar mapstosc_name[] = { 'm', 'a', 'p', 's', 't', 'o', ';' };
+  const frenzy::uchar mapstodownsc_name[] = { 'm', 'a', 'p', 's', 't', 'o', 'd', 'o', 'w', 'n', ';' };
+  const frenzy::uchar mapstoleftsc_name[] = { 'm', 'a', 'p', 's', 't', 'o', 'l', 'e', 'f', 't', ';' };
+  const frenzy::uchar mapstoupsc_name[] = { 'm', 'a', 'p', 's', 't', 'o', 'u', 'p', ';' };
+  const frenzy::uchar markersc_name[] = { 'm', 'a', 'r', 'k', 'e', 'r', ';' };
+  const frenzy::uchar mcommasc_name[] = { 'm', 'c', 'o', 'm', 'm', 'a', ';' };
+  const frenzy::uchar mcysc_name[] = { 'm', 'c', 'y', ';' };
+  const frenzy::uchar mdashsc_name[] = { 'm', 'd', 'a', 's', 'h', ';' };
+  const frenzy::uchar measuredanglesc_name[] = { 'm', 'e', 'a', 's', 'u', 'r', 'e', 'd', 'a', 'n', 'g', 'l', 'e', ';' };
+  const frenzy::uchar mfrsc_name[] = { 'm', 'f', 'r', ';' };
+  const frenzy::uchar mhosc_name[] = { 'm', 'h', 'o', ';' };
+  const frenzy::uchar micro_name[] = { 'm', 'i', 'c', 'r', 'o' };
+  const frenzy::uchar microsc_name[] = { 'm', 'i', 'c', 'r', 'o', ';' };
+  const frenzy::uchar midsc_name[] = { 'm', 'i', 'd', ';' };
+  const frenzy::uchar midastsc_name[] = { 'm', 'i', 'd', 'a', 's', 't', ';' };
+  const frenzy::uchar midcirsc_name[] = { 'm', 'i', 'd', 'c', 'i', 'r', ';' };
+  const frenzy::uchar middot_name[] = { 'm', 'i', 'd', 'd', 'o', 't' };
+  const frenzy::uchar middotsc_name[] = { 'm', 'i', 'd', 'd', 'o', 't', ';' };
+  const frenzy::uchar minussc_name[] = { 'm', 'i', 'n', 'u', 's', ';' };
+  const frenzy::uchar minusbsc_name[] = { 'm', 'i', 'n', 'u', 's', 'b', ';' };
+  const frenzy::uchar minusdsc_name[] = { 'm', 'i', 'n', 'u', 's', 'd', ';' };
+  const frenzy::uchar minusdusc_name[] = { 'm', 'i', 'n', 'u', 's', 'd', 'u', ';' };
+  const frenzy::uchar mlcpsc_name[] = { 'm', 'l', 'c', 'p', ';' };
+  const frenzy::uchar mldrsc_name[] = { 'm', 'l', 'd', 'r', ';' };
+  const frenzy::uchar mnplussc_name[] = { 'm', 'n', 'p', 'l', 'u', 's', ';' };
+  const frenzy::uchar modelssc_name[] = { 'm', 'o', 'd', 'e', 'l', 's', ';' };
+  const frenzy::uchar mopfsc_name[] = { 'm', 'o', 'p', 'f', ';' };
+  const frenzy::uchar mpsc_name[] = { 'm', 'p', ';' };
+  const frenzy::uchar mscrsc_name[] = { 'm', 's', 'c', 'r', ';' };
+  const frenzy::uchar mstpossc_name[] = { 'm', 's', 't', 'p', 'o', 's', ';' };
+  const frenzy::uchar musc_name[] = { 'm', 'u', ';' };
+  const frenzy::uchar multimapsc_name[] = { 'm', 'u', 'l', 't', 'i', 'm', 'a', 'p', ';' };
+  const frenzy::uchar mumapsc_name[] = { 'm', 'u', 'm', 'a', 'p', ';' };
+  const frenzy::uchar nGgsc_name[] = { 'n', 'G', 'g', ';' };
+  const frenzy::uchar nGtsc_name[] = { 'n', 'G', 't', ';' };
+  const frenzy::uchar nGtvsc_name[] = { 'n', 'G', 't', 'v', ';' };
+  const frenzy::uchar nLeftarrowsc_name[] = { 'n', 'L', 'e', 'f', 't', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar nLeftrightarrowsc_name[] = { 'n', 'L', 'e', 'f', 't', 'r', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar nLlsc_name[] = { 'n', 'L', 'l', ';' };
+  const frenzy::uchar nLtsc_name[] = { 'n', 'L', 't', ';' };
+  const frenzy::uchar nLtvsc_name[] = { 'n', 'L', 't', 'v', ';' };
+  const frenzy::uchar nRightarrowsc_name[] = { 'n', 'R', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar nVDashsc_name[] = { 'n', 'V', 'D', 'a', 's', 'h', ';' };
+  const frenzy::uchar nVdashsc_name[] = { 'n', 'V', 'd', 'a', 's', 'h', ';' };
+  const frenzy::uchar nablasc_name[] = { 'n', 'a', 'b', 'l', 'a', ';' };
+  const frenzy::uchar nacutesc_name[] = { 'n', 'a', 'c', 'u', 't', 'e', ';' };
+  const frenzy::uchar nangsc_name[] = { 'n', 'a', 'n', 'g', ';' };
+  const frenzy::uchar napsc_name[] = { 'n', 'a', 'p', ';' };
+  const frenzy::uchar napEsc_name[] = { 'n', 'a', 'p', 'E', ';' };
+  const frenzy::uchar napidsc_name[] = { 'n', 'a', 'p', 'i', 'd', ';' };
+  const frenzy::uchar napossc_name[] = { 'n', 'a', 'p', 'o', 's', ';' };
+  const frenzy::uchar napproxsc_name[] = { 'n', 'a', 'p', 'p', 'r', 'o', 'x', ';' };
+  const frenzy::uchar natursc_name[] = { 'n', 'a', 't', 'u', 'r', ';' };
+  const frenzy::uchar naturalsc_name[] = { 'n', 'a', 't', 'u', 'r', 'a', 'l', ';' };
+  const frenzy::uchar naturalssc_name[] = { 'n', 'a', 't', 'u', 'r', 'a', 'l', 's', ';' };
+  const frenzy::uchar nbsp_name[] = { 'n', 'b', 's', 'p' };
+  const frenzy::uchar nbspsc_name[] = { 'n', 'b', 's', 'p', ';' };
+  const frenzy::uchar nbumpsc_name[] = { 'n', 'b', 'u', 'm', 'p', ';' };
+  const frenzy::uchar nbumpesc_name[] = { 'n', 'b', 'u', 'm', 'p', 'e', ';' };
+  const frenzy::uchar ncapsc_name[] = { 'n', 'c', 'a', 'p', ';' };
+  const frenzy::uchar ncaronsc_name[] = { 'n', 'c', 'a', 'r', 'o', 'n', ';' };
+  const frenzy::uchar ncedilsc_name[] = { 'n', 'c', 'e', 'd', 'i', 'l', ';' };
+  const frenzy::uchar ncongsc_name[] = { 'n', 'c', 'o', 'n', 'g', ';' };
+  const frenzy::uchar ncongdotsc_name[] = { 'n', 'c', 'o', 'n', 'g', 'd', 'o', 't', ';' };
+  const frenzy::uchar ncupsc_name[] = { 'n', 'c', 'u', 'p', ';' };
+  const frenzy::uchar ncysc_name[] = { 'n', 'c', 'y', ';' };
+  const frenzy::uchar ndashsc_name[] = { 'n', 'd', 'a', 's', 'h', ';' };
+  const frenzy::uchar nesc_name[] = { 'n', 'e', ';' };
+  const frenzy::uchar neArrsc_name[] = { 'n', 'e', 'A', 'r', 'r', ';' };
+  const frenzy::uchar nearhksc_name[] = { 'n', 'e', 'a', 'r', 'h', 'k', ';' };
+  const frenzy::uchar nearrsc_name[] = { 'n', 'e', 'a', 'r', 'r', ';' };
+  const frenzy::uchar nearrowsc_name[] = { 'n', 'e', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar nedotsc_name[] = { 'n', 'e', 'd', 'o', 't', ';' };
+  const frenzy::uchar nequivsc_name[] = { 'n', 'e', 'q', 'u', 'i', 'v', ';' };
+  const frenzy::uchar nesearsc_name[] = { 'n', 'e', 's', 'e', 'a', 'r', ';' };
+  const frenzy::uchar nesimsc_name[] = { 'n', 'e', 's', 'i', 'm', ';' };
+  const frenzy::uchar nexistsc_name[] = { 'n', 'e', 'x', 'i', 's', 't', ';' };
+  const frenzy::uchar nexistssc_name[] = { 'n', 'e', 'x', 'i', 's', 't', 's', ';' };
+  const frenzy::uchar nfrsc_name[] = { 'n', 'f', 'r', ';' };
+  const frenzy::uchar ngEsc_name[] = { 'n', 'g', 'E', ';' };
+  const frenzy::uchar ngesc_name[] = { 'n', 'g', 'e', ';' };
+  const frenzy::uchar ngeqsc_name[] = { 'n', 'g', 'e', 'q', ';' };
+  const frenzy::uchar ngeqqsc_name[] = { 'n', 'g', 'e', 'q', 'q', ';' };
+  const frenzy::uchar ngeqslantsc_name[] = { 'n', 'g', 'e', 'q', 's', 'l', 'a', 'n', 't', ';' };
+  const frenzy::uchar ngessc_name[] = { 'n', 'g', 'e', 's', ';' };
+  const frenzy::uchar ngsimsc_name[] = { 'n', 'g', 's', 'i', 'm', ';' };
+  const frenzy::uchar ngtsc_name[] = { 'n', 'g', 't', ';' };
+  const frenzy::uchar ngtrsc_name[] = { 'n', 'g', 't', 'r', ';' };
+  const frenzy::uchar nhArrsc_name[] = { 'n', 'h', 'A', 'r', 'r', ';' };
+  const frenzy::uchar nharrsc_name[] = { 'n', 'h', 'a', 'r', 'r', ';' };
+  const frenzy::uchar nhparsc_name[] = { 'n', 'h', 'p', 'a', 'r', ';' };
+  const frenzy::uchar nisc_name[] = { 'n', 'i', ';' };
+  const frenzy::uchar nissc_name[] = { 'n', 'i', 's', ';' };
+  const frenzy::uchar nisdsc_name[] = { 'n', 'i', 's', 'd', ';' };
+  const frenzy::uchar nivsc_name[] = { 'n', 'i', 'v', ';' };
+  const frenzy::uchar njcysc_name[] = { 'n', 'j', 'c', 'y', ';' };
+  const frenzy::uchar nlArrsc_name[] = { 'n', 'l', 'A', 'r', 'r', ';' };
+  const frenzy::uchar nlEsc_name[] = { 'n', 'l', 'E', ';' };
+  const frenzy::uchar nlarrsc_name[] = { 'n', 'l', 'a', 'r', 'r', ';' };
+  const frenzy::uchar nldrsc_name[] = { 'n', 'l', 'd', 'r', ';' };
+  const frenzy::uchar nlesc_name[] = { 'n', 'l', 'e', ';' };
+  const frenzy::uchar nleftarrowsc_name[] = { 'n', 'l', 'e', 'f', 't', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar nleftrightarrowsc_name[] = { 'n', 'l', 'e', 'f', 't', 'r', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar nleqsc_name[] = { 'n', 'l', 'e', 'q', ';' };
+  const frenzy::uchar nleqqsc_name[] = { 'n', 'l', 'e', 'q', 'q', ';' };
+  const frenzy::uchar nleqslantsc_name[] = { 'n', 'l', 'e', 'q', 's', 'l', 'a', 'n', 't', ';' };
+  const frenzy::uchar nlessc_name[] = { 'n', 'l', 'e', 's', ';' };
+  const frenzy::uchar nlesssc_name[] = { 'n', 'l', 'e', 's', 's', ';' };
+  const frenzy::uchar nlsimsc_name[] = { 'n', 'l', 's', 'i', 'm', ';' };
+  const frenzy::uchar nltsc_name[] = { 'n', 'l', 't', ';' };
+  const frenzy::uchar nltrisc_name[] = { 'n', 'l', 't', 'r', 'i', ';' };
+  const frenzy::uchar nltriesc_name[] = { 'n', 'l', 't', 'r', 'i', 'e', ';' };
+  const frenzy::uchar nmidsc_name[] = { 'n', 'm', 'i', 'd', ';' };
+  const frenzy::uchar nopfsc_name[] = { 'n', 'o', 'p', 'f', ';' };
+  const frenzy::uchar not_name[] = { 'n', 'o', 't' };
+  const frenzy::uchar notsc_name[] = { 'n', 'o', 't', ';' };
+  const frenzy::uchar notinsc_name[] = { 'n', 'o', 't', 'i', 'n', ';' };
+  const frenzy::uchar notinEsc_name[] = { 'n', 'o', 't', 'i', 'n', 'E', ';' };
+  const frenzy::uchar notindotsc_name[] = { 'n', 'o', 't', 'i', 'n', 'd', 'o', 't', ';' };
+  const frenzy::uchar notinvasc_name[] = { 'n', 'o', 't', 'i', 'n', 'v', 'a', ';' };
+  const frenzy::uchar notinvbsc_name[] = { 'n', 'o', 't', 'i', 'n', 'v', 'b', ';' };
+  const frenzy::uchar notinvcsc_name[] = { 'n', 'o', 't', 'i', 'n', 'v', 'c', ';' };
+  const frenzy::uchar notnisc_name[] = { 'n', 'o', 't', 'n', 'i', ';' };
+  const frenzy::uchar notnivasc_name[] = { 'n', 'o', 't', 'n', 'i', 'v', 'a', ';' };
+  const frenzy::uchar notnivbsc_name[] = { 'n', 'o', 't', 'n', 'i', 'v', 'b', ';' };
+  const frenzy::uchar notnivcsc_name[] = { 'n', 'o', 't', 'n', 'i', 'v', 'c', ';' };
+  const frenzy::uchar nparsc_name[] = { 'n', 'p', 'a', 'r', ';' };
+  const frenzy::uchar nparallelsc_name[] = { 'n', 'p', 'a', 'r', 'a', 'l', 'l', 'e', 'l', ';' };
+  const frenzy::uchar nparslsc_name[] = { 'n', 'p', 'a', 'r', 's', 'l', ';' };
+  const frenzy::uchar npartsc_name[] = { 'n', 'p', 'a', 'r', 't', ';' };
+  const frenzy::uchar npolintsc_name[] = { 'n', 'p', 'o', 'l', 'i', 'n', 't', ';' };
+  const frenzy::uchar nprsc_name[] = { 'n', 'p', 'r', ';' };
+  const frenzy::uchar nprcuesc_name[] = { 'n', 'p', 'r', 'c', 'u', 'e', ';' };
+  const frenzy::uchar npresc_name[] = { 'n', 'p', 'r', 'e', ';' };
+  const frenzy::uchar nprecsc_name[] = { 'n', 'p', 'r', 'e', 'c', ';' };
+  const frenzy::uchar npreceqsc_name[] = { 'n', 'p', 'r', 'e', 'c', 'e', 'q', ';' };
+  const frenzy::uchar nrArrsc_name[] = { 'n', 'r', 'A', 'r', 'r', ';' };
+  const frenzy::uchar nrarrsc_name[] = { 'n', 'r', 'a', 'r', 'r', ';' };
+  const frenzy::uchar nrarrcsc_name[] = { 'n', 'r', 'a', 'r', 'r', 'c', ';' };
+  const frenzy::uchar nrarrwsc_name[] = { 'n', 'r', 'a', 'r', 'r', 'w', ';' };
+  const frenzy::uchar nrightarrowsc_name[] = { 'n', 'r', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar nrtrisc_name[] = { 'n', 'r', 't', 'r', 'i', ';' };
+  const frenzy::uchar nrtriesc_name[] = { 'n', 'r', 't', 'r', 'i', 'e', ';' };
+  const frenzy::uchar nscsc_name[] = { 'n', 's', 'c', ';' };
+  const frenzy::uchar nsccuesc_name[] = { 'n', 's', 'c', 'c', 'u', 'e', ';' };
+  const frenzy::uchar nscesc_name[] = { 'n', 's', 'c', 'e', ';' };
+  const frenzy::uchar nscrsc_name[] = { 'n', 's', 'c', 'r', ';' };
+  const frenzy::uchar nshortmidsc_name[] = { 'n', 's', 'h', 'o', 'r', 't', 'm', 'i', 'd', ';' };
+  const frenzy::uchar nshortparallelsc_name[] = { 'n', 's', 'h', 'o', 'r', 't', 'p', 'a', 'r', 'a', 'l', 'l', 'e', 'l', ';' };
+  const frenzy::uchar nsimsc_name[] = { 'n', 's', 'i', 'm', ';' };
+  const frenzy::uchar nsimesc_name[] = { 'n', 's', 'i', 'm', 'e', ';' };
+  const frenzy::uchar nsimeqsc_name[] = { 'n', 's', 'i', 'm', 'e', 'q', ';' };
+  const frenzy::uchar nsmidsc_name[] = { 'n', 's', 'm', 'i', 'd', ';' };
+  const frenzy::uchar nsparsc_name[] = { 'n', 's', 'p', 'a', 'r', ';' };
+  const frenzy::uchar nsqsubesc_name[] = { 'n', 's', 'q', 's', 'u', 'b', 'e', ';' };
+  const frenzy::uchar nsqsupesc_name[] = { 'n', 's', 'q', 's', 'u', 'p', 'e', ';' };
+  const frenzy::uchar nsubsc_name[] = { 'n', 's', 'u', 'b', ';' };
+  const frenzy::uchar nsubEsc_name[] = { 'n', 's', 'u', 'b', 'E', ';' };
+  const frenzy::uchar nsubesc_name[] = { 'n', 's', 'u', 'b', 'e', ';' };
+  const frenzy::uchar nsubsetsc_name[] = { 'n', 's', 'u', 'b', 's', 'e', 't', ';' };
+  const frenzy::uchar nsubseteqsc_name[] = { 'n', 's', 'u', 'b', 's', 'e', 't', 'e', 'q', ';' };
+  const frenzy::uchar nsubseteqqsc_name[] = { 'n', 's', 'u', 'b', 's', 'e', 't', 'e', 'q', 'q', ';' };
+  const frenzy::uchar nsuccsc_name[] = { 'n', 's', 'u', 'c', 'c', ';' };
+  const frenzy::uchar nsucceqsc_name[] = { 'n', 's', 'u', 'c', 'c', 'e', 'q', ';' };
+  const frenzy::uchar nsupsc_name[] = { 'n', 's', 'u', 'p', ';' };
+  const frenzy::uchar nsupEsc_name[] = { 'n', 's', 'u', 'p', 'E', ';' };
+  const frenzy::uchar nsupesc_name[] = { 'n', 's', 'u', 'p', 'e', ';' };
+  const frenzy::uchar nsupsetsc_name[] = { 'n', 's', 'u', 'p', 's', 'e', 't', ';' };
+  const frenzy::uchar nsupseteqsc_name[] = { 'n', 's', 'u', 'p', 's', 'e', 't', 'e', 'q', ';' };
+  const frenzy::uchar nsupseteqqsc_name[] = { 'n', 's', 'u', 'p', 's', 'e', 't', 'e', 'q', 'q', ';' };
+  const frenzy::uchar ntglsc_name[] = { 'n', 't', 'g', 'l', ';' };
+  const frenzy::uchar ntilde_name[] = { 'n', 't', 'i', 'l', 'd', 'e' };
+  const frenzy::uchar ntildesc_name[] = { 'n', 't', 'i', 'l', 'd', 'e', ';' };
+  const frenzy::uchar ntlgsc_name[] = { 'n', 't', 'l', 'g', ';' };
+  const frenzy::uchar ntriangleleftsc_name[] = { 'n', 't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'l', 'e', 'f', 't', ';' };
+  const frenzy::uchar ntrianglelefteqsc_name[] = { 'n', 't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'l', 'e', 'f', 't', 'e', 'q', ';' };
+  const frenzy::uchar ntrianglerightsc_name[] = { 'n', 't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'r', 'i', 'g', 'h', 't', ';' };
+  const frenzy::uchar ntrianglerighteqsc_name[] = { 'n', 't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'r', 'i', 'g', 'h', 't', 'e', 'q', ';' };
+  const frenzy::uchar nusc_name[] = { 'n', 'u', ';' };
+  const frenzy::uchar numsc_name[] = { 'n', 'u', 'm', ';' };
+  const frenzy::uchar numerosc_name[] = { 'n', 'u', 'm', 'e', 'r', 'o', ';' };
+  const frenzy::uchar numspsc_name[] = { 'n', 'u', 'm', 's', 'p', ';' };
+  const frenzy::uchar nvDashsc_name[] = { 'n', 'v', 'D', 'a', 's', 'h', ';' };
+  const frenzy::uchar nvHarrsc_name[] = { 'n', 'v', 'H', 'a', 'r', 'r', ';' };
+  const frenzy::uchar nvapsc_name[] = { 'n', 'v', 'a', 'p', ';' };
+  const frenzy::uchar nvdashsc_name[] = { 'n', 'v', 'd', 'a', 's', 'h', ';' };
+  const frenzy::uchar nvgesc_name[] = { 'n', 'v', 'g', 'e', ';' };
+  const frenzy::uchar nvgtsc_name[] = { 'n', 'v', 'g', 't', ';' };
+  const frenzy::uchar nvinfinsc_name[] = { 'n', 'v', 'i', 'n', 'f', 'i', 'n', ';' };
+  const frenzy::uchar nvlArrsc_name[] = { 'n', 'v', 'l', 'A', 'r', 'r', ';' };
+  const frenzy::uchar nvlesc_name[] = { 'n', 'v', 'l', 'e', ';' };
+  const frenzy::uchar nvltsc_name[] = { 'n', 'v', 'l', 't', ';' };
+  const frenzy::uchar nvltriesc_name[] = { 'n', 'v', 'l', 't', 'r', 'i', 'e', ';' };
+  const frenzy::uchar nvrArrsc_name[] = { 'n', 'v', 'r', 'A', 'r', 'r', ';' };
+  const frenzy::uchar nvrtriesc_name[] = { 'n', 'v', 'r', 't', 'r', 'i', 'e', ';' };
+  const frenzy::uchar nvsimsc_name[] = { 'n', 'v', 's', 'i', 'm', ';' };
+  const frenzy::uchar nwArrsc_name[] = { 'n', 'w', 'A', 'r', 'r', ';' };
+  const frenzy::uchar nwarhksc_name[] = { 'n', 'w', 'a', 'r', 'h', 'k', ';' };
+  const frenzy::uchar nwarrsc_name[] = { 'n', 'w', 'a', 'r', 'r', ';' };
+  const frenzy::uchar nwarrowsc_name[] = { 'n', 'w', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar nwnearsc_name[] = { 'n', 'w', 'n', 'e', 'a', 'r', ';' };
+  const frenzy::uchar oSsc_name[] = { 'o', 'S', ';' };
+  const frenzy::uchar oacute_name[] = { 'o', 'a', 'c', 'u', 't', 'e' };
+  const frenzy::uchar oacutesc_name[] = { 'o', 'a', 'c', 'u', 't', 'e', ';' };
+  const frenzy::uchar oastsc_name[] = { 'o', 'a', 's', 't', ';' };
+  const frenzy::uchar ocirsc_name[] = { 'o', 'c', 'i', 'r', ';' };
+  const frenzy::uchar ocirc_name[] = { 'o', 'c', 'i', 'r', 'c' };
+  const frenzy::uchar ocircsc_name[] = { 'o', 'c', 'i', 'r', 'c', ';' };
+  const frenzy::uchar ocysc_name[] = { 'o', 'c', 'y', ';' };
+  const frenzy::uchar odashsc_name[] = { 'o', 'd', 'a', 's', 'h', ';' };
+  const frenzy::uchar odblacsc_name[] = { 'o', 'd', 'b', 'l', 'a', 'c', ';' };
+  const frenzy::uchar odivsc_name[] = { 'o', 'd', 'i', 'v', ';' };
+  const frenzy::uchar odotsc_name[] = { 'o', 'd', 'o', 't', ';' };
+  const frenzy::uchar odsoldsc_name[] = { 'o', 'd', 's', 'o', 'l', 'd', ';' };
+  const frenzy::uchar oeligsc_name[] = { 'o', 'e', 'l', 'i', 'g', ';' };
+  const frenzy::uchar ofcirsc_name[] = { 'o', 'f', 'c', 'i', 'r', ';' };
+  const frenzy::uchar ofrsc_name[] = { 'o', 'f', 'r', ';' };
+  const frenzy::uchar ogonsc_name[] = { 'o', 'g', 'o', 'n', ';' };
+  const frenzy::uchar ograve_name[] = { 'o', 'g', 'r', 'a', 'v', 'e' };
+  const frenzy::uchar ogravesc_name[] = { 'o', 'g', 'r', 'a', 'v', 'e', ';' };
+  const frenzy::uchar ogtsc_name[] = { 'o', 'g', 't', ';' };
+  const frenzy::uchar ohbarsc_name[] = { 'o', 'h', 'b', 'a', 'r', ';' };
+  const frenzy::uchar ohmsc_name[] = { 'o', 'h', 'm', ';' };
+  const frenzy::uchar ointsc_name[] = { 'o', 'i', 'n', 't', ';' };
+  const frenzy::uchar olarrsc_name[] = { 'o', 'l', 'a', 'r', 'r', ';' };
+  const frenzy::uchar olcirsc_name[] = { 'o', 'l', 'c', 'i', 'r', ';' };
+  const frenzy::uchar olcrosssc_name[] = { 'o', 'l', 'c', 'r', 'o', 's', 's', ';' };
+  const frenzy::uchar olinesc_name[] = { 'o', 'l', 'i', 'n', 'e', ';' };
+  const frenzy::uchar oltsc_name[] = { 'o', 'l', 't', ';' };
+  const frenzy::uchar omacrsc_name[] = { 'o', 'm', 'a', 'c', 'r', ';' };
+  const frenzy::uchar omegasc_name[] = { 'o', 'm', 'e', 'g', 'a', ';' };
+  const frenzy::uchar omicronsc_name[] = { 'o', 'm', 'i', 'c', 'r', 'o', 'n', ';' };
+  const frenzy::uchar omidsc_name[] = { 'o', 'm', 'i', 'd', ';' };
+  const frenzy::uchar ominussc_name[] = { 'o', 'm', 'i', 'n', 'u', 's', ';' };
+  const frenzy::uchar oopfsc_name[] = { 'o', 'o', 'p', 'f', ';' };
+  const frenzy::uchar oparsc_name[] = { 'o', 'p', 'a', 'r', ';' };
+  const frenzy::uchar operpsc_name[] = { 'o', 'p', 'e', 'r', 'p', ';' };
+  const frenzy::uchar oplussc_name[] = { 'o', 'p', 'l', 'u', 's', ';' };
+  const frenzy::uchar orsc_name[] = { 'o', 'r', ';' };
+  const frenzy::uchar orarrsc_name[] = { 'o', 'r', 'a', 'r', 'r', ';' };
+  const frenzy::uchar ordsc_name[] = { 'o', 'r', 'd', ';' };
+  const frenzy::uchar ordersc_name[] = { 'o', 'r', 'd', 'e', 'r', ';' };
+  const frenzy::uchar orderofsc_name[] = { 'o', 'r', 'd', 'e', 'r', 'o', 'f', ';' };
+  const frenzy::uchar ordf_name[] = { 'o', 'r', 'd', 'f' };
+  const frenzy::uchar ordfsc_name[] = { 'o', 'r', 'd', 'f', ';' };
+  const frenzy::uchar ordm_name[] = { 'o', 'r', 'd', 'm' };
+  const frenzy::uchar ordmsc_name[] = { 'o', 'r', 'd', 'm', ';' };
+  const frenzy::uchar origofsc_name[] = { 'o', 'r', 'i', 'g', 'o', 'f', ';' };
+  const frenzy::uchar ororsc_name[] = { 'o', 'r', 'o', 'r', ';' };
+  const frenzy::uchar orslopesc_name[] = { 'o', 'r', 's', 'l', 'o', 'p', 'e', ';' };
+  const frenzy::uchar orvsc_name[] = { 'o', 'r', 'v', ';' };
+  const frenzy::uchar oscrsc_name[] = { 'o', 's', 'c', 'r', ';' };
+  const frenzy::uchar oslash_name[] = { 'o', 's', 'l', 'a', 's', 'h' };
+  const frenzy::uchar oslashsc_name[] = { 'o', 's', 'l', 'a', 's', 'h', ';' };
+  const frenzy::uchar osolsc_name[] = { 'o', 's', 'o', 'l', ';' };
+  const frenzy::uchar otilde_name[] = { 'o', 't', 'i', 'l', 'd', 'e' };
+  const frenzy::uchar otildesc_name[] = { 'o', 't', 'i', 'l', 'd', 'e', ';' };
+  const frenzy::uchar otimessc_name[] = { 'o', 't', 'i', 'm', 'e', 's', ';' };
+  const frenzy::uchar otimesassc_name[] = { 'o', 't', 'i', 'm', 'e', 's', 'a', 's', ';' };
+  const frenzy::uchar ouml_name[] = { 'o', 'u', 'm', 'l' };
+  const frenzy::uchar oumlsc_name[] = { 'o', 'u', 'm', 'l', ';' };
+  const frenzy::uchar ovbarsc_name[] = { 'o', 'v', 'b', 'a', 'r', ';' };
+  const frenzy::uchar parsc_name[] = { 'p', 'a', 'r', ';' };
+  const frenzy::uchar para_name[] = { 'p', 'a', 'r', 'a' };
+  const frenzy::uchar parasc_name[] = { 'p', 'a', 'r', 'a', ';' };
+  const frenzy::uchar parallelsc_name[] = { 'p', 'a', 'r', 'a', 'l', 'l', 'e', 'l', ';' };
+  const frenzy::uchar parsimsc_name[] = { 'p', 'a', 'r', 's', 'i', 'm', ';' };
+  const frenzy::uchar parslsc_name[] = { 'p', 'a', 'r', 's', 'l', ';' };
+  const frenzy::uchar partsc_name[] = { 'p', 'a', 'r', 't', ';' };
+  const frenzy::uchar pcysc_name[] = { 'p', 'c', 'y', ';' };
+  const frenzy::uchar percntsc_name[] = { 'p', 'e', 'r', 'c', 'n', 't', ';' };
+  const frenzy::uchar periodsc_name[] = { 'p', 'e', 'r', 'i', 'o', 'd', ';' };
+  const frenzy::uchar permilsc_name[] = { 'p', 'e', 'r', 'm', 'i', 'l', ';' };
+  const frenzy::uchar perpsc_name[] = { 'p', 'e', 'r', 'p', ';' };
+  const frenzy::uchar pertenksc_name[] = { 'p', 'e', 'r', 't', 'e', 'n', 'k', ';' };
+  const frenzy::uchar pfrsc_name[] = { 'p', 'f', 'r', ';' };
+  const frenzy::uchar phisc_name[] = { 'p', 'h', 'i', ';' };
+  const frenzy::uchar phivsc_name[] = { 'p', 'h', 'i', 'v', ';' };
+  const frenzy::uchar phmmatsc_name[] = { 'p', 'h', 'm', 'm', 'a', 't', ';' };
+  const frenzy::uchar phonesc_name[] = { 'p', 'h', 'o', 'n', 'e', ';' };
+  const frenzy::uchar pisc_name[] = { 'p', 'i', ';' };
+  const frenzy::uchar pitchforksc_name[] = { 'p', 'i', 't', 'c', 'h', 'f', 'o', 'r', 'k', ';' };
+  const frenzy::uchar pivsc_name[] = { 'p', 'i', 'v', ';' };
+  const frenzy::uchar plancksc_name[] = { 'p', 'l', 'a', 'n', 'c', 'k', ';' };
+  const frenzy::uchar planckhsc_name[] = { 'p', 'l', 'a', 'n', 'c', 'k', 'h', ';' };
+  const frenzy::uchar plankvsc_name[] = { 'p', 'l', 'a', 'n', 'k', 'v', ';' };
+  const frenzy::uchar plussc_name[] = { 'p', 'l', 'u', 's', ';' };
+  const frenzy::uchar plusacirsc_name[] = { 'p', 'l', 'u', 's', 'a', 'c', 'i', 'r', ';' };
+  const frenzy::uchar plusbsc_name[] = { 'p', 'l', 'u', 's', 'b', ';' };
+  const frenzy::uchar pluscirsc_name[] = { 'p', 'l', 'u', 's', 'c', 'i', 'r', ';' };
+  const frenzy::uchar plusdosc_name[] = { 'p', 'l', 'u', 's', 'd', 'o', ';' };
+  const frenzy::uchar plusdusc_name[] = { 'p', 'l', 'u', 's', 'd', 'u', ';' };
+  const frenzy::uchar plusesc_name[] = { 'p', 'l', 'u', 's', 'e', ';' };
+  const frenzy::uchar plusmn_name[] = { 'p', 'l', 'u', 's', 'm', 'n' };
+  const frenzy::uchar plusmnsc_name[] = { 'p', 'l', 'u', 's', 'm', 'n', ';' };
+  const frenzy::uchar plussimsc_name[] = { 'p', 'l', 'u', 's', 's', 'i', 'm', ';' };
+  const frenzy::uchar plustwosc_name[] = { 'p', 'l', 'u', 's', 't', 'w', 'o', ';' };
+  const frenzy::uchar pmsc_name[] = { 'p', 'm', ';' };
+  const frenzy::uchar pointintsc_name[] = { 'p', 'o', 'i', 'n', 't', 'i', 'n', 't', ';' };
+  const frenzy::uchar popfsc_name[] = { 'p', 'o', 'p', 'f', ';' };
+  const frenzy::uchar pound_name[] = { 'p', 'o', 'u', 'n', 'd' };
+  const frenzy::uchar poundsc_name[] = { 'p', 'o', 'u', 'n', 'd', ';' };
+  const frenzy::uchar prsc_name[] = { 'p', 'r', ';' };
+  const frenzy::uchar prEsc_name[] = { 'p', 'r', 'E', ';' };
+  const frenzy::uchar prapsc_name[] = { 'p', 'r', 'a', 'p', ';' };
+  const frenzy::uchar prcuesc_name[] = { 'p', 'r', 'c', 'u', 'e', ';' };
+  const frenzy::uchar presc_name[] = { 'p', 'r', 'e', ';' };
+  const frenzy::uchar precsc_name[] = { 'p', 'r', 'e', 'c', ';' };
+  const frenzy::uchar precapproxsc_name[] = { 'p', 'r', 'e', 'c', 'a', 'p', 'p', 'r', 'o', 'x', ';' };
+  const frenzy::uchar preccurlyeqsc_name[] = { 'p', 'r', 'e', 'c', 'c', 'u', 'r', 'l', 'y', 'e', 'q', ';' };
+  const frenzy::uchar preceqsc_name[] = { 'p', 'r', 'e', 'c', 'e', 'q', ';' };
+  const frenzy::uchar precnapproxsc_name[] = { 'p', 'r', 'e', 'c', 'n', 'a', 'p', 'p', 'r', 'o', 'x', ';' };
+  const frenzy::uchar precneqqsc_name[] = { 'p', 'r', 'e', 'c', 'n', 'e', 'q', 'q', ';' };
+  const frenzy::uchar precnsimsc_name[] = { 'p', 'r', 'e', 'c', 'n', 's', 'i', 'm', ';' };
+  const frenzy::uchar precsimsc_name[] = { 'p', 'r', 'e', 'c', 's', 'i', 'm', ';' };
+  const frenzy::uchar primesc_name[] = { 'p', 'r', 'i', 'm', 'e', ';' };
+  const frenzy::uchar primessc_name[] = { 'p', 'r', 'i', 'm', 'e', 's', ';' };
+  const frenzy::uchar prnEsc_name[] = { 'p', 'r', 'n', 'E', ';' };
+  const frenzy::uchar prnapsc_name[] = { 'p', 'r', 'n', 'a', 'p', ';' };
+  const frenzy::uchar prnsimsc_name[] = { 'p', 'r', 'n', 's', 'i', 'm', ';' };
+  const frenzy::uchar prodsc_name[] = { 'p', 'r', 'o', 'd', ';' };
+  const frenzy::uchar profalarsc_name[] = { 'p', 'r', 'o', 'f', 'a', 'l', 'a', 'r', ';' };
+  const frenzy::uchar proflinesc_name[] = { 'p', 'r', 'o', 'f', 'l', 'i', 'n', 'e', ';' };
+  const frenzy::uchar profsurfsc_name[] = { 'p', 'r', 'o', 'f', 's', 'u', 'r', 'f', ';' };
+  const frenzy::uchar propsc_name[] = { 'p', 'r', 'o', 'p', ';' };
+  const frenzy::uchar proptosc_name[] = { 'p', 'r', 'o', 'p', 't', 'o', ';' };
+  const frenzy::uchar prsimsc_name[] = { 'p', 'r', 's', 'i', 'm', ';' };
+  const frenzy::uchar prurelsc_name[] = { 'p', 'r', 'u', 'r', 'e', 'l', ';' };
+  const frenzy::uchar pscrsc_name[] = { 'p', 's', 'c', 'r', ';' };
+  const frenzy::uchar psisc_name[] = { 'p', 's', 'i', ';' };
+  const frenzy::uchar puncspsc_name[] = { 'p', 'u', 'n', 'c', 's', 'p', ';' };
+  const frenzy::uchar qfrsc_name[] = { 'q', 'f', 'r', ';' };
+  const frenzy::uchar qintsc_name[] = { 'q', 'i', 'n', 't', ';' };
+  const frenzy::uchar qopfsc_name[] = { 'q', 'o', 'p', 'f', ';' };
+  const frenzy::uchar qprimesc_name[] = { 'q', 'p', 'r', 'i', 'm', 'e', ';' };
+  const frenzy::uchar qscrsc_name[] = { 'q', 's', 'c', 'r', ';' };
+  const frenzy::uchar quaternionssc_name[] = { 'q', 'u', 'a', 't', 'e', 'r', 'n', 'i', 'o', 'n', 's', ';' };
+  const frenzy::uchar quatintsc_name[] = { 'q', 'u', 'a', 't', 'i', 'n', 't', ';' };
+  const frenzy::uchar questsc_name[] = { 'q', 'u', 'e', 's', 't', ';' };
+  const frenzy::uchar questeqsc_name[] = { 'q', 'u', 'e', 's', 't', 'e', 'q', ';' };
+  const frenzy::uchar quot_name[] = { 'q', 'u', 'o', 't' };
+  const frenzy::uchar quotsc_name[] = { 'q', 'u', 'o', 't', ';' };
+  const frenzy::uchar rAarrsc_name[] = { 'r', 'A', 'a', 'r', 'r', ';' };
+  const frenzy::uchar rArrsc_name[] = { 'r', 'A', 'r', 'r', ';' };
+  const frenzy::uchar rAtailsc_name[] = { 'r', 'A', 't', 'a', 'i', 'l', ';' };
+  const frenzy::uchar rBarrsc_name[] = { 'r', 'B', 'a', 'r', 'r', ';' };
+  const frenzy::uchar rHarsc_name[] = { 'r', 'H', 'a', 'r', ';' };
+  const frenzy::uchar racesc_name[] = { 'r', 'a', 'c', 'e', ';' };
+  const frenzy::uchar racutesc_name[] = { 'r', 'a', 'c', 'u', 't', 'e', ';' };
+  const frenzy::uchar radicsc_name[] = { 'r', 'a', 'd', 'i', 'c', ';' };
+  const frenzy::uchar raemptyvsc_name[] = { 'r', 'a', 'e', 'm', 'p', 't', 'y', 'v', ';' };
+  const frenzy::uchar rangsc_name[] = { 'r', 'a', 'n', 'g', ';' };
+  const frenzy::uchar rangdsc_name[] = { 'r', 'a', 'n', 'g', 'd', ';' };
+  const frenzy::uchar rangesc_name[] = { 'r', 'a', 'n', 'g', 'e', ';' };
+  const frenzy::uchar ranglesc_name[] = { 'r', 'a', 'n', 'g', 'l', 'e', ';' };
+  const frenzy::uchar raquo_name[] = { 'r', 'a', 'q', 'u', 'o' };
+  const frenzy::uchar raquosc_name[] = { 'r', 'a', 'q', 'u', 'o', ';' };
+  const frenzy::uchar rarrsc_name[] = { 'r', 'a', 'r', 'r', ';' };
+  const frenzy::uchar rarrapsc_name[] = { 'r', 'a', 'r', 'r', 'a', 'p', ';' };
+  const frenzy::uchar rarrbsc_name[] = { 'r', 'a', 'r', 'r', 'b', ';' };
+  const frenzy::uchar rarrbfssc_name[] = { 'r', 'a', 'r', 'r', 'b', 'f', 's', ';' };
+  const frenzy::uchar rarrcsc_name[] = { 'r', 'a', 'r', 'r', 'c', ';' };
+  const frenzy::uchar rarrfssc_name[] = { 'r', 'a', 'r', 'r', 'f', 's', ';' };
+  const frenzy::uchar rarrhksc_name[] = { 'r', 'a', 'r', 'r', 'h', 'k', ';' };
+  const frenzy::uchar rarrlpsc_name[] = { 'r', 'a', 'r', 'r', 'l', 'p', ';' };
+  const frenzy::uchar rarrplsc_name[] = { 'r', 'a', 'r', 'r', 'p', 'l', ';' };
+  const frenzy::uchar rarrsimsc_name[] = { 'r', 'a', 'r', 'r', 's', 'i', 'm', ';' };
+  const frenzy::uchar rarrtlsc_name[] = { 'r', 'a', 'r', 'r', 't', 'l', ';' };
+  const frenzy::uchar rarrwsc_name[] = { 'r', 'a', 'r', 'r', 'w', ';' };
+  const frenzy::uchar ratailsc_name[] = { 'r', 'a', 't', 'a', 'i', 'l', ';' };
+  const frenzy::uchar ratiosc_name[] = { 'r', 'a', 't', 'i', 'o', ';' };
+  const frenzy::uchar rationalssc_name[] = { 'r', 'a', 't', 'i', 'o', 'n', 'a', 'l', 's', ';' };
+  const frenzy::uchar rbarrsc_name[] = { 'r', 'b', 'a', 'r', 'r', ';' };
+  const frenzy::uchar rbbrksc_name[] = { 'r', 'b', 'b', 'r', 'k', ';' };
+  const frenzy::uchar rbracesc_name[] = { 'r', 'b', 'r', 'a', 'c', 'e', ';' };
+  const frenzy::uchar rbracksc_name[] = { 'r', 'b', 'r', 'a', 'c', 'k', ';' };
+  const frenzy::uchar rbrkesc_name[] = { 'r', 'b', 'r', 'k', 'e', ';' };
+  const frenzy::uchar rbrksldsc_name[] = { 'r', 'b', 'r', 'k', 's', 'l', 'd', ';' };
+  const frenzy::uchar rbrkslusc_name[] = { 'r', 'b', 'r', 'k', 's', 'l', 'u', ';' };
+  const frenzy::uchar rcaronsc_name[] = { 'r', 'c', 'a', 'r', 'o', 'n', ';' };
+  const frenzy::uchar rcedilsc_name[] = { 'r', 'c', 'e', 'd', 'i', 'l', ';' };
+  const frenzy::uchar rceilsc_name[] = { 'r', 'c', 'e', 'i', 'l', ';' };
+  const frenzy::uchar rcubsc_name[] = { 'r', 'c', 'u', 'b', ';' };
+  const frenzy::uchar rcysc_name[] = { 'r', 'c', 'y', ';' };
+  const frenzy::uchar rdcasc_name[] = { 'r', 'd', 'c', 'a', ';' };
+  const frenzy::uchar rdldharsc_name[] = { 'r', 'd', 'l', 'd', 'h', 'a', 'r', ';' };
+  const frenzy::uchar rdquosc_name[] = { 'r', 'd', 'q', 'u', 'o', ';' };
+  const frenzy::uchar rdquorsc_name[] = { 'r', 'd', 'q', 'u', 'o', 'r', ';' };
+  const frenzy::uchar rdshsc_name[] = { 'r', 'd', 's', 'h', ';' };
+  const frenzy::uchar realsc_name[] = { 'r', 'e', 'a', 'l', ';' };
+  const frenzy::uchar realinesc_name[] = { 'r', 'e', 'a', 'l', 'i', 'n', 'e', ';' };
+  const frenzy::uchar realpartsc_name[] = { 'r', 'e', 'a', 'l', 'p', 'a', 'r', 't', ';' };
+  const frenzy::uchar realssc_name[] = { 'r', 'e', 'a', 'l', 's', ';' };
+  const frenzy::uchar rectsc_name[] = { 'r', 'e', 'c', 't', ';' };
+  const frenzy::uchar reg_name[] = { 'r', 'e', 'g' };
+  const frenzy::uchar regsc_name[] = { 'r', 'e', 'g', ';' };
+  const frenzy::uchar rfishtsc_name[] = { 'r', 'f', 'i', 's', 'h', 't', ';' };
+  const frenzy::uchar rfloorsc_name[] = { 'r', 'f', 'l', 'o', 'o', 'r', ';' };
+  const frenzy::uchar rfrsc_name[] = { 'r', 'f', 'r', ';' };
+  const frenzy::uchar rhardsc_name[] = { 'r', 'h', 'a', 'r', 'd', ';' };
+  const frenzy::uchar rharusc_name[] = { 'r', 'h', 'a', 'r', 'u', ';' };
+  const frenzy::uchar rharulsc_name[] = { 'r', 'h', 'a', 'r', 'u', 'l', ';' };
+  const frenzy::uchar rhosc_name[] = { 'r', 'h', 'o', ';' };
+  const frenzy::uchar rhovsc_name[] = { 'r', 'h', 'o', 'v', ';' };
+  const frenzy::uchar rightarrowsc_name[] = { 'r', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar rightarrowtailsc_name[] = { 'r', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', 't', 'a', 'i', 'l', ';' };
+  const frenzy::uchar rightharpoondownsc_name[] = { 'r', 'i', 'g', 'h', 't', 'h', 'a', 'r', 'p', 'o', 'o', 'n', 'd', 'o', 'w', 'n', ';' };
+  const frenzy::uchar rightharpoonupsc_name[] = { 'r', 'i', 'g', 'h', 't', 'h', 'a', 'r', 'p', 'o', 'o', 'n', 'u', 'p', ';' };
+  const frenzy::uchar rightleftarrowssc_name[] = { 'r', 'i', 'g', 'h', 't', 'l', 'e', 'f', 't', 'a', 'r', 'r', 'o', 'w', 's', ';' };
+  const frenzy::uchar rightleftharpoonssc_name[] = { 'r', 'i', 'g', 'h', 't', 'l', 'e', 'f', 't', 'h', 'a', 'r', 'p', 'o', 'o', 'n', 's', ';' };
+  const frenzy::uchar rightrightarrowssc_name[] = { 'r', 'i', 'g', 'h', 't', 'r', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', 's', ';' };
+  const frenzy::uchar rightsquigarrowsc_name[] = { 'r', 'i', 'g', 'h', 't', 's', 'q', 'u', 'i', 'g', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar rightthreetimessc_name[] = { 'r', 'i', 'g', 'h', 't', 't', 'h', 'r', 'e', 'e', 't', 'i', 'm', 'e', 's', ';' };
+  const frenzy::uchar ringsc_name[] = { 'r', 'i', 'n', 'g', ';' };
+  const frenzy::uchar risingdotseqsc_name[] = { 'r', 'i', 's', 'i', 'n', 'g', 'd', 'o', 't', 's', 'e', 'q', ';' };
+  const frenzy::uchar rlarrsc_name[] = { 'r', 'l', 'a', 'r', 'r', ';' };
+  const frenzy::uchar rlharsc_name[] = { 'r', 'l', 'h', 'a', 'r', ';' };
+  const frenzy::uchar rlmsc_name[] = { 'r', 'l', 'm', ';' };
+  const frenzy::uchar rmoustsc_name[] = { 'r', 'm', 'o', 'u', 's', 't', ';' };
+  const frenzy::uchar rmoustachesc_name[] = { 'r', 'm', 'o', 'u', 's', 't', 'a', 'c', 'h', 'e', ';' };
+  const frenzy::uchar rnmidsc_name[] = { 'r', 'n', 'm', 'i', 'd', ';' };
+  const frenzy::uchar roangsc_name[] = { 'r', 'o', 'a', 'n', 'g', ';' };
+  const frenzy::uchar roarrsc_name[] = { 'r', 'o', 'a', 'r', 'r', ';' };
+  const frenzy::uchar robrksc_name[] = { 'r', 'o', 'b', 'r', 'k', ';' };
+  const frenzy::uchar roparsc_name[] = { 'r', 'o', 'p', 'a', 'r', ';' };
+  const frenzy::uchar ropfsc_name[] = { 'r', 'o', 'p', 'f', ';' };
+  const frenzy::uchar roplussc_name[] = { 'r', 'o', 'p', 'l', 'u', 's', ';' };
+  const frenzy::uchar rotimessc_name[] = { 'r', 'o', 't', 'i', 'm', 'e', 's', ';' };
+  const frenzy::uchar rparsc_name[] = { 'r', 'p', 'a', 'r', ';' };
+  const frenzy::uchar rpargtsc_name[] = { 'r', 'p', 'a', 'r', 'g', 't', ';' };
+  const frenzy::uchar rppolintsc_name[] = { 'r', 'p', 'p', 'o', 'l', 'i', 'n', 't', ';' };
+  const frenzy::uchar rrarrsc_name[] = { 'r', 'r', 'a', 'r', 'r', ';' };
+  const frenzy::uchar rsaquosc_name[] = { 'r', 's', 'a', 'q', 'u', 'o', ';' };
+  const frenzy::uchar rscrsc_name[] = { 'r', 's', 'c', 'r', ';' };
+  const frenzy::uchar rshsc_name[] = { 'r', 's', 'h', ';' };
+  const frenzy::uchar rsqbsc_name[] = { 'r', 's', 'q', 'b', ';' };
+  const frenzy::uchar rsquosc_name[] = { 'r', 's', 'q', 'u', 'o', ';' };
+  const frenzy::uchar rsquorsc_name[] = { 'r', 's', 'q', 'u', 'o', 'r', ';' };
+  const frenzy::uchar rthreesc_name[] = { 'r', 't', 'h', 'r', 'e', 'e', ';' };
+  const frenzy::uchar rtimessc_name[] = { 'r', 't', 'i', 'm', 'e', 's', ';' };
+  const frenzy::uchar rtrisc_name[] = { 'r', 't', 'r', 'i', ';' };
+  const frenzy::uchar rtriesc_name[] = { 'r', 't', 'r', 'i', 'e', ';' };
+  const frenzy::uchar rtrifsc_name[] = { 'r', 't', 'r', 'i', 'f', ';' };
+  const frenzy::uchar rtriltrisc_name[] = { 'r', 't', 'r', 'i', 'l', 't', 'r', 'i', ';' };
+  const frenzy::uchar ruluharsc_name[] = { 'r', 'u', 'l', 'u', 'h', 'a', 'r', ';' };
+  const frenzy::uchar rxsc_name[] = { 'r', 'x', ';' };
+  const frenzy::uchar sacutesc_name[] = { 's', 'a', 'c', 'u', 't', 'e', ';' };
+  const frenzy::uchar sbquosc_name[] = { 's', 'b', 'q', 'u', 'o', ';' };
+  const frenzy::uchar scsc_name[] = { 's', 'c', ';' };
+  const frenzy::uchar scEsc_name[] = { 's', 'c', 'E', ';' };
+  const frenzy::uchar scapsc_name[] = { 's', 'c', 'a', 'p', ';' };
+  const frenzy::uchar scaronsc_name[] = { 's', 'c', 'a', 'r', 'o', 'n', ';' };
+  const frenzy::uchar sccuesc_name[] = { 's', 'c', 'c', 'u', 'e', ';' };
+  const frenzy::uchar scesc_name[] = { 's', 'c', 'e', ';' };
+  const frenzy::uchar scedilsc_name[] = { 's', 'c', 'e', 'd', 'i', 'l', ';' };
+  const frenzy::uchar scircsc_name[] = { 's', 'c', 'i', 'r', 'c', ';' };
+  const frenzy::uchar scnEsc_name[] = { 's', 'c', 'n', 'E', ';' };
+  const frenzy::uchar scnapsc_name[] = { 's', 'c', 'n', 'a', 'p', ';' };
+  const frenzy::uchar scnsimsc_name[] = { 's', 'c', 'n', 's', 'i', 'm', ';' };
+  const frenzy::uchar scpolintsc_name[] = { 's', 'c', 'p', 'o', 'l', 'i', 'n', 't', ';' };
+  const frenzy::uchar scsimsc_name[] = { 's', 'c', 's', 'i', 'm', ';' };
+  const frenzy::uchar scysc_name[] = { 's', 'c', 'y', ';' };
+  const frenzy::uchar sdotsc_name[] = { 's', 'd', 'o', 't', ';' };
+  const frenzy::uchar sdotbsc_name[] = { 's', 'd', 'o', 't', 'b', ';' };
+  const frenzy::uchar sdotesc_name[] = { 's', 'd', 'o', 't', 'e', ';' };
+  const frenzy::uchar seArrsc_name[] = { 's', 'e', 'A', 'r', 'r', ';' };
+  const frenzy::uchar searhksc_name[] = { 's', 'e', 'a', 'r', 'h', 'k', ';' };
+  const frenzy::uchar searrsc_name[] = { 's', 'e', 'a', 'r', 'r', ';' };
+  const frenzy::uchar searrowsc_name[] = { 's', 'e', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar sect_name[] = { 's', 'e', 'c', 't' };
+  const frenzy::uchar sectsc_name[] = { 's', 'e', 'c', 't', ';' };
+  const frenzy::uchar semisc_name[] = { 's', 'e', 'm', 'i', ';' };
+  const frenzy::uchar seswarsc_name[] = { 's', 'e', 's', 'w', 'a', 'r', ';' };
+  const frenzy::uchar setminussc_name[] = { 's', 'e', 't', 'm', 'i', 'n', 'u', 's', ';' };
+  const frenzy::uchar setmnsc_name[] = { 's', 'e', 't', 'm', 'n', ';' };
+  const frenzy::uchar sextsc_name[] = { 's', 'e', 'x', 't', ';' };
+  const frenzy::uchar sfrsc_name[] = { 's', 'f', 'r', ';' };
+  const frenzy::uchar sfrownsc_name[] = { 's', 'f', 'r', 'o', 'w', 'n', ';' };
+  const frenzy::uchar sharpsc_name[] = { 's', 'h', 'a', 'r', 'p', ';' };
+  const frenzy::uchar shchcysc_name[] = { 's', 'h', 'c', 'h', 'c', 'y', ';' };
+  const frenzy::uchar shcysc_name[] = { 's', 'h', 'c', 'y', ';' };
+  const frenzy::uchar shortmidsc_name[] = { 's', 'h', 'o', 'r', 't', 'm', 'i', 'd', ';' };
+  const frenzy::uchar shortparallelsc_name[] = { 's', 'h', 'o', 'r', 't', 'p', 'a', 'r', 'a', 'l', 'l', 'e', 'l', ';' };
+  const frenzy::uchar shy_name[] = { 's', 'h', 'y' };
+  const frenzy::uchar shysc_name[] = { 's', 'h', 'y', ';' };
+  const frenzy::uchar sigmasc_name[] = { 's', 'i', 'g', 'm', 'a', ';' };
+  const frenzy::uchar sigmafsc_name[] = { 's', 'i', 'g', 'm', 'a', 'f', ';' };
+  const frenzy::uchar sigmavsc_name[] = { 's', 'i', 'g', 'm', 'a', 'v', ';' };
+  const frenzy::uchar simsc_name[] = { 's', 'i', 'm', ';' };
+  const frenzy::uchar simdotsc_name[] = { 's', 'i', 'm', 'd', 'o', 't', ';' };
+  const frenzy::uchar simesc_name[] = { 's', 'i', 'm', 'e', ';' };
+  const frenzy::uchar simeqsc_name[] = { 's', 'i', 'm', 'e', 'q', ';' };
+  const frenzy::uchar simgsc_name[] = { 's', 'i', 'm', 'g', ';' };
+  const frenzy::uchar simgEsc_name[] = { 's', 'i', 'm', 'g', 'E', ';' };
+  const frenzy::uchar simlsc_name[] = { 's', 'i', 'm', 'l', ';' };
+  const frenzy::uchar simlEsc_name[] = { 's', 'i', 'm', 'l', 'E', ';' };
+  const frenzy::uchar simnesc_name[] = { 's', 'i', 'm', 'n', 'e', ';' };
+  const frenzy::uchar simplussc_name[] = { 's', 'i', 'm', 'p', 'l', 'u', 's', ';' };
+  const frenzy::uchar simrarrsc_name[] = { 's', 'i', 'm', 'r', 'a', 'r', 'r', ';' };
+  const frenzy::uchar slarrsc_name[] = { 's', 'l', 'a', 'r', 'r', ';' };
+  const frenzy::uchar smallsetminussc_name[] = { 's', 'm', 'a', 'l', 'l', 's', 'e', 't', 'm', 'i', 'n', 'u', 's', ';' };
+  const frenzy::uchar smashpsc_name[] = { 's', 'm', 'a', 's', 'h', 'p', ';' };
+  const frenzy::uchar smeparslsc_name[] = { 's', 'm', 'e', 'p', 'a', 'r', 's', 'l', ';' };
+  const frenzy::uchar smidsc_name[] = { 's', 'm', 'i', 'd', ';' };
+  const frenzy::uchar smilesc_name[] = { 's', 'm', 'i', 'l', 'e', ';' };
+  const frenzy::uchar smtsc_name[] = { 's', 'm', 't', ';' };
+  const frenzy::uchar smtesc_name[] = { 's', 'm', 't', 'e', ';' };
+  const frenzy::uchar smtessc_name[] = { 's', 'm', 't', 'e', 's', ';' };
+  const frenzy::uchar softcysc_name[] = { 's', 'o', 'f', 't', 'c', 'y', ';' };
+  const frenzy::uchar solsc_name[] = { 's', 'o', 'l', ';' };
+  const frenzy::uchar solbsc_name[] = { 's', 'o', 'l', 'b', ';' };
+  const frenzy::uchar solbarsc_name[] = { 's', 'o', 'l', 'b', 'a', 'r', ';' };
+  const frenzy::uchar sopfsc_name[] = { 's', 'o', 'p', 'f', ';' };
+  const frenzy::uchar spadessc_name[] = { 's', 'p', 'a', 'd', 'e', 's', ';' };
+  const frenzy::uchar spadesuitsc_name[] = { 's', 'p', 'a', 'd', 'e', 's', 'u', 'i', 't', ';' };
+  const frenzy::uchar sparsc_name[] = { 's', 'p', 'a', 'r', ';' };
+  const frenzy::uchar sqcapsc_name[] = { 's', 'q', 'c', 'a', 'p', ';' };
+  const frenzy::uchar sqcapssc_name[] = { 's', 'q', 'c', 'a', 'p', 's', ';' };
+  const frenzy::uchar sqcupsc_name[] = { 's', 'q', 'c', 'u', 'p', ';' };
+  const frenzy::uchar sqcupssc_name[] = { 's', 'q', 'c', 'u', 'p', 's', ';' };
+  const frenzy::uchar sqsubsc_name[] = { 's', 'q', 's', 'u', 'b', ';' };
+  const frenzy::uchar sqsubesc_name[] = { 's', 'q', 's', 'u', 'b', 'e', ';' };
+  const frenzy::uchar sqsubsetsc_name[] = { 's', 'q', 's', 'u', 'b', 's', 'e', 't', ';' };
+  const frenzy::uchar sqsubseteqsc_name[] = { 's', 'q', 's', 'u', 'b', 's', 'e', 't', 'e', 'q', ';' };
+  const frenzy::uchar sqsupsc_name[] = { 's', 'q', 's', 'u', 'p', ';' };
+  const frenzy::uchar sqsupesc_name[] = { 's', 'q', 's', 'u', 'p', 'e', ';' };
+  const frenzy::uchar sqsupsetsc_name[] = { 's', 'q', 's', 'u', 'p', 's', 'e', 't', ';' };
+  const frenzy::uchar sqsupseteqsc_name[] = { 's', 'q', 's', 'u', 'p', 's', 'e', 't', 'e', 'q', ';' };
+  const frenzy::uchar squsc_name[] = { 's', 'q', 'u', ';' };
+  const frenzy::uchar squaresc_name[] = { 's', 'q', 'u', 'a', 'r', 'e', ';' };
+  const frenzy::uchar squarfsc_name[] = { 's', 'q', 'u', 'a', 'r', 'f', ';' };
+  const frenzy::uchar squfsc_name[] = { 's', 'q', 'u', 'f', ';' };
+  const frenzy::uchar srarrsc_name[] = { 's', 'r', 'a', 'r', 'r', ';' };
+  const frenzy::uchar sscrsc_name[] = { 's', 's', 'c', 'r', ';' };
+  const frenzy::uchar ssetmnsc_name[] = { 's', 's', 'e', 't', 'm', 'n', ';' };
+  const frenzy::uchar ssmilesc_name[] = { 's', 's', 'm', 'i', 'l', 'e', ';' };
+  const frenzy::uchar sstarfsc_name[] = { 's', 's', 't', 'a', 'r', 'f', ';' };
+  const frenzy::uchar starsc_name[] = { 's', 't', 'a', 'r', ';' };
+  const frenzy::uchar starfsc_name[] = { 's', 't', 'a', 'r', 'f', ';' };
+  const frenzy::uchar straightepsilonsc_name[] = { 's', 't', 'r', 'a', 'i', 'g', 'h', 't', 'e', 'p', 's', 'i', 'l', 'o', 'n', ';' };
+  const frenzy::uchar straightphisc_name[] = { 's', 't', 'r', 'a', 'i', 'g', 'h', 't', 'p', 'h', 'i', ';' };
+  const frenzy::uchar strnssc_name[] = { 's', 't', 'r', 'n', 's', ';' };
+  const frenzy::uchar subsc_name[] = { 's', 'u', 'b', ';' };
+  const frenzy::uchar subEsc_name[] = { 's', 'u', 'b', 'E', ';' };
+  const frenzy::uchar subdotsc_name[] = { 's', 'u', 'b', 'd', 'o', 't', ';' };
+  const frenzy::uchar subesc_name[] = { 's', 'u', 'b', 'e', ';' };
+  const frenzy::uchar subedotsc_name[] = { 's', 'u', 'b', 'e', 'd', 'o', 't', ';' };
+  const frenzy::uchar submultsc_name[] = { 's', 'u', 'b', 'm', 'u', 'l', 't', ';' };
+  const frenzy::uchar subnEsc_name[] = { 's', 'u', 'b', 'n', 'E', ';' };
+  const frenzy::uchar subnesc_name[] = { 's', 'u', 'b', 'n', 'e', ';' };
+  const frenzy::uchar subplussc_name[] = { 's', 'u', 'b', 'p', 'l', 'u', 's', ';' };
+  const frenzy::uchar subrarrsc_name[] = { 's', 'u', 'b', 'r', 'a', 'r', 'r', ';' };
+  const frenzy::uchar subsetsc_name[] = { 's', 'u', 'b', 's', 'e', 't', ';' };
+  const frenzy::uchar subseteqsc_name[] = { 's', 'u', 'b', 's', 'e', 't', 'e', 'q', ';' };
+  const frenzy::uchar subseteqqsc_name[] = { 's', 'u', 'b', 's', 'e', 't', 'e', 'q', 'q', ';' };
+  const frenzy::uchar subsetneqsc_name[] = { 's', 'u', 'b', 's', 'e', 't', 'n', 'e', 'q', ';' };
+  const frenzy::uchar subsetneqqsc_name[] = { 's', 'u', 'b', 's', 'e', 't', 'n', 'e', 'q', 'q', ';' };
+  const frenzy::uchar subsimsc_name[] = { 's', 'u', 'b', 's', 'i', 'm', ';' };
+  const frenzy::uchar subsubsc_name[] = { 's', 'u', 'b', 's', 'u', 'b', ';' };
+  const frenzy::uchar subsupsc_name[] = { 's', 'u', 'b', 's', 'u', 'p', ';' };
+  const frenzy::uchar succsc_name[] = { 's', 'u', 'c', 'c', ';' };
+  const frenzy::uchar succapproxsc_name[] = { 's', 'u', 'c', 'c', 'a', 'p', 'p', 'r', 'o', 'x', ';' };
+  const frenzy::uchar succcurlyeqsc_name[] = { 's', 'u', 'c', 'c', 'c', 'u', 'r', 'l', 'y', 'e', 'q', ';' };
+  const frenzy::uchar succeqsc_name[] = { 's', 'u', 'c', 'c', 'e', 'q', ';' };
+  const frenzy::uchar succnapproxsc_name[] = { 's', 'u', 'c', 'c', 'n', 'a', 'p', 'p', 'r', 'o', 'x', ';' };
+  const frenzy::uchar succneqqsc_name[] = { 's', 'u', 'c', 'c', 'n', 'e', 'q', 'q', ';' };
+  const frenzy::uchar succnsimsc_name[] = { 's', 'u', 'c', 'c', 'n', 's', 'i', 'm', ';' };
+  const frenzy::uchar succsimsc_name[] = { 's', 'u', 'c', 'c', 's', 'i', 'm', ';' };
+  const frenzy::uchar sumsc_name[] = { 's', 'u', 'm', ';' };
+  const frenzy::uchar sungsc_name[] = { 's', 'u', 'n', 'g', ';' };
+  const frenzy::uchar sup1_name[] = { 's', 'u', 'p', '1' };
+  const frenzy::uchar sup1sc_name[] = { 's', 'u', 'p', '1', ';' };
+  const frenzy::uchar sup2_name[] = { 's', 'u', 'p', '2' };
+  const frenzy::uchar sup2sc_name[] = { 's', 'u', 'p', '2', ';' };
+  const frenzy::uchar sup3_name[] = { 's', 'u', 'p', '3' };
+  const frenzy::uchar sup3sc_name[] = { 's', 'u', 'p', '3', ';' };
+  const frenzy::uchar supsc_name[] = { 's', 'u', 'p', ';' };
+  const frenzy::uchar supEsc_name[] = { 's', 'u', 'p', 'E', ';' };
+  const frenzy::uchar supdotsc_name[] = { 's', 'u', 'p', 'd', 'o', 't', ';' };
+  const frenzy::uchar supdsubsc_name[] = { 's', 'u', 'p', 'd', 's', 'u', 'b', ';' };
+  const frenzy::uchar supesc_name[] = { 's', 'u', 'p', 'e', ';' };
+  const frenzy::uchar supedotsc_name[] = { 's', 'u', 'p', 'e', 'd', 'o', 't', ';' };
+  const frenzy::uchar suphsolsc_name[] = { 's', 'u', 'p', 'h', 's', 'o', 'l', ';' };
+  const frenzy::uchar suphsubsc_name[] = { 's', 'u', 'p', 'h', 's', 'u', 'b', ';' };
+  const frenzy::uchar suplarrsc_name[] = { 's', 'u', 'p', 'l', 'a', 'r', 'r', ';' };
+  const frenzy::uchar supmultsc_name[] = { 's', 'u', 'p', 'm', 'u', 'l', 't', ';' };
+  const frenzy::uchar supnEsc_name[] = { 's', 'u', 'p', 'n', 'E', ';' };
+  const frenzy::uchar supnesc_name[] = { 's', 'u', 'p', 'n', 'e', ';' };
+  const frenzy::uchar supplussc_name[] = { 's', 'u', 'p', 'p', 'l', 'u', 's', ';' };
+  const frenzy::uchar supsetsc_name[] = { 's', 'u', 'p', 's', 'e', 't', ';' };
+  const frenzy::uchar supseteqsc_name[] = { 's', 'u', 'p', 's', 'e', 't', 'e', 'q', ';' };
+  const frenzy::uchar supseteqqsc_name[] = { 's', 'u', 'p', 's', 'e', 't', 'e', 'q', 'q', ';' };
+  const frenzy::uchar supsetneqsc_name[] = { 's', 'u', 'p', 's', 'e', 't', 'n', 'e', 'q', ';' };
+  const frenzy::uchar supsetneqqsc_name[] = { 's', 'u', 'p', 's', 'e', 't', 'n', 'e', 'q', 'q', ';' };
+  const frenzy::uchar supsimsc_name[] = { 's', 'u', 'p', 's', 'i', 'm', ';' };
+  const frenzy::uchar supsubsc_name[] = { 's', 'u', 'p', 's', 'u', 'b', ';' };
+  const frenzy::uchar supsupsc_name[] = { 's', 'u', 'p', 's', 'u', 'p', ';' };
+  const frenzy::uchar swArrsc_name[] = { 's', 'w', 'A', 'r', 'r', ';' };
+  const frenzy::uchar swarhksc_name[] = { 's', 'w', 'a', 'r', 'h', 'k', ';' };
+  const frenzy::uchar swarrsc_name[] = { 's', 'w', 'a', 'r', 'r', ';' };
+  const frenzy::uchar swarrowsc_name[] = { 's', 'w', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar swnwarsc_name[] = { 's', 'w', 'n', 'w', 'a', 'r', ';' };
+  const frenzy::uchar szlig_name[] = { 's', 'z', 'l', 'i', 'g' };
+  const frenzy::uchar szligsc_name[] = { 's', 'z', 'l', 'i', 'g', ';' };
+  const frenzy::uchar targetsc_name[] = { 't', 'a', 'r', 'g', 'e', 't', ';' };
+  const frenzy::uchar tausc_name[] = { 't', 'a', 'u', ';' };
+  const frenzy::uchar tbrksc_name[] = { 't', 'b', 'r', 'k', ';' };
+  const frenzy::uchar tcaronsc_name[] = { 't', 'c', 'a', 'r', 'o', 'n', ';' };
+  const frenzy::uchar tcedilsc_name[] = { 't', 'c', 'e', 'd', 'i', 'l', ';' };
+  const frenzy::uchar tcysc_name[] = { 't', 'c', 'y', ';' };
+  const frenzy::uchar tdotsc_name[] = { 't', 'd', 'o', 't', ';' };
+  const frenzy::uchar telrecsc_name[] = { 't', 'e', 'l', 'r', 'e', 'c', ';' };
+  const frenzy::uchar tfrsc_name[] = { 't', 'f', 'r', ';' };
+  const frenzy::uchar there4sc_name[] = { 't', 'h', 'e', 'r', 'e', '4', ';' };
+  const frenzy::uchar thereforesc_name[] = { 't', 'h', 'e', 'r', 'e', 'f', 'o', 'r', 'e', ';' };
+  const frenzy::uchar thetasc_name[] = { 't', 'h', 'e', 't', 'a', ';' };
+  const frenzy::uchar thetasymsc_name[] = { 't', 'h', 'e', 't', 'a', 's', 'y', 'm', ';' };
+  const frenzy::uchar thetavsc_name[] = { 't', 'h', 'e', 't', 'a', 'v', ';' };
+  const frenzy::uchar thickapproxsc_name[] = { 't', 'h', 'i', 'c', 'k', 'a', 'p', 'p', 'r', 'o', 'x', ';' };
+  const frenzy::uchar thicksimsc_name[] = { 't', 'h', 'i', 'c', 'k', 's', 'i', 'm', ';' };
+  const frenzy::uchar thinspsc_name[] = { 't', 'h', 'i', 'n', 's', 'p', ';' };
+  const frenzy::uchar thkapsc_name[] = { 't', 'h', 'k', 'a', 'p', ';' };
+  const frenzy::uchar thksimsc_name[] = { 't', 'h', 'k', 's', 'i', 'm', ';' };
+  const frenzy::uchar thorn_name[] = { 't', 'h', 'o', 'r', 'n' };
+  const frenzy::uchar thornsc_name[] = { 't', 'h', 'o', 'r', 'n', ';' };
+  const frenzy::uchar tildesc_name[] = { 't', 'i', 'l', 'd', 'e', ';' };
+  const frenzy::uchar times_name[] = { 't', 'i', 'm', 'e', 's' };
+  const frenzy::uchar timessc_name[] = { 't', 'i', 'm', 'e', 's', ';' };
+  const frenzy::uchar timesbsc_name[] = { 't', 'i', 'm', 'e', 's', 'b', ';' };
+  const frenzy::uchar timesbarsc_name[] = { 't', 'i', 'm', 'e', 's', 'b', 'a', 'r', ';' };
+  const frenzy::uchar timesdsc_name[] = { 't', 'i', 'm', 'e', 's', 'd', ';' };
+  const frenzy::uchar tintsc_name[] = { 't', 'i', 'n', 't', ';' };
+  const frenzy::uchar toeasc_name[] = { 't', 'o', 'e', 'a', ';' };
+  const frenzy::uchar topsc_name[] = { 't', 'o', 'p', ';' };
+  const frenzy::uchar topbotsc_name[] = { 't', 'o', 'p', 'b', 'o', 't', ';' };
+  const frenzy::uchar topcirsc_name[] = { 't', 'o', 'p', 'c', 'i', 'r', ';' };
+  const frenzy::uchar topfsc_name[] = { 't', 'o', 'p', 'f', ';' };
+  const frenzy::uchar topforksc_name[] = { 't', 'o', 'p', 'f', 'o', 'r', 'k', ';' };
+  const frenzy::uchar tosasc_name[] = { 't', 'o', 's', 'a', ';' };
+  const frenzy::uchar tprimesc_name[] = { 't', 'p', 'r', 'i', 'm', 'e', ';' };
+  const frenzy::uchar tradesc_name[] = { 't', 'r', 'a', 'd', 'e', ';' };
+  const frenzy::uchar trianglesc_name[] = { 't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', ';' };
+  const frenzy::uchar triangledownsc_name[] = { 't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'd', 'o', 'w', 'n', ';' };
+  const frenzy::uchar triangleleftsc_name[] = { 't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'l', 'e', 'f', 't', ';' };
+  const frenzy::uchar trianglelefteqsc_name[] = { 't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'l', 'e', 'f', 't', 'e', 'q', ';' };
+  const frenzy::uchar triangleqsc_name[] = { 't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'q', ';' };
+  const frenzy::uchar trianglerightsc_name[] = { 't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'r', 'i', 'g', 'h', 't', ';' };
+  const frenzy::uchar trianglerighteqsc_name[] = { 't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'r', 'i', 'g', 'h', 't', 'e', 'q', ';' };
+  const frenzy::uchar tridotsc_name[] = { 't', 'r', 'i', 'd', 'o', 't', ';' };
+  const frenzy::uchar triesc_name[] = { 't', 'r', 'i', 'e', ';' };
+  const frenzy::uchar triminussc_name[] = { 't', 'r', 'i', 'm', 'i', 'n', 'u', 's', ';' };
+  const frenzy::uchar triplussc_name[] = { 't', 'r', 'i', 'p', 'l', 'u', 's', ';' };
+  const frenzy::uchar trisbsc_name[] = { 't', 'r', 'i', 's', 'b', ';' };
+  const frenzy::uchar tritimesc_name[] = { 't', 'r', 'i', 't', 'i', 'm', 'e', ';' };
+  const frenzy::uchar trpeziumsc_name[] = { 't', 'r', 'p', 'e', 'z', 'i', 'u', 'm', ';' };
+  const frenzy::uchar tscrsc_name[] = { 't', 's', 'c', 'r', ';' };
+  const frenzy::uchar tscysc_name[] = { 't', 's', 'c', 'y', ';' };
+  const frenzy::uchar tshcysc_name[] = { 't', 's', 'h', 'c', 'y', ';' };
+  const frenzy::uchar tstroksc_name[] = { 't', 's', 't', 'r', 'o', 'k', ';' };
+  const frenzy::uchar twixtsc_name[] = { 't', 'w', 'i', 'x', 't', ';' };
+  const frenzy::uchar twoheadleftarrowsc_name[] = { 't', 'w', 'o', 'h', 'e', 'a', 'd', 'l', 'e', 'f', 't', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar twoheadrightarrowsc_name[] = { 't', 'w', 'o', 'h', 'e', 'a', 'd', 'r', 'i', 'g', 'h', 't', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar uArrsc_name[] = { 'u', 'A', 'r', 'r', ';' };
+  const frenzy::uchar uHarsc_name[] = { 'u', 'H', 'a', 'r', ';' };
+  const frenzy::uchar uacute_name[] = { 'u', 'a', 'c', 'u', 't', 'e' };
+  const frenzy::uchar uacutesc_name[] = { 'u', 'a', 'c', 'u', 't', 'e', ';' };
+  const frenzy::uchar uarrsc_name[] = { 'u', 'a', 'r', 'r', ';' };
+  const frenzy::uchar ubrcysc_name[] = { 'u', 'b', 'r', 'c', 'y', ';' };
+  const frenzy::uchar ubrevesc_name[] = { 'u', 'b', 'r', 'e', 'v', 'e', ';' };
+  const frenzy::uchar ucirc_name[] = { 'u', 'c', 'i', 'r', 'c' };
+  const frenzy::uchar ucircsc_name[] = { 'u', 'c', 'i', 'r', 'c', ';' };
+  const frenzy::uchar ucysc_name[] = { 'u', 'c', 'y', ';' };
+  const frenzy::uchar udarrsc_name[] = { 'u', 'd', 'a', 'r', 'r', ';' };
+  const frenzy::uchar udblacsc_name[] = { 'u', 'd', 'b', 'l', 'a', 'c', ';' };
+  const frenzy::uchar udharsc_name[] = { 'u', 'd', 'h', 'a', 'r', ';' };
+  const frenzy::uchar ufishtsc_name[] = { 'u', 'f', 'i', 's', 'h', 't', ';' };
+  const frenzy::uchar ufrsc_name[] = { 'u', 'f', 'r', ';' };
+  const frenzy::uchar ugrave_name[] = { 'u', 'g', 'r', 'a', 'v', 'e' };
+  const frenzy::uchar ugravesc_name[] = { 'u', 'g', 'r', 'a', 'v', 'e', ';' };
+  const frenzy::uchar uharlsc_name[] = { 'u', 'h', 'a', 'r', 'l', ';' };
+  const frenzy::uchar uharrsc_name[] = { 'u', 'h', 'a', 'r', 'r', ';' };
+  const frenzy::uchar uhblksc_name[] = { 'u', 'h', 'b', 'l', 'k', ';' };
+  const frenzy::uchar ulcornsc_name[] = { 'u', 'l', 'c', 'o', 'r', 'n', ';' };
+  const frenzy::uchar ulcornersc_name[] = { 'u', 'l', 'c', 'o', 'r', 'n', 'e', 'r', ';' };
+  const frenzy::uchar ulcropsc_name[] = { 'u', 'l', 'c', 'r', 'o', 'p', ';' };
+  const frenzy::uchar ultrisc_name[] = { 'u', 'l', 't', 'r', 'i', ';' };
+  const frenzy::uchar umacrsc_name[] = { 'u', 'm', 'a', 'c', 'r', ';' };
+  const frenzy::uchar uml_name[] = { 'u', 'm', 'l' };
+  const frenzy::uchar umlsc_name[] = { 'u', 'm', 'l', ';' };
+  const frenzy::uchar uogonsc_name[] = { 'u', 'o', 'g', 'o', 'n', ';' };
+  const frenzy::uchar uopfsc_name[] = { 'u', 'o', 'p', 'f', ';' };
+  const frenzy::uchar uparrowsc_name[] = { 'u', 'p', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar updownarrowsc_name[] = { 'u', 'p', 'd', 'o', 'w', 'n', 'a', 'r', 'r', 'o', 'w', ';' };
+  const frenzy::uchar upharpoonleftsc_name[] = { 'u', 'p', 'h', 'a', 'r', 'p', 'o', 'o', 'n', 'l', 'e', 'f', 't', ';' };
+  const frenzy::uchar upharpoonrightsc_name[] = { 'u', 'p', 'h', 'a', 'r', 'p', 'o', 'o', 'n', 'r', 'i', 'g', 'h', 't', ';' };
+  const frenzy::uchar uplussc_name[] = { 'u', 'p', 'l', 'u', 's', ';' };
+  const frenzy::uchar upsisc_name[] = { 'u', 'p', 's', 'i', ';' };
+  const frenzy::uchar upsihsc_name[] = { 'u', 'p', 's', 'i', 'h', ';' };
+  const frenzy::uchar upsilonsc_name[] = { 'u', 'p', 's', 'i', 'l', 'o', 'n', ';' };
+  const frenzy::uchar upuparrowssc_name[] = { 'u', 'p', 'u', 'p', 'a', 'r', 'r', 'o', 'w', 's', ';' };
+  const frenzy::uchar urcornsc_name[] = { 'u', 'r', 'c', 'o', 'r', 'n', ';' };
+  const frenzy::uchar urcornersc_name[] = { 'u', 'r', 'c', 'o', 'r', 'n', 'e', 'r', ';' };
+  const frenzy::uchar urcropsc_name[] = { 'u', 'r', 'c', 'r', 'o', 'p', ';' };
+  const frenzy::uchar uringsc_name[] = { 'u', 'r', 'i', 'n', 'g', ';' };
+  const frenzy::uchar urtrisc_name[] = { 'u', 'r', 't', 'r', 'i', ';' };
+  const frenzy::uchar uscrsc_name[] = { 'u', 's', 'c', 'r', ';' };
+  const frenzy::uchar utdotsc_name[] = { 'u', 't', 'd', 'o', 't', ';' };
+  const frenzy::uchar utildesc_name[] = { 'u', 't', 'i', 'l', 'd', 'e', ';' };
+  const frenzy::uchar utrisc_name[] = { 'u', 't', 'r', 'i', ';' };
+  const frenzy::uchar utrifsc_name[] = { 'u', 't', 'r', 'i', 'f', ';' };
+  const frenzy::uchar uuarrsc_name[] = { 'u', 'u', 'a', 'r', 'r', ';' };
+  const frenzy::uchar uuml_name[] = { 'u', 'u', 'm', 'l' };
+  const frenzy::uchar uumlsc_name[] = { 'u', 'u', 'm', 'l', ';' };
+  const frenzy::uchar uwanglesc_name[] = { 'u', 'w', 'a', 'n', 'g', 'l', 'e', ';' };
+  const frenzy::uchar vArrsc_name[] = { 'v', 'A', 'r', 'r', ';' };
+  const frenzy::uchar vBarsc_name[] = { 'v', 'B', 'a', 'r', ';' };
+  const frenzy::uchar vBarvsc_name[] = { 'v', 'B', 'a', 'r', 'v', ';' };
+  const frenzy::uchar vDashsc_name[] = { 'v', 'D', 'a', 's', 'h', ';' };
+  const frenzy::uchar vangrtsc_name[] = { 'v', 'a', 'n', 'g', 'r', 't', ';' };
+  const frenzy::uchar varepsilonsc_name[] = { 'v', 'a', 'r', 'e', 'p', 's', 'i', 'l', 'o', 'n', ';' };
+  const frenzy::uchar varkappasc_name[] = { 'v', 'a', 'r', 'k', 'a', 'p', 'p', 'a', ';' };
+  const frenzy::uchar varnothingsc_name[] = { 'v', 'a', 'r', 'n', 'o', 't', 'h', 'i', 'n', 'g', ';' };
+  const frenzy::uchar varphisc_name[] = { 'v', 'a', 'r', 'p', 'h', 'i', ';' };
+  const frenzy::uchar varpisc_name[] = { 'v', 'a', 'r', 'p', 'i', ';' };
+  const frenzy::uchar varproptosc_name[] = { 'v', 'a', 'r', 'p', 'r', 'o', 'p', 't', 'o', ';' };
+  const frenzy::uchar varrsc_name[] = { 'v', 'a', 'r', 'r', ';' };
+  const frenzy::uchar varrhosc_name[] = { 'v', 'a', 'r', 'r', 'h', 'o', ';' };
+  const frenzy::uchar varsigmasc_name[] = { 'v', 'a', 'r', 's', 'i', 'g', 'm', 'a', ';' };
+  const frenzy::uchar varsubsetneqsc_name[] = { 'v', 'a', 'r', 's', 'u', 'b', 's', 'e', 't', 'n', 'e', 'q', ';' };
+  const frenzy::uchar varsubsetneqqsc_name[] = { 'v', 'a', 'r', 's', 'u', 'b', 's', 'e', 't', 'n', 'e', 'q', 'q', ';' };
+  const frenzy::uchar varsupsetneqsc_name[] = { 'v', 'a', 'r', 's', 'u', 'p', 's', 'e', 't', 'n', 'e', 'q', ';' };
+  const frenzy::uchar varsupsetneqqsc_name[] = { 'v', 'a', 'r', 's', 'u', 'p', 's', 'e', 't', 'n', 'e', 'q', 'q', ';' };
+  const frenzy::uchar varthetasc_name[] = { 'v', 'a', 'r', 't', 'h', 'e', 't', 'a', ';' };
+  const frenzy::uchar vartriangleleftsc_name[] = { 'v', 'a', 'r', 't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'l', 'e', 'f', 't', ';' };
+  const frenzy::uchar vartrianglerightsc_name[] = { 'v', 'a', 'r', 't', 'r', 'i', 'a', 'n', 'g', 'l', 'e', 'r', 'i', 'g', 'h', 't', ';' };
+  const frenzy::uchar vcysc_name[] = { 'v', 'c', 'y', ';' };
+  const frenzy::uchar vdashsc_name[] = { 'v', 'd', 'a', 's', 'h', ';' };
+  const frenzy::uchar veesc_name[] = { 'v', 'e', 'e', ';' };
+  const frenzy::uchar veebarsc_name[] = { 'v', 'e', 'e', 'b', 'a', 'r', ';' };
+  const frenzy::uchar veeeqsc_name[] = { 'v', 'e', 'e', 'e', 'q', ';' };
+  const frenzy::uchar vellipsc_name[] = { 'v', 'e', 'l', 'l', 'i', 'p', ';' };
+  const frenzy::uchar verbarsc_name[] = { 'v', 'e', 'r', 'b', 'a', 'r', ';' };
+  const frenzy::uchar vertsc_name[] = { 'v', 'e', 'r', 't', ';' };
+  const frenzy::uchar vfrsc_name[] = { 'v', 'f', 'r', ';' };
+  const frenzy::uchar vltrisc_name[] = { 'v', 'l', 't', 'r', 'i', ';' };
+  const frenzy::uchar vnsubsc_name[] = { 'v', 'n', 's', 'u', 'b', ';' };
+  const frenzy::uchar vnsupsc_name[] = { 'v', 'n', 's', 'u', 'p', ';' };
+  const frenzy::uchar vopfsc_name[] = { 'v', 'o', 'p', 'f', ';' };
+  const frenzy::uchar vpropsc_name[] = { 'v', 'p', 'r', 'o', 'p', ';' };
+  const frenzy::uchar vrtrisc_name[] = { 'v', 'r', 't', 'r', 'i', ';' };
+  const frenzy::uchar vscrsc_name[] = { 'v', 's', 'c', 'r', ';' };
+  const frenzy::uchar vsubnEsc_name[] = { 'v', 's', 'u', 'b', 'n', 'E', ';' };
+  const frenzy::uchar vsubnesc_name[] = { 'v', 's', 'u', 'b', 'n', 'e', ';' };
+  const frenzy::uchar vsupnEsc_name[] = { 'v', 's', 'u', 'p', 'n', 'E', ';' };
+  const frenzy::uchar vsupnesc_name[] = { 'v', 's', 'u', 'p', 'n', 'e', ';' };
+  const frenzy::uchar vzigzagsc_name[] = { 'v', 'z', 'i', 'g', 'z', 'a', 'g', ';' };
+  const frenzy::uchar wcircsc_name[] = { 'w', 'c', 'i', 'r', 'c', ';' };
+  const frenzy::uchar wedbarsc_name[] = { 'w', 'e', 'd', 'b', 'a', 'r', ';' };
+  const frenzy::uchar wedgesc_name[] = { 'w', 'e', 'd', 'g', 'e', ';' };
+  const frenzy::uchar wedgeqsc_name[] = { 'w', 'e', 'd', 'g', 'e', 'q', ';' };
+  const frenzy::uchar weierpsc_name[] = { 'w', 'e', 'i', 'e', 'r', 'p', ';' };
+  const frenzy::uchar wfrsc_name[] = { 'w', 'f', 'r', ';' };
+  const frenzy::uchar wopfsc_name[] = { 'w', 'o', 'p', 'f', ';' };
+  const frenzy::uchar wpsc_name[] = { 'w', 'p', ';' };
+  const frenzy::uchar wrsc_name[] = { 'w', 'r', ';' };
+  const frenzy::uchar wreathsc_name[] = { 'w', 'r', 'e', 'a', 't', 'h', ';' };
+  const frenzy::uchar wscrsc_name[] = { 'w', 's', 'c', 'r', ';' };
+  const frenzy::uchar xcapsc_name[] = { 'x', 'c', 'a', 'p', ';' };
+  const frenzy::uchar xcircsc_name[] = { 'x', 'c', 'i', 'r', 'c', ';' };
+  const frenzy::uchar xcupsc_name[] = { 'x', 'c', 'u', 'p', ';' };
+  const frenzy::uchar xdtrisc_name[] = { 'x', 'd', 't', 'r', 'i', ';' };
+  const frenzy::uchar xfrsc_name[] = { 'x', 'f', 'r', ';' };
+  const frenzy::uchar xhArrsc_name[] = { 'x', 'h', 'A', 'r', 'r', ';' };
+  const frenzy::uchar xharrsc_name[] = { 'x', 'h', 'a', 'r', 'r', ';' };
+  const frenzy::uchar xisc_name[] = { 'x', 'i', ';' };
+  const frenzy::uchar xlArrsc_name[] = { 'x', 'l', 'A', 'r', 'r', ';' };
+  const frenzy::uchar xlarrsc_name[] = { 'x', 'l', 'a', 'r', 'r', ';' };
+  const frenzy::uchar xmapsc_name[] = { 'x', 'm', 'a', 'p', ';' };
+  const frenzy::uchar xnissc_name[] = { 'x', 'n', 'i', 's', ';' };
+  const frenzy::uchar xodotsc_name[] = { 'x', 'o', 'd', 'o', 't', ';' };
+  const frenzy::uchar xopfsc_name[] = { 'x', 'o', 'p', 'f', ';' };
+  const frenzy::uchar xoplussc_name[] = { 'x', 'o', 'p', 'l', 'u', 's', ';' };
+  const frenzy::uchar xotimesc_name[] = { 'x', 'o', 't', 'i', 'm', 'e', ';' };
+  const frenzy::uchar xrArrsc_name[] = { 'x', 'r', 'A', 'r', 'r', ';' };
+  const frenzy::uchar xrarrsc_name[] = { 'x', 'r', 'a', 'r', 'r', ';' };
+  const frenzy::uchar xscrsc_name[] = { 'x', 's', 'c', 'r', ';' };
+  const frenzy::uchar xsqcupsc_name[] = { 'x', 's', 'q', 'c', 'u', 'p', ';' };
+  const frenzy::uchar xuplussc_name[] = { 'x', 'u', 'p', 'l', 'u', 's', ';' };
+  const frenzy::uchar xutrisc_name[] = { 'x', 'u', 't', 'r', 'i', ';' };
+  const frenzy::uchar xveesc_name[] = { 'x', 'v', 'e', 'e', ';' };
+  const frenzy::uchar xwedgesc_name[] = { 'x', 'w', 'e', 'd', 'g', 'e', ';' };
+  const frenzy::uchar yacute_name[] = { 'y', 'a', 'c', 'u', 't', 'e' };
+  const frenzy::uchar yacutesc_name[] = { 'y', 'a', 'c', 'u', 't', 'e', ';' };
+  const frenzy::uchar yacysc_name[] = { 'y', 'a', 'c', 'y', ';' };
+  const frenzy::uchar ycircsc_name[] = { 'y', 'c', 'i', 'r', 'c', ';' };
+  const frenzy::uchar ycysc_name[] = { 'y', 'c', 'y', ';' };
+  const frenzy::uchar yen_name[] = { 'y', 'e', 'n' };
+  const frenzy::uchar yensc_name[] = { 'y', 'e', 'n', ';' };
+  const frenzy::uchar yfrsc_name[] = { 'y', 'f', 'r', ';' };
+  const frenzy::uchar yicysc_name[] = { 'y', 'i', 'c', 'y', ';' };
+  const frenzy::uchar yopfsc_name[] = { 'y', 'o', 'p', 'f', ';' };
+  const frenzy::uchar yscrsc_name[] = { 'y', 's', 'c', 'r', ';' };
+  const frenzy::uchar yucysc_name[] = { 'y', 'u', 'c', 'y', ';' };
+  const frenzy::uchar yuml_name[] = { 'y', 'u', 'm', 'l' };
+  const frenzy::uchar yumlsc_name[] = { 'y', 'u', 'm', 'l', ';' };
+  const frenzy::uchar zacutesc_name[] = { 'z', 'a', 'c', 'u', 't', 'e', ';' };
+  const frenzy::uchar zcaronsc_name[] = { 'z', 'c', 'a', 'r', 'o', 'n', ';' };
+  const frenzy::uchar zcysc_name[] = { 'z', 'c', 'y', ';' };
+  const frenzy::uchar zdotsc_name[] = { 'z', 'd', 'o', 't', ';' };
+  const frenzy::uchar zeetrfsc_name[] = { 'z', 'e', 'e', 't', 'r', 'f', ';' };
+  const frenzy::uchar zetasc_name[] = { 'z', 'e', 't', 'a', ';' };
+  const frenzy::uchar zfrsc_name[] = { 'z', 'f', 'r', ';' };
+  const frenzy::uchar zhcysc_name[] = { 'z', 'h', 'c', 'y', ';' };
+  const frenzy::uchar zigrarrsc_name[] = { 'z', 'i', 'g', 'r', 'a', 'r', 'r', ';' };
+  const frenzy::uchar zopfsc_name[] = { 'z', 'o', 'p', 'f', ';' };
+  const frenzy::uchar zscrsc_name[] = { 'z', 's', 'c', 'r', ';' };
+  const frenzy::uchar zwjsc_name[] = { 'z', 'w', 'j', ';' };
+  const frenzy::uchar zwnjsc_name[] = { 'z', 'w', 'n', 'j', ';' };
+
+  const frenzy::parser::htmlentity entities[2231] = {
+    { AElig_name, 5, 198, 0 },
+    { AEligsc_name, 6, 198, 0 },
+    { AMP_name, 3, 38, 0 },
+    { AMPsc_name, 4, 38, 0 },
+    { Aacute_name, 6, 193, 0 },
+    { Aacutesc_name, 7, 193, 0 },
+    { Abrevesc_name, 7, 258, 0 },
+    { Acirc_name, 5, 194, 0 },
+    { Acircsc_name, 6, 194, 0 },
+    { Acysc_name, 4, 1040, 0 },
+    { Afrsc_name, 4, 120068, 0 },
+    { Agrave_name, 6, 192, 0 },
+    { Agravesc_name, 7, 192, 0 },
+    { Alphasc_name, 6, 913, 0 },
+    { Amacrsc_name, 6, 256, 0 },
+    { Andsc_name, 4, 10835, 0 },
+    { Aogonsc_name, 6, 260, 0 },
+    { Aopfsc_name, 5, 120120, 0 },
+    { ApplyFunctionsc_name, 14, 8289, 0 },
+    { Aring_name, 5, 197, 0 },
+    { Aringsc_name, 6, 197, 0 },
+    { Ascrsc_name, 5, 119964, 0 },
+    { Assignsc_name, 7, 8788, 0 },
+    { Atilde_name, 6, 195, 0 },
+    { Atildesc_name, 7, 195, 0 },
+    { Auml_name, 4, 196, 0 },
+    { Aumlsc_name, 5, 196, 0 },
+    { Backslashsc_name, 10, 8726, 0 },
+    { Barvsc_name, 5, 10983, 0 },
+    { Barwedsc_name, 7, 8966, 0 },
+    { Bcysc_name, 4, 1041, 0 },
+    { Becausesc_name, 8, 8757, 0 },
+    { Bernoullissc_name, 11, 8492, 0 },
+    { Betasc_name, 5, 914, 0 },
+    { Bfrsc_name, 4, 120069, 0 },
+    { Bopfsc_name, 5, 120121, 0 },
+    { Brevesc_name, 6, 728, 0 },
+    { Bscrsc_name, 5, 8492, 0 },
+    { Bumpeqsc_name, 7, 8782, 0 },
+    { CHcysc_name, 5, 1063, 0 },
+    { COPY_name, 4, 169, 0 },
+    { COPYsc_name, 5, 169, 0 },
+    { Cacutesc_name, 7, 262, 0 },
+    { Capsc_name, 4, 8914, 0 },
+    { CapitalDifferentialDsc_name, 21, 8517, 0 },
+    { Cayleyssc_name, 8, 8493, 0 },
+    { Ccaronsc_name, 7, 268, 0 },
+    { Ccedil_name, 6, 199, 0 },
+    { Ccedilsc_name, 7, 199, 0 },
+    { Ccircsc_name, 6, 264, 0 },
+    { Cconintsc_name, 8, 8752, 0 },
+    { Cdotsc_name, 5, 266, 0 },
+    { Cedillasc_name, 8, 184, 0 },
+    { CenterDotsc_name, 10, 183, 0 },
+    { Cfrsc_name, 4, 8493, 0 },
+    { Chisc_name, 4, 935, 0 },
+    { CircleDotsc_name, 10, 8857, 0 },
+    { CircleMinussc_name, 12, 8854, 0 },
+    { CirclePlussc_name, 11, 8853, 0 },
+    { CircleTimessc_name, 12, 8855, 0 },
+    { ClockwiseContourIntegralsc_name, 25, 8754, 0 },
+    { CloseCurlyDoubleQuotesc_name, 22, 8221, 0 },
+    { CloseCurlyQuotesc_name, 16, 8217, 0 },
+    { Colonsc_name, 6, 8759, 0 },
+    { Colonesc_name, 7, 10868, 0 },
+    { Congruentsc_name, 10, 8801, 0 },
+    { Conintsc_name, 7, 8751, 0 },
+    { ContourIntegralsc_name, 16, 8750, 0 },
+    { Copfsc_name, 5, 8450, 0 },
+    { Coproductsc_name, 10, 8720, 0 },
+    { CounterClockwiseContourIntegralsc_name, 32, 8755, 0 },
+    { Crosssc_name, 6, 10799, 0 },
+    { Cscrsc_name, 5, 119966, 0 },
+    { Cupsc_name, 4, 8915, 0 },
+    { CupCapsc_name, 7, 8781, 0 },
+    { DDsc_name, 3, 8517, 0 },
+    { DDotrahdsc_name, 9, 10513, 0 },
+    { DJcysc_name, 5, 1026, 0 },
+    { DScysc_name, 5, 1029, 0 },
+    { DZcysc_name, 5, 1039, 0 },
+    { Daggersc_name, 7, 8225, 0 },
+    { Darrsc_name, 5, 8609, 0 },
+    { Dashvsc_name, 6, 10980, 0 },
+    { Dcaronsc_name, 7, 270, 0 },
+    { Dcysc_name, 4, 1044, 0 },
+    { Delsc_name, 4, 8711, 0 },
+    { Deltasc_name, 6, 916, 0 },
+    { Dfrsc_name, 4, 120071, 0 },
+    { DiacriticalAcutesc_name, 17, 180, 0 },
+    { DiacriticalDotsc_name, 15, 729, 0 },
+    { DiacriticalDoubleAcutesc_name, 23, 733, 0 },
+    { DiacriticalGravesc_name, 17, 96, 0 },
+    { DiacriticalTildesc_name, 17, 732, 0 },
+    { Diamondsc_name, 8, 8900, 0 },
+    { DifferentialDsc_name, 14, 8518, 0 },
+    { Dopfsc_name, 5, 120123, 0 },
+    { Dotsc_name, 4, 168, 0 },
+    { DotDotsc_name, 7, 8412, 0 },
+    { DotEqualsc_name, 9, 8784, 0 },
+    { DoubleContourIntegralsc_name, 22, 8751, 0 },
+    { DoubleDotsc_name, 10, 168, 0 },
+    { DoubleDownArrowsc_name, 16, 8659, 0 },
+    { DoubleLeftArrowsc_name, 16, 8656, 0 },
+    { DoubleLeftRightArrowsc_name, 21, 8660, 0 },
+    { DoubleLeftTeesc_name, 14, 10980, 0 },
+    { DoubleLongLeftArrowsc_name, 20, 10232, 0 },
+    { DoubleLongLeftRightArrowsc_name, 25, 10234, 0 },
+    { DoubleLongRightArrowsc_name, 21, 10233, 0 },
+    { DoubleRightArrowsc_name, 17, 8658, 0 },
+    { DoubleRightTeesc_name, 15, 8872, 0 },
+    { DoubleUpArrowsc_name, 14, 8657, 0 },
+    { DoubleUpDownArrowsc_name, 18, 8661, 0 },
+    { DoubleVerticalBarsc_name, 18, 8741, 0 },
+    { DownArrowsc_name, 10, 8595, 0 },
+    { DownArrowBarsc_name, 13, 10515, 0 },
+    { DownArrowUpArrowsc_name, 17, 8693, 0 },
+    { DownBrevesc_name, 10, 785, 0 },
+    { DownLeftRightVectorsc_name, 20, 10576, 0 },
+    { DownLeftTeeVectorsc_name, 18, 10590, 0 },
+    { DownLeftVectorsc_name, 15, 8637, 0 },
+    { DownLeftVectorBarsc_name, 18, 10582, 0 },
+    { DownRightTeeVectorsc_name, 19, 10591, 0 },
+    { DownRightVectorsc_name, 16, 8641, 0 },
+    { DownRightVectorBarsc_name, 19, 10583, 0 },
+    { DownTeesc_name, 8, 8868, 0 },
+    { DownTeeArrowsc_name, 13, 8615, 0 },
+    { Downarrowsc_name, 10, 8659, 0 },
+    { Dscrsc_name, 5, 119967, 0 },
+    { Dstroksc_name, 7, 272, 0 },
+    { ENGsc_name, 4, 330, 0 },
+    { ETH_name, 3, 208, 0 },
+    { ETHsc_name, 4, 208, 0 },
+    { Eacute_name, 6, 201, 0 },
+    { Eacutesc_name, 7, 201, 0 },
+    { Ecaronsc_name, 7, 282, 0 },
+    { Ecirc_name, 5, 202, 0 },
+    { Ecircsc_name, 6, 202, 0 },
+    { Ecysc_name, 4, 1069, 0 },
+    { Edotsc_name, 5, 278, 0 },
+    { Efrsc_name, 4, 120072, 0 },
+    { Egrave_name, 6, 200, 0 },
+    { Egravesc_name, 7, 200, 0 },
+    { Elementsc_name, 8, 8712, 0 },
+    { Emacrsc_name, 6, 274, 0 },
+    { EmptySmallSquaresc_name, 17, 9723, 0 },
+    { EmptyVerySmallSquaresc_name, 21, 9643, 0 },
+    { Eogonsc_name, 6, 280, 0 },
+    { Eopfsc_name, 5, 120124, 0 },
+    { Epsilonsc_name, 8, 917, 0 },
+    { Equalsc_name, 6, 10869, 0 },
+    { EqualTildesc_name, 11, 8770, 0 },
+    { Equilibriumsc_name, 12, 8652, 0 },
+    { Escrsc_name, 5, 8496, 0 },
+    { Esimsc_name, 5, 10867, 0 },
+    { Etasc_name, 4, 919, 0 },
+    { Euml_name, 4, 203, 0 },
+    { Eumlsc_name, 5, 203, 0 },
+    { Existssc_name, 7, 8707, 0 },
+    { ExponentialEsc_name, 13, 8519, 0 },
+    { Fcysc_name, 4, 1060, 0 },
+    { Ffrsc_name, 4, 120073, 0 },
+    { FilledSmallSquaresc_name, 18, 9724, 0 },
+    { FilledVerySmallSquaresc_name, 22, 9642, 0 },
+    { Fopfsc_name, 5, 120125, 0 },
+    { ForAllsc_name, 7, 8704, 0 },
+    { Fouriertrfsc_name, 11, 8497, 0 },
+    { Fscrsc_name, 5, 8497, 0 },
+    { GJcysc_name, 5, 1027, 0 },
+    { GT_name, 2, 62, 0 },
+    { GTsc_name, 3, 62, 0 },
+    { Gammasc_name, 6, 915, 0 },
+    { Gammadsc_name, 7, 988, 0 },
+    { Gbrevesc_name, 7, 286, 0 },
+    { Gcedilsc_name, 7, 290, 0 },
+    { Gcircsc_name, 6, 284, 0 },
+    { Gcysc_name, 4, 1043, 0 },
+    { Gdotsc_name, 5, 288, 0 },
+    { Gfrsc_name, 4, 120074, 0 },
+    { Ggsc_name, 3, 8921, 0 },
+    { Gopfsc_name, 5, 120126, 0 },
+    { GreaterEqualsc_name, 13, 8805, 0 },
+    { GreaterEqualLesssc_name, 17, 8923, 0 },
+    { GreaterFullEqualsc_name, 17, 8807, 0 },
+    { GreaterGreatersc_name, 15, 10914, 0 },
+    { GreaterLesssc_name, 12, 8823, 0 },
+    { GreaterSlantEqualsc_name, 18, 10878, 0 },
+    { GreaterTildesc_name, 13, 8819, 0 },
+    { Gscrsc_name, 5, 119970, 0 },
+    { Gtsc_name, 3, 8811, 0 },
+    { HARDcysc_name, 7, 1066, 0 },
+    { Haceksc_name, 6, 711, 0 },
+    { Hatsc_name, 4, 94, 0 },
+    { Hcircsc_name, 6, 292, 0 },
+    { Hfrsc_name, 4, 8460, 0 },
+    { HilbertSpacesc_name, 13, 8459, 0 },
+    { Hopfsc_name, 5, 8461, 0 },
+    { HorizontalLinesc_name, 15, 9472, 0 },
+    { Hscrsc_name, 5, 8459, 0 },
+    { Hstroksc_name, 7, 294, 0 },
+    { HumpDownHumpsc_name, 13, 8782, 0 },
+    { HumpEqualsc_name, 10, 8783, 0 },
+    { IEcysc_name, 5, 1045, 0 },
+    { IJligsc_name, 6, 306, 0 },
+    { IOcysc_name, 5, 1025, 0 },
+    { Iacute_name, 6, 205, 0 },
+    { Iacutesc_name, 7, 205, 0 },
+    { Icirc_name, 5, 206, 0 },
+    { Icircsc_name, 6, 206, 0 },
+    { Icysc_name, 4, 1048, 0 },
+    { Idotsc_name, 5, 304, 0 },
+    { Ifrsc_name, 4, 8465, 0 },
+    { Igrave_name, 6, 204, 0 },
+    { Igravesc_name, 7, 204, 0 },
+    { Imsc_name, 3, 8465, 0 },
+    { Imacrsc_name, 6, 298, 0 },
+    { ImaginaryIsc_name, 11, 8520, 0 },
+    { Impliessc_name, 8, 8658, 0 },
+    { Intsc_name, 4, 8748, 0 },
+    { Integralsc_name, 9, 8747, 0 },
+    { Intersectionsc_name, 13, 8898, 0 },
+    { InvisibleCommasc_name, 15, 8291, 0 },
+    { InvisibleTimessc_name, 15, 8290, 0 },
+    { Iogonsc_name, 6, 302, 0 },
+    { Iopfsc_name, 5, 120128, 0 },
+    { Iotasc_name, 5, 921, 0 },
+    { Iscrsc_name, 5, 8464, 0 },
+    { Itildesc_name, 7, 296, 0 },
+    { Iukcysc_name, 6, 1030, 0 },
+    { Iuml_name, 4, 207, 0 },
+    { Iumlsc_name, 5, 207, 0 },
+    { Jcircsc_name, 6, 308, 0 },
+    { Jcysc_name, 4, 1049, 0 },
+    { Jfrsc_name, 4, 120077, 0 },
+    { Jopfsc_name, 5, 120129, 0 },
+    { Jscrsc_name, 5, 119973, 0 },
+    { Jsercysc_name, 7, 1032, 0 },
+    { Jukcysc_name, 6, 1028, 0 },
+    { KHcysc_name, 5, 1061, 0 },
+    { KJcysc_name, 5, 1036, 0 },
+    { Kappasc_name, 6, 922, 0 },
+    { Kcedilsc_name, 7, 310, 0 },
+    { Kcysc_name, 4, 1050, 0 },
+    { Kfrsc_name, 4, 120078, 0 },
+    { Kopfsc_name, 5, 120130, 0 },
+    { Kscrsc_name, 5, 119974, 0 },
+    { LJcysc_name, 5, 1033, 0 },
+    { LT_name, 2, 60, 0 },
+    { LTsc_name, 3, 60, 0 },
+    { Lacutesc_name, 7, 313, 0 },
+    { Lambdasc_name, 7, 923, 0 },
+    { Langsc_name, 5, 10218, 0 },
+    { Laplacetrfsc_name, 11, 8466, 0 },
+    { Larrsc_name, 5, 8606, 0 },
+    { Lcaronsc_name, 7, 317, 0 },
+    { Lcedilsc_name, 7, 315, 0 },
+    { Lcysc_name, 4, 1051, 0 },
+    { LeftAngleBracketsc_name, 17, 10216, 0 },
+    { LeftArrowsc_name, 10, 8592, 0 },
+    { LeftArrowBarsc_name, 13, 8676, 0 },
+    { LeftArrowRightArrowsc_name, 20, 8646, 0 },
+    { LeftCeilingsc_name, 12, 8968, 0 },
+    { LeftDoubleBracketsc_name, 18, 10214, 0 },
+    { LeftDownTeeVectorsc_name, 18, 10593, 0 },
+    { LeftDownVectorsc_name, 15, 8643, 0 },
+    { LeftDownVectorBarsc_name, 18, 10585, 0 },
+    { LeftFloorsc_name, 10, 8970, 0 },
+    { LeftRightArrowsc_name, 15, 8596, 0 },
+    { LeftRightVectorsc_name, 16, 10574, 0 },
+    { LeftTeesc_name, 8, 8867, 0 },
+    { LeftTeeArrowsc_name, 13, 8612, 0 },
+    { LeftTeeVectorsc_name, 14, 10586, 0 },
+    { LeftTrianglesc_name, 13, 8882, 0 },
+    { LeftTriangleBarsc_name, 16, 10703, 0 },
+    { LeftTriangleEqualsc_name, 18, 8884, 0 },
+    { LeftUpDownVectorsc_name, 17, 10577, 0 },
+    { LeftUpTeeVectorsc_name, 16, 10592, 0 },
+    { LeftUpVectorsc_name, 13, 8639, 0 },
+    { LeftUpVectorBarsc_name, 16, 10584, 0 },
+    { LeftVectorsc_name, 11, 8636, 0 },
+    { LeftVectorBarsc_name, 14, 10578, 0 },
+    { Leftarrowsc_name, 10, 8656, 0 },
+    { Leftrightarrowsc_name, 15, 8660, 0 },
+    { LessEqualGreatersc_name, 17, 8922, 0 },
+    { LessFullEqualsc_name, 14, 8806, 0 },
+    { LessGreatersc_name, 12, 8822, 0 },
+    { LessLesssc_name, 9, 10913, 0 },
+    { LessSlantEqualsc_name, 15, 10877, 0 },
+    { LessTildesc_name, 10, 8818, 0 },
+    { Lfrsc_name, 4, 120079, 0 },
+    { Llsc_name, 3, 8920, 0 },
+    { Lleftarrowsc_name, 11, 8666, 0 },
+    { Lmidotsc_name, 7, 319, 0 },
+    { LongLeftArrowsc_name, 14, 10229, 0 },
+    { LongLeftRightArrowsc_name, 19, 10231, 0 },
+    { LongRightArrowsc_name, 15, 10230, 0 },
+    { Longleftarrowsc_name, 14, 10232, 0 },
+    { Longleftrightarrowsc_name, 19, 10234, 0 },
+    { Longrightarrowsc_name, 15, 10233, 0 },
+    { Lopfsc_name, 5, 120131, 0 },
+    { LowerLeftArrowsc_name, 15, 8601, 0 },
+    { LowerRightArrowsc_name, 16, 8600, 0 },
+    { Lscrsc_name, 5, 8466, 0 },
+    { Lshsc_name, 4, 8624, 0 },
+    { Lstroksc_name, 7, 321, 0 },
+    { Ltsc_name, 3, 8810, 0 },
+    { Mapsc_name, 4, 10501, 0 },
+    { Mcysc_name, 4, 1052, 0 },
+    { MediumSpacesc_name, 12, 8287, 0 },
+    { Mellintrfsc_name, 10, 8499, 0 },
+    { Mfrsc_name, 4, 120080, 0 },
+    { MinusPlussc_name, 10, 8723, 0 },
+    { Mopfsc_name, 5, 120132, 0 },
+    { Mscrsc_name, 5, 8499, 0 },
+    { Musc_name, 3, 924, 0 },
+    { NJcysc_name, 5, 1034, 0 },
+    { Nacutesc_name, 7, 323, 0 },
+    { Ncaronsc_name, 7, 327, 0 },
+    { Ncedilsc_name, 7, 325, 0 },
+    { Ncysc_name, 4, 1053, 0 },
+    { NegativeMediumSpacesc_name, 20, 8203, 0 },
+    { NegativeThickSpacesc_name, 19, 8203, 0 },
+    { NegativeThinSpacesc_name, 18, 8203, 0 },
+    { NegativeVeryThinSpacesc_name, 22, 8203, 0 },
+    { NestedGreaterGreatersc_name, 21, 8811, 0 },
+    { NestedLessLesssc_name, 15, 8810, 0 },
+    { NewLinesc_name, 8, 10, 0 },
+    { Nfrsc_name, 4, 120081, 0 },
+    { NoBreaksc_name, 8, 8288, 0 },
+    { NonBreakingSpacesc_name, 17, 160, 0 },
+    { Nopfsc_name, 5, 8469, 0 },
+    { Notsc_name, 4, 10988, 0 },
+    { NotCongruentsc_name, 13, 8802, 0 },
+    { NotCupCapsc_name, 10, 8813, 0 },
+    { NotDoubleVerticalBarsc_name, 21, 8742, 0 },
+    { NotElementsc_name, 11, 8713, 0 },
+    { NotEqualsc_name, 9, 8800, 0 },
+    { NotEqualTildesc_name, 14, 8770, 824 },
+    { NotExistssc_name, 10, 8708, 0 },
+    { NotGreatersc_name, 11, 8815, 0 },
+    { NotGreaterEqualsc_name, 16, 8817, 0 },
+    { NotGreaterFullEqualsc_name, 20, 8807, 824 },
+    { NotGreaterGreatersc_name, 18, 8811, 824 },
+    { NotGreaterLesssc_name, 15, 8825, 0 },
+    { NotGreaterSlantEqualsc_name, 21, 10878, 824 },
+    { NotGreaterTildesc_name, 16, 8821, 0 },
+    { NotHumpDownHumpsc_name, 16, 8782, 824 },
+    { NotHumpEqualsc_name, 13, 8783, 824 },
+    { NotLeftTrianglesc_name, 16, 8938, 0 },
+    { NotLeftTriangleBarsc_name, 19, 10703, 824 },
+    { NotLeftTriangleEqualsc_name, 21, 8940, 0 },
+    { NotLesssc_name, 8, 8814, 0 },
+    { NotLessEqualsc_name, 13, 8816, 0 },
+    { NotLessGreatersc_name, 15, 8824, 0 },
+    { NotLessLesssc_name, 12, 8810, 824 },
+    { NotLessSlantEqualsc_name, 18, 10877, 824 },
+    { NotLessTildesc_name, 13, 8820, 0 },
+    { NotNestedGreaterGreatersc_name, 24, 10914, 824 },
+    { NotNestedLessLesssc_name, 18, 10913, 824 },
+    { NotPrecedessc_name, 12, 8832, 0 },
+    { NotPrecedesEqualsc_name, 17, 10927, 824 },
+    { NotPrecedesSlantEqualsc_name, 22, 8928, 0 },
+    { NotReverseElementsc_name, 18, 8716, 0 },
+    { NotRightTrianglesc_name, 17, 8939, 0 },
+    { NotRightTriangleBarsc_name, 20, 10704, 824 },
+    { NotRightTriangleEqualsc_name, 22, 8941, 0 },
+    { NotSquareSubsetsc_name, 16, 8847, 824 },
+    { NotSquareSubsetEqualsc_name, 21, 8930, 0 },
+    { NotSquareSupersetsc_name, 18, 8848, 824 },
+    { NotSquareSupersetEqualsc_name, 23, 8931, 0 },
+    { NotSubsetsc_name, 10, 8834, 8402 },
+    { NotSubsetEqualsc_name, 15, 8840, 0 },
+    { NotSucceedssc_name, 12, 8833, 0 },
+    { NotSucceedsEqualsc_name, 17, 10928, 824 },
+    { NotSucceedsSlantEqualsc_name, 22, 8929, 0 },
+    { NotSucceedsTildesc_name, 17, 8831, 824 },
+    { NotSupersetsc_name, 12, 8835, 8402 },
+    { NotSupersetEqualsc_name, 17, 8841, 0 },
+    { NotTildesc_name, 9, 8769, 0 },
+    { NotTildeEqualsc_name, 14, 8772, 0 },
+    { NotTildeFullEqualsc_name, 18, 8775, 0 },
+    { NotTildeTildesc_name, 14, 8777, 0 },
+    { NotVerticalBarsc_name, 15, 8740, 0 },
+    { Nscrsc_name, 5, 119977, 0 },
+    { Ntilde_name, 6, 209, 0 },
+    { Ntildesc_name, 7, 209, 0 },
+    { Nusc_name, 3, 925, 0 },
+    { OEligsc_name, 6, 338, 0 },
+    { Oacute_name, 6, 211, 0 },
+    { Oacutesc_name, 7, 211, 0 },
+    { Ocirc_name, 5, 212, 0 },
+    { Ocircsc_name, 6, 212, 0 },
+    { Ocysc_name, 4, 1054, 0 },
+    { Odblacsc_name, 7, 336, 0 },
+    { Ofrsc_name, 4, 120082, 0 },
+    { Ograve_name, 6, 210, 0 },
+    { Ogravesc_name, 7, 210, 0 },
+    { Omacrsc_name, 6, 332, 0 },
+    { Omegasc_name, 6, 937, 0 },
+    { Omicronsc_name, 8, 927, 0 },
+    { Oopfsc_name, 5, 120134, 0 },
+    { OpenCurlyDoubleQuotesc_name, 21, 8220, 0 },
+    { OpenCurlyQuotesc_name, 15, 8216, 0 },
+    { Orsc_name, 3, 10836, 0 },
+    { Oscrsc_name, 5, 119978, 0 },
+    { Oslash_name, 6, 216, 0 },
+    { Oslashsc_name, 7, 216, 0 },
+    { Otilde_name, 6, 213, 0 },
+    { Otildesc_name, 7, 213, 0 },
+    { Otimessc_name, 7, 10807, 0 },
+    { Ouml_name, 4, 214, 0 },
+    { Oumlsc_name, 5, 214, 0 },
+    { OverBarsc_name, 8, 8254, 0 },
+    { OverBracesc_name, 10, 9182, 0 },
+    { OverBracketsc_name, 12, 9140, 0 },
+    { OverParenthesissc_name, 16, 9180, 0 },
+    { PartialDsc_name, 9, 8706, 0 },
+    { Pcysc_name, 4, 1055, 0 },
+    { Pfrsc_name, 4, 120083, 0 },
+    { Phisc_name, 4, 934, 0 },
+    { Pisc_name, 3, 928, 0 },
+    { PlusMinussc_name, 10, 177, 0 },
+    { Poincareplanesc_name, 14, 8460, 0 },
+    { Popfsc_name, 5, 8473, 0 },
+    { Prsc_name, 3, 10939, 0 },
+    { Precedessc_name, 9, 8826, 0 },
+    { PrecedesEqualsc_name, 14, 10927, 0 },
+    { PrecedesSlantEqualsc_name, 19, 8828, 0 },
+    { PrecedesTildesc_name, 14, 8830, 0 },
+    { Primesc_name, 6, 8243, 0 },
+    { Productsc_name, 8, 8719, 0 },
+    { Proportionsc_name, 11, 8759, 0 },
+    { Proportionalsc_name, 13, 8733, 0 },
+    { Pscrsc_name, 5, 119979, 0 },
+    { Psisc_name, 4, 936, 0 },
+    { QUOT_name, 4, 34, 0 },
+    { QUOTsc_name, 5, 34, 0 },
+    { Qfrsc_name, 4, 120084, 0 },
+    { Qopfsc_name, 5, 8474, 0 },
+    { Qscrsc_name, 5, 119980, 0 },
+    { RBarrsc_name, 6, 10512, 0 },
+    { REG_name, 3, 174, 0 },
+    { REGsc_name, 4, 174, 0 },
+    { Racutesc_name, 7, 340, 0 },
+    { Rangsc_name, 5, 10219, 0 },
+    { Rarrsc_name, 5, 8608, 0 },
+    { Rarrtlsc_name, 7, 10518, 0 },
+    { Rcaronsc_name, 7, 344, 0 },
+    { Rcedilsc_name, 7, 342, 0 },
+    { Rcysc_name, 4, 1056, 0 },
+    { Resc_name, 3, 8476, 0 },
+    { ReverseElementsc_name, 15, 8715, 0 },
+    { ReverseEquilibriumsc_name, 19, 8651, 0 },
+    { ReverseUpEquilibriumsc_name, 21, 10607, 0 },
+    { Rfrsc_name, 4, 8476, 0 },
+    { Rhosc_name, 4, 929, 0 },
+    { RightAngleBracketsc_name, 18, 10217, 0 },
+    { RightArrowsc_name, 11, 8594, 0 },
+    { RightArrowBarsc_name, 14, 8677, 0 },
+    { RightArrowLeftArrowsc_name, 20, 8644, 0 },
+    { RightCeilingsc_name, 13, 8969, 0 },
+    { RightDoubleBracketsc_name, 19, 10215, 0 },
+    { RightDownTeeVectorsc_name, 19, 10589, 0 },
+    { RightDownVectorsc_name, 16, 8642, 0 },
+    { RightDownVectorBarsc_name, 19, 10581, 0 },
+    { RightFloorsc_name, 11, 8971, 0 },
+    { RightTeesc_name, 9, 8866, 0 },
+    { RightTeeArrowsc_name, 14, 8614, 0 },
+    { RightTeeVectorsc_name, 15, 10587, 0 },
+    { RightTrianglesc_name, 14, 8883, 0 },
+    { RightTriangleBarsc_name, 17, 10704, 0 },
+    { RightTriangleEqualsc_name, 19, 8885, 0 },
+    { RightUpDownVectorsc_name, 18, 10575, 0 },
+    { RightUpTeeVectorsc_name, 17, 10588, 0 },
+    { RightUpVectorsc_name, 14, 8638, 0 },
+    { RightUpVectorBarsc_name, 17, 10580, 0 },
+    { RightVectorsc_name, 12, 8640, 0 },
+    { RightVectorBarsc_name, 15, 10579, 0 },
+    { Rightarrowsc_name, 11, 8658, 0 },
+    { Ropfsc_name, 5, 8477, 0 },
+    { RoundImpliessc_name, 13, 10608, 0 },
+    { Rrightarrowsc_name, 12, 8667, 0 },
+    { Rscrsc_name, 5, 8475, 0 },
+    { Rshsc_name, 4, 8625, 0 },
+    { RuleDelayedsc_name, 12, 10740, 0 },
+    { SHCHcysc_name, 7, 1065, 0 },
+    { SHcysc_name, 5, 1064, 0 },
+    { SOFTcysc_name, 7, 1068, 0 },
+    { Sacutesc_name, 7, 346, 0 },
+    { Scsc_name, 3, 10940, 0 },
+    { Scaronsc_name, 7, 352, 0 },
+    { Scedilsc_name, 7, 350, 0 },
+    { Scircsc_name, 6, 348, 0 },
+    { Scysc_name, 4, 1057, 0 },
+    { Sfrsc_name, 4, 120086, 0 },
+    { ShortDownArrowsc_name, 15, 8595, 0 },
+    { ShortLeftArrowsc_name, 15, 8592, 0 },
+    { ShortRightArrowsc_name, 16, 8594, 0 },
+    { ShortUpArrowsc_name, 13, 8593, 0 },
+    { Sigmasc_name, 6, 931, 0 },
+    { SmallCirclesc_name, 12, 8728, 0 },
+    { Sopfsc_name, 5, 120138, 0 },
+    { Sqrtsc_name, 5, 8730, 0 },
+    { Squaresc_name, 7, 9633, 0 },
+    { SquareIntersectionsc_name, 19, 8851, 0 },
+    { SquareSubsetsc_name, 13, 8847, 0 },
+    { SquareSubsetEqualsc_name, 18, 8849, 0 },
+    { SquareSupersetsc_name, 15, 8848, 0 },
+    { SquareSupersetEqualsc_name, 20, 8850, 0 },
+    { SquareUnionsc_name, 12, 8852, 0 },
+    { Sscrsc_name, 5, 119982, 0 },
+    { Starsc_name, 5, 8902, 0 },
+    { Subsc_name, 4, 8912, 0 },
+    { Subsetsc_name, 7, 8912, 0 },
+    { SubsetEqualsc_name, 12, 8838, 0 },
+    { Succeedssc_name, 9, 8827, 0 },
+    { SucceedsEqualsc_name, 14, 10928, 0 },
+    { SucceedsSlantEqualsc_name, 19, 8829, 0 },
+    { SucceedsTildesc_name, 14, 8831, 0 },
+    { SuchThatsc_name, 9, 8715, 0 },
+    { Sumsc_name, 4, 8721, 0 },
+    { Supsc_name, 4, 8913, 0 },
+    { Supersetsc_name, 9, 8835, 0 },
+    { SupersetEqualsc_name, 14, 8839, 0 },
+    { Supsetsc_name, 7, 8913, 0 },
+    { THORN_name, 5, 222, 0 },
+    { THORNsc_name, 6, 222, 0 },
+    { TRADEsc_name, 6, 8482, 0 },
+    { TSHcysc_name, 6, 1035, 0 },
+    { TScysc_name, 5, 1062, 0 },
+    { Tabsc_name, 4, 9, 0 },
+    { Tausc_name, 4, 932, 0 },
+    { Tcaronsc_name, 7, 356, 0 },
+    { Tcedilsc_name, 7, 354, 0 },
+    { Tcysc_name, 4, 1058, 0 },
+    { Tfrsc_name, 4, 120087, 0 },
+    { Thereforesc_name, 10, 8756, 0 },
+    { Thetasc_name, 6, 920, 0 },
+    { ThickSpacesc_name, 11, 8287, 8202 },
+    { ThinSpacesc_name, 10, 8201, 0 },
+    { Tildesc_name, 6, 8764, 0 },
+    { TildeEqualsc_name, 11, 8771, 0 },
+    { TildeFullEqualsc_name, 15, 8773, 0 },
+    { TildeTildesc_name, 11, 8776, 0 },
+    { Topfsc_name, 5, 120139, 0 },
+    { TripleDotsc_name, 10, 8411, 0 },
+    { Tscrsc_name, 5, 119983, 0 },
+    { Tstroksc_name, 7, 358, 0 },
+    { Uacute_name, 6, 218, 0 },
+    { Uacutesc_name, 7, 218, 0 },
+    { Uarrsc_name, 5, 8607, 0 },
+    { Uarrocirsc_name, 9, 10569, 0 },
+    { Ubrcysc_name, 6, 1038, 0 },
+    { Ubrevesc_name, 7, 364, 0 },
+    { Ucirc_name, 5, 219, 0 },
+    { Ucircsc_name, 6, 219, 0 },
+    { Ucysc_name, 4, 1059, 0 },
+    { Udblacsc_name, 7, 368, 0 },
+    { Ufrsc_name, 4, 120088, 0 },
+    { Ugrave_name, 6, 217, 0 },
+    { Ugravesc_name, 7, 217, 0 },
+    { Umacrsc_name, 6, 362, 0 },
+    { UnderBarsc_name, 9, 95, 0 },
+    { UnderBracesc_name, 11, 9183, 0 },
+    { UnderBracketsc_name, 13, 9141, 0 },
+    { UnderParenthesissc_name, 17, 9181, 0 },
+    { Unionsc_name, 6, 8899, 0 },
+    { UnionPlussc_name, 10, 8846, 0 },
+    { Uogonsc_name, 6, 370, 0 },
+    { Uopfsc_name, 5, 120140, 0 },
+    { UpArrowsc_name, 8, 8593, 0 },
+    { UpArrowBarsc_name, 11, 10514, 0 },
+    { UpArrowDownArrowsc_name, 17, 8645, 0 },
+    { UpDownArrowsc_name, 12, 8597, 0 },
+    { UpEquilibriumsc_name, 14, 10606, 0 },
+    { UpTeesc_name, 6, 8869, 0 },
+    { UpTeeArrowsc_name, 11, 8613, 0 },
+    { Uparrowsc_name, 8, 8657, 0 },
+    { Updownarrowsc_name, 12, 8661, 0 },
+    { UpperLeftArrowsc_name, 15, 8598, 0 },
+    { UpperRightArrowsc_name, 16, 8599, 0 },
+    { Upsisc_name, 5, 978, 0 },
+    { Upsilonsc_name, 8, 933, 0 },
+    { Uringsc_name, 6, 366, 0 },
+    { Uscrsc_name, 5, 119984, 0 },
+    { Utildesc_name, 7, 360, 0 },
+    { Uuml_name, 4, 220, 0 },
+    { Uumlsc_name, 5, 220, 0 },
+    { VDashsc_name, 6, 8875, 0 },
+    { Vbarsc_name, 5, 10987, 0 },
+    { Vcysc_name, 4, 1042, 0 },
+    { Vdashsc_name, 6, 8873, 0 },
+    { Vdashlsc_name, 7, 10982, 0 },
+    { Veesc_name, 4, 8897, 0 },
+    { Verbarsc_name, 7, 8214, 0 },
+    { Vertsc_name, 5, 8214, 0 },
+    { VerticalBarsc_name, 12, 8739, 0 },
+    { VerticalLinesc_name, 13, 124, 0 },
+    { VerticalSeparatorsc_name, 18, 10072, 0 },
+    { VerticalTildesc_name, 14, 8768, 0 },
+    { VeryThinSpacesc_name, 14, 8202, 0 },
+    { Vfrsc_name, 4, 120089, 0 },
+    { Vopfsc_name, 5, 120141, 0 },
+    { Vscrsc_name, 5, 119985, 0 },
+    { Vvdashsc_name, 7, 8874, 0 },
+    { Wcircsc_name, 6, 372, 0 },
+    { Wedgesc_name, 6, 8896, 0 },
+    { Wfrsc_name, 4, 120090, 0 },
+    { Wopfsc_name, 5, 120142, 0 },
+    { Wscrsc_name, 5, 119986, 0 },
+    { Xfrsc_name, 4, 120091, 0 },
+    { Xisc_name, 3, 926, 0 },
+    { Xopfsc_name, 5, 120143, 0 },
+    { Xscrsc_name, 5, 119987, 0 },
+    { YAcysc_name, 5, 1071, 0 },
+    { YIcysc_name, 5, 1031, 0 },
+    { YUcysc_name, 5, 1070, 0 },
+    { Yacute_name, 6, 221, 0 },
+    { Yacutesc_name, 7, 221, 0 },
+    { Ycircsc_name, 6, 374, 0 },
+    { Ycysc_name, 4, 1067, 0 },
+    { Yfrsc_name, 4, 120092, 0 },
+    { Yopfsc_name, 5, 120144, 0 },
+    { Yscrsc_name, 5, 119988, 0 },
+    { Yumlsc_name, 5, 376, 0 },
+    { ZHcysc_name, 5, 1046, 0 },
+    { Zacutesc_name, 7, 377, 0 },
+    { Zcaronsc_name, 7, 381, 0 },
+    { Zcysc_name, 4, 1047, 0 },
+    { Zdotsc_name, 5, 379, 0 },
+    { ZeroWidthSpacesc_name, 15, 8203, 0 },
+    { Zetasc_name, 5, 918, 0 },
+    { Zfrsc_name, 4, 8488, 0 },
+    { Zopfsc_name, 5, 8484, 0 },
+    { Zscrsc_name, 5, 119989, 0 },
+    { aacute_name, 6, 225, 0 },
+    { aacutesc_name, 7, 225, 0 },
+    { abrevesc_name, 7, 259, 0 },
+    { acsc_name, 3, 8766, 0 },
+    { acEsc_name, 4, 8766, 819 },
+    { acdsc_name, 4, 8767, 0 },
+    { acirc_name, 5, 226, 0 },
+    { acircsc_name, 6, 226, 0 },
+    { acute_name, 5, 180, 0 },
+    { acutesc_name, 6, 180, 0 },
+    { acysc_name, 4, 1072, 0 },
+    { aelig_name, 5, 230, 0 },
+    { aeligsc_name, 6, 230, 0 },
+    { afsc_name, 3, 8289, 0 },
+    { afrsc_name, 4, 120094, 0 },
+    { agrave_name, 6, 224, 0 },
+    { agravesc_name, 7, 224, 0 },
+    { alefsymsc_name, 8, 8501, 0 },
+    { alephsc_name, 6, 8501, 0 },
+    { alphasc_name, 6, 945, 0 },
+    { amacrsc_name, 6, 257, 0 },
+    { amalgsc_name, 6, 10815, 0 },
+    { amp_name, 3, 38, 0 },
+    { ampsc_name, 4, 38, 0 },
+    { andsc_name, 4, 8743, 0 },
+    { andandsc_name, 7, 10837, 0 },
+    { anddsc_name, 5, 10844, 0 },
+    { andslopesc_name, 9, 10840, 0 },
+    { andvsc_name, 5, 10842, 0 },
+    { angsc_name, 4, 8736, 0 },
+    { angesc_name, 5, 10660, 0 },
+    { anglesc_name, 6, 8736, 0 },
+    { angmsdsc_name, 7, 8737, 0 },
+    { angmsdaasc_name, 9, 10664, 0 },
+    { angmsdabsc_name, 9, 10665, 0 },
+    { angmsdacsc_name, 9, 10666, 0 },
+    { angmsdadsc_name, 9, 10667, 0 },
+    { angmsdaesc_name, 9, 10668, 0 },
+    { angmsdafsc_name, 9, 10669, 0 },
+    { angmsdagsc_name, 9, 10670, 0 },
+    { angmsdahsc_name, 9, 10671, 0 },
+    { angrtsc_name, 6, 8735, 0 },
+    { angrtvbsc_name, 8, 8894, 0 },
+    { angrtvbdsc_name, 9, 10653, 0 },
+    { angsphsc_name, 7, 8738, 0 },
+    { angstsc_name, 6, 197, 0 },
+    { angzarrsc_name, 8, 9084, 0 },
+    { aogonsc_name, 6, 261, 0 },
+    { aopfsc_name, 5, 120146, 0 },
+    { apsc_name, 3, 8776, 0 },
+    { apEsc_name, 4, 10864, 0 },
+    { apacirsc_name, 7, 10863, 0 },
+    { apesc_name, 4, 8778, 0 },
+    { apidsc_name, 5, 8779, 0 },
+    { apossc_name, 5, 39, 0 },
+    { approxsc_name, 7, 8776, 0 },
+    { approxeqsc_name, 9, 8778, 0 },
+    { aring_name, 5, 229, 0 },
+    { aringsc_name, 6, 229, 0 },
+    { ascrsc_name, 5, 119990, 0 },
+    { astsc_name, 4, 42, 0 },
+    { asympsc_name, 6, 8776, 0 },
+    { asympeqsc_name, 8, 8781, 0 },
+    { atilde_name, 6, 227, 0 },
+    { atildesc_name, 7, 227, 0 },
+    { auml_name, 4, 228, 0 },
+    { aumlsc_name, 5, 228, 0 },
+    { awconintsc_name, 9, 8755, 0 },
+    { awintsc_name, 6, 10769, 0 },
+    { bNotsc_name, 5, 10989, 0 },
+    { backcongsc_name, 9, 8780, 0 },
+    { backepsilonsc_name, 12, 1014, 0 },
+    { backprimesc_name, 10, 8245, 0 },
+    { backsimsc_name, 8, 8765, 0 },
+    { backsimeqsc_name, 10, 8909, 0 },
+    { barveesc_name, 7, 8893, 0 },
+    { barwedsc_name, 7, 8965, 0 },
+    { barwedgesc_name, 9, 8965, 0 },
+    { bbrksc_name, 5, 9141, 0 },
+    { bbrktbrksc_name, 9, 9142, 0 },
+    { bcongsc_name, 6, 8780, 0 },
+    { bcysc_name, 4, 1073, 0 },
+    { bdquosc_name, 6, 8222, 0 },
+    { becaussc_name, 7, 8757, 0 },
+    { becausesc_name, 8, 8757, 0 },
+    { bemptyvsc_name, 8, 10672, 0 },
+    { bepsisc_name, 6, 1014, 0 },
+    { bernousc_name, 7, 8492, 0 },
+    { betasc_name, 5, 946, 0 },
+    { bethsc_name, 5, 8502, 0 },
+    { betweensc_name, 8, 8812, 0 },
+    { bfrsc_name, 4, 120095, 0 },
+    { bigcapsc_name, 7, 8898, 0 },
+    { bigcircsc_name, 8, 9711, 0 },
+    { bigcupsc_name, 7, 8899, 0 },
+    { bigodotsc_name, 8, 10752, 0 },
+    { bigoplussc_name, 9, 10753, 0 },
+    { bigotimessc_name, 10, 10754, 0 },
+    { bigsqcupsc_name, 9, 10758, 0 },
+    { bigstarsc_name, 8, 9733, 0 },
+    { bigtriangledownsc_name, 16, 9661, 0 },
+    { bigtriangleupsc_name, 14, 9651, 0 },
+    { biguplussc_name, 9, 10756, 0 },
+    { bigveesc_name, 7, 8897, 0 },
+    { bigwedgesc_name, 9, 8896, 0 },
+    { bkarowsc_name, 7, 10509, 0 },
+    { blacklozengesc_name, 13, 10731, 0 },
+    { blacksquaresc_name, 12, 9642, 0 },
+    { blacktrianglesc_name, 14, 9652, 0 },
+    { blacktriangledownsc_name, 18, 9662, 0 },
+    { blacktriangleleftsc_name, 18, 9666, 0 },
+    { blacktrianglerightsc_name, 19, 9656, 0 },
+    { blanksc_name, 6, 9251, 0 },
+    { blk12sc_name, 6, 9618, 0 },
+    { blk14sc_name, 6, 9617, 0 },
+    { blk34sc_name, 6, 9619, 0 },
+    { blocksc_name, 6, 9608, 0 },
+    { bnesc_name, 4, 61, 8421 },
+    { bnequivsc_name, 8, 8801, 8421 },
+    { bnotsc_name, 5, 8976, 0 },
+    { bopfsc_name, 5, 120147, 0 },
+    { botsc_name, 4, 8869, 0 },
+    { bottomsc_name, 7, 8869, 0 },
+    { bowtiesc_name, 7, 8904, 0 },
+    { boxDLsc_name, 6, 9559, 0 },
+    { boxDRsc_name, 6, 9556, 0 },
+    { boxDlsc_name, 6, 9558, 0 },
+    { boxDrsc_name, 6, 9555, 0 },
+    { boxHsc_name, 5, 9552, 0 },
+    { boxHDsc_name, 6, 9574, 0 },
+    { boxHUsc_name, 6, 9577, 0 },
+    { boxHdsc_name, 6, 9572, 0 },
+    { boxHusc_name, 6, 9575, 0 },
+    { boxULsc_name, 6, 9565, 0 },
+    { boxURsc_name, 6, 9562, 0 },
+    { boxUlsc_name, 6, 9564, 0 },
+    { boxUrsc_name, 6, 9561, 0 },
+    { boxVsc_name, 5, 9553, 0 },
+    { boxVHsc_name, 6, 9580, 0 },
+    { boxVLsc_name, 6, 9571, 0 },
+    { boxVRsc_name, 6, 9568, 0 },
+    { boxVhsc_name, 6, 9579, 0 },
+    { boxVlsc_name, 6, 9570, 0 },
+    { boxVrsc_name, 6, 9567, 0 },
+    { boxboxsc_name, 7, 10697, 0 },
+    { boxdLsc_name, 6, 9557, 0 },
+    { boxdRsc_name, 6, 9554, 0 },
+    { boxdlsc_name, 6, 9488, 0 },
+    { boxdrsc_name, 6, 9484, 0 },
+    { boxhsc_name, 5, 9472, 0 },
+    { boxhDsc_name, 6, 9573, 0 },
+    { boxhUsc_name, 6, 9576, 0 },
+    { boxhdsc_name, 6, 9516, 0 },
+    { boxhusc_name, 6, 9524, 0 },
+    { boxminussc_name, 9, 8863, 0 },
+    { boxplussc_name, 8, 8862, 0 },
+    { boxtimessc_name, 9, 8864, 0 },
+    { boxuLsc_name, 6, 9563, 0 },
+    { boxuRsc_name, 6, 9560, 0 },
+    { boxulsc_name, 6, 9496, 0 },
+    { boxursc_name, 6, 9492, 0 },
+    { boxvsc_name, 5, 9474, 0 },
+    { boxvHsc_name, 6, 9578, 0 },
+    { boxvLsc_name, 6, 9569, 0 },
+    { boxvRsc_name, 6, 9566, 0 },
+    { boxvhsc_name, 6, 9532, 0 },
+    { boxvlsc_name, 6, 9508, 0 },
+    { boxvrsc_name, 6, 9500, 0 },
+    { bprimesc_name, 7, 8245, 0 },
+    { brevesc_name, 6, 728, 0 },
+    { brvbar_name, 6, 166, 0 },
+    { brvbarsc_name, 7, 166, 0 },
+    { bscrsc_name, 5, 119991, 0 },
+    { bsemisc_name, 6, 8271, 0 },
+    { bsimsc_name, 5, 8765, 0 },
+    { bsimesc_name, 6, 8909, 0 },
+    { bsolsc_name, 5, 92, 0 },
+    { bsolbsc_name, 6, 10693, 0 },
+    { bsolhsubsc_name, 9, 10184, 0 },
+    { bullsc_name, 5, 8226, 0 },
+    { bulletsc_name, 7, 8226, 0 },
+    { bumpsc_name, 5, 8782, 0 },
+    { bumpEsc_name, 6, 10926, 0 },
+    { bumpesc_name, 6, 8783, 0 },
+    { bumpeqsc_name, 7, 8783, 0 },
+    { cacutesc_name, 7, 263, 0 },
+    { capsc_name, 4, 8745, 0 },
+    { capandsc_name, 7, 10820, 0 },
+    { capbrcupsc_name, 9, 10825, 0 },
+    { capcapsc_name, 7, 10827, 0 },
+    { capcupsc_name, 7, 10823, 0 },
+    { capdotsc_name, 7, 10816, 0 },
+    { capssc_name, 5, 8745, 65024 },
+    { caretsc_name, 6, 8257, 0 },
+    { caronsc_name, 6, 711, 0 },
+    { ccapssc_name, 6, 10829, 0 },
+    { ccaronsc_name, 7, 269, 0 },
+    { ccedil_name, 6, 231, 0 },
+    { ccedilsc_name, 7, 231, 0 },
+    { ccircsc_name, 6, 265, 0 },
+    { ccupssc_name, 6, 10828, 0 },
+    { ccupssmsc_name, 8, 10832, 0 },
+    { cdotsc_name, 5, 267, 0 },
+    { cedil_name, 5, 184, 0 },
+    { cedilsc_name, 6, 184, 0 },
+    { cemptyvsc_name, 8, 10674, 0 },
+    { cent_name, 4, 162, 0 },
+    { centsc_name, 5, 162, 0 },
+    { centerdotsc_name, 10, 183, 0 },
+    { cfrsc_name, 4, 120096, 0 },
+    { chcysc_name, 5, 1095, 0 },
+    { checksc_name, 6, 10003, 0 },
+    { checkmarksc_name, 10, 10003, 0 },
+    { chisc_name, 4, 967, 0 },
+    { cirsc_name, 4, 9675, 0 },
+    { cirEsc_name, 5, 10691, 0 },
+    { circsc_name, 5, 710, 0 },
+    { circeqsc_name, 7, 8791, 0 },
+    { circlearrowleftsc_name, 16, 8634, 0 },
+    { circlearrowrightsc_name, 17, 8635, 0 },
+    { circledRsc_name, 9, 174, 0 },
+    { circledSsc_name, 9, 9416, 0 },
+    { circledastsc_name, 11, 8859, 0 },
+    { circledcircsc_name, 12, 8858, 0 },
+    { circleddashsc_name, 12, 8861, 0 },
+    { ciresc_name, 5, 8791, 0 },
+    { cirfnintsc_name, 9, 10768, 0 },
+    { cirmidsc_name, 7, 10991, 0 },
+    { cirscirsc_name, 8, 10690, 0 },
+    { clubssc_name, 6, 9827, 0 },
+    { clubsuitsc_name, 9, 9827, 0 },
+    { colonsc_name, 6, 58, 0 },
+    { colonesc_name, 7, 8788, 0 },
+    { coloneqsc_name, 8, 8788, 0 },
+    { commasc_name, 6, 44, 0 },
+    { commatsc_name, 7, 64, 0 },
+    { compsc_name, 5, 8705, 0 },
+    { compfnsc_name, 7, 8728, 0 },
+    { complementsc_name, 11, 8705, 0 },
+    { complexessc_name, 10, 8450, 0 },
+    { congsc_name, 5, 8773, 0 },
+    { congdotsc_name, 8, 10861, 0 },
+    { conintsc_name, 7, 8750, 0 },
+    { copfsc_name, 5, 120148, 0 },
+    { coprodsc_name, 7, 8720, 0 },
+    { copy_name, 4, 169, 0 },
+    { copysc_name, 5, 169, 0 },
+    { copysrsc_name, 7, 8471, 0 },
+    { crarrsc_name, 6, 8629, 0 },
+    { crosssc_name, 6, 10007, 0 },
+    { cscrsc_name, 5, 119992, 0 },
+    { csubsc_name, 5, 10959, 0 },
+    { csubesc_name, 6, 10961, 0 },
+    { csupsc_name, 5, 10960, 0 },
+    { csupesc_name, 6, 10962, 0 },
+    { ctdotsc_name, 6, 8943, 0 },
+    { cudarrlsc_name, 8, 10552, 0 },
+    { cudarrrsc_name, 8, 10549, 0 },
+    { cueprsc_name, 6, 8926, 0 },
+    { cuescsc_name, 6, 8927, 0 },
+    { cularrsc_name, 7, 8630, 0 },
+    { cularrpsc_name, 8, 10557, 0 },
+    { cupsc_name, 4, 8746, 0 },
+    { cupbrcapsc_name, 9, 10824, 0 },
+    { cupcapsc_name, 7, 10822, 0 },
+    { cupcupsc_name, 7, 10826, 0 },
+    { cupdotsc_name, 7, 8845, 0 },
+    { cuporsc_name, 6, 10821, 0 },
+    { cupssc_name, 5, 8746, 65024 },
+    { curarrsc_name, 7, 8631, 0 },
+    { curarrmsc_name, 8, 10556, 0 },
+    { curlyeqprecsc_name, 12, 8926, 0 },
+    { curlyeqsuccsc_name, 12, 8927, 0 },
+    { curlyveesc_name, 9, 8910, 0 },
+    { curlywedgesc_name, 11, 8911, 0 },
+    { curren_name, 6, 164, 0 },
+    { currensc_name, 7, 164, 0 },
+    { curvearrowleftsc_name, 15, 8630, 0 },
+    { curvearrowrightsc_name, 16, 8631, 0 },
+    { cuveesc_name, 6, 8910, 0 },
+    { cuwedsc_name, 6, 8911, 0 },
+    { cwconintsc_name, 9, 8754, 0 },
+    { cwintsc_name, 6, 8753, 0 },
+    { cylctysc_name, 7, 9005, 0 },
+    { dArrsc_name, 5, 8659, 0 },
+    { dHarsc_name, 5, 10597, 0 },
+    { daggersc_name, 7, 8224, 0 },
+    { dalethsc_name, 7, 8504, 0 },
+    { darrsc_name, 5, 8595, 0 },
+    { dashsc_name, 5, 8208, 0 },
+    { dashvsc_name, 6, 8867, 0 },
+    { dbkarowsc_name, 8, 10511, 0 },
+    { dblacsc_name, 6, 733, 0 },
+    { dcaronsc_name, 7, 271, 0 },
+    { dcysc_name, 4, 1076, 0 },
+    { ddsc_name, 3, 8518, 0 },
+    { ddaggersc_name, 8, 8225, 0 },
+    { ddarrsc_name, 6, 8650, 0 },
+    { ddotseqsc_name, 8, 10871, 0 },
+    { deg_name, 3, 176, 0 },
+    { degsc_name, 4, 176, 0 },
+    { deltasc_name, 6, 948, 0 },
+    { demptyvsc_name, 8, 10673, 0 },
+    { dfishtsc_name, 7, 10623, 0 },
+    { dfrsc_name, 4, 120097, 0 },
+    { dharlsc_name, 6, 8643, 0 },
+    { dharrsc_name, 6, 8642, 0 },
+    { diamsc_name, 5, 8900, 0 },
+    { diamondsc_name, 8, 8900, 0 },
+    { diamondsuitsc_name, 12, 9830, 0 },
+    { diamssc_name, 6, 9830, 0 },
+    { diesc_name, 4, 168, 0 },
+    { digammasc_name, 8, 989, 0 },
+    { disinsc_name, 6, 8946, 0 },
+    { divsc_name, 4, 247, 0 },
+    { divide_name, 6, 247, 0 },
+    { dividesc_name, 7, 247, 0 },
+    { divideontimessc_name, 14, 8903, 0 },
+    { divonxsc_name, 7, 8903, 0 },
+    { djcysc_name, 5, 1106, 0 },
+    { dlcornsc_name, 7, 8990, 0 },
+    { dlcropsc_name, 7, 8973, 0 },
+    { dollarsc_name, 7, 36, 0 },
+    { dopfsc_name, 5, 120149, 0 },
+    { dotsc_name, 4, 729, 0 },
+    { doteqsc_name, 6, 8784, 0 },
+    { doteqdotsc_name, 9, 8785, 0 },
+    { dotminussc_name, 9, 8760, 0 },
+    { dotplussc_name, 8, 8724, 0 },
+    { dotsquaresc_name, 10, 8865, 0 },
+    { doublebarwedgesc_name, 15, 8966, 0 },
+    { downarrowsc_name, 10, 8595, 0 },
+    { downdownarrowssc_name, 15, 8650, 0 },
+    { downharpoonleftsc_name, 16, 8643, 0 },
+    { downharpoonrightsc_name, 17, 8642, 0 },
+    { drbkarowsc_name, 9, 10512, 0 },
+    { drcornsc_name, 7, 8991, 0 },
+    { drcropsc_name, 7, 8972, 0 },
+    { dscrsc_name, 5, 119993, 0 },
+    { dscysc_name, 5, 1109, 0 },
+    { dsolsc_name, 5, 10742, 0 },
+    { dstroksc_name, 7, 273, 0 },
+    { dtdotsc_name, 6, 8945, 0 },
+    { dtrisc_name, 5, 9663, 0 },
+    { dtrifsc_name, 6, 9662, 0 },
+    { duarrsc_name, 6, 8693, 0 },
+    { duharsc_name, 6, 10607, 0 },
+    { dwanglesc_name, 8, 10662, 0 },
+    { dzcysc_name, 5, 1119, 0 },
+    { dzigrarrsc_name, 9, 10239, 0 },
+    { eDDotsc_name, 6, 10871, 0 },
+    { eDotsc_name, 5, 8785, 0 },
+    { eacute_name, 6, 233, 0 },
+    { eacutesc_name, 7, 233, 0 },
+    { eastersc_name, 7, 10862, 0 },
+    { ecaronsc_name, 7, 283, 0 },
+    { ecirsc_name, 5, 8790, 0 },
+    { ecirc_name, 5, 234, 0 },
+    { ecircsc_name, 6, 234, 0 },
+    { ecolonsc_name, 7, 8789, 0 },
+    { ecysc_name, 4, 1101, 0 },
+    { edotsc_name, 5, 279, 0 },
+    { eesc_name, 3, 8519, 0 },
+    { efDotsc_name, 6, 8786, 0 },
+    { efrsc_name, 4, 120098, 0 },
+    { egsc_name, 3, 10906, 0 },
+    { egrave_name, 6, 232, 0 },
+    { egravesc_name, 7, 232, 0 },
+    { egssc_name, 4, 10902, 0 },
+    { egsdotsc_name, 7, 10904, 0 },
+    { elsc_name, 3, 10905, 0 },
+    { elinterssc_name, 9, 9191, 0 },
+    { ellsc_name, 4, 8467, 0 },
+    { elssc_name, 4, 10901, 0 },
+    { elsdotsc_name, 7, 10903, 0 },
+    { emacrsc_name, 6, 275, 0 },
+    { emptysc_name, 6, 8709, 0 },
+    { emptysetsc_name, 9, 8709, 0 },
+    { emptyvsc_name, 7, 8709, 0 },
+    { emsp13sc_name, 7, 8196, 0 },
+    { emsp14sc_name, 7, 8197, 0 },
+    { emspsc_name, 5, 8195, 0 },
+    { engsc_name, 4, 331, 0 },
+    { enspsc_name, 5, 8194, 0 },
+    { eogonsc_name, 6, 281, 0 },
+    { eopfsc_name, 5, 120150, 0 },
+    { eparsc_name, 5, 8917, 0 },
+    { eparslsc_name, 7, 10723, 0 },
+    { eplussc_name, 6, 10865, 0 },
+    { epsisc_name, 5, 949, 0 },
+    { epsilonsc_name, 8, 949, 0 },
+    { epsivsc_name, 6, 1013, 0 },
+    { eqcircsc_name, 7, 8790, 0 },
+    { eqcolonsc_name, 8, 8789, 0 },
+    { eqsimsc_name, 6, 8770, 0 },
+    { eqslantgtrsc_name, 11, 10902, 0 },
+    { eqslantlesssc_name, 12, 10901, 0 },
+    { equalssc_name, 7, 61, 0 },
+    { equestsc_name, 7, 8799, 0 },
+    { equivsc_name, 6, 8801, 0 },
+    { equivDDsc_name, 8, 10872, 0 },
+    { eqvparslsc_name, 9, 10725, 0 },
+    { erDotsc_name, 6, 8787, 0 },
+    { erarrsc_name, 6, 10609, 0 },
+    { escrsc_name, 5, 8495, 0 },
+    { esdotsc_name, 6, 8784, 0 },
+    { esimsc_name, 5, 8770, 0 },
+    { etasc_name, 4, 951, 0 },
+    { eth_name, 3, 240, 0 },
+    { ethsc_name, 4, 240, 0 },
+    { euml_name, 4, 235, 0 },
+    { eumlsc_name, 5, 235, 0 },
+    { eurosc_name, 5, 8364, 0 },
+    { exclsc_name, 5, 33, 0 },
+    { existsc_name, 6, 8707, 0 },
+    { expectationsc_name, 12, 8496, 0 },
+    { exponentialesc_name, 13, 8519, 0 },
+    { fallingdotseqsc_name, 14, 8786, 0 },
+    { fcysc_name, 4, 1092, 0 },
+    { femalesc_name, 7, 9792, 0 },
+    { ffiligsc_name, 7, 64259, 0 },
+    { ffligsc_name, 6, 64256, 0 },
+    { fflligsc_name, 7, 64260, 0 },
+    { ffrsc_name, 4, 120099, 0 },
+    { filigsc_name, 6, 64257, 0 },
+    { fjligsc_name, 6, 102, 106 },
+    { flatsc_name, 5, 9837, 0 },
+    { flligsc_name, 6, 64258, 0 },
+    { fltnssc_name, 6, 9649, 0 },
+    { fnofsc_name, 5, 402, 0 },
+    { fopfsc_name, 5, 120151, 0 },
+    { forallsc_name, 7, 8704, 0 },
+    { forksc_name, 5, 8916, 0 },
+    { forkvsc_name, 6, 10969, 0 },
+    { fpartintsc_name, 9, 10765, 0 },
+    { frac12_name, 6, 189, 0 },
+    { frac12sc_name, 7, 189, 0 },
+    { frac13sc_name, 7, 8531, 0 },
+    { frac14_name, 6, 188, 0 },
+    { frac14sc_name, 7, 188, 0 },
+    { frac15sc_name, 7, 8533, 0 },
+    { frac16sc_name, 7, 8537, 0 },
+    { frac18sc_name, 7, 8539, 0 },
+    { frac23sc_name, 7, 8532, 0 },
+    { frac25sc_name, 7, 8534, 0 },
+    { frac34_name, 6, 190, 0 },
+    { frac34sc_name, 7, 190, 0 },
+    { frac35sc_name, 7, 8535, 0 },
+    { frac38sc_name, 7, 8540, 0 },
+    { frac45sc_name, 7, 8536, 0 },
+    { frac56sc_name, 7, 8538, 0 },
+    { frac58sc_name, 7, 8541, 0 },
+    { frac78sc_name, 7, 8542, 0 },
+    { fraslsc_name, 6, 8260, 0 },
+    { frownsc_name, 6, 8994, 0 },
+    { fscrsc_name, 5, 119995, 0 },
+    { gEsc_name, 3, 8807, 0 },
+    { gElsc_name, 4, 10892, 0 },
+    { gacutesc_name, 7, 501, 0 },
+    { gammasc_name, 6, 947, 0 },
+    { gammadsc_name, 7, 989, 0 },
+    { gapsc_name, 4, 10886, 0 },
+    { gbrevesc_name, 7, 287, 0 },
+    { gcircsc_name, 6, 285, 0 },
+    { gcysc_name, 4, 1075, 0 },
+    { gdotsc_name, 5, 289, 0 },
+    { gesc_name, 3, 8805, 0 },
+    { gelsc_name, 4, 8923, 0 },
+    { geqsc_name, 4, 8805, 0 },
+    { geqqsc_name, 5, 8807, 0 },
+    { geqslantsc_name, 9, 10878, 0 },
+    { gessc_name, 4, 10878, 0 },
+    { gesccsc_name, 6, 10921, 0 },
+    { gesdotsc_name, 7, 10880, 0 },
+    { gesdotosc_name, 8, 10882, 0 },
+    { gesdotolsc_name, 9, 10884, 0 },
+    { geslsc_name, 5, 8923, 65024 },
+    { geslessc_name, 7, 10900, 0 },
+    { gfrsc_name, 4, 120100, 0 },
+    { ggsc_name, 3, 8811, 0 },
+    { gggsc_name, 4, 8921, 0 },
+    { gimelsc_name, 6, 8503, 0 },
+    { gjcysc_name, 5, 1107, 0 },
+    { glsc_name, 3, 8823, 0 },
+    { glEsc_name, 4, 10898, 0 },
+    { glasc_name, 4, 10917, 0 },
+    { gljsc_name, 4, 10916, 0 },
+    { gnEsc_name, 4, 8809, 0 },
+    { gnapsc_name, 5, 10890, 0 },
+    { gnapproxsc_name, 9, 10890, 0 },
+    { gnesc_name, 4, 10888, 0 },
+    { gneqsc_name, 5, 10888, 0 },
+    { gneqqsc_name, 6, 8809, 0 },
+    { gnsimsc_name, 6, 8935, 0 },
+    { gopfsc_name, 5, 120152, 0 },
+    { gravesc_name, 6, 96, 0 },
+    { gscrsc_name, 5, 8458, 0 },
+    { gsimsc_name, 5, 8819, 0 },
+    { gsimesc_name, 6, 10894, 0 },
+    { gsimlsc_name, 6, 10896, 0 },
+    { gt_name, 2, 62, 0 },
+    { gtsc_name, 3, 62, 0 },
+    { gtccsc_name, 5, 10919, 0 },
+    { gtcirsc_name, 6, 10874, 0 },
+    { gtdotsc_name, 6, 8919, 0 },
+    { gtlParsc_name, 7, 10645, 0 },
+    { gtquestsc_name, 8, 10876, 0 },
+    { gtrapproxsc_name, 10, 10886, 0 },
+    { gtrarrsc_name, 7, 10616, 0 },
+    { gtrdotsc_name, 7, 8919, 0 },
+    { gtreqlesssc_name, 10, 8923, 0 },
+    { gtreqqlesssc_name, 11, 10892, 0 },
+    { gtrlesssc_name, 8, 8823, 0 },
+    { gtrsimsc_name, 7, 8819, 0 },
+    { gvertneqqsc_name, 10, 8809, 65024 },
+    { gvnEsc_name, 5, 8809, 65024 },
+    { hArrsc_name, 5, 8660, 0 },
+    { hairspsc_name, 7, 8202, 0 },
+    { halfsc_name, 5, 189, 0 },
+    { hamiltsc_name, 7, 8459, 0 },
+    { hardcysc_name, 7, 1098, 0 },
+    { harrsc_name, 5, 8596, 0 },
+    { harrcirsc_name, 8, 10568, 0 },
+    { harrwsc_name, 6, 8621, 0 },
+    { hbarsc_name, 5, 8463, 0 },
+    { hcircsc_name, 6, 293, 0 },
+    { heartssc_name, 7, 9829, 0 },
+    { heartsuitsc_name, 10, 9829, 0 },
+    { hellipsc_name, 7, 8230, 0 },
+    { herconsc_name, 7, 8889, 0 },
+    { hfrsc_name, 4, 120101, 0 },
+    { hksearowsc_name, 9, 10533, 0 },
+    { hkswarowsc_name, 9, 10534, 0 },
+    { hoarrsc_name, 6, 8703, 0 },
+    { homthtsc_name, 7, 8763, 0 },
+    { hookleftarrowsc_name, 14, 8617, 0 },
+    { hookrightarrowsc_name, 15, 8618, 0 },
+    { hopfsc_name, 5, 120153, 0 },
+    { horbarsc_name, 7, 8213, 0 },
+    { hscrsc_name, 5, 119997, 0 },
+    { hslashsc_name, 7, 8463, 0 },
+    { hstroksc_name, 7, 295, 0 },
+    { hybullsc_name, 7, 8259, 0 },
+    { hyphensc_name, 7, 8208, 0 },
+    { iacute_name, 6, 237, 0 },
+    { iacutesc_name, 7, 237, 0 },
+    { icsc_name, 3, 8291, 0 },
+    { icirc_name, 5, 238, 0 },
+    { icircsc_name, 6, 238, 0 },
+    { icysc_name, 4, 1080, 0 },
+    { iecysc_name, 5, 1077, 0 },
+    { iexcl_name, 5, 161, 0 },
+    { iexclsc_name, 6, 161, 0 },
+    { iffsc_name, 4, 8660, 0 },
+    { ifrsc_name, 4, 120102, 0 },
+    { igrave_name, 6, 236, 0 },
+    { igravesc_name, 7, 236, 0 },
+    { iisc_name, 3, 8520, 0 },
+    { iiiintsc_name, 7, 10764, 0 },
+    { iiintsc_name, 6, 8749, 0 },
+    { iinfinsc_name, 7, 10716, 0 },
+    { iiotasc_name, 6, 8489, 0 },
+    { ijligsc_name, 6, 307, 0 },
+    { imacrsc_name, 6, 299, 0 },
+    { imagesc_name, 6, 8465, 0 },
+    { imaglinesc_name, 9, 8464, 0 },
+    { imagpartsc_name, 9, 8465, 0 },
+    { imathsc_name, 6, 305, 0 },
+    { imofsc_name, 5, 8887, 0 },
+    { impedsc_name, 6, 437, 0 },
+    { insc_name, 3, 8712, 0 },
+    { incaresc_name, 7, 8453, 0 },
+    { infinsc_name, 6, 8734, 0 },
+    { infintiesc_name, 9, 10717, 0 },
+    { inodotsc_name, 7, 305, 0 },
+    { intsc_name, 4, 8747, 0 },
+    { intcalsc_name, 7, 8890, 0 },
+    { integerssc_name, 9, 8484, 0 },
+    { intercalsc_name, 9, 8890, 0 },
+    { intlarhksc_name, 9, 10775, 0 },
+    { intprodsc_name, 8, 10812, 0 },
+    { iocysc_name, 5, 1105, 0 },
+    { iogonsc_name, 6, 303, 0 },
+    { iopfsc_name, 5, 120154, 0 },
+    { iotasc_name, 5, 953, 0 },
+    { iprodsc_name, 6, 10812, 0 },
+    { iquest_name, 6, 191, 0 },
+    { iquestsc_name, 7, 191, 0 },
+    { iscrsc_name, 5, 119998, 0 },
+    { isinsc_name, 5, 8712, 0 },
+    { isinEsc_name, 6, 8953, 0 },
+    { isindotsc_name, 8, 8949, 0 },
+    { isinssc_name, 6, 8948, 0 },
+    { isinsvsc_name, 7, 8947, 0 },
+    { isinvsc_name, 6, 8712, 0 },
+    { itsc_name, 3, 8290, 0 },
+    { itildesc_name, 7, 297, 0 },
+    { iukcysc_name, 6, 1110, 0 },
+    { iuml_name, 4, 239, 0 },
+    { iumlsc_name, 5, 239, 0 },
+    { jcircsc_name, 6, 309, 0 },
+    { jcysc_name, 4, 1081, 0 },
+    { jfrsc_name, 4, 120103, 0 },
+    { jmathsc_name, 6, 567, 0 },
+    { jopfsc_name, 5, 120155, 0 },
+    { jscrsc_name, 5, 119999, 0 },
+    { jsercysc_name, 7, 1112, 0 },
+    { jukcysc_name, 6, 1108, 0 },
+    { kappasc_name, 6, 954, 0 },
+    { kappavsc_name, 7, 1008, 0 },
+    { kcedilsc_name, 7, 311, 0 },
+    { kcysc_name, 4, 1082, 0 },
+    { kfrsc_name, 4, 120104, 0 },
+    { kgreensc_name, 7, 312, 0 },
+    { khcysc_name, 5, 1093, 0 },
+    { kjcysc_name, 5, 1116, 0 },
+    { kopfsc_name, 5, 120156, 0 },
+    { kscrsc_name, 5, 120000, 0 },
+    { lAarrsc_name, 6, 8666, 0 },
+    { lArrsc_name, 5, 8656, 0 },
+    { lAtailsc_name, 7, 10523, 0 },
+    { lBarrsc_name, 6, 10510, 0 },
+    { lEsc_name, 3, 8806, 0 },
+    { lEgsc_name, 4, 10891, 0 },
+    { lHarsc_name, 5, 10594, 0 },
+    { lacutesc_name, 7, 314, 0 },
+    { laemptyvsc_name, 9, 10676, 0 },
+    { lagransc_name, 7, 8466, 0 },
+    { lambdasc_name, 7, 955, 0 },
+    { langsc_name, 5, 10216, 0 },
+    { langdsc_name, 6, 10641, 0 },
+    { langlesc_name, 7, 10216, 0 },
+    { lapsc_name, 4, 10885, 0 },
+    { laquo_name, 5, 171, 0 },
+    { laquosc_name, 6, 171, 0 },
+    { larrsc_name, 5, 8592, 0 },
+    { larrbsc_name, 6, 8676, 0 },
+    { larrbfssc_name, 8, 10527, 0 },
+    { larrfssc_name, 7, 10525, 0 },
+    { larrhksc_name, 7, 8617, 0 },
+    { larrlpsc_name, 7, 8619, 0 },
+    { larrplsc_name, 7, 10553, 0 },
+    { larrsimsc_name, 8, 10611, 0 },
+    { larrtlsc_name, 7, 8610, 0 },
+    { latsc_name, 4, 10923, 0 },
+    { latailsc_name, 7, 10521, 0 },
+    { latesc_name, 5, 10925, 0 },
+    { latessc_name, 6, 10925, 65024 },
+    { lbarrsc_name, 6, 10508, 0 },
+    { lbbrksc_name, 6, 10098, 0 },
+    { lbracesc_name, 7, 123, 0 },
+    { lbracksc_name, 7, 91, 0 },
+    { lbrkesc_name, 6, 10635, 0 },
+    { lbrksldsc_name, 8, 10639, 0 },
+    { lbrkslusc_name, 8, 10637, 0 },
+    { lcaronsc_name, 7, 318, 0 },
+    { lcedilsc_name, 7, 316, 0 },
+    { lceilsc_name, 6, 8968, 0 },
+    { lcubsc_name, 5, 123, 0 },
+    { lcysc_name, 4, 1083, 0 },
+    { ldcasc_name, 5, 10550, 0 },
+    { ldquosc_name, 6, 8220, 0 },
+    { ldquorsc_name, 7, 8222, 0 },
+    { ldrdharsc_name, 8, 10599, 0 },
+    { ldrusharsc_name, 9, 10571, 0 },
+    { ldshsc_name, 5, 8626, 0 },
+    { lesc_name, 3, 8804, 0 },
+    { leftarrowsc_name, 10, 8592, 0 },
+    { leftarrowtailsc_name, 14, 8610, 0 },
+    { leftharpoondownsc_name, 16, 8637, 0 },
+    { leftharpoonupsc_name, 14, 8636, 0 },
+    { leftleftarrowssc_name, 15, 8647, 0 },
+    { leftrightarrowsc_name, 15, 8596, 0 },
+    { leftrightarrowssc_name, 16, 8646, 0 },
+    { leftrightharpoonssc_name, 18, 8651, 0 },
+    { leftrightsquigarrowsc_name, 20, 8621, 0 },
+    { leftthreetimessc_name, 15, 8907, 0 },
+    { legsc_name, 4, 8922, 0 },
+    { leqsc_name, 4, 8804, 0 },
+    { leqqsc_name, 5, 8806, 0 },
+    { leqslantsc_name, 9, 10877, 0 },
+    { lessc_name, 4, 10877, 0 },
+    { lesccsc_name, 6, 10920, 0 },
+    { lesdotsc_name, 7, 10879, 0 },
+    { lesdotosc_name, 8, 10881, 0 },
+    { lesdotorsc_name, 9, 10883, 0 },
+    { lesgsc_name, 5, 8922, 65024 },
+    { lesgessc_name, 7, 10899, 0 },
+    { lessapproxsc_name, 11, 10885, 0 },
+    { lessdotsc_name, 8, 8918, 0 },
+    { lesseqgtrsc_name, 10, 8922, 0 },
+    { lesseqqgtrsc_name, 11, 10891, 0 },
+    { lessgtrsc_name, 8, 8822, 0 },
+    { lesssimsc_name, 8, 8818, 0 },
+    { lfishtsc_name, 7, 10620, 0 },
+    { lfloorsc_name, 7, 8970, 0 },
+    { lfrsc_name, 4, 120105, 0 },
+    { lgsc_name, 3, 8822, 0 },
+    { lgEsc_name, 4, 10897, 0 },
+    { lhardsc_name, 6, 8637, 0 },
+    { lharusc_name, 6, 8636, 0 },
+    { lharulsc_name, 7, 10602, 0 },
+    { lhblksc_name, 6, 9604, 0 },
+    { ljcysc_name, 5, 1113, 0 },
+    { llsc_name, 3, 8810, 0 },
+    { llarrsc_name, 6, 8647, 0 },
+    { llcornersc_name, 9, 8990, 0 },
+    { llhardsc_name, 7, 10603, 0 },
+    { lltrisc_name, 6, 9722, 0 },
+    { lmidotsc_name, 7, 320, 0 },
+    { lmoustsc_name, 7, 9136, 0 },
+    { lmoustachesc_name, 11, 9136, 0 },
+    { lnEsc_name, 4, 8808, 0 },
+    { lnapsc_name, 5, 10889, 0 },
+    { lnapproxsc_name, 9, 10889, 0 },
+    { lnesc_name, 4, 10887, 0 },
+    { lneqsc_name, 5, 10887, 0 },
+    { lneqqsc_name, 6, 8808, 0 },
+    { lnsimsc_name, 6, 8934, 0 },
+    { loangsc_name, 6, 10220, 0 },
+    { loarrsc_name, 6, 8701, 0 },
+    { lobrksc_name, 6, 10214, 0 },
+    { longleftarrowsc_name, 14, 10229, 0 },
+    { longleftrightarrowsc_name, 19, 10231, 0 },
+    { longmapstosc_name, 11, 10236, 0 },
+    { longrightarrowsc_name, 15, 10230, 0 },
+    { looparrowleftsc_name, 14, 8619, 0 },
+    { looparrowrightsc_name, 15, 8620, 0 },
+    { loparsc_name, 6, 10629, 0 },
+    { lopfsc_name, 5, 120157, 0 },
+    { loplussc_name, 7, 10797, 0 },
+    { lotimessc_name, 8, 10804, 0 },
+    { lowastsc_name, 7, 8727, 0 },
+    { lowbarsc_name, 7, 95, 0 },
+    { lozsc_name, 4, 9674, 0 },
+    { lozengesc_name, 8, 9674, 0 },
+    { lozfsc_name, 5, 10731, 0 },
+    { lparsc_name, 5, 40, 0 },
+    { lparltsc_name, 7, 10643, 0 },
+    { lrarrsc_name, 6, 8646, 0 },
+    { lrcornersc_name, 9, 8991, 0 },
+    { lrharsc_name, 6, 8651, 0 },
+    { lrhardsc_name, 7, 10605, 0 },
+    { lrmsc_name, 4, 8206, 0 },
+    { lrtrisc_name, 6, 8895, 0 },
+    { lsaquosc_name, 7, 8249, 0 },
+    { lscrsc_name, 5, 120001, 0 },
+    { lshsc_name, 4, 8624, 0 },
+    { lsimsc_name, 5, 8818, 0 },
+    { lsimesc_name, 6, 10893, 0 },
+    { lsimgsc_name, 6, 10895, 0 },
+    { lsqbsc_name, 5, 91, 0 },
+    { lsquosc_name, 6, 8216, 0 },
+    { lsquorsc_name, 7, 8218, 0 },
+    { lstroksc_name, 7, 322, 0 },
+    { lt_name, 2, 60, 0 },
+    { ltsc_name, 3, 60, 0 },
+    { ltccsc_name, 5, 10918, 0 },
+    { ltcirsc_name, 6, 10873, 0 },
+    { ltdotsc_name, 6, 8918, 0 },
+    { lthreesc_name, 7, 8907, 0 },
+    { ltimessc_name, 7, 8905, 0 },
+    { ltlarrsc_name, 7, 10614, 0 },
+    { ltquestsc_name, 8, 10875, 0 },
+    { ltrParsc_name, 7, 10646, 0 },
+    { ltrisc_name, 5, 9667, 0 },
+    { ltriesc_name, 6, 8884, 0 },
+    { ltrifsc_name, 6, 9666, 0 },
+    { lurdsharsc_name, 9, 10570, 0 },
+    { luruharsc_name, 8, 10598, 0 },
+    { lvertneqqsc_name, 10, 8808, 65024 },
+    { lvnEsc_name, 5, 8808, 65024 },
+    { mDDotsc_name, 6, 8762, 0 },
+    { macr_name, 4, 175, 0 },
+    { macrsc_name, 5, 175, 0 },
+    { malesc_name, 5, 9794, 0 },
+    { maltsc_name, 5, 10016, 0 },
+    { maltesesc_name, 8, 10016, 0 },
+    { mapsc_name, 4, 8614, 0 },
+    { mapstosc_name, 7, 8614, 0 },
+    { mapstodownsc_name, 11, 8615, 0 },
+    { mapstoleftsc_name, 11, 8612, 0 },
+    { mapstoupsc_name, 9, 8613, 0 },
+    { markersc_name, 7, 9646, 0 },
+    { mcommasc_name, 7, 10793, 0 },
+    { mcysc_name, 4, 1084, 0 },
+    { mdashsc_name, 6, 8212, 0 },
+    { measuredanglesc_name, 14, 8737, 0 },
+    { mfrsc_name, 4, 120106, 0 },
+    { mhosc_name, 4, 8487, 0 },
+    { micro_name, 5, 181, 0 },
+    { microsc_name, 6, 181, 0 },
+    { midsc_name, 4, 8739, 0 },
+    { midastsc_name, 7, 42, 0 },
+    { midcirsc_name, 7, 10992, 0 },
+    { middot_name, 6, 183, 0 },
+    { middotsc_name, 7, 183, 0 },
+    { minussc_name, 6, 8722, 0 },
+    { minusbsc_name, 7, 8863, 0 },
+    { minusdsc_name, 7, 8760, 0 },
+    { minusdusc_name, 8, 10794, 0 },
+    { mlcpsc_name, 5, 10971, 0 },
+    { mldrsc_name, 5, 8230, 0 },
+    { mnplussc_name, 7, 8723, 0 },
+    { modelssc_name, 7, 8871, 0 },
+    { mopfsc_name, 5, 120158, 0 },
+    { mpsc_name, 3, 8723, 0 },
+    { mscrsc_name, 5, 120002, 0 },
+    { mstpossc_name, 7, 8766, 0 },
+    { musc_name, 3, 956, 0 },
+    { multimapsc_name, 9, 8888, 0 },
+    { mumapsc_name, 6, 8888, 0 },
+    { nGgsc_name, 4, 8921, 824 },
+    { nGtsc_name, 4, 8811, 8402 },
+    { nGtvsc_name, 5, 8811, 824 },
+    { nLeftarrowsc_name, 11, 8653, 0 },
+    { nLeftrightarrowsc_name, 16, 8654, 0 },
+    { nLlsc_name, 4, 8920, 824 },
+    { nLtsc_name, 4, 8810, 8402 },
+    { nLtvsc_name, 5, 8810, 824 },
+    { nRightarrowsc_name, 12, 8655, 0 },
+    { nVDashsc_name, 7, 8879, 0 },
+    { nVdashsc_name, 7, 8878, 0 },
+    { nablasc_name, 6, 8711, 0 },
+    { nacutesc_name, 7, 324, 0 },
+    { nangsc_name, 5, 8736, 8402 },
+    { napsc_name, 4, 8777, 0 },
+    { napEsc_name, 5, 10864, 824 },
+    { napidsc_name, 6, 8779, 824 },
+    { napossc_name, 6, 329, 0 },
+    { napproxsc_name, 8, 8777, 0 },
+    { natursc_name, 6, 9838, 0 },
+    { naturalsc_name, 8, 9838, 0 },
+    { naturalssc_name, 9, 8469, 0 },
+    { nbsp_name, 4, 160, 0 },
+    { nbspsc_name, 5, 160, 0 },
+    { nbumpsc_name, 6, 8782, 824 },
+    { nbumpesc_name, 7, 8783, 824 },
+    { ncapsc_name, 5, 10819, 0 },
+    { ncaronsc_name, 7, 328, 0 },
+    { ncedilsc_name, 7, 326, 0 },
+    { ncongsc_name, 6, 8775, 0 },
+    { ncongdotsc_name, 9, 10861, 824 },
+    { ncupsc_name, 5, 10818, 0 },
+    { ncysc_name, 4, 1085, 0 },
+    { ndashsc_name, 6, 8211, 0 },
+    { nesc_name, 3, 8800, 0 },
+    { neArrsc_name, 6, 8663, 0 },
+    { nearhksc_name, 7, 10532, 0 },
+    { nearrsc_name, 6, 8599, 0 },
+    { nearrowsc_name, 8, 8599, 0 },
+    { nedotsc_name, 6, 8784, 824 },
+    { nequivsc_name, 7, 8802, 0 },
+    { nesearsc_name, 7, 10536, 0 },
+    { nesimsc_name, 6, 8770, 824 },
+    { nexistsc_name, 7, 8708, 0 },
+    { nexistssc_name, 8, 8708, 0 },
+    { nfrsc_name, 4, 120107, 0 },
+    { ngEsc_name, 4, 8807, 824 },
+    { ngesc_name, 4, 8817, 0 },
+    { ngeqsc_name, 5, 8817, 0 },
+    { ngeqqsc_name, 6, 8807, 824 },
+    { ngeqslantsc_name, 10, 10878, 824 },
+    { ngessc_name, 5, 10878, 824 },
+    { ngsimsc_name, 6, 8821, 0 },
+    { ngtsc_name, 4, 8815, 0 },
+    { ngtrsc_name, 5, 8815, 0 },
+    { nhArrsc_name, 6, 8654, 0 },
+    { nharrsc_name, 6, 8622, 0 },
+    { nhparsc_name, 6, 10994, 0 },
+    { nisc_name, 3, 8715, 0 },
+    { nissc_name, 4, 8956, 0 },
+    { nisdsc_name, 5, 8954, 0 },
+    { nivsc_name, 4, 8715, 0 },
+    { njcysc_name, 5, 1114, 0 },
+    { nlArrsc_name, 6, 8653, 0 },
+    { nlEsc_name, 4, 8806, 824 },
+    { nlarrsc_name, 6, 8602, 0 },
+    { nldrsc_name, 5, 8229, 0 },
+    { nlesc_name, 4, 8816, 0 },
+    { nleftarrowsc_name, 11, 8602, 0 },
+    { nleftrightarrowsc_name, 16, 8622, 0 },
+    { nleqsc_name, 5, 8816, 0 },
+    { nleqqsc_name, 6, 8806, 824 },
+    { nleqslantsc_name, 10, 10877, 824 },
+    { nlessc_name, 5, 10877, 824 },
+    { nlesssc_name, 6, 8814, 0 },
+    { nlsimsc_name, 6, 8820, 0 },
+    { nltsc_name, 4, 8814, 0 },
+    { nltrisc_name, 6, 8938, 0 },
+    { nltriesc_name, 7, 8940, 0 },
+    { nmidsc_name, 5, 8740, 0 },
+    { nopfsc_name, 5, 120159, 0 },
+    { not_name, 3, 172, 0 },
+    { notsc_name, 4, 172, 0 },
+    { notinsc_name, 6, 8713, 0 },
+    { notinEsc_name, 7, 8953, 824 },
+    { notindotsc_name, 9, 8949, 824 },
+    { notinvasc_name, 8, 8713, 0 },
+    { notinvbsc_name, 8, 8951, 0 },
+    { notinvcsc_name, 8, 8950, 0 },
+    { notnisc_name, 6, 8716, 0 },
+    { notnivasc_name, 8, 8716, 0 },
+    { notnivbsc_name, 8, 8958, 0 },
+    { notnivcsc_name, 8, 8957, 0 },
+    { nparsc_name, 5, 8742, 0 },
+    { nparallelsc_name, 10, 8742, 0 },
+    { nparslsc_name, 7, 11005, 8421 },
+    { npartsc_name, 6, 8706, 824 },
+    { npolintsc_name, 8, 10772, 0 },
+    { nprsc_name, 4, 8832, 0 },
+    { nprcuesc_name, 7, 8928, 0 },
+    { npresc_name, 5, 10927, 824 },
+    { nprecsc_name, 6, 8832, 0 },
+    { npreceqsc_name, 8, 10927, 824 },
+    { nrArrsc_name, 6, 8655, 0 },
+    { nrarrsc_name, 6, 8603, 0 },
+    { nrarrcsc_name, 7, 10547, 824 },
+    { nrarrwsc_name, 7, 8605, 824 },
+    { nrightarrowsc_name, 12, 8603, 0 },
+    { nrtrisc_name, 6, 8939, 0 },
+    { nrtriesc_name, 7, 8941, 0 },
+    { nscsc_name, 4, 8833, 0 },
+    { nsccuesc_name, 7, 8929, 0 },
+    { nscesc_name, 5, 10928, 824 },
+    { nscrsc_name, 5, 120003, 0 },
+    { nshortmidsc_name, 10, 8740, 0 },
+    { nshortparallelsc_name, 15, 8742, 0 },
+    { nsimsc_name, 5, 8769, 0 },
+    { nsimesc_name, 6, 8772, 0 },
+    { nsimeqsc_name, 7, 8772, 0 },
+    { nsmidsc_name, 6, 8740, 0 },
+    { nsparsc_name, 6, 8742, 0 },
+    { nsqsubesc_name, 8, 8930, 0 },
+    { nsqsupesc_name, 8, 8931, 0 },
+    { nsubsc_name, 5, 8836, 0 },
+    { nsubEsc_name, 6, 10949, 824 },
+    { nsubesc_name, 6, 8840, 0 },
+    { nsubsetsc_name, 8, 8834, 8402 },
+    { nsubseteqsc_name, 10, 8840, 0 },
+    { nsubseteqqsc_name, 11, 10949, 824 },
+    { nsuccsc_name, 6, 8833, 0 },
+    { nsucceqsc_name, 8, 10928, 824 },
+    { nsupsc_name, 5, 8837, 0 },
+    { nsupEsc_name, 6, 10950, 824 },
+    { nsupesc_name, 6, 8841, 0 },
+    { nsupsetsc_name, 8, 8835, 8402 },
+    { nsupseteqsc_name, 10, 8841, 0 },
+    { nsupseteqqsc_name, 11, 10950, 824 },
+    { ntglsc_name, 5, 8825, 0 },
+    { ntilde_name, 6, 241, 0 },
+    { ntildesc_name, 7, 241, 0 },
+    { ntlgsc_name, 5, 8824, 0 },
+    { ntriangleleftsc_name, 14, 8938, 0 },
+    { ntrianglelefteqsc_name, 16, 8940, 0 },
+    { ntrianglerightsc_name, 15, 8939, 0 },
+    { ntrianglerighteqsc_name, 17, 8941, 0 },
+    { nusc_name, 3, 957, 0 },
+    { numsc_name, 4, 35, 0 },
+    { numerosc_name, 7, 8470, 0 },
+    { numspsc_name, 6, 8199, 0 },
+    { nvDashsc_name, 7, 8877, 0 },
+    { nvHarrsc_name, 7, 10500, 0 },
+    { nvapsc_name, 5, 8781, 8402 },
+    { nvdashsc_name, 7, 8876, 0 },
+    { nvgesc_name, 5, 8805, 8402 },
+    { nvgtsc_name, 5, 62, 8402 },
+    { nvinfinsc_name, 8, 10718, 0 },
+    { nvlArrsc_name, 7, 10498, 0 },
+    { nvlesc_name, 5, 8804, 8402 },
+    { nvltsc_name, 5, 60, 8402 },
+    { nvltriesc_name, 8, 8884, 8402 },
+    { nvrArrsc_name, 7, 10499, 0 },
+    { nvrtriesc_name, 8, 8885, 8402 },
+    { nvsimsc_name, 6, 8764, 8402 },
+    { nwArrsc_name, 6, 8662, 0 },
+    { nwarhksc_name, 7, 10531, 0 },
+    { nwarrsc_name, 6, 8598, 0 },
+    { nwarrowsc_name, 8, 8598, 0 },
+    { nwnearsc_name, 7, 10535, 0 },
+    { oSsc_name, 3, 9416, 0 },
+    { oacute_name, 6, 243, 0 },
+    { oacutesc_name, 7, 243, 0 },
+    { oastsc_name, 5, 8859, 0 },
+    { ocirsc_name, 5, 8858, 0 },
+    { ocirc_name, 5, 244, 0 },
+    { ocircsc_name, 6, 244, 0 },
+    { ocysc_name, 4, 1086, 0 },
+    { odashsc_name, 6, 8861, 0 },
+    { odblacsc_name, 7, 337, 0 },
+    { odivsc_name, 5, 10808, 0 },
+    { odotsc_name, 5, 8857, 0 },
+    { odsoldsc_name, 7, 10684, 0 },
+    { oeligsc_name, 6, 339, 0 },
+    { ofcirsc_name, 6, 10687, 0 },
+    { ofrsc_name, 4, 120108, 0 },
+    { ogonsc_name, 5, 731, 0 },
+    { ograve_name, 6, 242, 0 },
+    { ogravesc_name, 7, 242, 0 },
+    { ogtsc_name, 4, 10689, 0 },
+    { ohbarsc_name, 6, 10677, 0 },
+    { ohmsc_name, 4, 937, 0 },
+    { ointsc_name, 5, 8750, 0 },
+    { olarrsc_name, 6, 8634, 0 },
+    { olcirsc_name, 6, 10686, 0 },
+    { olcrosssc_name, 8, 10683, 0 },
+    { olinesc_name, 6, 8254, 0 },
+    { oltsc_name, 4, 10688, 0 },
+    { omacrsc_name, 6, 333, 0 },
+    { omegasc_name, 6, 969, 0 },
+    { omicronsc_name, 8, 959, 0 },
+    { omidsc_name, 5, 10678, 0 },
+    { ominussc_name, 7, 8854, 0 },
+    { oopfsc_name, 5, 120160, 0 },
+    { oparsc_name, 5, 10679, 0 },
+    { operpsc_name, 6, 10681, 0 },
+    { oplussc_name, 6, 8853, 0 },
+    { orsc_name, 3, 8744, 0 },
+    { orarrsc_name, 6, 8635, 0 },
+    { ordsc_name, 4, 10845, 0 },
+    { ordersc_name, 6, 8500, 0 },
+    { orderofsc_name, 8, 8500, 0 },
+    { ordf_name, 4, 170, 0 },
+    { ordfsc_name, 5, 170, 0 },
+    { ordm_name, 4, 186, 0 },
+    { ordmsc_name, 5, 186, 0 },
+    { origofsc_name, 7, 8886, 0 },
+    { ororsc_name, 5, 10838, 0 },
+    { orslopesc_name, 8, 10839, 0 },
+    { orvsc_name, 4, 10843, 0 },
+    { oscrsc_name, 5, 8500, 0 },
+    { oslash_name, 6, 248, 0 },
+    { oslashsc_name, 7, 248, 0 },
+    { osolsc_name, 5, 8856, 0 },
+    { otilde_name, 6, 245, 0 },
+    { otildesc_name, 7, 245, 0 },
+    { otimessc_name, 7, 8855, 0 },
+    { otimesassc_name, 9, 10806, 0 },
+    { ouml_name, 4, 246, 0 },
+    { oumlsc_name, 5, 246, 0 },
+    { ovbarsc_name, 6, 9021, 0 },
+    { parsc_name, 4, 8741, 0 },
+    { para_name, 4, 182, 0 },
+    { parasc_name, 5, 182, 0 },
+    { parallelsc_name, 9, 8741, 0 },
+    { parsimsc_name, 7, 10995, 0 },
+    { parslsc_name, 6, 11005, 0 },
+    { partsc_name, 5, 8706, 0 },
+    { pcysc_name, 4, 1087, 0 },
+    { percntsc_name, 7, 37, 0 },
+    { periodsc_name, 7, 46, 0 },
+    { permilsc_name, 7, 8240, 0 },
+    { perpsc_name, 5, 8869, 0 },
+    { pertenksc_name, 8, 8241, 0 },
+    { pfrsc_name, 4, 120109, 0 },
+    { phisc_name, 4, 966, 0 },
+    { phivsc_name, 5, 981, 0 },
+    { phmmatsc_name, 7, 8499, 0 },
+    { phonesc_name, 6, 9742, 0 },
+    { pisc_name, 3, 960, 0 },
+    { pitchforksc_name, 10, 8916, 0 },
+    { pivsc_name, 4, 982, 0 },
+    { plancksc_name, 7, 8463, 0 },
+    { planckhsc_name, 8, 8462, 0 },
+    { plankvsc_name, 7, 8463, 0 },
+    { plussc_name, 5, 43, 0 },
+    { plusacirsc_name, 9, 10787, 0 },
+    { plusbsc_name, 6, 8862, 0 },
+    { pluscirsc_name, 8, 10786, 0 },
+    { plusdosc_name, 7, 8724, 0 },
+    { plusdusc_name, 7, 10789, 0 },
+    { plusesc_name, 6, 10866, 0 },
+    { plusmn_name, 6, 177, 0 },
+    { plusmnsc_name, 7, 177, 0 },
+    { plussimsc_name, 8, 10790, 0 },
+    { plustwosc_name, 8, 10791, 0 },
+    { pmsc_name, 3, 177, 0 },
+    { pointintsc_name, 9, 10773, 0 },
+    { popfsc_name, 5, 120161, 0 },
+    { pound_name, 5, 163, 0 },
+    { poundsc_name, 6, 163, 0 },
+    { prsc_name, 3, 8826, 0 },
+    { prEsc_name, 4, 10931, 0 },
+    { prapsc_name, 5, 10935, 0 },
+    { prcuesc_name, 6, 8828, 0 },
+    { presc_name, 4, 10927, 0 },
+    { precsc_name, 5, 8826, 0 },
+    { precapproxsc_name, 11, 10935, 0 },
+    { preccurlyeqsc_name, 12, 8828, 0 },
+    { preceqsc_name, 7, 10927, 0 },
+    { precnapproxsc_name, 12, 10937, 0 },
+    { precneqqsc_name, 9, 10933, 0 },
+    { precnsimsc_name, 9, 8936, 0 },
+    { precsimsc_name, 8, 8830, 0 },
+    { primesc_name, 6, 8242, 0 },
+    { primessc_name, 7, 8473, 0 },
+    { prnEsc_name, 5, 10933, 0 },
+    { prnapsc_name, 6, 10937, 0 },
+    { prnsimsc_name, 7, 8936, 0 },
+    { prodsc_name, 5, 8719, 0 },
+    { profalarsc_name, 9, 9006, 0 },
+    { proflinesc_name, 9, 8978, 0 },
+    { profsurfsc_name, 9, 8979, 0 },
+    { propsc_name, 5, 8733, 0 },
+    { proptosc_name, 7, 8733, 0 },
+    { prsimsc_name, 6, 8830, 0 },
+    { prurelsc_name, 7, 8880, 0 },
+    { pscrsc_name, 5, 120005, 0 },
+    { psisc_name, 4, 968, 0 },
+    { puncspsc_name, 7, 8200, 0 },
+    { qfrsc_name, 4, 120110, 0 },
+    { qintsc_name, 5, 10764, 0 },
+    { qopfsc_name, 5, 120162, 0 },
+    { qprimesc_name, 7, 8279, 0 },
+    { qscrsc_name, 5, 120006, 0 },
+    { quaternionssc_name, 12, 8461, 0 },
+    { quatintsc_name, 8, 10774, 0 },
+    { questsc_name, 6, 63, 0 },
+    { questeqsc_name, 8, 8799, 0 },
+    { quot_name, 4, 34, 0 },
+    { quotsc_name, 5, 34, 0 },
+    { rAarrsc_name, 6, 8667, 0 },
+    { rArrsc_name, 5, 8658, 0 },
+    { rAtailsc_name, 7, 10524, 0 },
+    { rBarrsc_name, 6, 10511, 0 },
+    { rHarsc_name, 5, 10596, 0 },
+    { racesc_name, 5, 8765, 817 },
+    { racutesc_name, 7, 341, 0 },
+    { radicsc_name, 6, 8730, 0 },
+    { raemptyvsc_name, 9, 10675, 0 },
+    { rangsc_name, 5, 10217, 0 },
+    { rangdsc_name, 6, 10642, 0 },
+    { rangesc_name, 6, 10661, 0 },
+    { ranglesc_name, 7, 10217, 0 },
+    { raquo_name, 5, 187, 0 },
+    { raquosc_name, 6, 187, 0 },
+    { rarrsc_name, 5, 8594, 0 },
+    { rarrapsc_name, 7, 10613, 0 },
+    { rarrbsc_name, 6, 8677, 0 },
+    { rarrbfssc_name, 8, 10528, 0 },
+    { rarrcsc_name, 6, 10547, 0 },
+    { rarrfssc_name, 7, 10526, 0 },
+    { rarrhksc_name, 7, 8618, 0 },
+    { rarrlpsc_name, 7, 8620, 0 },
+    { rarrplsc_name, 7, 10565, 0 },
+    { rarrsimsc_name, 8, 10612, 0 },
+    { rarrtlsc_name, 7, 8611, 0 },
+    { rarrwsc_name, 6, 8605, 0 },
+    { ratailsc_name, 7, 10522, 0 },
+    { ratiosc_name, 6, 8758, 0 },
+    { rationalssc_name, 10, 8474, 0 },
+    { rbarrsc_name, 6, 10509, 0 },
+    { rbbrksc_name, 6, 10099, 0 },
+    { rbracesc_name, 7, 125, 0 },
+    { rbracksc_name, 7, 93, 0 },
+    { rbrkesc_name, 6, 10636, 0 },
+    { rbrksldsc_name, 8, 10638, 0 },
+    { rbrkslusc_name, 8, 10640, 0 },
+    { rcaronsc_name, 7, 345, 0 },
+    { rcedilsc_name, 7, 343, 0 },
+    { rceilsc_name, 6, 8969, 0 },
+    { rcubsc_name, 5, 125, 0 },
+    { rcysc_name, 4, 1088, 0 },
+    { rdcasc_name, 5, 10551, 0 },
+    { rdldharsc_name, 8, 10601, 0 },
+    { rdquosc_name, 6, 8221, 0 },
+    { rdquorsc_name, 7, 8221, 0 },
+    { rdshsc_name, 5, 8627, 0 },
+    { realsc_name, 5, 8476, 0 },
+    { realinesc_name, 8, 8475, 0 },
+    { realpartsc_name, 9, 8476, 0 },
+    { realssc_name, 6, 8477, 0 },
+    { rectsc_name, 5, 9645, 0 },
+    { reg_name, 3, 174, 0 },
+    { regsc_name, 4, 174, 0 },
+    { rfishtsc_name, 7, 10621, 0 },
+    { rfloorsc_name, 7, 8971, 0 },
+    { rfrsc_name, 4, 120111, 0 },
+    { rhardsc_name, 6, 8641, 0 },
+    { rharusc_name, 6, 8640, 0 },
+    { rharulsc_name, 7, 10604, 0 },
+    { rhosc_name, 4, 961, 0 },
+    { rhovsc_name, 5, 1009, 0 },
+    { rightarrowsc_name, 11, 8594, 0 },
+    { rightarrowtailsc_name, 15, 8611, 0 },
+    { rightharpoondownsc_name, 17, 8641, 0 },
+    { rightharpoonupsc_name, 15, 8640, 0 },
+    { rightleftarrowssc_name, 16, 8644, 0 },
+    { rightleftharpoonssc_name, 18, 8652, 0 },
+    { rightrightarrowssc_name, 17, 8649, 0 },
+    { rightsquigarrowsc_name, 16, 8605, 0 },
+    { rightthreetimessc_name, 16, 8908, 0 },
+    { ringsc_name, 5, 730, 0 },
+    { risingdotseqsc_name, 13, 8787, 0 },
+    { rlarrsc_name, 6, 8644, 0 },
+    { rlharsc_name, 6, 8652, 0 },
+    { rlmsc_name, 4, 8207, 0 },
+    { rmoustsc_name, 7, 9137, 0 },
+    { rmoustachesc_name, 11, 9137, 0 },
+    { rnmidsc_name, 6, 10990, 0 },
+    { roangsc_name, 6, 10221, 0 },
+    { roarrsc_name, 6, 8702, 0 },
+    { robrksc_name, 6, 10215, 0 },
+    { roparsc_name, 6, 10630, 0 },
+    { ropfsc_name, 5, 120163, 0 },
+    { roplussc_name, 7, 10798, 0 },
+    { rotimessc_name, 8, 10805, 0 },
+    { rparsc_name, 5, 41, 0 },
+    { rpargtsc_name, 7, 10644, 0 },
+    { rppolintsc_name, 9, 10770, 0 },
+    { rrarrsc_name, 6, 8649, 0 },
+    { rsaquosc_name, 7, 8250, 0 },
+    { rscrsc_name, 5, 120007, 0 },
+    { rshsc_name, 4, 8625, 0 },
+    { rsqbsc_name, 5, 93, 0 },
+    { rsquosc_name, 6, 8217, 0 },
+    { rsquorsc_name, 7, 8217, 0 },
+    { rthreesc_name, 7, 8908, 0 },
+    { rtimessc_name, 7, 8906, 0 },
+    { rtrisc_name, 5, 9657, 0 },
+    { rtriesc_name, 6, 8885, 0 },
+    { rtrifsc_name, 6, 9656, 0 },
+    { rtriltrisc_name, 9, 10702, 0 },
+    { ruluharsc_name, 8, 10600, 0 },
+    { rxsc_name, 3, 8478, 0 },
+    { sacutesc_name, 7, 347, 0 },
+    { sbquosc_name, 6, 8218, 0 },
+    { scsc_name, 3, 8827, 0 },
+    { scEsc_name, 4, 10932, 0 },
+    { scapsc_name, 5, 10936, 0 },
+    { scaronsc_name, 7, 353, 0 },
+    { sccuesc_name, 6, 8829, 0 },
+    { scesc_name, 4, 10928, 0 },
+    { scedilsc_name, 7, 351, 0 },
+    { scircsc_name, 6, 349, 0 },
+    { scnEsc_name, 5, 10934, 0 },
+    { scnapsc_name, 6, 10938, 0 },
+    { scnsimsc_name, 7, 8937, 0 },
+    { scpolintsc_name, 9, 10771, 0 },
+    { scsimsc_name, 6, 8831, 0 },
+    { scysc_name, 4, 1089, 0 },
+    { sdotsc_name, 5, 8901, 0 },
+    { sdotbsc_name, 6, 8865, 0 },
+    { sdotesc_name, 6, 10854, 0 },
+    { seArrsc_name, 6, 8664, 0 },
+    { searhksc_name, 7, 10533, 0 },
+    { searrsc_name, 6, 8600, 0 },
+    { searrowsc_name, 8, 8600, 0 },
+    { sect_name, 4, 167, 0 },
+    { sectsc_name, 5, 167, 0 },
+    { semisc_name, 5, 59, 0 },
+    { seswarsc_name, 7, 10537, 0 },
+    { setminussc_name, 9, 8726, 0 },
+    { setmnsc_name, 6, 8726, 0 },
+    { sextsc_name, 5, 10038, 0 },
+    { sfrsc_name, 4, 120112, 0 },
+    { sfrownsc_name, 7, 8994, 0 },
+    { sharpsc_name, 6, 9839, 0 },
+    { shchcysc_name, 7, 1097, 0 },
+    { shcysc_name, 5, 1096, 0 },
+    { shortmidsc_name, 9, 8739, 0 },
+    { shortparallelsc_name, 14, 8741, 0 },
+    { shy_name, 3, 173, 0 },
+    { shysc_name, 4, 173, 0 },
+    { sigmasc_name, 6, 963, 0 },
+    { sigmafsc_name, 7, 962, 0 },
+    { sigmavsc_name, 7, 962, 0 },
+    { simsc_name, 4, 8764, 0 },
+    { simdotsc_name, 7, 10858, 0 },
+    { simesc_name, 5, 8771, 0 },
+    { simeqsc_name, 6, 8771, 0 },
+    { simgsc_name, 5, 10910, 0 },
+    { simgEsc_name, 6, 10912, 0 },
+    { simlsc_name, 5, 10909, 0 },
+    { simlEsc_name, 6, 10911, 0 },
+    { simnesc_name, 6, 8774, 0 },
+    { simplussc_name, 8, 10788, 0 },
+    { simrarrsc_name, 8, 10610, 0 },
+    { slarrsc_name, 6, 8592, 0 },
+    { smallsetminussc_name, 14, 8726, 0 },
+    { smashpsc_name, 7, 10803, 0 },
+    { smeparslsc_name, 9, 10724, 0 },
+    { smidsc_name, 5, 8739, 0 },
+    { smilesc_name, 6, 8995, 0 },
+    { smtsc_name, 4, 10922, 0 },
+    { smtesc_name, 5, 10924, 0 },
+    { smtessc_name, 6, 10924, 65024 },
+    { softcysc_name, 7, 1100, 0 },
+    { solsc_name, 4, 47, 0 },
+    { solbsc_name, 5, 10692, 0 },
+    { solbarsc_name, 7, 9023, 0 },
+    { sopfsc_name, 5, 120164, 0 },
+    { spadessc_name, 7, 9824, 0 },
+    { spadesuitsc_name, 10, 9824, 0 },
+    { sparsc_name, 5, 8741, 0 },
+    { sqcapsc_name, 6, 8851, 0 },
+    { sqcapssc_name, 7, 8851, 65024 },
+    { sqcupsc_name, 6, 8852, 0 },
+    { sqcupssc_name, 7, 8852, 65024 },
+    { sqsubsc_name, 6, 8847, 0 },
+    { sqsubesc_name, 7, 8849, 0 },
+    { sqsubsetsc_name, 9, 8847, 0 },
+    { sqsubseteqsc_name, 11, 8849, 0 },
+    { sqsupsc_name, 6, 8848, 0 },
+    { sqsupesc_name, 7, 8850, 0 },
+    { sqsupsetsc_name, 9, 8848, 0 },
+    { sqsupseteqsc_name, 11, 8850, 0 },
+    { squsc_name, 4, 9633, 0 },
+    { squaresc_name, 7, 9633, 0 },
+    { squarfsc_name, 7, 9642, 0 },
+    { squfsc_name, 5, 9642, 0 },
+    { srarrsc_name, 6, 8594, 0 },
+    { sscrsc_name, 5, 120008, 0 },
+    { ssetmnsc_name, 7, 8726, 0 },
+    { ssmilesc_name, 7, 8995, 0 },
+    { sstarfsc_name, 7, 8902, 0 },
+    { starsc_name, 5, 9734, 0 },
+    { starfsc_name, 6, 9733, 0 },
+    { straightepsilonsc_name, 16, 1013, 0 },
+    { straightphisc_name, 12, 981, 0 },
+    { strnssc_name, 6, 175, 0 },
+    { subsc_name, 4, 8834, 0 },
+    { subEsc_name, 5, 10949, 0 },
+    { subdotsc_name, 7, 10941, 0 },
+    { subesc_name, 5, 8838, 0 },
+    { subedotsc_name, 8, 10947, 0 },
+    { submultsc_name, 8, 10945, 0 },
+    { subnEsc_name, 6, 10955, 0 },
+    { subnesc_name, 6, 8842, 0 },
+    { subplussc_name, 8, 10943, 0 },
+    { subrarrsc_name, 8, 10617, 0 },
+    { subsetsc_name, 7, 8834, 0 },
+    { subseteqsc_name, 9, 8838, 0 },
+    { subseteqqsc_name, 10, 10949, 0 },
+    { subsetneqsc_name, 10, 8842, 0 },
+    { subsetneqqsc_name, 11, 10955, 0 },
+    { subsimsc_name, 7, 10951, 0 },
+    { subsubsc_name, 7, 10965, 0 },
+    { subsupsc_name, 7, 10963, 0 },
+    { succsc_name, 5, 8827, 0 },
+    { succapproxsc_name, 11, 10936, 0 },
+    { succcurlyeqsc_name, 12, 8829, 0 },
+    { succeqsc_name, 7, 10928, 0 },
+    { succnapproxsc_name, 12, 10938, 0 },
+    { succneqqsc_name, 9, 10934, 0 },
+    { succnsimsc_name, 9, 8937, 0 },
+    { succsimsc_name, 8, 8831, 0 },
+    { sumsc_name, 4, 8721, 0 },
+    { sungsc_name, 5, 9834, 0 },
+    { sup1_name, 4, 185, 0 },
+    { sup1sc_name, 5, 185, 0 },
+    { sup2_name, 4, 178, 0 },
+    { sup2sc_name, 5, 178, 0 },
+    { sup3_name, 4, 179, 0 },
+    { sup3sc_name, 5, 179, 0 },
+    { supsc_name, 4, 8835, 0 },
+    { supEsc_name, 5, 10950, 0 },
+    { supdotsc_name, 7, 10942, 0 },
+    { supdsubsc_name, 8, 10968, 0 },
+    { supesc_name, 5, 8839, 0 },
+    { supedotsc_name, 8, 10948, 0 },
+    { suphsolsc_name, 8, 10185, 0 },
+    { suphsubsc_name, 8, 10967, 0 },
+    { suplarrsc_name, 8, 10619, 0 },
+    { supmultsc_name, 8, 10946, 0 },
+    { supnEsc_name, 6, 10956, 0 },
+    { supnesc_name, 6, 8843, 0 },
+    { supplussc_name, 8, 10944, 0 },
+    { supsetsc_name, 7, 8835, 0 },
+    { supseteqsc_name, 9, 8839, 0 },
+    { supseteqqsc_name, 10, 10950, 0 },
+    { supsetneqsc_name, 10, 8843, 0 },
+    { supsetneqqsc_name, 11, 10956, 0 },
+    { supsimsc_name, 7, 10952, 0 },
+    { supsubsc_name, 7, 10964, 0 },
+    { supsupsc_name, 7, 10966, 0 },
+    { swArrsc_name, 6, 8665, 0 },
+    { swarhksc_name, 7, 10534, 0 },
+    { swarrsc_name, 6, 8601, 0 },
+    { swarrowsc_name, 8, 8601, 0 },
+    { swnwarsc_name, 7, 10538, 0 },
+    { szlig_name, 5, 223, 0 },
+    { szligsc_name, 6, 223, 0 },
+    { targetsc_name, 7, 8982, 0 },
+    { tausc_name, 4, 964, 0 },
+    { tbrksc_name, 5, 9140, 0 },
+    { tcaronsc_name, 7, 357, 0 },
+    { tcedilsc_name, 7, 355, 0 },
+    { tcysc_name, 4, 1090, 0 },
+    { tdotsc_name, 5, 8411, 0 },
+    { telrecsc_name, 7, 8981, 0 },
+    { tfrsc_name, 4, 120113, 0 },
+    { there4sc_name, 7, 8756, 0 },
+    { thereforesc_name, 10, 8756, 0 },
+    { thetasc_name, 6, 952, 0 },
+    { thetasymsc_name, 9, 977, 0 },
+    { thetavsc_name, 7, 977, 0 },
+    { thickapproxsc_name, 12, 8776, 0 },
+    { thicksimsc_name, 9, 8764, 0 },
+    { thinspsc_name, 7, 8201, 0 },
+    { thkapsc_name, 6, 8776, 0 },
+    { thksimsc_name, 7, 8764, 0 },
+    { thorn_name, 5, 254, 0 },
+    { thornsc_name, 6, 254, 0 },
+    { tildesc_name, 6, 732, 0 },
+    { times_name, 5, 215, 0 },
+    { timessc_name, 6, 215, 0 },
+    { timesbsc_name, 7, 8864, 0 },
+    { timesbarsc_name, 9, 10801, 0 },
+    { timesdsc_name, 7, 10800, 0 },
+    { tintsc_name, 5, 8749, 0 },
+    { toeasc_name, 5, 10536, 0 },
+    { topsc_name, 4, 8868, 0 },
+    { topbotsc_name, 7, 9014, 0 },
+    { topcirsc_name, 7, 10993, 0 },
+    { topfsc_name, 5, 120165, 0 },
+    { topforksc_name, 8, 10970, 0 },
+    { tosasc_name, 5, 10537, 0 },
+    { tprimesc_name, 7, 8244, 0 },
+    { tradesc_name, 6, 8482, 0 },
+    { trianglesc_name, 9, 9653, 0 },
+    { triangledownsc_name, 13, 9663, 0 },
+    { triangleleftsc_name, 13, 9667, 0 },
+    { trianglelefteqsc_name, 15, 8884, 0 },
+    { triangleqsc_name, 10, 8796, 0 },
+    { trianglerightsc_name, 14, 9657, 0 },
+    { trianglerighteqsc_name, 16, 8885, 0 },
+    { tridotsc_name, 7, 9708, 0 },
+    { triesc_name, 5, 8796, 0 },
+    { triminussc_name, 9, 10810, 0 },
+    { triplussc_name, 8, 10809, 0 },
+    { trisbsc_name, 6, 10701, 0 },
+    { tritimesc_name, 8, 10811, 0 },
+    { trpeziumsc_name, 9, 9186, 0 },
+    { tscrsc_name, 5, 120009, 0 },
+    { tscysc_name, 5, 1094, 0 },
+    { tshcysc_name, 6, 1115, 0 },
+    { tstroksc_name, 7, 359, 0 },
+    { twixtsc_name, 6, 8812, 0 },
+    { twoheadleftarrowsc_name, 17, 8606, 0 },
+    { twoheadrightarrowsc_name, 18, 8608, 0 },
+    { uArrsc_name, 5, 8657, 0 },
+    { uHarsc_name, 5, 10595, 0 },
+    { uacute_name, 6, 250, 0 },
+    { uacutesc_name, 7, 250, 0 },
+    { uarrsc_name, 5, 8593, 0 },
+    { ubrcysc_name, 6, 1118, 0 },
+    { ubrevesc_name, 7, 365, 0 },
+    { ucirc_name, 5, 251, 0 },
+    { ucircsc_name, 6, 251, 0 },
+    { ucysc_name, 4, 1091, 0 },
+    { udarrsc_name, 6, 8645, 0 },
+    { udblacsc_name, 7, 369, 0 },
+    { udharsc_name, 6, 10606, 0 },
+    { ufishtsc_name, 7, 10622, 0 },
+    { ufrsc_name, 4, 120114, 0 },
+    { ugrave_name, 6, 249, 0 },
+    { ugravesc_name, 7, 249, 0 },
+    { uharlsc_name, 6, 8639, 0 },
+    { uharrsc_name, 6, 8638, 0 },
+    { uhblksc_name, 6, 9600, 0 },
+    { ulcornsc_name, 7, 8988, 0 },
+    { ulcornersc_name, 9, 8988, 0 },
+    { ulcropsc_name, 7, 8975, 0 },
+    { ultrisc_name, 6, 9720, 0 },
+    { umacrsc_name, 6, 363, 0 },
+    { uml_name, 3, 168, 0 },
+    { umlsc_name, 4, 168, 0 },
+    { uogonsc_name, 6, 371, 0 },
+    { uopfsc_name, 5, 120166, 0 },
+    { uparrowsc_name, 8, 8593, 0 },
+    { updownarrowsc_name, 12, 8597, 0 },
+    { upharpoonleftsc_name, 14, 8639, 0 },
+    { upharpoonrightsc_name, 15, 8638, 0 },
+    { uplussc_name, 6, 8846, 0 },
+    { upsisc_name, 5, 965, 0 },
+    { upsihsc_name, 6, 978, 0 },
+    { upsilonsc_name, 8, 965, 0 },
+    { upuparrowssc_name, 11, 8648, 0 },
+    { urcornsc_name, 7, 8989, 0 },
+    { urcornersc_name, 9, 8989, 0 },
+    { urcropsc_name, 7, 8974, 0 },
+    { uringsc_name, 6, 367, 0 },
+    { urtrisc_name, 6, 9721, 0 },
+    { uscrsc_name, 5, 120010, 0 },
+    { utdotsc_name, 6, 8944, 0 },
+    { utildesc_name, 7, 361, 0 },
+    { utrisc_name, 5, 9653, 0 },
+    { utrifsc_name, 6, 9652, 0 },
+    { uuarrsc_name, 6, 8648, 0 },
+    { uuml_name, 4, 252, 0 },
+    { uumlsc_name, 5, 252, 0 },
+    { uwanglesc_name, 8, 10663, 0 },
+    { vArrsc_name, 5, 8661, 0 },
+    { vBarsc_name, 5, 10984, 0 },
+    { vBarvsc_name, 6, 10985, 0 },
+    { vDashsc_name, 6, 8872, 0 },
+    { vangrtsc_name, 7, 10652, 0 },
+    { varepsilonsc_name, 11, 1013, 0 },
+    { varkappasc_name, 9, 1008, 0 },
+    { varnothingsc_name, 11, 8709, 0 },
+    { varphisc_name, 7, 981, 0 },
+    { varpisc_name, 6, 982, 0 },
+    { varproptosc_name, 10, 8733, 0 },
+    { varrsc_name, 5, 8597, 0 },
+    { varrhosc_name, 7, 1009, 0 },
+    { varsigmasc_name, 9, 962, 0 },
+    { varsubsetneqsc_name, 13, 8842, 65024 },
+    { varsubsetneqqsc_name, 14, 10955, 65024 },
+    { varsupsetneqsc_name, 13, 8843, 65024 },
+    { varsupsetneqqsc_name, 14, 10956, 65024 },
+    { varthetasc_name, 9, 977, 0 },
+    { vartriangleleftsc_name, 16, 8882, 0 },
+    { vartrianglerightsc_name, 17, 8883, 0 },
+    { vcysc_name, 4, 1074, 0 },
+    { vdashsc_name, 6, 8866, 0 },
+    { veesc_name, 4, 8744, 0 },
+    { veebarsc_name, 7, 8891, 0 },
+    { veeeqsc_name, 6, 8794, 0 },
+    { vellipsc_name, 7, 8942, 0 },
+    { verbarsc_name, 7, 124, 0 },
+    { vertsc_name, 5, 124, 0 },
+    { vfrsc_name, 4, 120115, 0 },
+    { vltrisc_name, 6, 8882, 0 },
+    { vnsubsc_name, 6, 8834, 8402 },
+    { vnsupsc_name, 6, 8835, 8402 },
+    { vopfsc_name, 5, 120167, 0 },
+    { vpropsc_name, 6, 8733, 0 },
+    { vrtrisc_name, 6, 8883, 0 },
+    { vscrsc_name, 5, 120011, 0 },
+    { vsubnEsc_name, 7, 10955, 65024 },
+    { vsubnesc_name, 7, 8842, 65024 },
+    { vsupnEsc_name, 7, 10956, 65024 },
+    { vsupnesc_name, 7, 8843, 65024 },
+    { vzigzagsc_name, 8, 10650, 0 },
+    { wcircsc_name, 6, 373, 0 },
+    { wedbarsc_name, 7, 10847, 0 },
+    { wedgesc_name, 6, 8743, 0 },
+    { wedgeqsc_name, 7, 8793, 0 },
+    { weierpsc_name, 7, 8472, 0 },
+    { wfrsc_name, 4, 120116, 0 },
+    { wopfsc_name, 5, 120168, 0 },
+    { wpsc_name, 3, 8472, 0 },
+    { wrsc_name, 3, 8768, 0 },
+    { wreathsc_name, 7, 8768, 0 },
+    { wscrsc_name, 5, 120012, 0 },
+    { xcapsc_name, 5, 8898, 0 },
+    { xcircsc_name, 6, 9711, 0 },
+    { xcupsc_name, 5, 8899, 0 },
+    { xdtrisc_name, 6, 9661, 0 },
+    { xfrsc_name, 4, 120117, 0 },
+    { xhArrsc_name, 6, 10234, 0 },
+    { xharrsc_name, 6, 10231, 0 },
+    { xisc_name, 3, 958, 0 },
+    { xlArrsc_name, 6, 10232, 0 },
+    { xlarrsc_name, 6, 10229, 0 },
+    { xmapsc_name, 5, 10236, 0 },
+    { xnissc_name, 5, 8955, 0 },
+    { xodotsc_name, 6, 10752, 0 },
+    { xopfsc_name, 5, 120169, 0 },
+    { xoplussc_name, 7, 10753, 0 },
+    { xotimesc_name, 7, 10754, 0 },
+    { xrArrsc_name, 6, 10233, 0 },
+    { xrarrsc_name, 6, 10230, 0 },
+    { xscrsc_name, 5, 120013, 0 },
+    { xsqcupsc_name, 7, 10758, 0 },
+    { xuplussc_name, 7, 10756, 0 },
+    { xutrisc_name, 6, 9651, 0 },
+    { xveesc_name, 5, 8897, 0 },
+    { xwedgesc_name, 7, 8896, 0 },
+    { yacute_name, 6, 253, 0 },
+    { yacutesc_name, 7, 253, 0 },
+    { yacysc_name, 5, 1103, 0 },
+    { ycircsc_name, 6, 375, 0 },
+    { ycysc_name, 4, 1099, 0 },
+    { yen_name, 3, 165, 0 },
+    { yensc_name, 4, 165, 0 },
+    { yfrsc_name, 4, 120118, 0 },
+    { yicysc_name, 5, 1111, 0 },
+    { yopfsc_name, 5, 120170, 0 },
+    { yscrsc_name, 5, 120014, 0 },
+    { yucysc_name, 5, 1102, 0 },
+    { yuml_name, 4, 255, 0 },
+    { yumlsc_name, 5, 255, 0 },
+    { zacutesc_name, 7, 378, 0 },
+    { zcaronsc_name, 7, 382, 0 },
+    { zcysc_name, 4, 1079, 0 },
+    { zdotsc_name, 5, 380, 0 },
+    { zeetrfsc_name, 7, 8488, 0 },
+    { zetasc_name, 5, 950, 0 },
+    { zfrsc_name, 4, 120119, 0 },
+    { zhcysc_name, 5, 1078, 0 },
+    { zigrarrsc_name, 8, 8669, 0 },
+    { zopfsc_name, 5, 120171, 0 },
+    { zscrsc_name, 5, 120015, 0 },
+    { zwjsc_name, 4, 8205, 0 },
+    { zwnjsc_name, 5, 8204, 0 }
+  };
+
+  const frenzy::parser::htmlentity* uppercases[] = {
+    &entities[0],
+    &entities[27],
+    &entities[39],
+    &entities[75],
+    &entities[129],
+    &entities[159],
+    &entities[167],
+    &entities[189],
+    &entities[201],
+    &entities[230],
+    &entities[237],
+    &entities[245],
+    &entities[305],
+    &entities[314],
+    &entities[386],
+    &entities[415],
+    &entities[434],
+    &entities[439],
+    &entities[484],
+    &entities[524],
+    &entities[547],
+    &entities[587],
+    &entities[604],
+    &entities[609],
+    &entities[613],
+    &entities[624],
+    &entities[634]
+  };
+
+  const frenzy::parser::htmlentity* lowercases[] = {
+    &entities[634],
+    &entities[703],
+    &entities[819],
+    &entities[918],
+    &entities[984],
+    &entities[1051],
+    &entities[1090],
+    &entities[1150],
+    &entities[1178],
+    &entities[1234],
+    &entities[1242],
+    &entities[1252],
+    &entities[1406],
+    &entities[1446],
+    &entities[1614],
+    &entities[1675],
+    &entities[1744],
+    &entities[1755],
+    &entities[1859],
+    &entities[2017],
+    &entities[2075],
+    &entities[2127],
+    &entities[2169],
+    &entities[2180],
+    &entities[2204],
+    &entities[2218],
+    &entities[2231]
+  };
+}
+
+const frenzy::parser::htmlentity*
+frenzy::parser::htmlentity_begin(frenzy::uchar u)
+{
+  if (u >= 'a' && u <= 'z')
+    return lowercases[u - 'a'];
+  else if (u >= 'A' && u <= 'Z')
+    return uppercases[u - 'A'];
+  return NULL;
+}
+
+const frenzy::parser::htmlentity*
+frenzy::parser::htmlentity_end(frenzy::uchar u)
+{
+  if (u >= 'a' && u <= 'z')
+    return lowercases[u - 'a' + 1] - 1;
+  else if (u >= 'A' && u <= 'Z')
+    return uppercases[u - 'A' + 1] - 1;
+  return NULL;
+}
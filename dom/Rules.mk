@@ -4,7 +4,7 @@ dirstack_$(sp)	:= $(d)
 d		:= $(dir)
 # End standard header
 
-SOURCES += $(call filelist,node.cpp element.cpp document.cpp text.cpp exception.cpp htmlelement.cpp graphics.cpp)
+SOURCES += $(call filelist,arena.cpp node.cpp element.cpp document.cpp text.cpp exception.cpp htmlelement.cpp graphics.cpp)
 
 # Begin standard footer
 d		:= $(dirstack_$(sp))
@@ -0,0 +1,159 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+#include <cassert>
+#include <algorithm>
+
+#include "arena.hpp"
+
+namespace
+{
+  // Precedes every node allocation, padded to keep the node aligned
+  union nodeheader
+  {
+    struct
+    {
+      frenzy::dom::nodearena* arena;
+      size_t size;
+    } info;
+    double align[2];
+  };
+}
+
+frenzy::dom::nodearenap
+frenzy::dom::nodearena::create()
+{
+  return nodearenap(new nodearena(), &nodearena::release);
+}
+
+frenzy::dom::nodearena::nodearena()
+  : chunk_next(0)
+  , chunk_end(0)
+  , live_nodes(0)
+  , released(false)
+{
+  std::fill(freelists, freelists + size_classes, static_cast<freeblock*>(0));
+}
+
+frenzy::dom::nodearena::~nodearena()
+{
+  for (size_t i = 0; i < chunks.size(); ++i)
+  {
+    ::operator delete(chunks[i]);
+  }
+}
+
+void*
+frenzy::dom::nodearena::allocate(size_t size)
+{
+  if (size == 0)
+    size = 1;
+
+  if (size > granularity * size_classes)
+    return ::operator new(size);
+
+  size_t sizeclass = (size - 1) / granularity;
+  if (freeblock* block = freelists[sizeclass])
+  {
+    freelists[sizeclass] = block->next;
+    return block;
+  }
+
+  size_t rounded = (sizeclass + 1) * granularity;
+  if (static_cast<size_t>(chunk_end - chunk_next) < rounded)
+  {
+    // The rest of the previous chunk is left unused
+    chunk_next = static_cast<char*>(::operator new(chunk_size));
+    chunk_end = chunk_next + chunk_size;
+    chunks.push_back(chunk_next);
+  }
+
+  void* ret = chunk_next;
+  chunk_next += rounded;
+  return ret;
+}
+
+void
+frenzy::dom::nodearena::deallocate(void* p, size_t size)
+{
+  if (!p)
+    return;
+
+  if (size == 0)
+    size = 1;
+
+  if (size > granularity * size_classes)
+  {
+    ::operator delete(p);
+    return;
+  }
+
+  size_t sizeclass = (size - 1) / granularity;
+  freeblock* block = static_cast<freeblock*>(p);
+  block->next = freelists[sizeclass];
+  freelists[sizeclass] = block;
+}
+
+void
+frenzy::dom::nodearena::release(frenzy::dom::nodearena* arena)
+{
+  arena->released = true;
+  if (arena->live_nodes == 0)
+    delete arena;
+}
+
+size_t
+frenzy::dom::nodearena::bytes_reserved() const
+{
+  return chunks.size() * chunk_size;
+}
+
+void*
+frenzy::dom::nodearena::allocate_node(size_t size, frenzy::dom::nodearena* arena)
+{
+  size += sizeof(nodeheader);
+
+  nodeheader* header = static_cast<nodeheader*>(arena ? arena->allocate(size) : ::operator new(size));
+  if (arena)
+    ++arena->live_nodes;
+
+  header->info.arena = arena;
+  header->info.size = size;
+  return header + 1;
+}
+
+void
+frenzy::dom::nodearena::deallocate_node(void* p)
+{
+  if (!p)
+    return;
+
+  nodeheader* header = static_cast<nodeheader*>(p) - 1;
+  nodearena* arena = header->info.arena;
+  if (!arena)
+  {
+    ::operator delete(header);
+    return;
+  }
+
+  arena->deallocate(header, header->info.size);
+  if (--arena->live_nodes == 0 && arena->released)
+    delete arena;
+}
+
+frenzy::dom::nodearena*
+frenzy::dom::nodearena::arena_of(const void* node)
+{
+  assert(node);
+  return (static_cast<const nodeheader*>(node) - 1)->info.arena;
+}
@@ -0,0 +1,85 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+#ifndef FRENZY_ARENA_HPP
+#define FRENZY_ARENA_HPP
+
+#include <cstddef>
+#include <vector>
+#include <boost/noncopyable.hpp>
+
+#include "pointers.hpp"
+
+namespace frenzy
+{
+  namespace dom
+  {
+    /*
+     * Memory for the nodes of a document. Small requests are served
+     * from size-class free lists carved out of large chunks, larger
+     * ones from the heap. The chunks are released all at once when
+     * the arena is destroyed.
+     *
+     * The arena counts the nodes allocated from it, and lives until
+     * both the pointers returned by create() and the last of its
+     * nodes are gone, so nodes can outlive their Document. Like the
+     * rest of the DOM, an arena is not thread-safe: a document and
+     * its nodes must be used from one thread at a time.
+     */
+    struct nodearena : private boost::noncopyable
+    {
+      static nodearenap create();
+
+      void* allocate(size_t size);
+      void deallocate(void* p, size_t size);
+
+      // The bytes taken by the chunks, for diagnostics
+      size_t bytes_reserved() const;
+
+      // Node allocation, used by Node's operator new and delete. A
+      // null arena allocates from the heap.
+      static void* allocate_node(size_t size, nodearena* arena);
+      static void deallocate_node(void* p);
+      static nodearena* arena_of(const void* node);
+
+    private:
+      nodearena();
+      ~nodearena();
+
+      // The deleter of the pointers returned by create()
+      static void release(nodearena* arena);
+
+      enum
+      {
+	granularity = 16,
+	size_classes = 32,
+	chunk_size = 64 * 1024
+      };
+
+      struct freeblock
+      {
+	freeblock* next;
+      };
+
+      std::vector<char*> chunks;
+      char* chunk_next;
+      char* chunk_end;
+      freeblock* freelists[size_classes];
+
+      size_t live_nodes;
+      bool released;
+    };
+  }
+}
+
+#endif
@@ -11,10 +11,14 @@
  * 
  */
 
+#include <cassert>
 #include <map>
+#include <algorithm>
 #include <boost/shared_ptr.hpp>
+#include <boost/functional/hash.hpp>
 
 #include "document.hpp"
+#include "arena.hpp"
 #include "element.hpp"
 #include "htmlelement.hpp"
 #include "text.hpp"
@@ -27,11 +31,16 @@ frenzy::dom::Document::create()
   return Documentp(new Document());
 }
 
+namespace
+{
+  // The DOMImplementation is shared by all documents
+  const frenzy::dom::DOMImplementationp implementation = frenzy::dom::DOMImplementation::create();
+}
+
 frenzy::dom::DOMImplementationp
 frenzy::dom::Document::get_implementation() const
 {
-  static DOMImplementationp impl = DOMImplementation::create();
-  return impl;
+  return implementation;
 }
 
 frenzy::dom::Node::nodeType
@@ -61,12 +70,10 @@ frenzy::dom::Document::get_doctype() const
   // that there's only one DocumentType child. Therefore, the first
   // DOCUMENT_TYPE_NODE in the list of children is our document type.
 
-  for (children_t::const_iterator it = children.begin();
-       it != children.end();
-       ++it)
+  for (Nodep child = get_firstChild(); child; child = child->get_nextSibling())
   {
-    if ((*it)->get_nodeType() == Node::DOCUMENT_TYPE_NODE)
-      return dom_cast<DocumentType>(*it);
+    if (child->get_nodeType() == Node::DOCUMENT_TYPE_NODE)
+      return dom_cast<DocumentType>(child);
   }
 
   return DocumentTypep();
@@ -79,38 +86,15 @@ frenzy::dom::Document::get_documentElement() const
   // that there's only one element child. Therefore, the first
   // ELEMENT_NODE in the list of children is our document element.
 
-  for (children_t::const_iterator it = children.begin();
-       it != children.end();
-       ++it)
+  for (Nodep child = get_firstChild(); child; child = child->get_nextSibling())
   {
-    if ((*it)->get_nodeType() == Node::ELEMENT_NODE)
-      return dom_cast<Element>(*it);
+    if (child->get_nodeType() == Node::ELEMENT_NODE)
+      return dom_cast<Element>(child);
   }
 
   return Elementp();
 }
 
-namespace
-{
-  struct localnamematch
-  {
-    localnamematch(frenzy::ustring localname)
-      : localname(localname)
-    {}
-
-    bool operator()(frenzy::dom::Nodep n)
-    {
-      if (n->get_nodeType() != frenzy::dom::Node::ELEMENT_NODE)
-	return false;
-
-      return frenzy::dom_cast<frenzy::dom::Element>(n)->get_localName() == localname;
-    }
-
-  private:
-    frenzy::ustring localname;
-  };
-}
-
 frenzy::dom::NodeListp
 frenzy::dom::Document::getElementsByTagName(frenzy::ustring localName)
 {
@@ -118,22 +102,28 @@ frenzy::dom::Document::getElementsByTagName(frenzy::ustring localName)
   if (localName == "*")
     return NodeList::create(shared_from_this(), TRAVERSE_TREE, type_filter(Node::ELEMENT_NODE));
 
-  return NodeList::create(shared_from_this(), TRAVERSE_TREE, localnamematch(localName));
+  return NodeList::create(shared_from_this(), localName);
+}
+
+frenzy::dom::NodeListp
+frenzy::dom::Document::getElementsByClassName(frenzy::ustring classNames)
+{
+  return NodeList::create_by_class(shared_from_this(), classNames);
 }
 
 namespace
 {
   struct elementfactory_base
   {
-    virtual frenzy::dom::Elementp create(frenzy::ustring localname) = 0;
+    virtual frenzy::dom::Elementp create(frenzy::ustring localname, frenzy::dom::nodearenap arena) = 0;
   };
 
   template <typename T>
   struct elementfactory : elementfactory_base
   {
-    virtual frenzy::dom::Elementp create(frenzy::ustring localname)
+    virtual frenzy::dom::Elementp create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
     {
-      return T::create(localname);
+      return T::create(localname, arena);
     }
   };
 
@@ -265,6 +255,10 @@ namespace
 
     return ret;
   }
+
+  // Built before main() and only read after that, so documents on
+  // different threads can create elements at the same time.
+  const factorymap_t factories = get_factorymap();
 }
 
 frenzy::dom::Elementp
@@ -272,18 +266,16 @@ frenzy::dom::Document::createElement(frenzy::ustring localName)
 {
   verify_valid_name(localName);
 
-  static const factorymap_t factories = get_factorymap();
-
   Elementp ret;
 
   factorymap_t::const_iterator it = factories.find(localName);
   if (it != factories.end())
   {
-    ret = it->second->create(localName);
+    ret = it->second->create(localName, arena);
   }
   else
   {
-    ret = HTMLUnknownElement::create(localName);
+    ret = HTMLUnknownElement::create(localName, arena);
   }
 
   ret->recursive_set_ownerdocument(shared_from_this());
@@ -293,7 +285,7 @@ frenzy::dom::Document::createElement(frenzy::ustring localName)
 frenzy::dom::DocumentFragmentp
 frenzy::dom::Document::createDocumentFragment()
 {
-  DocumentFragmentp ret = DocumentFragment::create();
+  DocumentFragmentp ret = DocumentFragment::create(arena);
   ret->recursive_set_ownerdocument(shared_from_this());
   return ret;
 }
@@ -301,7 +293,7 @@ frenzy::dom::Document::createDocumentFragment()
 frenzy::dom::Textp
 frenzy::dom::Document::createTextNode(frenzy::ustring data)
 {
-  Textp ret = Text::create(data);
+  Textp ret = Text::create(data, arena);
   ret->recursive_set_ownerdocument(shared_from_this());
   return ret;
 }
@@ -309,7 +301,7 @@ frenzy::dom::Document::createTextNode(frenzy::ustring data)
 frenzy::dom::Commentp
 frenzy::dom::Document::createComment(frenzy::ustring data)
 {
-  Commentp ret = Comment::create(data);
+  Commentp ret = Comment::create(data, arena);
   ret->recursive_set_ownerdocument(shared_from_this());
   return ret;
 }
@@ -349,7 +341,7 @@ frenzy::dom::Document::createAttribute(frenzy::ustring name)
 {
   verify_valid_name(name);
 
-  Attrp ret = Attr::create(name);
+  Attrp ret = Attr::create(name, arena);
   ret->recursive_set_ownerdocument(shared_from_this());
   return ret;
 }
@@ -364,6 +356,7 @@ void
 frenzy::dom::Document::graphicsfactory(boost::shared_ptr<frenzy::graphics::factory> f)
 {
   recursive_drop_graphics();
+  recursive_mark_dirty();
 
   fact = f;
 
@@ -379,14 +372,49 @@ frenzy::dom::Document::graphicsfactory() const
 void
 frenzy::dom::Document::layout_document()
 {
-  if (!fact)
+  if (!fact || !is_dirty())
     return;
 
-  get_documentElement()->layout(fact->page_width());
+  // Layout may be requested while the document is still being
+  // parsed. Only the dirty parts of the tree are laid out again.
+  if (Elementp root = get_documentElement())
+    root->relayout(fact->page_width());
+
+  mark_clean();
 }
 
 frenzy::dom::Document::Document()
+  : arena(nodearena::create())
+  , generation(0)
+  , tree_order_valid(false)
+  , tree_order(1)
+{
+  connected = true;
+}
+
+frenzy::dom::Document::~Document()
 {
+  // Nodes that outlive the document are no longer in its tree
+  for (Node* n = first_child; n; n = next_in_subtree(n, this))
+    n->connected = false;
+}
+
+size_t
+frenzy::dom::Document::get_generation() const
+{
+  return generation;
+}
+
+void
+frenzy::dom::Document::tree_changed()
+{
+  ++generation;
+}
+
+frenzy::dom::nodearenap
+frenzy::dom::Document::get_arena() const
+{
+  return arena;
 }
 
 frenzy::dom::Documentp
@@ -445,15 +473,15 @@ frenzy::dom::DocumentFragment::get_nodeName() const
 frenzy::dom::Nodep
 frenzy::dom::DocumentFragment::cloneNode(bool deep) const
 {
-  DocumentFragmentp ret = DocumentFragment::create();
+  DocumentFragmentp ret = DocumentFragment::create(owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::DocumentFragmentp
-frenzy::dom::DocumentFragment::create()
+frenzy::dom::DocumentFragment::create(frenzy::dom::nodearenap arena)
 {
-  return DocumentFragmentp(new DocumentFragment);
+  return DocumentFragmentp(new (arena) DocumentFragment);
 }
 
 frenzy::dom::DocumentFragment::DocumentFragment()
@@ -475,7 +503,7 @@ frenzy::dom::DocumentType::get_nodeName() const
 frenzy::dom::Nodep
 frenzy::dom::DocumentType::cloneNode(bool deep) const
 {
-  DocumentTypep ret = DocumentType::create(name, publicid, systemid);
+  DocumentTypep ret = DocumentType::create(name, publicid, systemid, owner_arena());
   copyTo(ret, deep);
   return ret;
 }
@@ -513,9 +541,10 @@ frenzy::dom::DocumentType::get_notations() const
 frenzy::dom::DocumentTypep
 frenzy::dom::DocumentType::create(frenzy::ustring name,
 				  frenzy::ustring publicid,
-				  frenzy::ustring systemid)
+				  frenzy::ustring systemid,
+				  frenzy::dom::nodearenap arena)
 {
-  return DocumentTypep(new DocumentType(name, publicid, systemid));
+  return DocumentTypep(new (arena) DocumentType(name, publicid, systemid));
 }
 
 frenzy::dom::DocumentType::DocumentType(frenzy::ustring name,
@@ -548,3 +577,391 @@ frenzy::dom::DOMImplementation::create()
 frenzy::dom::DOMImplementation::DOMImplementation()
 {
 }
+
+void
+frenzy::dom::Document::subtree_inserted(frenzy::dom::Node* n)
+{
+  if (tree_order_valid && !n->first_child)
+    tree_order_valid = label_leaf(n);
+  else
+    tree_order_valid = false;
+
+  for (Node* cur = n; cur; cur = next_in_subtree(cur, n))
+  {
+    cur->connected = true;
+
+    if (cur->get_nodeType() == ELEMENT_NODE)
+    {
+      Element* e = static_cast<Element*>(cur);
+      bucket_insert(tagindex[e->localname], e, tag_slot());
+      if (e->id)
+	bucket_insert(idindex[*e->id], e, id_slot());
+      for (size_t i = 0; i < e->classes.size(); ++i)
+      {
+	size_t token = e->classes[i].token;
+	bucket_insert(classindex[token], e, class_slot(token));
+      }
+    }
+  }
+}
+
+void
+frenzy::dom::Document::subtree_removed(frenzy::dom::Node* n)
+{
+  // The labels of the remaining nodes stay in order
+  for (Node* cur = n; cur; cur = next_in_subtree(cur, n))
+  {
+    cur->connected = false;
+
+    if (cur->get_nodeType() == ELEMENT_NODE)
+    {
+      Element* e = static_cast<Element*>(cur);
+
+      tagindex_t::iterator tag = tagindex.find(e->localname);
+      assert(tag != tagindex.end());
+      bucket_erase(tag->second, e, tag_slot());
+
+      if (e->id)
+      {
+	idindex_t::iterator id = idindex.find(*e->id);
+	assert(id != idindex.end());
+	bucket_erase(id->second, e, id_slot());
+	if (id->second.elements.empty())
+	  idindex.erase(id);
+      }
+
+      for (size_t i = 0; i < e->classes.size(); ++i)
+      {
+	size_t token = e->classes[i].token;
+	bucket_erase(classindex[token], e, class_slot(token));
+      }
+    }
+  }
+}
+
+void
+frenzy::dom::Document::id_changed(frenzy::dom::Element* e, const boost::optional<frenzy::ustring>& id)
+{
+  if (!e->connected)
+  {
+    e->id = id;
+    return;
+  }
+
+  if (e->id)
+  {
+    idindex_t::iterator it = idindex.find(*e->id);
+    assert(it != idindex.end());
+    bucket_erase(it->second, e, id_slot());
+    if (it->second.elements.empty())
+      idindex.erase(it);
+  }
+
+  e->id = id;
+
+  if (e->id)
+    bucket_insert(idindex[*e->id], e, id_slot());
+}
+
+void
+frenzy::dom::Document::classes_changed(frenzy::dom::Element* e, const std::vector<size_t>& tokens)
+{
+  if (e->connected)
+  {
+    for (size_t i = 0; i < e->classes.size(); ++i)
+    {
+      size_t token = e->classes[i].token;
+      bucket_erase(classindex[token], e, class_slot(token));
+    }
+  }
+
+  e->classes.resize(tokens.size());
+  for (size_t i = 0; i < tokens.size(); ++i)
+    e->classes[i].token = tokens[i];
+
+  if (e->connected)
+  {
+    for (size_t i = 0; i < tokens.size(); ++i)
+      bucket_insert(classindex[tokens[i]], e, class_slot(tokens[i]));
+  }
+}
+
+size_t
+frenzy::dom::Document::class_token(const frenzy::ustring& name)
+{
+  std::pair<classtokens_t::iterator, bool> ins =
+    classtokens.insert(std::make_pair(name, classindex.size()));
+  if (ins.second)
+    classindex.push_back(elementbucket());
+
+  return ins.first->second;
+}
+
+frenzy::dom::Elementp
+frenzy::dom::Document::getElementById(frenzy::ustring elementId)
+{
+  idindex_t::iterator it = idindex.find(elementId);
+  if (it == idindex.end())
+    return Elementp();
+
+  // The first in tree order wins if the id is not unique
+  if (it->second.elements.size() > 1)
+    bucket_sort(it->second, id_slot());
+
+  return Elementp(it->second.elements.front());
+}
+
+bool
+frenzy::dom::Document::elements_by_tag(const frenzy::ustring& localname,
+				       frenzy::dom::Node* root,
+				       std::vector<frenzy::dom::Nodep>& result)
+{
+  if (!root->connected)
+    return false;
+
+  tagindex_t::iterator it = tagindex.find(localname);
+  if (it == tagindex.end())
+    return true;
+
+  bucket_sort(it->second, tag_slot());
+
+  // The descendants of root are labeled (tree_index, tree_end]
+  std::vector<Element*>& elements = it->second.elements;
+  std::vector<Element*>::iterator i =
+    std::upper_bound(elements.begin(), elements.end(), root->tree_index, &tree_index_less);
+  for (; i != elements.end() && (*i)->tree_index <= root->tree_end; ++i)
+    result.push_back(Nodep(*i));
+
+  return true;
+}
+
+bool
+frenzy::dom::Document::elements_by_class(const std::vector<frenzy::ustring>& classes,
+					 frenzy::dom::Node* root,
+					 std::vector<frenzy::dom::Nodep>& result)
+{
+  if (!root->connected)
+    return false;
+
+  // Start from the class with the fewest elements, and check the
+  // others against the tokens of each candidate
+  std::vector<size_t> tokens;
+  size_t smallest = 0;
+  for (size_t i = 0; i < classes.size(); ++i)
+  {
+    classtokens_t::const_iterator it = classtokens.find(classes[i]);
+    if (it == classtokens.end())
+      return true;
+
+    tokens.push_back(it->second);
+    if (classindex[it->second].elements.size() < classindex[tokens[smallest]].elements.size())
+      smallest = i;
+  }
+
+  if (tokens.empty())
+    return true;
+
+  elementbucket& bucket = classindex[tokens[smallest]];
+  bucket_sort(bucket, class_slot(tokens[smallest]));
+
+  std::vector<Element*>& elements = bucket.elements;
+  std::vector<Element*>::iterator i =
+    std::upper_bound(elements.begin(), elements.end(), root->tree_index, &tree_index_less);
+  for (; i != elements.end() && (*i)->tree_index <= root->tree_end; ++i)
+  {
+    bool match = true;
+    for (size_t j = 0; j < tokens.size() && match; ++j)
+    {
+      match = (*i)->has_class_token(tokens[j]);
+    }
+
+    if (match)
+      result.push_back(Nodep(*i));
+  }
+
+  return true;
+}
+
+frenzy::dom::Document::elementbucket::elementbucket()
+  : sorted(0)
+{
+}
+
+template<typename Slot>
+void
+frenzy::dom::Document::bucket_insert(frenzy::dom::Document::elementbucket& bucket,
+				     frenzy::dom::Element* e,
+				     Slot slot)
+{
+  slot(e) = bucket.elements.size();
+  bucket.elements.push_back(e);
+  bucket.sorted = 0;
+}
+
+template<typename Slot>
+void
+frenzy::dom::Document::bucket_erase(frenzy::dom::Document::elementbucket& bucket,
+				    frenzy::dom::Element* e,
+				    Slot slot)
+{
+  // Order is restored on the next query
+  Element* last = bucket.elements.back();
+  bucket.elements[slot(e)] = last;
+  slot(last) = slot(e);
+  bucket.elements.pop_back();
+  bucket.sorted = 0;
+}
+
+template<typename Slot>
+void
+frenzy::dom::Document::bucket_sort(frenzy::dom::Document::elementbucket& bucket,
+				   Slot slot)
+{
+  refresh_tree_order();
+
+  if (bucket.sorted == tree_order)
+    return;
+
+  std::sort(bucket.elements.begin(), bucket.elements.end(), &tree_order_less);
+  for (size_t i = 0; i < bucket.elements.size(); ++i)
+    slot(bucket.elements[i]) = i;
+  bucket.sorted = tree_order;
+}
+
+size_t&
+frenzy::dom::Document::tag_slot::operator()(frenzy::dom::Element* e) const
+{
+  return e->tagslot;
+}
+
+size_t&
+frenzy::dom::Document::id_slot::operator()(frenzy::dom::Element* e) const
+{
+  return e->idslot;
+}
+
+frenzy::dom::Document::class_slot::class_slot(size_t token)
+  : token(token)
+{
+}
+
+size_t&
+frenzy::dom::Document::class_slot::operator()(frenzy::dom::Element* e) const
+{
+  return e->find_class_token(token)->slot;
+}
+
+size_t
+frenzy::dom::Document::ustring_hash::operator()(const frenzy::ustring& str) const
+{
+  return boost::hash_range(str.begin(), str.end());
+}
+
+namespace
+{
+  // The distance between the labels given by relabeling, and between
+  // a leaf appended after the last node and its predecessor
+  const boost::uint64_t label_step = 1 << 16;
+}
+
+void
+frenzy::dom::Document::refresh_tree_order()
+{
+  if (tree_order_valid)
+    return;
+
+  boost::uint64_t label = 0;
+  Node* n = this;
+  while (n)
+  {
+    n->tree_index = label;
+    label += label_step;
+
+    if (n->first_child)
+    {
+      n = n->first_child;
+      continue;
+    }
+
+    // Close the subtrees that end at n
+    while (n)
+    {
+      n->tree_end = label - label_step;
+
+      if (n == this)
+	n = 0;
+      else if (n->next_sibling)
+      {
+	n = n->next_sibling;
+	break;
+      }
+      else
+	n = n->parent;
+    }
+  }
+
+  tree_order_valid = true;
+  ++tree_order;
+}
+
+bool
+frenzy::dom::Document::label_leaf(frenzy::dom::Node* n)
+{
+  // The label must come after the subtree of the previous sibling,
+  // or after the parent, and before the next node in tree order
+  boost::uint64_t low = n->prev_sibling ? n->prev_sibling->tree_end : n->parent->tree_index;
+
+  Node* next = 0;
+  for (Node* a = n; a && !next; a = a->parent)
+    next = a->next_sibling;
+
+  boost::uint64_t label;
+  if (next)
+  {
+    if (next->tree_index - low < 2)
+      return false;
+    label = low + (next->tree_index - low) / 2;
+  }
+  else
+  {
+    if (boost::uint64_t(-1) - low < label_step)
+      return false;
+    label = low + label_step;
+  }
+
+  n->tree_index = label;
+  n->tree_end = label;
+
+  for (Node* a = n->parent; a && a->tree_end < label; a = a->parent)
+    a->tree_end = label;
+
+  return true;
+}
+
+frenzy::dom::Node*
+frenzy::dom::Document::next_in_subtree(frenzy::dom::Node* n, frenzy::dom::Node* root)
+{
+  if (n->first_child)
+    return n->first_child;
+
+  while (n != root)
+  {
+    if (n->next_sibling)
+      return n->next_sibling;
+    n = n->parent;
+  }
+
+  return 0;
+}
+
+bool
+frenzy::dom::Document::tree_order_less(const frenzy::dom::Element* a, const frenzy::dom::Element* b)
+{
+  return a->tree_index < b->tree_index;
+}
+
+bool
+frenzy::dom::Document::tree_index_less(boost::uint64_t index, const frenzy::dom::Element* e)
+{
+  return index < e->tree_index;
+}
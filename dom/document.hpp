@@ -14,7 +14,10 @@
 #ifndef FRENZY_DOCUMENT_HPP
 #define FRENZY_DOCUMENT_HPP
 
+#include <map>
+#include <vector>
 #include <boost/optional.hpp>
+#include <boost/unordered_map.hpp>
 
 #include "util/unicode.hpp"
 #include "node.hpp"
@@ -38,6 +41,8 @@ namespace frenzy
       DocumentTypep get_doctype() const;
       Elementp get_documentElement() const;
       NodeListp getElementsByTagName(ustring localName);
+      Elementp getElementById(ustring elementId);
+      NodeListp getElementsByClassName(ustring classNames);
 
       Elementp createElement(ustring localName);
       Elementp createElementNS(boost::optional<ustring> nspace, ustring qualifiedName);
@@ -63,9 +68,58 @@ namespace frenzy
       boost::shared_ptr<graphics::factory> graphicsfactory() const;
 
       // Layout the document. Does nothing if there is no graphics
-      // factory set.
+      // factory set or nothing has changed since the last
+      // layout. Can be called repeatedly while the document is being
+      // parsed to lay out the content received so far.
       void layout_document();
 
+      //
+      // Implementation details
+      //
+
+      // The arena the nodes created by this document are allocated
+      // from
+      nodearenap get_arena() const;
+
+      // The mutation generation, which changes whenever a node is
+      // inserted or removed or an attribute changes anywhere in the
+      // nodes owned by this document. Cached views of the tree
+      // compare it to know when they are stale.
+      size_t get_generation() const;
+      void tree_changed();
+
+      // Called by Node after `n' and its subtree are inserted into
+      // the document tree, and before they are removed from it. Keeps
+      // the element indexes current.
+      void subtree_inserted(Node* n);
+      void subtree_removed(Node* n);
+
+      // Fills `result' with the elements with the given local name in
+      // the subtree of `root', in tree order, from the tag index.
+      // Returns false if `root' is not in the document tree.
+      bool elements_by_tag(const ustring& localname, Node* root, std::vector<Nodep>& result);
+
+      // Like elements_by_tag(), for the elements that have all of
+      // the given classes
+      bool elements_by_class(const std::vector<ustring>& classes, Node* root, std::vector<Nodep>& result);
+
+      // Labels the nodes of the document tree in tree order if the
+      // labels are out of date. Each node also gets the last label in
+      // its subtree, so ancestry is a range check. The labels are
+      // spaced apart: a leaf inserted between labeled nodes is given
+      // a label in between, and removals leave gaps. Only inserting
+      // a subtree or running out of room relabels the whole tree.
+      void refresh_tree_order();
+
+      // Called by Element to change the id or the class tokens of `e'
+      void id_changed(Element* e, const boost::optional<ustring>& id);
+      void classes_changed(Element* e, const std::vector<size_t>& tokens);
+
+      // The token of a class name in this document
+      size_t class_token(const ustring& name);
+
+      virtual ~Document();
+
     private:
       Document();
 
@@ -76,6 +130,74 @@ namespace frenzy
       void verify_valid_name(ustring name);
 
       boost::shared_ptr<graphics::factory> fact;
+      nodearenap arena;
+      size_t generation;
+
+      // The node after `n' in tree order within the subtree of `root'
+      static Node* next_in_subtree(Node* n, Node* root);
+      static bool tree_order_less(const Element* a, const Element* b);
+      static bool tree_index_less(boost::uint64_t index, const Element* e);
+
+      // Labels a leaf just inserted into a labeled tree. Returns false
+      // if there is no room for it between its neighbours.
+      bool label_leaf(Node* n);
+
+      bool tree_order_valid;
+      // Bumped each time the tree is renumbered
+      size_t tree_order;
+
+      // Elements in the document tree sharing a key. A bucket is
+      // sorted in tree order on the first query after the tree
+      // changes, and `sorted' records the numbering it was sorted by.
+      // Each element stores its position in the bucket in `slot'.
+      struct elementbucket
+      {
+	elementbucket();
+
+	std::vector<Element*> elements;
+	size_t sorted;
+      };
+
+      // Slot accessors for the different indexes
+      struct tag_slot
+      {
+	size_t& operator()(Element* e) const;
+      };
+      struct id_slot
+      {
+	size_t& operator()(Element* e) const;
+      };
+      struct class_slot
+      {
+	class_slot(size_t token);
+	size_t& operator()(Element* e) const;
+
+	size_t token;
+      };
+
+      template<typename Slot>
+      static void bucket_insert(elementbucket& bucket, Element* e, Slot slot);
+      template<typename Slot>
+      static void bucket_erase(elementbucket& bucket, Element* e, Slot slot);
+      template<typename Slot>
+      void bucket_sort(elementbucket& bucket, Slot slot);
+
+      struct ustring_hash
+      {
+	size_t operator()(const ustring& str) const;
+      };
+
+      // Elements by local name
+      typedef std::map<ustring, elementbucket> tagindex_t;
+      tagindex_t tagindex;
+      // Elements by id. Buckets are dropped when they empty.
+      typedef boost::unordered_map<ustring, elementbucket, ustring_hash> idindex_t;
+      idindex_t idindex;
+      // Class names interned to tokens, and the elements by token.
+      // Tokens live as long as the document.
+      typedef boost::unordered_map<ustring, size_t, ustring_hash> classtokens_t;
+      classtokens_t classtokens;
+      std::vector<elementbucket> classindex;
     };
 
     struct XMLDocument : Document
@@ -88,7 +210,7 @@ namespace frenzy
       virtual ustring get_nodeName() const;
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static DocumentFragmentp create();
+      static DocumentFragmentp create(nodearenap arena = nodearenap());
 
     private:
       DocumentFragment();
@@ -115,7 +237,8 @@ namespace frenzy
       NamedNodeMapp get_entities() const;
       NamedNodeMapp get_notations() const;
 
-      static DocumentTypep create(ustring name, ustring publicid, ustring systemid);
+      static DocumentTypep create(ustring name, ustring publicid, ustring systemid,
+				   nodearenap arena = nodearenap());
 
     private:
       DocumentType(ustring name, ustring publicid, ustring systemid);
@@ -11,7 +11,10 @@
  * 
  */
 
+#include <algorithm>
+
 #include "element.hpp"
+#include "arena.hpp"
 #include "document.hpp"
 #include "text.hpp"
 #include "exception.hpp"
@@ -28,7 +31,7 @@ frenzy::dom::Element::get_nodeName() const
   return get_tagName();
 }
 
-frenzy::ustring
+const frenzy::ustring&
 frenzy::dom::Element::get_localName() const
 {
   return localname;
@@ -69,6 +72,8 @@ frenzy::dom::Element::setAttribute(frenzy::ustring name, frenzy::ustring value)
     newattr->set_ownerElement(shared_from_this());
     newattr->set_value(value);
     attributes.insert(std::make_pair(name, newattr));
+    note_mutation();
+    attribute_changed(name);
     return;
   }
 
@@ -80,7 +85,11 @@ frenzy::dom::Element::removeAttribute(frenzy::ustring name)
 {
   attributes_t::iterator it = attributes.find(name);
   if (it != attributes.end())
+  {
     attributes.erase(it);
+    note_mutation();
+    attribute_changed(name);
+  }
 }
 
 bool
@@ -126,6 +135,8 @@ frenzy::dom::Element::setAttributeNode(frenzy::dom::Attrp newAttr)
 
   attributes.insert(std::make_pair(name, newAttr));
   newAttr->set_ownerElement(shared_from_this());
+  note_mutation();
+  attribute_changed(name);
 
   return ret;
 }
@@ -144,29 +155,6 @@ frenzy::dom::Element::removeAttributeNode(frenzy::dom::Attrp oldAttr)
   return oldAttr;
 }
 
-// TODO: Refactor to somehow combine Element::getElementsByTagName and
-// Document::getElementsByTagName, and localnamematch
-namespace
-{
-  struct localnamematch
-  {
-    localnamematch(frenzy::ustring localname)
-      : localname(localname)
-    {}
-
-    bool operator()(frenzy::dom::Nodep n)
-    {
-      if (n->get_nodeType() != frenzy::dom::Node::ELEMENT_NODE)
-	return false;
-
-      return frenzy::dom_cast<frenzy::dom::Element>(n)->get_localName() == localname;
-    }
-
-  private:
-    frenzy::ustring localname;
-  };
-}
-
 frenzy::dom::NodeListp
 frenzy::dom::Element::getElementsByTagName(ustring name)
 {
@@ -174,7 +162,13 @@ frenzy::dom::Element::getElementsByTagName(ustring name)
   if (name == "*")
     return NodeList::create(shared_from_this(), TRAVERSE_TREE, type_filter(Node::ELEMENT_NODE));
   
-  return NodeList::create(shared_from_this(), TRAVERSE_TREE, localnamematch(name));
+  return NodeList::create(shared_from_this(), name);
+}
+
+frenzy::dom::NodeListp
+frenzy::dom::Element::getElementsByClassName(frenzy::ustring classNames)
+{
+  return NodeList::create_by_class(shared_from_this(), classNames);
 }
 
 frenzy::dom::NamedNodeMapp
@@ -183,6 +177,12 @@ frenzy::dom::Element::get_attributes()
   return NamedNodeMap::create(shared_from_this());
 }
 
+const frenzy::dom::Element::attributes_t&
+frenzy::dom::Element::get_attributeMap() const
+{
+  return attributes;
+}
+
 frenzy::dom::Attrp
 frenzy::dom::Element::getAttributeNodeByIndex(size_t index)
 {
@@ -220,14 +220,102 @@ frenzy::dom::Element::copyTo(frenzy::dom::Nodep n, bool deep) const
   frenzy::dom::Elementp elem = dom_cast<Element>(n);
   assert(elem);
 
-  elem->attributes = attributes;
+  // The attributes are always copied, and belong to the copy
+  for (attributes_t::const_iterator it = attributes.begin();
+       it != attributes.end();
+       ++it)
+  {
+    Attrp attr = dom_cast<Attr>(it->second->cloneNode(true));
+    attr->set_ownerElement(elem);
+    elem->attributes.insert(std::make_pair(it->first, attr));
+  }
+  elem->update_id();
+  elem->update_classes();
 
   Node::copyTo(n, deep);
 }
 
 frenzy::dom::Element::Element(frenzy::ustring localname)
   : localname(localname)
+  , tagslot(0)
+  , idslot(0)
+{
+}
+
+void
+frenzy::dom::Element::attribute_changed(const frenzy::ustring& name)
+{
+  if (name == "id")
+    update_id();
+  else if (name == "class")
+    update_classes();
+}
+
+void
+frenzy::dom::Element::update_id()
 {
+  boost::optional<ustring> newid;
+  attributes_t::const_iterator it = attributes.find("id");
+  if (it != attributes.end())
+  {
+    newid = it->second->get_value();
+    // An empty id matches nothing
+    if (newid->empty())
+      newid = boost::none;
+  }
+
+  if (newid == id)
+    return;
+
+  if (Documentp doc = get_ownerDocument())
+    doc->id_changed(this, newid);
+  else
+    id = newid;
+}
+
+void
+frenzy::dom::Element::update_classes()
+{
+  if (classes.empty() && attributes.empty())
+    return;
+
+  Documentp doc = get_ownerDocument();
+  if (!doc)
+  {
+    classes.clear();
+    return;
+  }
+
+  std::vector<size_t> tokens;
+  attributes_t::const_iterator it = attributes.find("class");
+  if (it != attributes.end())
+  {
+    std::vector<ustring> names = split_classes(it->second->get_value());
+    for (size_t i = 0; i < names.size(); ++i)
+      tokens.push_back(doc->class_token(names[i]));
+
+    std::sort(tokens.begin(), tokens.end());
+    tokens.erase(std::unique(tokens.begin(), tokens.end()), tokens.end());
+  }
+
+  doc->classes_changed(this, tokens);
+}
+
+frenzy::dom::Element::classentry*
+frenzy::dom::Element::find_class_token(size_t token)
+{
+  std::vector<classentry>::iterator it =
+    std::lower_bound(classes.begin(), classes.end(), token);
+  if (it == classes.end() || it->token != token)
+    return 0;
+
+  return &*it;
+}
+
+bool
+frenzy::dom::Element::has_class_token(size_t token) const
+{
+  return const_cast<Element*>(this)->find_class_token(token) != 0;
 }
 
 frenzy::dom::Elementp
@@ -317,12 +405,12 @@ frenzy::dom::Attr::set_nodeValue(frenzy::ustring str)
 frenzy::dom::Nodep
 frenzy::dom::Attr::cloneNode(bool deep) const
 {
-  Attrp ret = Attr::create(name);
+  Attrp ret = Attr::create(name, owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
-frenzy::ustring
+const frenzy::ustring&
 frenzy::dom::Attr::get_name() const
 {
   return name;
@@ -341,11 +429,9 @@ frenzy::dom::Attr::get_value() const
 {
   ustring ret;
 
-  for (children_t::const_iterator it = children.begin();
-       it != children.end();
-       ++it)
+  for (Nodep child = get_firstChild(); child; child = child->get_nextSibling())
   {
-    Textp t = dom_cast<Text>(*it);
+    Textp t = dom_cast<Text>(child);
     assert(t);
 
     ret.append(t->get_data());
@@ -357,9 +443,9 @@ frenzy::dom::Attr::get_value() const
 void
 frenzy::dom::Attr::set_value(frenzy::ustring str)
 {
-  while (!children.empty())
+  while (hasChildNodes())
   {
-    removeChild(children.back());
+    removeChild(get_lastChild());
   }
 
   Textp t = get_ownerDocument()->createTextNode(str);
@@ -378,10 +464,47 @@ frenzy::dom::Attr::set_ownerElement(frenzy::dom::Elementp e)
   elem = e;
 }
 
+void
+frenzy::dom::Attr::children_changed()
+{
+  // The value of the attribute changed
+  note_mutation();
+
+  if (Elementp e = get_ownerElement())
+    e->attribute_changed(name);
+}
+
+std::vector<frenzy::ustring>
+frenzy::dom::split_classes(const frenzy::ustring& value)
+{
+  std::vector<ustring> ret;
+  ustring current;
+
+  for (ustring::const_iterator it = value.begin(); it != value.end(); ++it)
+  {
+    switch (*it)
+    {
+    case 0x09: case 0x0A: case 0x0C: case 0x0D: case 0x20:
+      if (!current.empty())
+	ret.push_back(current);
+      current.clear();
+      break;
+    default:
+      current.push_back(*it);
+      break;
+    }
+  }
+
+  if (!current.empty())
+    ret.push_back(current);
+
+  return ret;
+}
+
 frenzy::dom::Attrp
-frenzy::dom::Attr::create(frenzy::ustring name)
+frenzy::dom::Attr::create(frenzy::ustring name, frenzy::dom::nodearenap arena)
 {
-  return Attrp(new Attr(name));
+  return Attrp(new (arena) Attr(name));
 }
 
 void
@@ -15,6 +15,7 @@
 #define FRENZY_ELEMENT_HPP
 
 #include <map>
+#include <vector>
 #include <boost/optional.hpp>
 
 #include "util/unicode.hpp"
@@ -30,7 +31,7 @@ namespace frenzy
       virtual Node::nodeType get_nodeType() const;
       virtual ustring get_nodeName() const;
 
-      ustring get_localName() const;
+      const ustring& get_localName() const;
       ustring get_tagName() const;
 
       boost::optional<ustring> getAttribute(ustring name) const;
@@ -43,15 +44,24 @@ namespace frenzy
       Attrp removeAttributeNode(Attrp oldAttr);
 
       NodeListp getElementsByTagName(ustring name);
+      NodeListp getElementsByClassName(ustring classNames);
 
       virtual NamedNodeMapp get_attributes();
 
       // Implementation details
+      typedef std::map<ustring, Attrp> attributes_t;
+      // The attributes by name, for walking them in order
+      const attributes_t& get_attributeMap() const;
       Attrp getAttributeNodeByIndex(size_t index);
       size_t getAttributeSize() const;
 
       void normalizeAttributes();
 
+      // Called after an attribute of the element is set, removed or
+      // changed, or the element moves to another document. Keeps the
+      // id and class indexes of the document current.
+      void attribute_changed(const ustring& name);
+
     protected:
       virtual void copyTo(dom::Nodep n, bool deep) const;
 
@@ -59,13 +69,42 @@ namespace frenzy
 
     private:
       ustring localname;
-
-      typedef std::map<ustring, Attrp> attributes_t;
       attributes_t attributes;
 
+      void update_id();
+      void update_classes();
+
+      // The class attribute split into tokens of the owner
+      // document, sorted by token, with the position of the element
+      // in the class index bucket of each
+      struct classentry
+      {
+	size_t token;
+	size_t slot;
+
+	bool operator<(size_t other) const
+	{
+	  return token < other;
+	}
+      };
+      std::vector<classentry> classes;
+
+      classentry* find_class_token(size_t token);
+      bool has_class_token(size_t token) const;
+
+      // The id as last seen by update_id(), and the positions in
+      // the index buckets of the document
+      boost::optional<ustring> id;
+      size_t tagslot;
+      size_t idslot;
+      friend struct Document;
+
       Elementp shared_from_this();
     };
 
+    // Splits a class attribute value at ASCII whitespace
+    std::vector<ustring> split_classes(const ustring& value);
+
     struct HTMLCollection
     {
     };
@@ -95,7 +134,7 @@ namespace frenzy
       virtual void set_nodeValue(ustring str);
       virtual Nodep cloneNode(bool deep = true) const;
 
-      ustring get_name() const;
+      const ustring& get_name() const;
       bool get_specified() const;
       ustring get_value() const;
       void set_value(ustring str);
@@ -103,7 +142,9 @@ namespace frenzy
       Elementp get_ownerElement() const;
       void set_ownerElement(Elementp elem);
 
-      static Attrp create(ustring name);
+      virtual void children_changed();
+
+      static Attrp create(ustring name, nodearenap arena = nodearenap());
 
     protected:
       virtual void copyTo(dom::Nodep n, bool deep) const;
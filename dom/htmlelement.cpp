@@ -12,20 +12,21 @@
  */
 
 #include "htmlelement.hpp"
+#include "arena.hpp"
 #include "text.hpp"
 
 frenzy::dom::Nodep
 frenzy::dom::HTMLElement::cloneNode(bool deep) const
 {
-  HTMLElementp ret = HTMLElement::create(get_localName());
+  HTMLElementp ret = HTMLElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLElementp
-frenzy::dom::HTMLElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLElementp(new HTMLElement(localname));
+  return HTMLElementp(new (arena) HTMLElement(localname));
 }
 
 frenzy::dom::HTMLElement::HTMLElement(frenzy::ustring localname)
@@ -36,15 +37,15 @@ frenzy::dom::HTMLElement::HTMLElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLUnknownElement::cloneNode(bool deep) const
 {
-  HTMLUnknownElementp ret = HTMLUnknownElement::create(get_localName());
+  HTMLUnknownElementp ret = HTMLUnknownElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLUnknownElementp
-frenzy::dom::HTMLUnknownElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLUnknownElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLUnknownElementp(new HTMLUnknownElement(localname));
+  return HTMLUnknownElementp(new (arena) HTMLUnknownElement(localname));
 }
 
 frenzy::dom::HTMLUnknownElement::HTMLUnknownElement(frenzy::ustring localname)
@@ -55,15 +56,15 @@ frenzy::dom::HTMLUnknownElement::HTMLUnknownElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLAnchorElement::cloneNode(bool deep) const
 {
-  HTMLAnchorElementp ret = HTMLAnchorElement::create(get_localName());
+  HTMLAnchorElementp ret = HTMLAnchorElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLAnchorElementp
-frenzy::dom::HTMLAnchorElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLAnchorElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLAnchorElementp(new HTMLAnchorElement(localname));
+  return HTMLAnchorElementp(new (arena) HTMLAnchorElement(localname));
 }
 
 frenzy::dom::HTMLAnchorElement::HTMLAnchorElement(frenzy::ustring localname)
@@ -74,15 +75,15 @@ frenzy::dom::HTMLAnchorElement::HTMLAnchorElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLAreaElement::cloneNode(bool deep) const
 {
-  HTMLAreaElementp ret = HTMLAreaElement::create(get_localName());
+  HTMLAreaElementp ret = HTMLAreaElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLAreaElementp
-frenzy::dom::HTMLAreaElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLAreaElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLAreaElementp(new HTMLAreaElement(localname));
+  return HTMLAreaElementp(new (arena) HTMLAreaElement(localname));
 }
 
 frenzy::dom::HTMLAreaElement::HTMLAreaElement(frenzy::ustring localname)
@@ -93,15 +94,15 @@ frenzy::dom::HTMLAreaElement::HTMLAreaElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLBaseElement::cloneNode(bool deep) const
 {
-  HTMLBaseElementp ret = HTMLBaseElement::create(get_localName());
+  HTMLBaseElementp ret = HTMLBaseElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLBaseElementp
-frenzy::dom::HTMLBaseElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLBaseElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLBaseElementp(new HTMLBaseElement(localname));
+  return HTMLBaseElementp(new (arena) HTMLBaseElement(localname));
 }
 
 frenzy::dom::HTMLBaseElement::HTMLBaseElement(frenzy::ustring localname)
@@ -112,15 +113,15 @@ frenzy::dom::HTMLBaseElement::HTMLBaseElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLBodyElement::cloneNode(bool deep) const
 {
-  HTMLBodyElementp ret = HTMLBodyElement::create(get_localName());
+  HTMLBodyElementp ret = HTMLBodyElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLBodyElementp
-frenzy::dom::HTMLBodyElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLBodyElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLBodyElementp(new HTMLBodyElement(localname));
+  return HTMLBodyElementp(new (arena) HTMLBodyElement(localname));
 }
 
 frenzy::dom::HTMLBodyElement::HTMLBodyElement(frenzy::ustring localname)
@@ -131,15 +132,15 @@ frenzy::dom::HTMLBodyElement::HTMLBodyElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLBRElement::cloneNode(bool deep) const
 {
-  HTMLBRElementp ret = HTMLBRElement::create(get_localName());
+  HTMLBRElementp ret = HTMLBRElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLBRElementp
-frenzy::dom::HTMLBRElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLBRElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLBRElementp(new HTMLBRElement(localname));
+  return HTMLBRElementp(new (arena) HTMLBRElement(localname));
 }
 
 frenzy::dom::HTMLBRElement::HTMLBRElement(frenzy::ustring localname)
@@ -150,15 +151,15 @@ frenzy::dom::HTMLBRElement::HTMLBRElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLButtonElement::cloneNode(bool deep) const
 {
-  HTMLButtonElementp ret = HTMLButtonElement::create(get_localName());
+  HTMLButtonElementp ret = HTMLButtonElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLButtonElementp
-frenzy::dom::HTMLButtonElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLButtonElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLButtonElementp(new HTMLButtonElement(localname));
+  return HTMLButtonElementp(new (arena) HTMLButtonElement(localname));
 }
 
 frenzy::dom::HTMLButtonElement::HTMLButtonElement(frenzy::ustring localname)
@@ -169,15 +170,15 @@ frenzy::dom::HTMLButtonElement::HTMLButtonElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLCanvasElement::cloneNode(bool deep) const
 {
-  HTMLCanvasElementp ret = HTMLCanvasElement::create(get_localName());
+  HTMLCanvasElementp ret = HTMLCanvasElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLCanvasElementp
-frenzy::dom::HTMLCanvasElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLCanvasElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLCanvasElementp(new HTMLCanvasElement(localname));
+  return HTMLCanvasElementp(new (arena) HTMLCanvasElement(localname));
 }
 
 frenzy::dom::HTMLCanvasElement::HTMLCanvasElement(frenzy::ustring localname)
@@ -188,15 +189,15 @@ frenzy::dom::HTMLCanvasElement::HTMLCanvasElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLCommandElement::cloneNode(bool deep) const
 {
-  HTMLCommandElementp ret = HTMLCommandElement::create(get_localName());
+  HTMLCommandElementp ret = HTMLCommandElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLCommandElementp
-frenzy::dom::HTMLCommandElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLCommandElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLCommandElementp(new HTMLCommandElement(localname));
+  return HTMLCommandElementp(new (arena) HTMLCommandElement(localname));
 }
 
 frenzy::dom::HTMLCommandElement::HTMLCommandElement(frenzy::ustring localname)
@@ -207,15 +208,15 @@ frenzy::dom::HTMLCommandElement::HTMLCommandElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLDataElement::cloneNode(bool deep) const
 {
-  HTMLDataElementp ret = HTMLDataElement::create(get_localName());
+  HTMLDataElementp ret = HTMLDataElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLDataElementp
-frenzy::dom::HTMLDataElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLDataElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLDataElementp(new HTMLDataElement(localname));
+  return HTMLDataElementp(new (arena) HTMLDataElement(localname));
 }
 
 frenzy::dom::HTMLDataElement::HTMLDataElement(frenzy::ustring localname)
@@ -226,15 +227,15 @@ frenzy::dom::HTMLDataElement::HTMLDataElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLDataListElement::cloneNode(bool deep) const
 {
-  HTMLDataListElementp ret = HTMLDataListElement::create(get_localName());
+  HTMLDataListElementp ret = HTMLDataListElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLDataListElementp
-frenzy::dom::HTMLDataListElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLDataListElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLDataListElementp(new HTMLDataListElement(localname));
+  return HTMLDataListElementp(new (arena) HTMLDataListElement(localname));
 }
 
 frenzy::dom::HTMLDataListElement::HTMLDataListElement(frenzy::ustring localname)
@@ -245,15 +246,15 @@ frenzy::dom::HTMLDataListElement::HTMLDataListElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLDetailsElement::cloneNode(bool deep) const
 {
-  HTMLDetailsElementp ret = HTMLDetailsElement::create(get_localName());
+  HTMLDetailsElementp ret = HTMLDetailsElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLDetailsElementp
-frenzy::dom::HTMLDetailsElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLDetailsElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLDetailsElementp(new HTMLDetailsElement(localname));
+  return HTMLDetailsElementp(new (arena) HTMLDetailsElement(localname));
 }
 
 frenzy::dom::HTMLDetailsElement::HTMLDetailsElement(frenzy::ustring localname)
@@ -264,15 +265,15 @@ frenzy::dom::HTMLDetailsElement::HTMLDetailsElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLDialogElement::cloneNode(bool deep) const
 {
-  HTMLDialogElementp ret = HTMLDialogElement::create(get_localName());
+  HTMLDialogElementp ret = HTMLDialogElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLDialogElementp
-frenzy::dom::HTMLDialogElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLDialogElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLDialogElementp(new HTMLDialogElement(localname));
+  return HTMLDialogElementp(new (arena) HTMLDialogElement(localname));
 }
 
 frenzy::dom::HTMLDialogElement::HTMLDialogElement(frenzy::ustring localname)
@@ -283,15 +284,15 @@ frenzy::dom::HTMLDialogElement::HTMLDialogElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLDivElement::cloneNode(bool deep) const
 {
-  HTMLDivElementp ret = HTMLDivElement::create(get_localName());
+  HTMLDivElementp ret = HTMLDivElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLDivElementp
-frenzy::dom::HTMLDivElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLDivElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLDivElementp(new HTMLDivElement(localname));
+  return HTMLDivElementp(new (arena) HTMLDivElement(localname));
 }
 
 frenzy::dom::HTMLDivElement::HTMLDivElement(frenzy::ustring localname)
@@ -302,15 +303,15 @@ frenzy::dom::HTMLDivElement::HTMLDivElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLDListElement::cloneNode(bool deep) const
 {
-  HTMLDListElementp ret = HTMLDListElement::create(get_localName());
+  HTMLDListElementp ret = HTMLDListElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLDListElementp
-frenzy::dom::HTMLDListElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLDListElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLDListElementp(new HTMLDListElement(localname));
+  return HTMLDListElementp(new (arena) HTMLDListElement(localname));
 }
 
 frenzy::dom::HTMLDListElement::HTMLDListElement(frenzy::ustring localname)
@@ -321,15 +322,15 @@ frenzy::dom::HTMLDListElement::HTMLDListElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLEmbedElement::cloneNode(bool deep) const
 {
-  HTMLEmbedElementp ret = HTMLEmbedElement::create(get_localName());
+  HTMLEmbedElementp ret = HTMLEmbedElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLEmbedElementp
-frenzy::dom::HTMLEmbedElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLEmbedElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLEmbedElementp(new HTMLEmbedElement(localname));
+  return HTMLEmbedElementp(new (arena) HTMLEmbedElement(localname));
 }
 
 frenzy::dom::HTMLEmbedElement::HTMLEmbedElement(frenzy::ustring localname)
@@ -340,15 +341,15 @@ frenzy::dom::HTMLEmbedElement::HTMLEmbedElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLFieldSetElement::cloneNode(bool deep) const
 {
-  HTMLFieldSetElementp ret = HTMLFieldSetElement::create(get_localName());
+  HTMLFieldSetElementp ret = HTMLFieldSetElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLFieldSetElementp
-frenzy::dom::HTMLFieldSetElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLFieldSetElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLFieldSetElementp(new HTMLFieldSetElement(localname));
+  return HTMLFieldSetElementp(new (arena) HTMLFieldSetElement(localname));
 }
 
 frenzy::dom::HTMLFieldSetElement::HTMLFieldSetElement(frenzy::ustring localname)
@@ -359,15 +360,15 @@ frenzy::dom::HTMLFieldSetElement::HTMLFieldSetElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLFormElement::cloneNode(bool deep) const
 {
-  HTMLFormElementp ret = HTMLFormElement::create(get_localName());
+  HTMLFormElementp ret = HTMLFormElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLFormElementp
-frenzy::dom::HTMLFormElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLFormElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLFormElementp(new HTMLFormElement(localname));
+  return HTMLFormElementp(new (arena) HTMLFormElement(localname));
 }
 
 frenzy::dom::HTMLFormElement::HTMLFormElement(frenzy::ustring localname)
@@ -378,15 +379,15 @@ frenzy::dom::HTMLFormElement::HTMLFormElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLHeadElement::cloneNode(bool deep) const
 {
-  HTMLHeadElementp ret = HTMLHeadElement::create(get_localName());
+  HTMLHeadElementp ret = HTMLHeadElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLHeadElementp
-frenzy::dom::HTMLHeadElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLHeadElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLHeadElementp(new HTMLHeadElement(localname));
+  return HTMLHeadElementp(new (arena) HTMLHeadElement(localname));
 }
 
 frenzy::dom::HTMLHeadElement::HTMLHeadElement(frenzy::ustring localname)
@@ -397,15 +398,15 @@ frenzy::dom::HTMLHeadElement::HTMLHeadElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLHeadingElement::cloneNode(bool deep) const
 {
-  HTMLHeadingElementp ret = HTMLHeadingElement::create(get_localName());
+  HTMLHeadingElementp ret = HTMLHeadingElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLHeadingElementp
-frenzy::dom::HTMLHeadingElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLHeadingElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLHeadingElementp(new HTMLHeadingElement(localname));
+  return HTMLHeadingElementp(new (arena) HTMLHeadingElement(localname));
 }
 
 frenzy::dom::HTMLHeadingElement::HTMLHeadingElement(frenzy::ustring localname)
@@ -416,15 +417,15 @@ frenzy::dom::HTMLHeadingElement::HTMLHeadingElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLHRElement::cloneNode(bool deep) const
 {
-  HTMLHRElementp ret = HTMLHRElement::create(get_localName());
+  HTMLHRElementp ret = HTMLHRElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLHRElementp
-frenzy::dom::HTMLHRElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLHRElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLHRElementp(new HTMLHRElement(localname));
+  return HTMLHRElementp(new (arena) HTMLHRElement(localname));
 }
 
 frenzy::dom::HTMLHRElement::HTMLHRElement(frenzy::ustring localname)
@@ -435,15 +436,15 @@ frenzy::dom::HTMLHRElement::HTMLHRElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLHtmlElement::cloneNode(bool deep) const
 {
-  HTMLHtmlElementp ret = HTMLHtmlElement::create(get_localName());
+  HTMLHtmlElementp ret = HTMLHtmlElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLHtmlElementp
-frenzy::dom::HTMLHtmlElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLHtmlElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLHtmlElementp(new HTMLHtmlElement(localname));
+  return HTMLHtmlElementp(new (arena) HTMLHtmlElement(localname));
 }
 
 frenzy::dom::HTMLHtmlElement::HTMLHtmlElement(frenzy::ustring localname)
@@ -454,15 +455,15 @@ frenzy::dom::HTMLHtmlElement::HTMLHtmlElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLIFrameElement::cloneNode(bool deep) const
 {
-  HTMLIFrameElementp ret = HTMLIFrameElement::create(get_localName());
+  HTMLIFrameElementp ret = HTMLIFrameElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLIFrameElementp
-frenzy::dom::HTMLIFrameElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLIFrameElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLIFrameElementp(new HTMLIFrameElement(localname));
+  return HTMLIFrameElementp(new (arena) HTMLIFrameElement(localname));
 }
 
 frenzy::dom::HTMLIFrameElement::HTMLIFrameElement(frenzy::ustring localname)
@@ -473,15 +474,15 @@ frenzy::dom::HTMLIFrameElement::HTMLIFrameElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLImageElement::cloneNode(bool deep) const
 {
-  HTMLImageElementp ret = HTMLImageElement::create(get_localName());
+  HTMLImageElementp ret = HTMLImageElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLImageElementp
-frenzy::dom::HTMLImageElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLImageElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLImageElementp(new HTMLImageElement(localname));
+  return HTMLImageElementp(new (arena) HTMLImageElement(localname));
 }
 
 frenzy::dom::HTMLImageElement::HTMLImageElement(frenzy::ustring localname)
@@ -492,15 +493,15 @@ frenzy::dom::HTMLImageElement::HTMLImageElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLInputElement::cloneNode(bool deep) const
 {
-  HTMLInputElementp ret = HTMLInputElement::create(get_localName());
+  HTMLInputElementp ret = HTMLInputElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLInputElementp
-frenzy::dom::HTMLInputElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLInputElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLInputElementp(new HTMLInputElement(localname));
+  return HTMLInputElementp(new (arena) HTMLInputElement(localname));
 }
 
 frenzy::dom::HTMLInputElement::HTMLInputElement(frenzy::ustring localname)
@@ -511,15 +512,15 @@ frenzy::dom::HTMLInputElement::HTMLInputElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLKeygenElement::cloneNode(bool deep) const
 {
-  HTMLKeygenElementp ret = HTMLKeygenElement::create(get_localName());
+  HTMLKeygenElementp ret = HTMLKeygenElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLKeygenElementp
-frenzy::dom::HTMLKeygenElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLKeygenElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLKeygenElementp(new HTMLKeygenElement(localname));
+  return HTMLKeygenElementp(new (arena) HTMLKeygenElement(localname));
 }
 
 frenzy::dom::HTMLKeygenElement::HTMLKeygenElement(frenzy::ustring localname)
@@ -530,15 +531,15 @@ frenzy::dom::HTMLKeygenElement::HTMLKeygenElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLLabelElement::cloneNode(bool deep) const
 {
-  HTMLLabelElementp ret = HTMLLabelElement::create(get_localName());
+  HTMLLabelElementp ret = HTMLLabelElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLLabelElementp
-frenzy::dom::HTMLLabelElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLLabelElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLLabelElementp(new HTMLLabelElement(localname));
+  return HTMLLabelElementp(new (arena) HTMLLabelElement(localname));
 }
 
 frenzy::dom::HTMLLabelElement::HTMLLabelElement(frenzy::ustring localname)
@@ -549,15 +550,15 @@ frenzy::dom::HTMLLabelElement::HTMLLabelElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLLegendElement::cloneNode(bool deep) const
 {
-  HTMLLegendElementp ret = HTMLLegendElement::create(get_localName());
+  HTMLLegendElementp ret = HTMLLegendElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLLegendElementp
-frenzy::dom::HTMLLegendElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLLegendElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLLegendElementp(new HTMLLegendElement(localname));
+  return HTMLLegendElementp(new (arena) HTMLLegendElement(localname));
 }
 
 frenzy::dom::HTMLLegendElement::HTMLLegendElement(frenzy::ustring localname)
@@ -568,15 +569,15 @@ frenzy::dom::HTMLLegendElement::HTMLLegendElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLLIElement::cloneNode(bool deep) const
 {
-  HTMLLIElementp ret = HTMLLIElement::create(get_localName());
+  HTMLLIElementp ret = HTMLLIElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLLIElementp
-frenzy::dom::HTMLLIElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLLIElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLLIElementp(new HTMLLIElement(localname));
+  return HTMLLIElementp(new (arena) HTMLLIElement(localname));
 }
 
 frenzy::dom::HTMLLIElement::HTMLLIElement(frenzy::ustring localname)
@@ -587,15 +588,15 @@ frenzy::dom::HTMLLIElement::HTMLLIElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLLinkElement::cloneNode(bool deep) const
 {
-  HTMLLinkElementp ret = HTMLLinkElement::create(get_localName());
+  HTMLLinkElementp ret = HTMLLinkElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLLinkElementp
-frenzy::dom::HTMLLinkElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLLinkElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLLinkElementp(new HTMLLinkElement(localname));
+  return HTMLLinkElementp(new (arena) HTMLLinkElement(localname));
 }
 
 frenzy::dom::HTMLLinkElement::HTMLLinkElement(frenzy::ustring localname)
@@ -606,15 +607,15 @@ frenzy::dom::HTMLLinkElement::HTMLLinkElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLMapElement::cloneNode(bool deep) const
 {
-  HTMLMapElementp ret = HTMLMapElement::create(get_localName());
+  HTMLMapElementp ret = HTMLMapElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLMapElementp
-frenzy::dom::HTMLMapElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLMapElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLMapElementp(new HTMLMapElement(localname));
+  return HTMLMapElementp(new (arena) HTMLMapElement(localname));
 }
 
 frenzy::dom::HTMLMapElement::HTMLMapElement(frenzy::ustring localname)
@@ -625,15 +626,15 @@ frenzy::dom::HTMLMapElement::HTMLMapElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLMenuElement::cloneNode(bool deep) const
 {
-  HTMLMenuElementp ret = HTMLMenuElement::create(get_localName());
+  HTMLMenuElementp ret = HTMLMenuElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLMenuElementp
-frenzy::dom::HTMLMenuElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLMenuElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLMenuElementp(new HTMLMenuElement(localname));
+  return HTMLMenuElementp(new (arena) HTMLMenuElement(localname));
 }
 
 frenzy::dom::HTMLMenuElement::HTMLMenuElement(frenzy::ustring localname)
@@ -644,15 +645,15 @@ frenzy::dom::HTMLMenuElement::HTMLMenuElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLMetaElement::cloneNode(bool deep) const
 {
-  HTMLMetaElementp ret = HTMLMetaElement::create(get_localName());
+  HTMLMetaElementp ret = HTMLMetaElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLMetaElementp
-frenzy::dom::HTMLMetaElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLMetaElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLMetaElementp(new HTMLMetaElement(localname));
+  return HTMLMetaElementp(new (arena) HTMLMetaElement(localname));
 }
 
 frenzy::dom::HTMLMetaElement::HTMLMetaElement(frenzy::ustring localname)
@@ -663,15 +664,15 @@ frenzy::dom::HTMLMetaElement::HTMLMetaElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLMeterElement::cloneNode(bool deep) const
 {
-  HTMLMeterElementp ret = HTMLMeterElement::create(get_localName());
+  HTMLMeterElementp ret = HTMLMeterElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLMeterElementp
-frenzy::dom::HTMLMeterElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLMeterElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLMeterElementp(new HTMLMeterElement(localname));
+  return HTMLMeterElementp(new (arena) HTMLMeterElement(localname));
 }
 
 frenzy::dom::HTMLMeterElement::HTMLMeterElement(frenzy::ustring localname)
@@ -682,15 +683,15 @@ frenzy::dom::HTMLMeterElement::HTMLMeterElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLModElement::cloneNode(bool deep) const
 {
-  HTMLModElementp ret = HTMLModElement::create(get_localName());
+  HTMLModElementp ret = HTMLModElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLModElementp
-frenzy::dom::HTMLModElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLModElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLModElementp(new HTMLModElement(localname));
+  return HTMLModElementp(new (arena) HTMLModElement(localname));
 }
 
 frenzy::dom::HTMLModElement::HTMLModElement(frenzy::ustring localname)
@@ -701,15 +702,15 @@ frenzy::dom::HTMLModElement::HTMLModElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLObjectElement::cloneNode(bool deep) const
 {
-  HTMLObjectElementp ret = HTMLObjectElement::create(get_localName());
+  HTMLObjectElementp ret = HTMLObjectElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLObjectElementp
-frenzy::dom::HTMLObjectElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLObjectElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLObjectElementp(new HTMLObjectElement(localname));
+  return HTMLObjectElementp(new (arena) HTMLObjectElement(localname));
 }
 
 frenzy::dom::HTMLObjectElement::HTMLObjectElement(frenzy::ustring localname)
@@ -720,15 +721,15 @@ frenzy::dom::HTMLObjectElement::HTMLObjectElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLOListElement::cloneNode(bool deep) const
 {
-  HTMLOListElementp ret = HTMLOListElement::create(get_localName());
+  HTMLOListElementp ret = HTMLOListElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLOListElementp
-frenzy::dom::HTMLOListElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLOListElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLOListElementp(new HTMLOListElement(localname));
+  return HTMLOListElementp(new (arena) HTMLOListElement(localname));
 }
 
 frenzy::dom::HTMLOListElement::HTMLOListElement(frenzy::ustring localname)
@@ -739,15 +740,15 @@ frenzy::dom::HTMLOListElement::HTMLOListElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLOptGroupElement::cloneNode(bool deep) const
 {
-  HTMLOptGroupElementp ret = HTMLOptGroupElement::create(get_localName());
+  HTMLOptGroupElementp ret = HTMLOptGroupElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLOptGroupElementp
-frenzy::dom::HTMLOptGroupElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLOptGroupElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLOptGroupElementp(new HTMLOptGroupElement(localname));
+  return HTMLOptGroupElementp(new (arena) HTMLOptGroupElement(localname));
 }
 
 frenzy::dom::HTMLOptGroupElement::HTMLOptGroupElement(frenzy::ustring localname)
@@ -758,15 +759,15 @@ frenzy::dom::HTMLOptGroupElement::HTMLOptGroupElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLOptionElement::cloneNode(bool deep) const
 {
-  HTMLOptionElementp ret = HTMLOptionElement::create(get_localName());
+  HTMLOptionElementp ret = HTMLOptionElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLOptionElementp
-frenzy::dom::HTMLOptionElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLOptionElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLOptionElementp(new HTMLOptionElement(localname));
+  return HTMLOptionElementp(new (arena) HTMLOptionElement(localname));
 }
 
 frenzy::dom::HTMLOptionElement::HTMLOptionElement(frenzy::ustring localname)
@@ -777,15 +778,15 @@ frenzy::dom::HTMLOptionElement::HTMLOptionElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLOutputElement::cloneNode(bool deep) const
 {
-  HTMLOutputElementp ret = HTMLOutputElement::create(get_localName());
+  HTMLOutputElementp ret = HTMLOutputElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLOutputElementp
-frenzy::dom::HTMLOutputElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLOutputElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLOutputElementp(new HTMLOutputElement(localname));
+  return HTMLOutputElementp(new (arena) HTMLOutputElement(localname));
 }
 
 frenzy::dom::HTMLOutputElement::HTMLOutputElement(frenzy::ustring localname)
@@ -796,15 +797,15 @@ frenzy::dom::HTMLOutputElement::HTMLOutputElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLParagraphElement::cloneNode(bool deep) const
 {
-  HTMLParagraphElementp ret = HTMLParagraphElement::create(get_localName());
+  HTMLParagraphElementp ret = HTMLParagraphElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLParagraphElementp
-frenzy::dom::HTMLParagraphElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLParagraphElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLParagraphElementp(new HTMLParagraphElement(localname));
+  return HTMLParagraphElementp(new (arena) HTMLParagraphElement(localname));
 }
 
 frenzy::dom::HTMLParagraphElement::HTMLParagraphElement(frenzy::ustring localname)
@@ -815,15 +816,15 @@ frenzy::dom::HTMLParagraphElement::HTMLParagraphElement(frenzy::ustring localnam
 frenzy::dom::Nodep
 frenzy::dom::HTMLParamElement::cloneNode(bool deep) const
 {
-  HTMLParamElementp ret = HTMLParamElement::create(get_localName());
+  HTMLParamElementp ret = HTMLParamElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLParamElementp
-frenzy::dom::HTMLParamElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLParamElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLParamElementp(new HTMLParamElement(localname));
+  return HTMLParamElementp(new (arena) HTMLParamElement(localname));
 }
 
 frenzy::dom::HTMLParamElement::HTMLParamElement(frenzy::ustring localname)
@@ -834,15 +835,15 @@ frenzy::dom::HTMLParamElement::HTMLParamElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLPreElement::cloneNode(bool deep) const
 {
-  HTMLPreElementp ret = HTMLPreElement::create(get_localName());
+  HTMLPreElementp ret = HTMLPreElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLPreElementp
-frenzy::dom::HTMLPreElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLPreElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLPreElementp(new HTMLPreElement(localname));
+  return HTMLPreElementp(new (arena) HTMLPreElement(localname));
 }
 
 frenzy::dom::HTMLPreElement::HTMLPreElement(frenzy::ustring localname)
@@ -853,15 +854,15 @@ frenzy::dom::HTMLPreElement::HTMLPreElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLProgressElement::cloneNode(bool deep) const
 {
-  HTMLProgressElementp ret = HTMLProgressElement::create(get_localName());
+  HTMLProgressElementp ret = HTMLProgressElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLProgressElementp
-frenzy::dom::HTMLProgressElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLProgressElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLProgressElementp(new HTMLProgressElement(localname));
+  return HTMLProgressElementp(new (arena) HTMLProgressElement(localname));
 }
 
 frenzy::dom::HTMLProgressElement::HTMLProgressElement(frenzy::ustring localname)
@@ -872,15 +873,15 @@ frenzy::dom::HTMLProgressElement::HTMLProgressElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLQuoteElement::cloneNode(bool deep) const
 {
-  HTMLQuoteElementp ret = HTMLQuoteElement::create(get_localName());
+  HTMLQuoteElementp ret = HTMLQuoteElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLQuoteElementp
-frenzy::dom::HTMLQuoteElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLQuoteElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLQuoteElementp(new HTMLQuoteElement(localname));
+  return HTMLQuoteElementp(new (arena) HTMLQuoteElement(localname));
 }
 
 frenzy::dom::HTMLQuoteElement::HTMLQuoteElement(frenzy::ustring localname)
@@ -891,15 +892,15 @@ frenzy::dom::HTMLQuoteElement::HTMLQuoteElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLScriptElement::cloneNode(bool deep) const
 {
-  HTMLScriptElementp ret = HTMLScriptElement::create(get_localName());
+  HTMLScriptElementp ret = HTMLScriptElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLScriptElementp
-frenzy::dom::HTMLScriptElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLScriptElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLScriptElementp(new HTMLScriptElement(localname));
+  return HTMLScriptElementp(new (arena) HTMLScriptElement(localname));
 }
 
 frenzy::dom::HTMLScriptElement::HTMLScriptElement(frenzy::ustring localname)
@@ -910,15 +911,15 @@ frenzy::dom::HTMLScriptElement::HTMLScriptElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLSelectElement::cloneNode(bool deep) const
 {
-  HTMLSelectElementp ret = HTMLSelectElement::create(get_localName());
+  HTMLSelectElementp ret = HTMLSelectElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLSelectElementp
-frenzy::dom::HTMLSelectElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLSelectElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLSelectElementp(new HTMLSelectElement(localname));
+  return HTMLSelectElementp(new (arena) HTMLSelectElement(localname));
 }
 
 frenzy::dom::HTMLSelectElement::HTMLSelectElement(frenzy::ustring localname)
@@ -929,15 +930,15 @@ frenzy::dom::HTMLSelectElement::HTMLSelectElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLSourceElement::cloneNode(bool deep) const
 {
-  HTMLSourceElementp ret = HTMLSourceElement::create(get_localName());
+  HTMLSourceElementp ret = HTMLSourceElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLSourceElementp
-frenzy::dom::HTMLSourceElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLSourceElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLSourceElementp(new HTMLSourceElement(localname));
+  return HTMLSourceElementp(new (arena) HTMLSourceElement(localname));
 }
 
 frenzy::dom::HTMLSourceElement::HTMLSourceElement(frenzy::ustring localname)
@@ -948,15 +949,15 @@ frenzy::dom::HTMLSourceElement::HTMLSourceElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLSpanElement::cloneNode(bool deep) const
 {
-  HTMLSpanElementp ret = HTMLSpanElement::create(get_localName());
+  HTMLSpanElementp ret = HTMLSpanElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLSpanElementp
-frenzy::dom::HTMLSpanElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLSpanElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLSpanElementp(new HTMLSpanElement(localname));
+  return HTMLSpanElementp(new (arena) HTMLSpanElement(localname));
 }
 
 frenzy::dom::HTMLSpanElement::HTMLSpanElement(frenzy::ustring localname)
@@ -967,15 +968,15 @@ frenzy::dom::HTMLSpanElement::HTMLSpanElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLStyleElement::cloneNode(bool deep) const
 {
-  HTMLStyleElementp ret = HTMLStyleElement::create(get_localName());
+  HTMLStyleElementp ret = HTMLStyleElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLStyleElementp
-frenzy::dom::HTMLStyleElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLStyleElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLStyleElementp(new HTMLStyleElement(localname));
+  return HTMLStyleElementp(new (arena) HTMLStyleElement(localname));
 }
 
 frenzy::dom::HTMLStyleElement::HTMLStyleElement(frenzy::ustring localname)
@@ -986,15 +987,15 @@ frenzy::dom::HTMLStyleElement::HTMLStyleElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLTableCaptionElement::cloneNode(bool deep) const
 {
-  HTMLTableCaptionElementp ret = HTMLTableCaptionElement::create(get_localName());
+  HTMLTableCaptionElementp ret = HTMLTableCaptionElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLTableCaptionElementp
-frenzy::dom::HTMLTableCaptionElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLTableCaptionElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLTableCaptionElementp(new HTMLTableCaptionElement(localname));
+  return HTMLTableCaptionElementp(new (arena) HTMLTableCaptionElement(localname));
 }
 
 frenzy::dom::HTMLTableCaptionElement::HTMLTableCaptionElement(frenzy::ustring localname)
@@ -1005,15 +1006,15 @@ frenzy::dom::HTMLTableCaptionElement::HTMLTableCaptionElement(frenzy::ustring lo
 frenzy::dom::Nodep
 frenzy::dom::HTMLTableColElement::cloneNode(bool deep) const
 {
-  HTMLTableColElementp ret = HTMLTableColElement::create(get_localName());
+  HTMLTableColElementp ret = HTMLTableColElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLTableColElementp
-frenzy::dom::HTMLTableColElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLTableColElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLTableColElementp(new HTMLTableColElement(localname));
+  return HTMLTableColElementp(new (arena) HTMLTableColElement(localname));
 }
 
 frenzy::dom::HTMLTableColElement::HTMLTableColElement(frenzy::ustring localname)
@@ -1024,15 +1025,15 @@ frenzy::dom::HTMLTableColElement::HTMLTableColElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLTableElement::cloneNode(bool deep) const
 {
-  HTMLTableElementp ret = HTMLTableElement::create(get_localName());
+  HTMLTableElementp ret = HTMLTableElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLTableElementp
-frenzy::dom::HTMLTableElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLTableElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLTableElementp(new HTMLTableElement(localname));
+  return HTMLTableElementp(new (arena) HTMLTableElement(localname));
 }
 
 frenzy::dom::HTMLTableElement::HTMLTableElement(frenzy::ustring localname)
@@ -1043,15 +1044,15 @@ frenzy::dom::HTMLTableElement::HTMLTableElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLTableRowElement::cloneNode(bool deep) const
 {
-  HTMLTableRowElementp ret = HTMLTableRowElement::create(get_localName());
+  HTMLTableRowElementp ret = HTMLTableRowElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLTableRowElementp
-frenzy::dom::HTMLTableRowElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLTableRowElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLTableRowElementp(new HTMLTableRowElement(localname));
+  return HTMLTableRowElementp(new (arena) HTMLTableRowElement(localname));
 }
 
 frenzy::dom::HTMLTableRowElement::HTMLTableRowElement(frenzy::ustring localname)
@@ -1062,15 +1063,15 @@ frenzy::dom::HTMLTableRowElement::HTMLTableRowElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLTableSectionElement::cloneNode(bool deep) const
 {
-  HTMLTableSectionElementp ret = HTMLTableSectionElement::create(get_localName());
+  HTMLTableSectionElementp ret = HTMLTableSectionElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLTableSectionElementp
-frenzy::dom::HTMLTableSectionElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLTableSectionElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLTableSectionElementp(new HTMLTableSectionElement(localname));
+  return HTMLTableSectionElementp(new (arena) HTMLTableSectionElement(localname));
 }
 
 frenzy::dom::HTMLTableSectionElement::HTMLTableSectionElement(frenzy::ustring localname)
@@ -1081,15 +1082,15 @@ frenzy::dom::HTMLTableSectionElement::HTMLTableSectionElement(frenzy::ustring lo
 frenzy::dom::Nodep
 frenzy::dom::HTMLTextAreaElement::cloneNode(bool deep) const
 {
-  HTMLTextAreaElementp ret = HTMLTextAreaElement::create(get_localName());
+  HTMLTextAreaElementp ret = HTMLTextAreaElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLTextAreaElementp
-frenzy::dom::HTMLTextAreaElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLTextAreaElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLTextAreaElementp(new HTMLTextAreaElement(localname));
+  return HTMLTextAreaElementp(new (arena) HTMLTextAreaElement(localname));
 }
 
 frenzy::dom::HTMLTextAreaElement::HTMLTextAreaElement(frenzy::ustring localname)
@@ -1100,15 +1101,15 @@ frenzy::dom::HTMLTextAreaElement::HTMLTextAreaElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLTimeElement::cloneNode(bool deep) const
 {
-  HTMLTimeElementp ret = HTMLTimeElement::create(get_localName());
+  HTMLTimeElementp ret = HTMLTimeElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLTimeElementp
-frenzy::dom::HTMLTimeElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLTimeElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLTimeElementp(new HTMLTimeElement(localname));
+  return HTMLTimeElementp(new (arena) HTMLTimeElement(localname));
 }
 
 frenzy::dom::HTMLTimeElement::HTMLTimeElement(frenzy::ustring localname)
@@ -1119,15 +1120,15 @@ frenzy::dom::HTMLTimeElement::HTMLTimeElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLTitleElement::cloneNode(bool deep) const
 {
-  HTMLTitleElementp ret = HTMLTitleElement::create(get_localName());
+  HTMLTitleElementp ret = HTMLTitleElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLTitleElementp
-frenzy::dom::HTMLTitleElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLTitleElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLTitleElementp(new HTMLTitleElement(localname));
+  return HTMLTitleElementp(new (arena) HTMLTitleElement(localname));
 }
 
 frenzy::dom::HTMLTitleElement::HTMLTitleElement(frenzy::ustring localname)
@@ -1138,15 +1139,15 @@ frenzy::dom::HTMLTitleElement::HTMLTitleElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLTrackElement::cloneNode(bool deep) const
 {
-  HTMLTrackElementp ret = HTMLTrackElement::create(get_localName());
+  HTMLTrackElementp ret = HTMLTrackElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLTrackElementp
-frenzy::dom::HTMLTrackElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLTrackElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLTrackElementp(new HTMLTrackElement(localname));
+  return HTMLTrackElementp(new (arena) HTMLTrackElement(localname));
 }
 
 frenzy::dom::HTMLTrackElement::HTMLTrackElement(frenzy::ustring localname)
@@ -1157,15 +1158,15 @@ frenzy::dom::HTMLTrackElement::HTMLTrackElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLUListElement::cloneNode(bool deep) const
 {
-  HTMLUListElementp ret = HTMLUListElement::create(get_localName());
+  HTMLUListElementp ret = HTMLUListElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLUListElementp
-frenzy::dom::HTMLUListElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLUListElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLUListElementp(new HTMLUListElement(localname));
+  return HTMLUListElementp(new (arena) HTMLUListElement(localname));
 }
 
 frenzy::dom::HTMLUListElement::HTMLUListElement(frenzy::ustring localname)
@@ -1194,15 +1195,15 @@ frenzy::dom::HTMLMediaElement::HTMLMediaElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLTableDataCellElement::cloneNode(bool deep) const
 {
-  HTMLTableDataCellElementp ret = HTMLTableDataCellElement::create(get_localName());
+  HTMLTableDataCellElementp ret = HTMLTableDataCellElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLTableDataCellElementp
-frenzy::dom::HTMLTableDataCellElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLTableDataCellElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLTableDataCellElementp(new HTMLTableDataCellElement(localname));
+  return HTMLTableDataCellElementp(new (arena) HTMLTableDataCellElement(localname));
 }
 
 frenzy::dom::HTMLTableDataCellElement::HTMLTableDataCellElement(frenzy::ustring localname)
@@ -1213,15 +1214,15 @@ frenzy::dom::HTMLTableDataCellElement::HTMLTableDataCellElement(frenzy::ustring
 frenzy::dom::Nodep
 frenzy::dom::HTMLTableHeaderCellElement::cloneNode(bool deep) const
 {
-  HTMLTableHeaderCellElementp ret = HTMLTableHeaderCellElement::create(get_localName());
+  HTMLTableHeaderCellElementp ret = HTMLTableHeaderCellElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLTableHeaderCellElementp
-frenzy::dom::HTMLTableHeaderCellElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLTableHeaderCellElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLTableHeaderCellElementp(new HTMLTableHeaderCellElement(localname));
+  return HTMLTableHeaderCellElementp(new (arena) HTMLTableHeaderCellElement(localname));
 }
 
 frenzy::dom::HTMLTableHeaderCellElement::HTMLTableHeaderCellElement(frenzy::ustring localname)
@@ -1232,15 +1233,15 @@ frenzy::dom::HTMLTableHeaderCellElement::HTMLTableHeaderCellElement(frenzy::ustr
 frenzy::dom::Nodep
 frenzy::dom::HTMLAudioElement::cloneNode(bool deep) const
 {
-  HTMLAudioElementp ret = HTMLAudioElement::create(get_localName());
+  HTMLAudioElementp ret = HTMLAudioElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLAudioElementp
-frenzy::dom::HTMLAudioElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLAudioElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLAudioElementp(new HTMLAudioElement(localname));
+  return HTMLAudioElementp(new (arena) HTMLAudioElement(localname));
 }
 
 frenzy::dom::HTMLAudioElement::HTMLAudioElement(frenzy::ustring localname)
@@ -1251,15 +1252,15 @@ frenzy::dom::HTMLAudioElement::HTMLAudioElement(frenzy::ustring localname)
 frenzy::dom::Nodep
 frenzy::dom::HTMLVideoElement::cloneNode(bool deep) const
 {
-  HTMLVideoElementp ret = HTMLVideoElement::create(get_localName());
+  HTMLVideoElementp ret = HTMLVideoElement::create(get_localName(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::HTMLVideoElementp
-frenzy::dom::HTMLVideoElement::create(frenzy::ustring localname)
+frenzy::dom::HTMLVideoElement::create(frenzy::ustring localname, frenzy::dom::nodearenap arena)
 {
-  return HTMLVideoElementp(new HTMLVideoElement(localname));
+  return HTMLVideoElementp(new (arena) HTMLVideoElement(localname));
 }
 
 frenzy::dom::HTMLVideoElement::HTMLVideoElement(frenzy::ustring localname)
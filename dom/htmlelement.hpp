@@ -33,7 +33,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLElementp create(ustring localname);
+      static HTMLElementp create(ustring localname, nodearenap arena = nodearenap());
 
       //
       // Graphics
@@ -50,7 +50,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLUnknownElementp create(ustring localname);
+      static HTMLUnknownElementp create(ustring localname, nodearenap arena = nodearenap());
 
     private:
       HTMLUnknownElement(ustring localname);
@@ -64,7 +64,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLAnchorElementp create(ustring localname);
+      static HTMLAnchorElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLAnchorElement(ustring localname);
@@ -74,7 +74,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLAreaElementp create(ustring localname);
+      static HTMLAreaElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLAreaElement(ustring localname);
@@ -84,7 +84,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLBaseElementp create(ustring localname);
+      static HTMLBaseElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLBaseElement(ustring localname);
@@ -94,7 +94,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLBodyElementp create(ustring localname);
+      static HTMLBodyElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLBodyElement(ustring localname);
@@ -104,7 +104,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLBRElementp create(ustring localname);
+      static HTMLBRElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLBRElement(ustring localname);
@@ -114,7 +114,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLButtonElementp create(ustring localname);
+      static HTMLButtonElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLButtonElement(ustring localname);
@@ -124,7 +124,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLCanvasElementp create(ustring localname);
+      static HTMLCanvasElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLCanvasElement(ustring localname);
@@ -134,7 +134,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLCommandElementp create(ustring localname);
+      static HTMLCommandElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLCommandElement(ustring localname);
@@ -144,7 +144,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLDataElementp create(ustring localname);
+      static HTMLDataElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLDataElement(ustring localname);
@@ -154,7 +154,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLDataListElementp create(ustring localname);
+      static HTMLDataListElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLDataListElement(ustring localname);
@@ -164,7 +164,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLDetailsElementp create(ustring localname);
+      static HTMLDetailsElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLDetailsElement(ustring localname);
@@ -174,7 +174,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLDialogElementp create(ustring localname);
+      static HTMLDialogElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLDialogElement(ustring localname);
@@ -184,7 +184,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLDivElementp create(ustring localname);
+      static HTMLDivElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLDivElement(ustring localname);
@@ -194,7 +194,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLDListElementp create(ustring localname);
+      static HTMLDListElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLDListElement(ustring localname);
@@ -204,7 +204,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLEmbedElementp create(ustring localname);
+      static HTMLEmbedElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLEmbedElement(ustring localname);
@@ -214,7 +214,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLFieldSetElementp create(ustring localname);
+      static HTMLFieldSetElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLFieldSetElement(ustring localname);
@@ -224,7 +224,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLFormElementp create(ustring localname);
+      static HTMLFormElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLFormElement(ustring localname);
@@ -234,7 +234,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLHeadElementp create(ustring localname);
+      static HTMLHeadElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLHeadElement(ustring localname);
@@ -244,7 +244,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLHeadingElementp create(ustring localname);
+      static HTMLHeadingElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLHeadingElement(ustring localname);
@@ -254,7 +254,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLHRElementp create(ustring localname);
+      static HTMLHRElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLHRElement(ustring localname);
@@ -264,7 +264,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLHtmlElementp create(ustring localname);
+      static HTMLHtmlElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLHtmlElement(ustring localname);
@@ -274,7 +274,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLIFrameElementp create(ustring localname);
+      static HTMLIFrameElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLIFrameElement(ustring localname);
@@ -284,7 +284,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLImageElementp create(ustring localname);
+      static HTMLImageElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLImageElement(ustring localname);
@@ -294,7 +294,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLInputElementp create(ustring localname);
+      static HTMLInputElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLInputElement(ustring localname);
@@ -304,7 +304,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLKeygenElementp create(ustring localname);
+      static HTMLKeygenElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLKeygenElement(ustring localname);
@@ -314,7 +314,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLLabelElementp create(ustring localname);
+      static HTMLLabelElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLLabelElement(ustring localname);
@@ -324,7 +324,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLLegendElementp create(ustring localname);
+      static HTMLLegendElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLLegendElement(ustring localname);
@@ -334,7 +334,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLLIElementp create(ustring localname);
+      static HTMLLIElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLLIElement(ustring localname);
@@ -344,7 +344,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLLinkElementp create(ustring localname);
+      static HTMLLinkElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLLinkElement(ustring localname);
@@ -354,7 +354,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLMapElementp create(ustring localname);
+      static HTMLMapElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLMapElement(ustring localname);
@@ -364,7 +364,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLMenuElementp create(ustring localname);
+      static HTMLMenuElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLMenuElement(ustring localname);
@@ -374,7 +374,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLMetaElementp create(ustring localname);
+      static HTMLMetaElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLMetaElement(ustring localname);
@@ -384,7 +384,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLMeterElementp create(ustring localname);
+      static HTMLMeterElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLMeterElement(ustring localname);
@@ -394,7 +394,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLModElementp create(ustring localname);
+      static HTMLModElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLModElement(ustring localname);
@@ -404,7 +404,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLObjectElementp create(ustring localname);
+      static HTMLObjectElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLObjectElement(ustring localname);
@@ -414,7 +414,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLOListElementp create(ustring localname);
+      static HTMLOListElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLOListElement(ustring localname);
@@ -424,7 +424,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLOptGroupElementp create(ustring localname);
+      static HTMLOptGroupElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLOptGroupElement(ustring localname);
@@ -434,7 +434,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLOptionElementp create(ustring localname);
+      static HTMLOptionElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLOptionElement(ustring localname);
@@ -444,7 +444,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLOutputElementp create(ustring localname);
+      static HTMLOutputElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLOutputElement(ustring localname);
@@ -454,7 +454,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLParagraphElementp create(ustring localname);
+      static HTMLParagraphElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLParagraphElement(ustring localname);
@@ -464,7 +464,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLParamElementp create(ustring localname);
+      static HTMLParamElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLParamElement(ustring localname);
@@ -474,7 +474,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLPreElementp create(ustring localname);
+      static HTMLPreElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLPreElement(ustring localname);
@@ -484,7 +484,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLProgressElementp create(ustring localname);
+      static HTMLProgressElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLProgressElement(ustring localname);
@@ -494,7 +494,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLQuoteElementp create(ustring localname);
+      static HTMLQuoteElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLQuoteElement(ustring localname);
@@ -504,7 +504,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLScriptElementp create(ustring localname);
+      static HTMLScriptElementp create(ustring localname, nodearenap arena = nodearenap());
 
       //
       // Graphics
@@ -524,7 +524,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLSelectElementp create(ustring localname);
+      static HTMLSelectElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLSelectElement(ustring localname);
@@ -534,7 +534,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLSourceElementp create(ustring localname);
+      static HTMLSourceElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLSourceElement(ustring localname);
@@ -544,7 +544,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLSpanElementp create(ustring localname);
+      static HTMLSpanElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLSpanElement(ustring localname);
@@ -554,7 +554,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLStyleElementp create(ustring localname);
+      static HTMLStyleElementp create(ustring localname, nodearenap arena = nodearenap());
 
       //
       // Graphics
@@ -574,7 +574,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLTableCaptionElementp create(ustring localname);
+      static HTMLTableCaptionElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLTableCaptionElement(ustring localname);
@@ -584,7 +584,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLTableColElementp create(ustring localname);
+      static HTMLTableColElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLTableColElement(ustring localname);
@@ -594,7 +594,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLTableElementp create(ustring localname);
+      static HTMLTableElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLTableElement(ustring localname);
@@ -604,7 +604,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLTableRowElementp create(ustring localname);
+      static HTMLTableRowElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLTableRowElement(ustring localname);
@@ -614,7 +614,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLTableSectionElementp create(ustring localname);
+      static HTMLTableSectionElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLTableSectionElement(ustring localname);
@@ -624,7 +624,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLTextAreaElementp create(ustring localname);
+      static HTMLTextAreaElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLTextAreaElement(ustring localname);
@@ -634,7 +634,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLTimeElementp create(ustring localname);
+      static HTMLTimeElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLTimeElement(ustring localname);
@@ -644,7 +644,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLTitleElementp create(ustring localname);
+      static HTMLTitleElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLTitleElement(ustring localname);
@@ -654,7 +654,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLTrackElementp create(ustring localname);
+      static HTMLTrackElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLTrackElement(ustring localname);
@@ -664,7 +664,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLUListElementp create(ustring localname);
+      static HTMLUListElementp create(ustring localname, nodearenap arena = nodearenap());
 
     protected:
       HTMLUListElement(ustring localname);
@@ -694,7 +694,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLTableDataCellElementp create(ustring localname);
+      static HTMLTableDataCellElementp create(ustring localname, nodearenap arena = nodearenap());
 
     private:
       HTMLTableDataCellElement(ustring localname);
@@ -704,7 +704,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLTableHeaderCellElementp create(ustring localname);
+      static HTMLTableHeaderCellElementp create(ustring localname, nodearenap arena = nodearenap());
 
     private:
       HTMLTableHeaderCellElement(ustring localname);
@@ -714,7 +714,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLAudioElementp create(ustring localname);
+      static HTMLAudioElementp create(ustring localname, nodearenap arena = nodearenap());
 
     private:
       HTMLAudioElement(ustring localname);
@@ -724,7 +724,7 @@ namespace frenzy
     {
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static HTMLVideoElementp create(ustring localname);
+      static HTMLVideoElementp create(ustring localname, nodearenap arena = nodearenap());
 
     private:
       HTMLVideoElement(ustring localname);
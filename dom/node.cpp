@@ -14,15 +14,47 @@
 #include <cassert>
 #include <algorithm>
 #include <stdexcept>
+#include <boost/bind.hpp>
 
 #include "node.hpp"
+#include "arena.hpp"
 #include "document.hpp"
 #include "element.hpp"
 #include "text.hpp"
 #include "exception.hpp"
 
+struct frenzy::dom::Node::observers
+{
+  // Called after this node is inserted as a child of another node.
+  modified_signal inserted_to;
+  // Called after this node is removed from its parent.
+  modified_signal removed_from;
+  // Called after a child is removed from `this'.
+  modified_signal child_removed;
+  // Called after a child is added to `this'.
+  modified_signal child_added;
+};
+
 frenzy::dom::Node::~Node()
 {
+  Node* child = first_child;
+  while (child)
+  {
+    Node* next = child->next_sibling;
+
+    child->parent = 0;
+    child->prev_sibling = 0;
+    child->next_sibling = 0;
+    intrusive_ptr_release(child);
+
+    child = next;
+  }
+
+  if (weak)
+  {
+    weak->target = 0;
+    release_weakcontrol(weak);
+  }
 }
 
 
@@ -35,13 +67,13 @@ frenzy::dom::Node::get_ownerDocument() const
 frenzy::dom::Nodep
 frenzy::dom::Node::get_parentNode() const
 {
-  return parent.lock();
+  return Nodep(parent);
 }
 
 bool
 frenzy::dom::Node::hasChildNodes() const
 {
-  return !children.empty();
+  return first_child;
 }
 
 frenzy::dom::NodeListp
@@ -53,31 +85,25 @@ frenzy::dom::Node::get_childNodes()
 frenzy::dom::Nodep
 frenzy::dom::Node::get_firstChild() const
 {
-  if (hasChildNodes())
-    return children.front();
-
-  return Nodep();
+  return Nodep(first_child);
 }
 
 frenzy::dom::Nodep
 frenzy::dom::Node::get_lastChild() const
 {
-  if (hasChildNodes())
-    return children.back();
-  
-  return Nodep();
+  return Nodep(last_child);
 }
 
 frenzy::dom::Nodep
 frenzy::dom::Node::get_previousSibling() const
 {
-  return prev_sibling.lock();
+  return Nodep(prev_sibling);
 }
 
 frenzy::dom::Nodep
 frenzy::dom::Node::get_nextSibling() const
 {
-  return next_sibling.lock();
+  return Nodep(next_sibling);
 }
 
 boost::optional<frenzy::ustring>
@@ -181,11 +207,9 @@ frenzy::dom::Node::normalize()
     thiselem->normalizeAttributes();
   }
 
-  for (children_t::const_iterator it = children.begin();
-       it != children.end();
-       ++it)
+  for (Node* child = first_child; child; child = child->next_sibling)
   {
-    dom::Nodep n = *it;
+    dom::Nodep n(child);
     nodeType type = n->get_nodeType();
     
     if (type == TEXT_NODE)
@@ -214,6 +238,84 @@ frenzy::dom::Node::normalize()
   }
 }
 
+frenzy::dom::Node::documentPosition
+frenzy::dom::Node::compareDocumentPosition(frenzy::dom::Nodep other) const
+{
+  if (other.get() == this)
+    return documentPosition(0);
+
+  if (labeled_document(other.get()))
+  {
+    if (other->tree_index < tree_index)
+    {
+      if (tree_index <= other->tree_end)
+	return documentPosition(DOCUMENT_POSITION_CONTAINS | DOCUMENT_POSITION_PRECEDING);
+      return DOCUMENT_POSITION_PRECEDING;
+    }
+
+    if (other->tree_index <= tree_end)
+      return documentPosition(DOCUMENT_POSITION_CONTAINED_BY | DOCUMENT_POSITION_FOLLOWING);
+    return DOCUMENT_POSITION_FOLLOWING;
+  }
+
+  // Outside a document tree, compare the ancestor chains
+  std::vector<const Node*> mine;
+  std::vector<const Node*> theirs;
+  for (const Node* n = this; n; n = n->parent)
+    mine.push_back(n);
+  for (const Node* n = other.get(); n; n = n->parent)
+    theirs.push_back(n);
+
+  if (mine.back() != theirs.back())
+  {
+    // The order of different trees is arbitrary but consistent
+    return documentPosition(DOCUMENT_POSITION_DISCONNECTED |
+			    DOCUMENT_POSITION_IMPLEMENTATION_SPECIFIC |
+			    (mine.back() < theirs.back() ?
+			     DOCUMENT_POSITION_FOLLOWING : DOCUMENT_POSITION_PRECEDING));
+  }
+
+  size_t i = mine.size();
+  size_t j = theirs.size();
+  while (i > 0 && j > 0 && mine[i - 1] == theirs[j - 1])
+  {
+    --i;
+    --j;
+  }
+
+  if (j == 0)
+    return documentPosition(DOCUMENT_POSITION_CONTAINS | DOCUMENT_POSITION_PRECEDING);
+  if (i == 0)
+    return documentPosition(DOCUMENT_POSITION_CONTAINED_BY | DOCUMENT_POSITION_FOLLOWING);
+
+  // mine[i - 1] and theirs[j - 1] are children of the same node
+  for (const Node* n = mine[i - 1]->next_sibling; n; n = n->next_sibling)
+  {
+    if (n == theirs[j - 1])
+      return DOCUMENT_POSITION_FOLLOWING;
+  }
+
+  return DOCUMENT_POSITION_PRECEDING;
+}
+
+bool
+frenzy::dom::Node::contains(frenzy::dom::Nodep other) const
+{
+  if (!other)
+    return false;
+
+  if (labeled_document(other.get()))
+    return tree_index <= other->tree_index && other->tree_index <= tree_end;
+
+  for (const Node* n = other.get(); n; n = n->parent)
+  {
+    if (n == this)
+      return true;
+  }
+
+  return false;
+}
+
 frenzy::dom::NamedNodeMapp
 frenzy::dom::Node::get_attributes()
 {
@@ -223,13 +325,14 @@ frenzy::dom::Node::get_attributes()
 frenzy::dom::Nodep
 frenzy::dom::Node::get_nextInTreeOrder(frenzy::dom::Nodep root)
 {
-  if (Nodep child = get_firstChild())
-    return child;
+  if (first_child)
+    return Nodep(first_child);
 
-  for (Nodep n = shared_from_this(); n != root; n = n->get_parentNode())
+  // Walking the raw links, only the result needs a reference
+  for (Node* n = this; n && n != root.get(); n = n->parent)
   {
-    if (Nodep sib = n->get_nextSibling())
-      return sib;
+    if (n->next_sibling)
+      return Nodep(n->next_sibling);
   }
 
   return Nodep();
@@ -238,13 +341,25 @@ frenzy::dom::Node::get_nextInTreeOrder(frenzy::dom::Nodep root)
 void
 frenzy::dom::Node::recursive_set_ownerdocument(frenzy::dom::Documentp doc)
 {
+  Documentp previous = ownerdocument.lock();
   ownerdocument = doc;
 
-  for (children_t::iterator it = children.begin();
-       it != children.end();
-       ++it)
+  // Class tokens are per document
+  if (doc != previous && get_nodeType() == ELEMENT_NODE)
+    static_cast<Element*>(this)->attribute_changed("class");
+
+  // Attributes are not children, but belong to the document too
+  if (NamedNodeMapp attrs = get_attributes())
   {
-    (*it)->recursive_set_ownerdocument(doc);
+    for (size_t i = 0; i < attrs->get_length(); ++i)
+    {
+      attrs->item(i)->recursive_set_ownerdocument(doc);
+    }
+  }
+
+  for (Node* child = first_child; child; child = child->next_sibling)
+  {
+    child->recursive_set_ownerdocument(doc);
   }
 }
 
@@ -253,22 +368,19 @@ frenzy::dom::Node::recursive_mark_dirty()
 {
   dirty = true;
 
-  for (children_t::iterator it = children.begin();
-       it != children.end();
-       ++it)
+  for (Node* child = first_child; child; child = child->next_sibling)
   {
-    (*it)->recursive_mark_dirty();
+    child->recursive_mark_dirty();
   }
 }
 
 void
 frenzy::dom::Node::mark_dirty()
 {
-  dirty = true;
-  
-  if (Nodep n = get_parentNode())
+  // The ancestors of a dirty node are dirty already
+  for (Node* n = this; n && !n->dirty; n = n->parent)
   {
-    n->mark_dirty();
+    n->dirty = true;
   }
 }
 
@@ -278,6 +390,12 @@ frenzy::dom::Node::is_dirty() const
   return dirty;
 }
 
+void
+frenzy::dom::Node::mark_clean()
+{
+  dirty = false;
+}
+
 void
 frenzy::dom::Node::drop_graphics()
 {
@@ -289,14 +407,25 @@ frenzy::dom::Node::recursive_drop_graphics()
 {
   drop_graphics();
 
-  for (children_t::iterator it = children.begin();
-       it != children.end();
-       ++it)
+  for (Node* child = first_child; child; child = child->next_sibling)
   {
-    (*it)->recursive_drop_graphics();
+    child->recursive_drop_graphics();
   }
 }
 
+frenzy::vec2
+frenzy::dom::Node::relayout(frenzy::vec maxwidth)
+{
+  if (!dirty && layoutwidth == maxwidth)
+    return layoutsize;
+
+  layoutsize = layout(maxwidth);
+  layoutwidth = maxwidth;
+  dirty = false;
+
+  return layoutsize;
+}
+
 frenzy::vec2
 frenzy::dom::Node::layout(frenzy::vec maxwidth)
 {
@@ -307,23 +436,21 @@ frenzy::dom::Node::layout(frenzy::vec maxwidth)
   vec2 childpos(0, 0);
   vec nextline(0);
 
-  for (children_t::iterator it = children.begin();
-       it != children.end();
-       ++it)
+  for (Node* child = first_child; child; child = child->next_sibling)
   {
-    positiontype postype = (*it)->get_positiontype();
+    positiontype postype = child->get_positiontype();
     if (postype == POSITION_ABSOLUTE || postype == POSITION_FLOAT)
     {
       // TODO: Implement these
       continue;
     }
     
-    vec2 childsize = (*it)->layout(xroom);
+    vec2 childsize = child->relayout(xroom);
     if (!fits(childsize.x, xroom) && nextline != 0)
     {
       xroom = maxwidth;
       childpos = vec2(0, nextline);
-      childsize = (*it)->layout(xroom);
+      childsize = child->relayout(xroom);
       // We'll leave it there even if it doesn't fit
     }
 
@@ -333,7 +460,7 @@ frenzy::dom::Node::layout(frenzy::vec maxwidth)
     boost::shared_ptr<graphics::translation> thispos = get_position();
     // Document should only call layout() when there is a graphics provider.
     assert(thispos);
-    (*it)->set_position(thispos, childpos);
+    child->set_position(thispos, childpos);
     
     size.grow(childpos + childsize);
     if (nextline < childpos.y + childsize.y)
@@ -400,8 +527,151 @@ frenzy::dom::Node::set_position(boost::shared_ptr<frenzy::graphics::translation>
 }
 
 frenzy::dom::Node::Node()
-  : dirty(true)
+  : first_child(0)
+  , last_child(0)
+  , parent(0)
+  , prev_sibling(0)
+  , next_sibling(0)
+  , dirty(true)
+  , connected(false)
+  , tree_index(0)
+  , tree_end(0)
+  , refcount(0)
+  , weak(0)
+{
+}
+
+frenzy::dom::Nodep
+frenzy::dom::Node::shared_from_this()
+{
+  return Nodep(this);
+}
+
+frenzy::dom::CNodep
+frenzy::dom::Node::shared_from_this() const
+{
+  return CNodep(this);
+}
+
+frenzy::dom::weakcontrol*
+frenzy::dom::acquire_weakcontrol(const frenzy::dom::Node* node)
+{
+  if (!node->weak)
+  {
+    // The node holds one reference until it dies
+    node->weak = new weakcontrol();
+    node->weak->refs = 1;
+    node->weak->target = const_cast<Node*>(node);
+  }
+
+  ++node->weak->refs;
+  return node->weak;
+}
+
+void
+frenzy::dom::release_weakcontrol(frenzy::dom::weakcontrol* control)
+{
+  if (--control->refs == 0)
+    delete control;
+}
+
+void*
+frenzy::dom::Node::operator new(size_t size)
+{
+  return nodearena::allocate_node(size, 0);
+}
+
+void*
+frenzy::dom::Node::operator new(size_t size, const frenzy::dom::nodearenap& arena)
+{
+  return nodearena::allocate_node(size, arena.get());
+}
+
+void
+frenzy::dom::Node::operator delete(void* p)
+{
+  nodearena::deallocate_node(p);
+}
+
+void
+frenzy::dom::Node::operator delete(void* p, const frenzy::dom::nodearenap&)
+{
+  nodearena::deallocate_node(p);
+}
+
+frenzy::dom::Documentp
+frenzy::dom::Node::node_document() const
+{
+  if (get_nodeType() == DOCUMENT_NODE)
+    return Documentp(static_cast<Document*>(const_cast<Node*>(this)));
+
+  return get_ownerDocument();
+}
+
+frenzy::dom::Documentp
+frenzy::dom::Node::labeled_document(const frenzy::dom::Node* other) const
+{
+  if (!connected || !other->connected)
+    return Documentp();
+
+  Documentp doc = node_document();
+  if (!doc || doc != other->node_document())
+    return Documentp();
+
+  doc->refresh_tree_order();
+  return doc;
+}
+
+frenzy::dom::Node::observers&
+frenzy::dom::Node::get_observers()
+{
+  if (!signals)
+    signals.reset(new observers());
+
+  return *signals;
+}
+
+boost::signals2::connection
+frenzy::dom::Node::on_inserted_to(const frenzy::dom::Node::modified_slot& slot)
+{
+  return get_observers().inserted_to.connect(slot);
+}
+
+boost::signals2::connection
+frenzy::dom::Node::on_removed_from(const frenzy::dom::Node::modified_slot& slot)
+{
+  return get_observers().removed_from.connect(slot);
+}
+
+boost::signals2::connection
+frenzy::dom::Node::on_child_removed(const frenzy::dom::Node::modified_slot& slot)
 {
+  return get_observers().child_removed.connect(slot);
+}
+
+boost::signals2::connection
+frenzy::dom::Node::on_child_added(const frenzy::dom::Node::modified_slot& slot)
+{
+  return get_observers().child_added.connect(slot);
+}
+
+void
+frenzy::dom::Node::children_changed()
+{
+}
+
+void
+frenzy::dom::Node::note_mutation()
+{
+  if (Documentp doc = node_document())
+    doc->tree_changed();
+}
+
+frenzy::dom::nodearenap
+frenzy::dom::Node::owner_arena() const
+{
+  Documentp doc = get_ownerDocument();
+  return doc ? doc->get_arena() : nodearenap();
 }
 
 void
@@ -411,11 +681,9 @@ frenzy::dom::Node::copyTo(frenzy::dom::Nodep n, bool deep) const
 
   if (deep)
   {
-    for (children_t::const_iterator it = children.begin();
-	 it != children.end();
-	 ++it)
+    for (Node* child = first_child; child; child = child->next_sibling)
     {
-      n->appendChild((*it)->cloneNode(deep));
+      n->appendChild(child->cloneNode(deep));
     }
   }
 }
@@ -432,59 +700,60 @@ frenzy::dom::Node::insertBefore(frenzy::dom::Nodep node,
     // TODO: Mutation records as per DOM4 5.2.1
   }
 
-  children_t toinsert;
+  std::vector<Nodep> toinsert;
 
   if (node->get_nodeType() == DOCUMENT_FRAGMENT_NODE)
   {
-    toinsert = node->children;
+    // The children are moved out of the fragment
+    for (Node* fragchild = node->first_child; fragchild; fragchild = fragchild->next_sibling)
+    {
+      toinsert.push_back(Nodep(fragchild));
+    }
+    for (size_t i = 0; i < toinsert.size(); ++i)
+    {
+      node->removeChild(toinsert[i], true);
+    }
   }
   else
   {
     toinsert.push_back(node);
   }
 
-  children_t::iterator it = children.end();
-  if (child)
-  {
-    it = std::find(children.begin(), children.end(), child);
-    assert(it != children.end());
-  }
+  Node* next = child.get();
+  assert(!next || next->parent == this);
+  Node* prev = next ? next->prev_sibling : last_child;
 
-  Nodep prev;
-  Nodep next;
-  if (it != children.begin())
+  for (size_t i = 0; i < toinsert.size(); ++i)
   {
-    children_t::iterator previt = it;
-    --previt;
-    prev = *previt;
-  }
-  if (it != children.end())
-  {
-    next = *it;
-  }
+    Node* n = toinsert[i].get();
+
+    // The parent holds a reference to each of its children
+    intrusive_ptr_add_ref(n);
+
+    n->parent = this;
+    n->prev_sibling = prev;
+    n->next_sibling = next;
 
-  for (children_t::const_iterator insiter = toinsert.begin();
-       insiter != toinsert.end();
-       ++insiter)
-  {
     if (prev)
-    {
-      prev->next_sibling = *insiter;
-    }
+      prev->next_sibling = n;
+    else
+      first_child = n;
+
     if (next)
-    {
-      next->prev_sibling = *insiter;
-    }
-    (*insiter)->next_sibling = next;
-    (*insiter)->prev_sibling = prev;
-    (*insiter)->parent = shared_from_this();
+      next->prev_sibling = n;
+    else
+      last_child = n;
 
-    children.insert(it, *insiter);
+    prev = n;
 
-    prev = *insiter;
+    note_mutation();
+    if (connected)
+      node_document()->subtree_inserted(n);
 
-    (*insiter)->inserted_to(shared_from_this());
-    child_added(*insiter);
+    if (n->signals)
+      n->signals->inserted_to(shared_from_this());
+    if (signals)
+      signals->child_added(toinsert[i]);
 
     if (!suppress_observers)
     {
@@ -493,6 +762,9 @@ frenzy::dom::Node::insertBefore(frenzy::dom::Nodep node,
     }
   }
 
+  children_changed();
+  mark_dirty();
+
   return node;
 }
 
@@ -509,47 +781,42 @@ frenzy::dom::Node::removeChild(frenzy::dom::Nodep child,
 
   // TODO: Registered observers chain handling to ancestors
 
-  children_t::iterator it = std::find(children.begin(), children.end(), child);
-  assert(it != children.end());
+  Node* n = child.get();
+  assert(n->parent == this);
 
-  Nodep prev;
-  Nodep next;
-  if (it != children.begin())
-  {
-    children_t::iterator previt = it;
-    --previt;
-    prev = *previt;
-  }
-  if (it != children.end())
-  {
-    children_t::iterator nextit = it;
-    ++nextit;
-    if (nextit != children.end())
-    {
-      next = *nextit;
-    }
-  }
+  if (n->connected)
+    node_document()->subtree_removed(n);
 
-  if (prev)
-  {
-    prev->next_sibling = next;
-  }
-  if (next)
-  {
-    next->prev_sibling = prev;
-  }
+  if (n->prev_sibling)
+    n->prev_sibling->next_sibling = n->next_sibling;
+  else
+    first_child = n->next_sibling;
 
-  children.erase(it);
+  if (n->next_sibling)
+    n->next_sibling->prev_sibling = n->prev_sibling;
+  else
+    last_child = n->prev_sibling;
+
+  n->parent = 0;
+  n->prev_sibling = 0;
+  n->next_sibling = 0;
 
-  child->parent.reset();
+  // `child' still holds a reference
+  intrusive_ptr_release(n);
+
+  note_mutation();
+  children_changed();
+  mark_dirty();
 
   if (!suppress_observers)
   {
     // TODO: Run "node is removed" as per HTML spec at this stage
   }
 
-  child->removed_from(shared_from_this());
-  child_removed(child);
+  if (n->signals)
+    n->signals->removed_from(shared_from_this());
+  if (signals)
+    signals->child_removed(child);
 }
 
 void
@@ -608,14 +875,12 @@ frenzy::dom::Node::verify_can_insert(frenzy::dom::Nodep node,
       bool nodehaselem = (ntype == ELEMENT_NODE);
       bool hasdoctype = false;
       bool nodehasdoctype = (ntype == DOCUMENT_TYPE_NODE);
-      for (children_t::const_iterator it = children.begin();
-	   it != children.end();
-	   ++it)
+      for (Node* child = first_child; child; child = child->next_sibling)
       {
-	if (*it == ignorechild)
+	if (child == ignorechild.get())
 	  continue;
 
-	nodeType childtype = (*it)->get_nodeType();
+	nodeType childtype = child->get_nodeType();
 	if (childtype == ELEMENT_NODE)
 	{
 	  assert(!haselem);
@@ -630,11 +895,9 @@ frenzy::dom::Node::verify_can_insert(frenzy::dom::Nodep node,
       
       if (ntype == DOCUMENT_FRAGMENT_NODE)
       {
-	for (children_t::const_iterator it = node->children.begin();
-	     it != node->children.end();
-	     ++it)
+	for (Node* child = node->first_child; child; child = child->next_sibling)
 	{
-	  nodeType fragchildt = (*it)->get_nodeType();
+	  nodeType fragchildt = child->get_nodeType();
 	  if (fragchildt == ELEMENT_NODE)
 	  {
 	    nodehaselem = true;
@@ -709,11 +972,9 @@ frenzy::dom::Node::verify_can_insert(frenzy::dom::Nodep node,
 	throw DOMException(DOMException::WRONG_DOCUMENT_ERR);
       }
 
-      for (children_t::const_iterator it = node->children.begin();
-	   it != node->children.end();
-	   ++it)
+      for (Node* child = node->first_child; child; child = child->next_sibling)
       {
-	if ((*it)->get_nodeType() != TEXT_NODE)
+	if (child->get_nodeType() != TEXT_NODE)
 	{
 	  throw DOMException(DOMException::HIERARCHY_REQUEST_ERR);
 	}
@@ -758,32 +1019,60 @@ frenzy::dom::always(frenzy::dom::Nodep)
 frenzy::dom::Nodep
 frenzy::dom::NodeList::item(size_t index) const
 {
-  size_t i = 0;
-
-  Nodep ret = get_first();
+  validate();
+  collect(index + 1);
 
-  while (i++ < index)
-  {
-    ret = get_next(ret);
-  }
+  if (index < items.size())
+    return items[index];
 
-  return ret;
+  return Nodep();
 }
 
 size_t
 frenzy::dom::NodeList::get_length() const
 {
-  size_t ret = 0;
+  validate();
+  collect(size_t(-1));
+
+  return items.size();
+}
+
+void
+frenzy::dom::NodeList::validate() const
+{
+  Documentp doc = root->node_document();
 
-  Nodep n = get_first();
+  // Nodes without a document can't tell when they change
+  if (doc && doc == cachedoc.lock() && doc->get_generation() == generation)
+    return;
+
+  items.clear();
+  complete = false;
+  cachedoc = doc;
+  generation = doc ? doc->get_generation() : 0;
+}
 
-  while (n)
+void
+frenzy::dom::NodeList::collect(size_t count) const
+{
+  if (lookup && !complete && items.empty())
   {
-    ++ret;
-    n = get_next(n);
+    Documentp doc = root->node_document();
+    if (doc && lookup(doc, root.get(), items))
+    {
+      complete = true;
+      return;
+    }
   }
 
-  return ret;
+  while (!complete && items.size() < count)
+  {
+    Nodep next = items.empty() ? get_first() : get_next(items.back());
+    if (next)
+      items.push_back(next);
+    else
+      complete = true;
+  }
 }
 
 frenzy::dom::NodeListp
@@ -804,10 +1093,77 @@ frenzy::dom::NodeList::create(frenzy::dom::Nodep root, frenzy::dom::node_travers
   return NodeListp(new NodeList(root, trav, filter));
 }
 
+namespace
+{
+  struct localnamematch
+  {
+    localnamematch(frenzy::ustring localname)
+      : localname(localname)
+    {}
+
+    bool operator()(frenzy::dom::Nodep n)
+    {
+      if (n->get_nodeType() != frenzy::dom::Node::ELEMENT_NODE)
+	return false;
+
+      return frenzy::dom_cast<frenzy::dom::Element>(n)->get_localName() == localname;
+    }
+
+  private:
+    frenzy::ustring localname;
+  };
+
+  struct classmatch
+  {
+    classmatch(const std::vector<frenzy::ustring>& classes)
+      : classes(classes)
+    {}
+
+    bool operator()(frenzy::dom::Nodep n)
+    {
+      if (n->get_nodeType() != frenzy::dom::Node::ELEMENT_NODE || classes.empty())
+	return false;
+
+      frenzy::dom::Elementp e = frenzy::dom_cast<frenzy::dom::Element>(n);
+      std::vector<frenzy::ustring> has = frenzy::dom::split_classes(*e->getAttribute("class"));
+      for (size_t i = 0; i < classes.size(); ++i)
+      {
+	if (std::find(has.begin(), has.end(), classes[i]) == has.end())
+	  return false;
+      }
+
+      return true;
+    }
+
+  private:
+    std::vector<frenzy::ustring> classes;
+  };
+}
+
+frenzy::dom::NodeListp
+frenzy::dom::NodeList::create(frenzy::dom::Nodep root, frenzy::ustring localname)
+{
+  NodeListp ret(new NodeList(root, TRAVERSE_TREE, localnamematch(localname)));
+  ret->lookup = boost::bind(&Document::elements_by_tag, _1, localname, _2, _3);
+  return ret;
+}
+
+frenzy::dom::NodeListp
+frenzy::dom::NodeList::create_by_class(frenzy::dom::Nodep root, frenzy::ustring classnames)
+{
+  std::vector<ustring> classes = split_classes(classnames);
+
+  NodeListp ret(new NodeList(root, TRAVERSE_TREE, classmatch(classes)));
+  ret->lookup = boost::bind(&Document::elements_by_class, _1, classes, _2, _3);
+  return ret;
+}
+
 frenzy::dom::NodeList::NodeList(frenzy::dom::Nodep root, frenzy::dom::node_traversal trav, frenzy::dom::node_filter filter)
   : root(root)
   , trav(trav)
   , filter(filter)
+  , complete(false)
+  , generation(0)
 {
 }
 
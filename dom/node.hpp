@@ -15,23 +15,23 @@
 #define FRENZY_NODE_HPP
 
 #include <vector>
-#include <list>
 #include <boost/optional.hpp>
-#include <boost/enable_shared_from_this.hpp>
 #include <boost/function.hpp>
+#include <boost/scoped_ptr.hpp>
 #include <boost/signals2/signal.hpp>
 
 #include "util/unicode.hpp"
 #include "util/vector.hpp"
 #include "event.hpp"
 #include "pointers.hpp"
+#include "weakref.hpp"
 #include "graphics.hpp"
 
 namespace frenzy
 {
   namespace dom
   {
-    struct Node : EventTarget, boost::enable_shared_from_this<Node>
+    struct Node : EventTarget
     {
       virtual ~Node() = 0;
 
@@ -114,13 +114,32 @@ namespace frenzy
 
       void recursive_set_ownerdocument(Documentp doc);
 
+      Nodep shared_from_this();
+      CNodep shared_from_this() const;
+
+      // The owner document, or the node itself if it is a Document
+      Documentp node_document() const;
+
+      // Called after a child is inserted or removed, or the data of a
+      // child changes
+      virtual void children_changed();
+
+      // Nodes are allocated with new (arena) from the arena of their
+      // document, see nodearena. A plain new or a null arena
+      // allocates from the heap.
+      static void* operator new(size_t size);
+      static void* operator new(size_t size, const nodearenap& arena);
+      static void operator delete(void* p);
+      static void operator delete(void* p, const nodearenap& arena);
+
       //
       // Graphics
       //
 
       // Mark this node and its children as dirty
       void recursive_mark_dirty();
-      // Mark this node and its parent all the way to the root as dirty
+      // Mark this node and its ancestors as dirty, stopping at the
+      // first one that is dirty already
       void mark_dirty();
       // Query dirtiness. layout() is supposed to recurse down to
       // children only if they are dirty.
@@ -131,6 +150,13 @@ namespace frenzy
       // Calls the above function and recurses to children.
       void recursive_drop_graphics();
 
+      // Calls layout() if this node is dirty or was last laid out
+      // with a different width, and marks the node clean
+      // afterwards. Otherwise returns the size from the previous
+      // layout without recursing, so that only the dirty parts of the
+      // tree are laid out again.
+      vec2 relayout(vec maxwidth);
+
       // Lays out the node's children and returns the size of this
       // node, in pixels. The width is restricted to the given
       // size. If the returned width exceeds the allotted maximum,
@@ -178,14 +204,13 @@ namespace frenzy
     private:
       typedef boost::signals2::signal<void(Nodep)> modified_signal;
 
-      // Called after this node is inserted as a child of another node.
-      modified_signal inserted_to;
-      // Called after this node is removed from its parent.
-      modified_signal removed_from;
-      // Called after a child is removed from `this'.
-      modified_signal child_removed;
-      // Called after a child is added to `this'.
-      modified_signal child_added;
+      // The signals, see node.cpp. Almost no node is ever observed,
+      // so they are allocated on the first connection and a node
+      // without them skips the emission.
+      struct observers;
+      boost::scoped_ptr<observers> signals;
+
+      observers& get_observers();
 
     public:
       typedef modified_signal::slot_type modified_slot;
@@ -204,21 +229,60 @@ namespace frenzy
       // the base class's copyTo() as well.
       virtual void copyTo(dom::Nodep n, bool deep) const;
 
-      typedef std::list<Nodep> children_t;
-      children_t children;
-      Nodewp parent;
+      // The arena of the owner document, for cloneNode()
+      nodearenap owner_arena() const;
+
+      // Bumps the mutation generation of the node document, see
+      // Document::get_generation()
+      void note_mutation();
+
+      // Clears the dirty flag of this node only. Used after the node
+      // has been laid out.
+      void mark_clean();
+
+      // The children are linked through their sibling pointers, and
+      // the parent holds a reference to each of them. The links are
+      // cleared by the parent when a child is removed or the parent
+      // dies.
+      Node* first_child;
+      Node* last_child;
+      Node* parent;
 
       boost::shared_ptr<graphics::translation> position;
 
     private:
       Documentwp ownerdocument;
-      Nodewp prev_sibling;
-      Nodewp next_sibling;
+      Node* prev_sibling;
+      Node* next_sibling;
       bool dirty;
 
+      // Whether the node is in the tree of its document, its tree
+      // order label and the last label in its subtree. The labels are
+      // kept by Document, see Document::refresh_tree_order()
+      bool connected;
+      boost::uint64_t tree_index;
+      boost::uint64_t tree_end;
+
+      friend struct Document;
+
+      mutable size_t refcount;
+      mutable weakcontrol* weak;
+
+      friend void intrusive_ptr_add_ref(const Node* node);
+      friend void intrusive_ptr_release(const Node* node);
+      friend weakcontrol* acquire_weakcontrol(const Node* node);
+
+      // Result of the last layout() through relayout()
+      vec layoutwidth;
+      vec2 layoutsize;
+
       Nodep insertBefore(Nodep node, Nodep child, bool suppress_observers);
       void removeChild(Nodep child, bool suppress_observers);
 
+      // The document whose tree holds both `this' and `other', with
+      // its tree order labels current, or null if there is none
+      Documentp labeled_document(const Node* other) const;
+
       // Verifies valid parent-child relationship, throws appropriate
       // DOMException when necessary. ignorechild, if not null, will
       // be ignored from the child list of `this'. The purpose of that
@@ -226,6 +290,17 @@ namespace frenzy
       void verify_can_insert(Nodep node, Nodep before, Nodep ignorechild = Nodep());
     };
 
+    inline void intrusive_ptr_add_ref(const Node* node)
+    {
+      ++node->refcount;
+    }
+
+    inline void intrusive_ptr_release(const Node* node)
+    {
+      if (--node->refcount == 0)
+	delete node;
+    }
+
     enum node_traversal
     {
       TRAVERSE_CHILDREN,
@@ -233,6 +308,10 @@ namespace frenzy
     };
 
     typedef boost::function<bool(Nodep)> node_filter;
+    // Fills the vector with the matching nodes in the subtree of the
+    // root, in tree order, from the indexes of the document. Returns
+    // false if the indexes can't answer for the root.
+    typedef boost::function<bool(Documentp, Node*, std::vector<Nodep>&)> node_lookup;
     node_filter type_filter(Node::nodeType type);
     bool always(frenzy::dom::Nodep);
 
@@ -247,6 +326,14 @@ namespace frenzy
       static NodeListp create(Nodep root, node_traversal trav, Node::nodeType type);
       // Create a list that matches all nodes that match the filter
       static NodeListp create(Nodep root, node_traversal trav, node_filter filter);
+      // Create a list of the elements in the subtree with the given
+      // local name. Served from the tag index of the document while
+      // the root is in the document tree.
+      static NodeListp create(Nodep root, ustring localname);
+      // Create a list of the elements in the subtree that have all of
+      // the whitespace separated classes, served from the class index
+      // the same way
+      static NodeListp create_by_class(Nodep root, ustring classnames);
 
     private:
       NodeList(Nodep root, node_traversal trav, node_filter filter);
@@ -255,9 +342,25 @@ namespace frenzy
       Nodep get_next(Nodep n) const;
       Nodep get_next_nofilter(Nodep n) const;
 
+      // Drops the cached items if the tree has changed since they
+      // were collected
+      void validate() const;
+      // Collects items until there are `count' of them or the list
+      // ends
+      void collect(size_t count) const;
+
       Nodep root;
       node_traversal trav;
       node_filter filter;
+      node_lookup lookup;
+
+      // The items found so far. They stay valid while the mutation
+      // generation of the document of `root' stays the same, so
+      // iterating in order takes amortized constant time per item.
+      mutable std::vector<Nodep> items;
+      mutable bool complete;
+      mutable Documentwp cachedoc;
+      mutable size_t generation;
     };
   }
 }
@@ -16,6 +16,7 @@
 
 #include <boost/shared_ptr.hpp>
 #include <boost/weak_ptr.hpp>
+#include <boost/intrusive_ptr.hpp>
 
 #define FRENZY_DECLARE_TYPE(x) \
   typedef boost::shared_ptr<struct x> x ## p; \
@@ -23,10 +24,27 @@
   typedef boost::shared_ptr<const struct x> C ## x ## p; \
   typedef boost::weak_ptr<const struct x> C ## x ## wp
 
+// Nodes are reference counted intrusively, see weakref.hpp
+#define FRENZY_DECLARE_NODE_TYPE(x) \
+  typedef boost::intrusive_ptr<struct x> x ## p; \
+  typedef weakref<struct x> x ## wp; \
+  typedef boost::intrusive_ptr<const struct x> C ## x ## p; \
+  typedef weakref<const struct x> C ## x ## wp
+
 namespace frenzy
 {
   namespace dom
   {
+    template <typename T>
+    struct weakref;
+
+    struct Node;
+    inline void intrusive_ptr_add_ref(const Node* node);
+    inline void intrusive_ptr_release(const Node* node);
+
+    // arena.hpp
+    FRENZY_DECLARE_TYPE(nodearena);
+
     // event.hpp
     FRENZY_DECLARE_TYPE(Event);
     FRENZY_DECLARE_TYPE(CustomEvent);
@@ -34,102 +52,102 @@ namespace frenzy
     FRENZY_DECLARE_TYPE(EventListener);
 
     // node.hpp
-    FRENZY_DECLARE_TYPE(Node);
+    FRENZY_DECLARE_NODE_TYPE(Node);
     FRENZY_DECLARE_TYPE(NodeList);
 
     // element.hpp
-    FRENZY_DECLARE_TYPE(Element);
+    FRENZY_DECLARE_NODE_TYPE(Element);
     FRENZY_DECLARE_TYPE(HTMLCollection);
     FRENZY_DECLARE_TYPE(NamedNodeMap);
-    FRENZY_DECLARE_TYPE(Attr);
+    FRENZY_DECLARE_NODE_TYPE(Attr);
 
     // document.hpp
-    FRENZY_DECLARE_TYPE(Document);
-    FRENZY_DECLARE_TYPE(XMLDocument);
-    FRENZY_DECLARE_TYPE(DocumentFragment);
-    FRENZY_DECLARE_TYPE(DocumentType);
+    FRENZY_DECLARE_NODE_TYPE(Document);
+    FRENZY_DECLARE_NODE_TYPE(XMLDocument);
+    FRENZY_DECLARE_NODE_TYPE(DocumentFragment);
+    FRENZY_DECLARE_NODE_TYPE(DocumentType);
     FRENZY_DECLARE_TYPE(DOMImplementation);
-    FRENZY_DECLARE_TYPE(EntityReference);
+    FRENZY_DECLARE_NODE_TYPE(EntityReference);
 
     // text.hpp
-    FRENZY_DECLARE_TYPE(CharacterData);
-    FRENZY_DECLARE_TYPE(Text);
-    FRENZY_DECLARE_TYPE(Comment);
-    FRENZY_DECLARE_TYPE(CDATASection);
+    FRENZY_DECLARE_NODE_TYPE(CharacterData);
+    FRENZY_DECLARE_NODE_TYPE(Text);
+    FRENZY_DECLARE_NODE_TYPE(Comment);
+    FRENZY_DECLARE_NODE_TYPE(CDATASection);
 
     // htmlelement.hpp
-    FRENZY_DECLARE_TYPE(HTMLElement);
-    FRENZY_DECLARE_TYPE(HTMLUnknownElement);
-    FRENZY_DECLARE_TYPE(HTMLHtmlElement);
-    FRENZY_DECLARE_TYPE(HTMLHeadElement);
-    FRENZY_DECLARE_TYPE(HTMLTitleElement);
-    FRENZY_DECLARE_TYPE(HTMLBaseElement);
-    FRENZY_DECLARE_TYPE(HTMLLinkElement);
-    FRENZY_DECLARE_TYPE(HTMLMetaElement);
-    FRENZY_DECLARE_TYPE(HTMLStyleElement);
-    FRENZY_DECLARE_TYPE(HTMLScriptElement);
-    FRENZY_DECLARE_TYPE(HTMLBodyElement);
-    FRENZY_DECLARE_TYPE(HTMLAnchorElement);
-    FRENZY_DECLARE_TYPE(HTMLAreaElement);
-    FRENZY_DECLARE_TYPE(HTMLAudioElement);
-    FRENZY_DECLARE_TYPE(HTMLBRElement);
-    FRENZY_DECLARE_TYPE(HTMLButtonElement);
-    FRENZY_DECLARE_TYPE(HTMLCanvasElement);
-    FRENZY_DECLARE_TYPE(HTMLCommandElement);
-    FRENZY_DECLARE_TYPE(HTMLDListElement);
-    FRENZY_DECLARE_TYPE(HTMLDataElement);
-    FRENZY_DECLARE_TYPE(HTMLDataListElement);
-    FRENZY_DECLARE_TYPE(HTMLDetailsElement);
-    FRENZY_DECLARE_TYPE(HTMLDialogElement);
-    FRENZY_DECLARE_TYPE(HTMLDivElement);
-    FRENZY_DECLARE_TYPE(HTMLEmbedElement);
-    FRENZY_DECLARE_TYPE(HTMLFieldSetElement);
-    FRENZY_DECLARE_TYPE(HTMLFormElement);
-    FRENZY_DECLARE_TYPE(HTMLHRElement);
-    FRENZY_DECLARE_TYPE(HTMLHeadElement);
-    FRENZY_DECLARE_TYPE(HTMLHeadingElement);
-    FRENZY_DECLARE_TYPE(HTMLHtmlElement);
-    FRENZY_DECLARE_TYPE(HTMLIFrameElement);
-    FRENZY_DECLARE_TYPE(HTMLImageElement);
-    FRENZY_DECLARE_TYPE(HTMLInputElement);
-    FRENZY_DECLARE_TYPE(HTMLKeygenElement);
-    FRENZY_DECLARE_TYPE(HTMLLIElement);
-    FRENZY_DECLARE_TYPE(HTMLLabelElement);
-    FRENZY_DECLARE_TYPE(HTMLLegendElement);
-    FRENZY_DECLARE_TYPE(HTMLLinkElement);
-    FRENZY_DECLARE_TYPE(HTMLMapElement);
-    FRENZY_DECLARE_TYPE(HTMLMenuElement);
-    FRENZY_DECLARE_TYPE(HTMLMetaElement);
-    FRENZY_DECLARE_TYPE(HTMLMeterElement);
-    FRENZY_DECLARE_TYPE(HTMLModElement);
-    FRENZY_DECLARE_TYPE(HTMLOListElement);
-    FRENZY_DECLARE_TYPE(HTMLObjectElement);
-    FRENZY_DECLARE_TYPE(HTMLOptGroupElement);
-    FRENZY_DECLARE_TYPE(HTMLOptionElement);
-    FRENZY_DECLARE_TYPE(HTMLOutputElement);
-    FRENZY_DECLARE_TYPE(HTMLParagraphElement);
-    FRENZY_DECLARE_TYPE(HTMLParamElement);
-    FRENZY_DECLARE_TYPE(HTMLPreElement);
-    FRENZY_DECLARE_TYPE(HTMLProgressElement);
-    FRENZY_DECLARE_TYPE(HTMLQuoteElement);
-    FRENZY_DECLARE_TYPE(HTMLScriptElement);
-    FRENZY_DECLARE_TYPE(HTMLSelectElement);
-    FRENZY_DECLARE_TYPE(HTMLSourceElement);
-    FRENZY_DECLARE_TYPE(HTMLSpanElement);
-    FRENZY_DECLARE_TYPE(HTMLStyleElement);
-    FRENZY_DECLARE_TYPE(HTMLTableCaptionElement);
-    FRENZY_DECLARE_TYPE(HTMLTableColElement);
-    FRENZY_DECLARE_TYPE(HTMLTableDataCellElement);
-    FRENZY_DECLARE_TYPE(HTMLTableElement);
-    FRENZY_DECLARE_TYPE(HTMLTableHeaderCellElement);
-    FRENZY_DECLARE_TYPE(HTMLTableRowElement);
-    FRENZY_DECLARE_TYPE(HTMLTableSectionElement);
-    FRENZY_DECLARE_TYPE(HTMLTextAreaElement);
-    FRENZY_DECLARE_TYPE(HTMLTimeElement);
-    FRENZY_DECLARE_TYPE(HTMLTitleElement);
-    FRENZY_DECLARE_TYPE(HTMLTrackElement);
-    FRENZY_DECLARE_TYPE(HTMLUListElement);
-    FRENZY_DECLARE_TYPE(HTMLVideoElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLUnknownElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLHtmlElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLHeadElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLTitleElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLBaseElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLLinkElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLMetaElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLStyleElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLScriptElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLBodyElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLAnchorElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLAreaElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLAudioElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLBRElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLButtonElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLCanvasElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLCommandElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLDListElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLDataElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLDataListElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLDetailsElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLDialogElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLDivElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLEmbedElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLFieldSetElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLFormElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLHRElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLHeadElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLHeadingElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLHtmlElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLIFrameElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLImageElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLInputElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLKeygenElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLLIElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLLabelElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLLegendElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLLinkElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLMapElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLMenuElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLMetaElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLMeterElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLModElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLOListElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLObjectElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLOptGroupElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLOptionElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLOutputElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLParagraphElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLParamElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLPreElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLProgressElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLQuoteElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLScriptElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLSelectElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLSourceElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLSpanElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLStyleElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLTableCaptionElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLTableColElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLTableDataCellElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLTableElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLTableHeaderCellElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLTableRowElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLTableSectionElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLTextAreaElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLTimeElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLTitleElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLTrackElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLUListElement);
+    FRENZY_DECLARE_NODE_TYPE(HTMLVideoElement);
   }
 
   template <typename T, typename U>
@@ -137,8 +155,15 @@ namespace frenzy
   {
     return boost::dynamic_pointer_cast<T>(p);
   }
+
+  template <typename T, typename U>
+  boost::intrusive_ptr<T> dom_cast(boost::intrusive_ptr<U> p)
+  {
+    return boost::dynamic_pointer_cast<T>(p);
+  }
 }
 
 #undef FRENZY_DECLARE_TYPE
+#undef FRENZY_DECLARE_NODE_TYPE
 
 #endif
@@ -12,6 +12,7 @@
  */
 
 #include "text.hpp"
+#include "arena.hpp"
 #include "document.hpp"
 #include "exception.hpp"
 #include "graphics.hpp"
@@ -29,11 +30,10 @@ frenzy::dom::CharacterData::get_nodeValue() const
 void
 frenzy::dom::CharacterData::set_nodeValue(frenzy::ustring str)
 {
-  // TODO: Mutation records
-  datastr = str;
+  set_data(str);
 }
 
-frenzy::ustring
+const frenzy::ustring&
 frenzy::dom::CharacterData::get_data() const
 {
   return datastr;
@@ -43,6 +43,7 @@ void
 frenzy::dom::CharacterData::set_data(frenzy::ustring data)
 {
   datastr = data;
+  data_changed();
 }
 
 size_t
@@ -63,6 +64,7 @@ void
 frenzy::dom::CharacterData::appendData(frenzy::ustring data)
 {
   datastr.append(data);
+  data_changed();
 }
 
 void
@@ -75,6 +77,7 @@ frenzy::dom::CharacterData::insertData(int offset, frenzy::ustring data)
   newdata.append(datastr.substr(offset, datastr.size() - offset));
 
   datastr = newdata;
+  data_changed();
 }
 
 void
@@ -97,6 +100,16 @@ frenzy::dom::CharacterData::replaceData(int offset, int count, frenzy::ustring d
   newdata.append(datastr.substr(offset + count, datastr.size() - offset - count));
 
   datastr = newdata;
+  data_changed();
+}
+
+void
+frenzy::dom::CharacterData::data_changed()
+{
+  mark_dirty();
+
+  if (Nodep p = get_parentNode())
+    p->children_changed();
 }
 
 frenzy::dom::CharacterData::CharacterData(frenzy::ustring data)
@@ -126,7 +139,7 @@ frenzy::dom::Text::get_nodeName() const
 frenzy::dom::Nodep
 frenzy::dom::Text::cloneNode(bool deep) const
 {
-  Textp ret = Text::create(get_data());
+  Textp ret = Text::create(get_data(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
@@ -147,9 +160,9 @@ frenzy::dom::Text::splitText(int offset)
 }
 
 frenzy::dom::Textp
-frenzy::dom::Text::create(frenzy::ustring data)
+frenzy::dom::Text::create(frenzy::ustring data, frenzy::dom::nodearenap arena)
 {
-  return Textp(new Text(data));
+  return Textp(new (arena) Text(data));
 }
 
 void
@@ -202,15 +215,15 @@ frenzy::dom::Comment::get_nodeName() const
 frenzy::dom::Nodep
 frenzy::dom::Comment::cloneNode(bool deep) const
 {
-  Commentp ret = Comment::create(get_data());
+  Commentp ret = Comment::create(get_data(), owner_arena());
   copyTo(ret, deep);
   return ret;
 }
 
 frenzy::dom::Commentp
-frenzy::dom::Comment::create(frenzy::ustring data)
+frenzy::dom::Comment::create(frenzy::ustring data, frenzy::dom::nodearenap arena)
 {
-  return Commentp(new Comment(data));
+  return Commentp(new (arena) Comment(data));
 }
 
 frenzy::dom::Comment::Comment(frenzy::ustring data)
@@ -30,7 +30,7 @@ namespace frenzy
       virtual boost::optional<ustring> get_nodeValue() const;
       virtual void set_nodeValue(ustring str);
 
-      ustring get_data() const;
+      const ustring& get_data() const;
       void set_data(ustring data);
       size_t get_length() const;
       ustring substringData(int offset, int count);
@@ -53,6 +53,10 @@ namespace frenzy
       // size. Note! offset + count is allowed to be larger than data
       // size.
       void verify_values(int offset, int count);
+
+      // Marks this node and its ancestors dirty after the data has
+      // changed, and tells the parent that its children changed.
+      void data_changed();
     };
 
     struct Text : CharacterData
@@ -63,7 +67,7 @@ namespace frenzy
 
       Textp splitText(int offset);
 
-      static Textp create(ustring data);
+      static Textp create(ustring data, nodearenap arena = nodearenap());
 
       //
       // Graphics
@@ -86,7 +90,7 @@ namespace frenzy
       virtual ustring get_nodeName() const;
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static Commentp create(ustring data);
+      static Commentp create(ustring data, nodearenap arena = nodearenap());
     private:
 
       Comment(ustring data);
@@ -98,7 +102,7 @@ namespace frenzy
       virtual ustring get_nodeName() const;
       virtual Nodep cloneNode(bool deep = true) const;
 
-      static CDATASectionp create(ustring data);
+      static CDATASectionp create(ustring data, nodearenap arena = nodearenap());
     private:
       CDATASection(ustring data);
     };
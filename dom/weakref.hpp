@@ -0,0 +1,117 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+#ifndef FRENZY_WEAKREF_HPP
+#define FRENZY_WEAKREF_HPP
+
+#include <algorithm>
+#include <boost/intrusive_ptr.hpp>
+
+#include "pointers.hpp"
+
+namespace frenzy
+{
+  namespace dom
+  {
+    /*
+     * Nodes carry their own reference count, which boost::intrusive_ptr
+     * (the Nodep family of types) maintains. The count is not atomic:
+     * a document and its nodes must be used from one thread at a time,
+     * and handed over between threads only with synchronization.
+     *
+     * Weak references to a node go through a control block that the
+     * node allocates the first time one is taken. The node clears the
+     * target when it dies, and the block lives until the last weak
+     * reference to it is gone.
+     */
+    struct weakcontrol
+    {
+      size_t refs;
+      Node* target;
+    };
+
+    weakcontrol* acquire_weakcontrol(const Node* node);
+    void release_weakcontrol(weakcontrol* control);
+
+    template <typename T>
+    struct weakref
+    {
+      weakref()
+	: control(0)
+      {
+      }
+
+      template <typename U>
+      weakref(const boost::intrusive_ptr<U>& p)
+	: control(0)
+      {
+	T* check = p.get();
+	if (check)
+	  control = acquire_weakcontrol(check);
+      }
+
+      weakref(const weakref& other)
+	: control(other.control)
+      {
+	if (control)
+	  ++control->refs;
+      }
+
+      template <typename U>
+      weakref(const weakref<U>& other)
+	: control(0)
+      {
+	boost::intrusive_ptr<T> p = other.lock();
+	if (p)
+	  control = acquire_weakcontrol(p.get());
+      }
+
+      ~weakref()
+      {
+	if (control)
+	  release_weakcontrol(control);
+      }
+
+      weakref& operator=(const weakref& other)
+      {
+	weakref tmp(other);
+	std::swap(control, tmp.control);
+	return *this;
+      }
+
+      boost::intrusive_ptr<T> lock() const
+      {
+	if (!control || !control->target)
+	  return boost::intrusive_ptr<T>();
+
+	return boost::intrusive_ptr<T>(static_cast<T*>(control->target));
+      }
+
+      bool expired() const
+      {
+	return !control || !control->target;
+      }
+
+      void reset()
+      {
+	weakref tmp;
+	std::swap(control, tmp.control);
+      }
+
+    private:
+      weakcontrol* control;
+    };
+  }
+}
+
+#endif
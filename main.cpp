@@ -16,7 +16,9 @@
 #include "WRATHLayerItemWidgetsTranslate.hpp"
 
 #include <iostream>
-#include <fstream>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
 
 #include <SDL.h>
 #include <boost/shared_ptr.hpp>
@@ -25,6 +27,7 @@
 #include "dom/graphics.hpp"
 #include "dom/document.hpp"
 #include "parser/htmlparser.hpp"
+#include "parser/fdinput.hpp"
 
 WRATHTripleBufferEnabler::handle tr;
 WRATHLayer* contents;
@@ -147,32 +150,17 @@ int main(int argc, char** argv)
   if (argc < 2)
   {
     std::cerr << "Usage: " << argv[0] << " filename\n";
+    std::cerr << "Use - as the filename to read standard input\n";
     return 1;
   }
 
-  std::ifstream input(argv[1]);
-  if (!input || !input.is_open())
+  int fd = std::strcmp(argv[1], "-") == 0 ? STDIN_FILENO : open(argv[1], O_RDONLY);
+  if (fd < 0)
   {
     std::cerr << "Failure opening " << argv[1] << "\n";
     return 1;
   }
 
-  std::cout << "Loading " << argv[1] << "...\n";
-  Documentp doc = Document::create();
-
-  htmlparser parser(doc);
-
-  bytestring inputstring((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
-
-  parser.pass_bytes(inputstring);
-  parser.pass_bytes(bytestring());
-
-  if (!parser.stopped())
-  {
-    std::cerr << "HTML parser jammed\n";
-    return 1;
-  }
-
   SDL_Init(SDL_INIT_VIDEO | SDL_INIT_TIMER);
 
   SDL_GL_SetAttribute(SDL_GL_DOUBLEBUFFER, 1);
@@ -203,11 +191,38 @@ int main(int argc, char** argv)
 
   boost::shared_ptr<factory> fact(new wrath_factory());
 
+  std::cout << "Loading " << argv[1] << "...\n";
+  Documentp doc = Document::create();
   doc->graphicsfactory(fact);
 
+  htmlparser parser(doc);
+
+  // The input is passed to the parser as it arrives, at most a chunk
+  // per frame, and the content parsed so far is laid out and drawn
+  // in between.
+  fdinput input(16384);
+  input.add(fd, parser);
+  bool loading = true;
+
   bool done = false;
   while (!done)
   {
+    if (loading)
+    {
+      if (input.poll(0) == 0)
+      {
+	loading = false;
+
+	if (!parser.stopped())
+	{
+	  std::cerr << "HTML parser jammed\n";
+	  return 1;
+	}
+      }
+
+      doc->layout_document();
+    }
+
     SDL_Event event;
     while (SDL_PollEvent(&event))
     {
@@ -4,7 +4,7 @@ dirstack_$(sp)	:= $(d)
 d		:= $(dir)
 # End standard header
 
-SOURCES += $(call filelist,chardecoder.cpp htmlentitysearcher.cpp htmltokenizer.cpp input_preprocessor.cpp token.cpp treeconstructor.cpp htmlparser.cpp)
+SOURCES += $(call filelist,chardecoder.cpp htmlentitysearcher.cpp htmltokenizer.cpp input_preprocessor.cpp token.cpp treeconstructor.cpp htmlparser.cpp preloadscanner.cpp tokenstream.cpp treesink.cpp parsemany.cpp speculativetokenizer.cpp tokenpipeline.cpp fdinput.cpp pullparser.cpp rewriter.cpp selector.cpp incrementalparser.cpp serializer.cpp markup.cpp)
 
 GENERATOR_SOURCES := $(call filelist,htmlentitydb_generator.cpp)
 GENERATOR_OBJECTS = $(addprefix $(BUILDDIR)/,$(GENERATOR_SOURCES:.cpp=.o))
@@ -20,6 +20,12 @@ frenzy::parser::charset_decoder::~charset_decoder()
 {
 }
 
+void
+frenzy::parser::charset_decoder::reset()
+{
+  completed_items.clear();
+}
+
 frenzy::urope
 frenzy::parser::charset_decoder::complete_characters()
 {
@@ -71,10 +77,32 @@ frenzy::parser::utf8_decoder::pass_bytes(const bytestring& input)
     result_buffer.clear();
   }
 
+  // An empty result means end-of-file to the next stage, so nothing
+  // is passed for input that only starts a multibyte sequence.
+  if (result_buffer.empty() && !input.empty())
+    return;
+
   completed(result_buffer);
   result_buffer.clear();
 }
 
+void
+frenzy::parser::utf8_decoder::reset()
+{
+  charset_decoder::reset();
+  result_buffer.clear();
+  state = UTF8_BEGIN;
+}
+
+size_t
+frenzy::parser::utf8_decoder::pending_bytes() const
+{
+  if (state != UTF8_CONTINUATION)
+    return 0;
+
+  return multibytesize - bytes_left;
+}
+
 void
 frenzy::parser::utf8_decoder::process_one(byte b)
 {
@@ -22,12 +22,14 @@
 namespace frenzy
 {
   /*
-   * Parser stages are constructed once _per_bytestream_. A
-   * constructed parser stage contains parser state that needs to be
-   * refreshed.
+   * Parser stages hold the parser state of one bytestream at a
+   * time. A stage is either constructed per bytestream, or reset()
+   * between bytestreams. Resetting clears the parser state but keeps
+   * the attached destination and the allocated buffers, so that
+   * parsing many documents doesn't construct the stages again.
    *
-   * Note that Javascript document.open() also requires new parser
-   * stage objects.
+   * Note that Javascript document.open() also requires fresh parser
+   * stages.
    *
    * Parser stage interface: pass_*() takes a sequence of input
    * datums. Any completed results are stored and can be fetched with
@@ -68,6 +70,9 @@ namespace frenzy
     {
       virtual ~charset_decoder() = 0;
 
+      // Clears the decoder state for a new bytestream
+      virtual void reset();
+
       virtual void pass_bytes(const bytestring& input) = 0;
 
       urope complete_characters();
@@ -93,6 +98,11 @@ namespace frenzy
       utf8_decoder();
 
       void pass_bytes(const bytestring& input);
+      virtual void reset();
+
+      // Returns the number of bytes of an incomplete sequence at the
+      // end of the input passed so far
+      size_t pending_bytes() const;
 
     private:
       void process_one(byte b);
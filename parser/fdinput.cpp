@@ -0,0 +1,203 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <sys/epoll.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <boost/bind.hpp>
+
+#include "fdinput.hpp"
+#include "htmlparser.hpp"
+
+namespace
+{
+  void throw_errno(const std::string& what)
+  {
+    throw std::runtime_error(what + ": " + std::strerror(errno));
+  }
+
+  const int maxevents = 64;
+}
+
+frenzy::fdinput::fdinput(size_t chunksize)
+  : epollfd(epoll_create1(EPOLL_CLOEXEC))
+  , buffer(std::max(chunksize, size_t(1)))
+{
+  if (epollfd < 0)
+    throw_errno("epoll_create1");
+}
+
+frenzy::fdinput::~fdinput()
+{
+  while (!sources.empty())
+    remove(sources.begin());
+
+  close(epollfd);
+}
+
+void
+frenzy::fdinput::add(int fd, frenzy::fdinput::destination_t dest)
+{
+  int flags = fcntl(fd, F_GETFL);
+  if (flags < 0 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0)
+    throw_errno("fcntl");
+
+  source s;
+  s.dest = dest;
+  s.polled = true;
+  s.paused = false;
+  s.flags = flags;
+
+  epoll_event ev;
+  ev.events = EPOLLIN;
+  ev.data.fd = fd;
+  if (epoll_ctl(epollfd, EPOLL_CTL_ADD, fd, &ev) < 0)
+  {
+    if (errno != EPERM)
+      throw_errno("epoll_ctl");
+
+    s.polled = false;
+  }
+
+  sources[fd] = s;
+}
+
+void
+frenzy::fdinput::add(int fd, frenzy::htmlparser& parser)
+{
+  add(fd, boost::bind(&htmlparser::pass_bytes, &parser, _1));
+}
+
+void
+frenzy::fdinput::pause(int fd)
+{
+  sources_t::iterator it = sources.find(fd);
+  if (it == sources.end() || it->second.paused)
+    return;
+
+  it->second.paused = true;
+  if (it->second.polled)
+    set_polling(fd, false);
+}
+
+void
+frenzy::fdinput::resume(int fd)
+{
+  sources_t::iterator it = sources.find(fd);
+  if (it == sources.end() || !it->second.paused)
+    return;
+
+  it->second.paused = false;
+  if (it->second.polled)
+    set_polling(fd, true);
+}
+
+size_t
+frenzy::fdinput::poll(int timeout)
+{
+  std::vector<int> ready;
+
+  for (sources_t::const_iterator it = sources.begin(); it != sources.end(); ++it)
+  {
+    if (!it->second.polled && !it->second.paused)
+      ready.push_back(it->first);
+  }
+
+  // Don't wait if there's a regular file to read
+  epoll_event events[maxevents];
+  int count = epoll_wait(epollfd, events, maxevents, ready.empty() ? timeout : 0);
+  if (count < 0)
+  {
+    if (errno != EINTR)
+      throw_errno("epoll_wait");
+    count = 0;
+  }
+
+  for (int i = 0; i < count; ++i)
+  {
+    ready.push_back(events[i].data.fd);
+  }
+
+  for (std::vector<int>::const_iterator it = ready.begin(); it != ready.end(); ++it)
+  {
+    // An earlier destination may have paused the source
+    sources_t::const_iterator s = sources.find(*it);
+    if (s != sources.end() && !s->second.paused)
+      read_source(*it);
+  }
+
+  return sources.size();
+}
+
+void
+frenzy::fdinput::run()
+{
+  while (poll(-1) > 0)
+  {
+    // Nothing
+  }
+}
+
+void
+frenzy::fdinput::read_source(int fd)
+{
+  ssize_t got = read(fd, &buffer[0], buffer.size());
+
+  if (got < 0)
+  {
+    if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+      return;
+
+    throw_errno("read");
+  }
+
+  sources_t::iterator it = sources.find(fd);
+  destination_t dest = it->second.dest;
+
+  if (got == 0)
+  {
+    // End-of-file. The source is removed first in case the
+    // destination throws.
+    remove(it);
+
+    dest(bytestring());
+    return;
+  }
+
+  dest(bytestring(buffer.begin(), buffer.begin() + got));
+}
+
+void
+frenzy::fdinput::set_polling(int fd, bool enabled)
+{
+  epoll_event ev;
+  ev.events = EPOLLIN;
+  ev.data.fd = fd;
+  if (epoll_ctl(epollfd, enabled ? EPOLL_CTL_ADD : EPOLL_CTL_DEL, fd, &ev) < 0)
+    throw_errno("epoll_ctl");
+}
+
+void
+frenzy::fdinput::remove(frenzy::fdinput::sources_t::iterator it)
+{
+  if (it->second.polled && !it->second.paused)
+    epoll_ctl(epollfd, EPOLL_CTL_DEL, it->first, NULL);
+
+  fcntl(it->first, F_SETFL, it->second.flags);
+  sources.erase(it);
+}
@@ -0,0 +1,100 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+
+#ifndef FRENZY_FDINPUT_HPP
+#define FRENZY_FDINPUT_HPP
+
+#include <map>
+#include <vector>
+#include <boost/function.hpp>
+#include <boost/noncopyable.hpp>
+
+#include "chardecoder.hpp"
+
+namespace frenzy
+{
+  struct htmlparser;
+
+  /*
+   * Reads input from file descriptors, like pipes and sockets, and
+   * passes it on as it arrives. The descriptors are read without
+   * blocking, and waited on with epoll. Regular files can't be
+   * waited on, and are always considered ready.
+   *
+   * Every poll() reads at most one chunk from each ready source, so
+   * the work per call stays bounded however fast the input
+   * arrives. Unread input stays in the pipe or socket buffer, which
+   * makes the writer wait when the parser falls behind. A source
+   * can also be paused explicitly.
+   *
+   * The destination of a source receives the bytes as with the
+   * parser stage interface: an empty bytestring passes end-of-file.
+   * Read errors throw std::runtime_error. The file descriptors are
+   * not closed by fdinput.
+   *
+   * The file descriptors are made non-blocking while they are read,
+   * which also affects other users of them, like a shared standard
+   * input. The original flags are restored at end-of-file or when
+   * the fdinput is destroyed.
+   */
+  struct fdinput : private boost::noncopyable
+  {
+    explicit fdinput(size_t chunksize = 16384);
+    ~fdinput();
+
+    typedef boost::function<void (const bytestring&)> destination_t;
+
+    // Adds a source. The file descriptor is made non-blocking until
+    // end-of-file.
+    void add(int fd, destination_t dest);
+    // Feeds the parser with pass_bytes() and pass_eof()
+    void add(int fd, htmlparser& parser);
+
+    // A paused source is not read until resumed
+    void pause(int fd);
+    void resume(int fd);
+
+    // Waits up to timeout milliseconds, or indefinitely if timeout is
+    // -1, for input and passes it on. Returns the number of sources
+    // that haven't reached end-of-file.
+    size_t poll(int timeout);
+    // Polls until all sources have reached end-of-file
+    void run();
+
+  private:
+    struct source
+    {
+      destination_t dest;
+      // False for regular files, which epoll doesn't support
+      bool polled;
+      bool paused;
+      // The file status flags before adding
+      int flags;
+    };
+
+    typedef std::map<int, source> sources_t;
+
+    sources_t sources;
+    int epollfd;
+    std::vector<byte> buffer;
+
+    void read_source(int fd);
+    // Paused sources are removed from the epoll set, as epoll reports
+    // hang-ups and errors even with no events requested
+    void set_polling(int fd, bool enabled);
+    void remove(sources_t::iterator it);
+  };
+}
+
+#endif
@@ -11,32 +11,227 @@
  * 
  */
 
+#include <stdexcept>
 #include <boost/bind.hpp>
 
 #include "htmlparser.hpp"
+#include "selector.hpp"
+#include "markup.hpp"
+#include "dom/document.hpp"
+#include "dom/element.hpp"
 
-frenzy::htmlparser::htmlparser(frenzy::dom::Documentp doc)
-  : tree(doc)
+namespace
 {
-  dec.attach_destination(boost::bind(&parser::input_preprocessor::pass_characters, &proc, _1));
-  proc.attach_destination(boost::bind(&parser::htmltokenizer::pass_characters, &tok, _1));
-  tree.couple_tokenizer(&tok);
+  bool selector_matches(const frenzy::simpleselector& selector, frenzy::dom::Elementp elem)
+  {
+    return selector.matches(elem);
+  }
+
+  // The tokenizer's end-of-file marker
+  const frenzy::uchar eof = 0xFFFFFFFF;
+}
+
+frenzy::htmlparser::htmlparser(frenzy::dom::Documentp doc,
+			       const frenzy::parser::treeoptions& options)
+  : tree(doc, options)
+  , bytes_passed(0)
+{
+  connect_stages();
+}
+
+frenzy::htmlparser::htmlparser(frenzy::dom::Elementp context,
+			       frenzy::dom::DocumentFragmentp fragment,
+			       const frenzy::parser::treeoptions& options)
+  : tree(fragment, parser::fragmentcontext(context), options)
+  , bytes_passed(0)
+{
+  connect_stages();
+}
+
+frenzy::dom::DocumentFragmentp
+frenzy::htmlparser::parse_fragment(frenzy::dom::Elementp context,
+				   const frenzy::bytestring& str)
+{
+  dom::DocumentFragmentp fragment = context->get_ownerDocument()->createDocumentFragment();
+
+  htmlparser parser(context, fragment);
+  parser.pass_bytes(str);
+  parser.pass_eof();
+
+  return fragment;
 }
 
 void
 frenzy::htmlparser::pass_bytes(frenzy::bytestring str)
 {
+  if (tok.halted())
+    return;
+
+  bytes_passed += str.size();
   dec.pass_bytes(str);
 }
 
 void
 frenzy::htmlparser::pass_eof()
 {
-  dec.pass_bytes(bytestring());
+  pass_bytes(bytestring());
 }
 
 bool
 frenzy::htmlparser::stopped() const
 {
-  return tree.stopped();
+  return tree.stopped() || tok.halted();
+}
+
+void
+frenzy::htmlparser::attach_preloader(boost::function<void (const parser::preload&)> dest)
+{
+  preloader.reset(new parser::preloadscanner());
+  preloader->attach_destination(dest);
+}
+
+void
+frenzy::htmlparser::tokenize_in_parallel(size_t threads, size_t chunksize)
+{
+  if (!watchers.empty())
+    throw std::logic_error("Speculative tokenization is not used with watched elements");
+  if (pipeline)
+    throw std::logic_error("Speculative tokenization is not used with pipelining");
+
+  speculator.reset(new parser::speculative_tokenizer(tok, threads, chunksize));
+}
+
+void
+frenzy::htmlparser::pipeline_tree_construction()
+{
+  if (!watchers.empty())
+    throw std::logic_error("Pipelining is not used with watched elements");
+  if (speculator)
+    throw std::logic_error("Pipelining is not used with speculative tokenization");
+
+  pipeline.reset(new parser::token_pipeline(tok));
+}
+
+void
+frenzy::htmlparser::watch(const frenzy::ustring& selector,
+			  frenzy::htmlparser::elementcallback_t callback)
+{
+  watch_if(boost::bind(selector_matches, simpleselector(selector), _1), callback);
+}
+
+void
+frenzy::htmlparser::watch_if(frenzy::htmlparser::elementpredicate_t predicate,
+			     frenzy::htmlparser::elementcallback_t callback)
+{
+  if (speculator || pipeline)
+    throw std::logic_error("Watched elements need the tokenizer in step with tree construction");
+
+  if (watchers.empty())
+    tree.attach_close_listener(boost::bind(&htmlparser::element_closed, this, _1));
+
+  watcher w;
+  w.predicate = predicate;
+  w.callback = callback;
+  watchers.push_back(w);
+}
+
+bool
+frenzy::htmlparser::halted() const
+{
+  return tok.halted();
+}
+
+size_t
+frenzy::htmlparser::bytes_consumed() const
+{
+  size_t unconsumed = dec.pending_bytes();
+
+  const urope& rest = tok.unconsumed();
+  for (urope::const_iterator it = rest.begin();
+       it != rest.end();
+       ++it)
+  {
+    if (*it != eof)
+      unconsumed += parser::utf8_length(*it);
+  }
+
+  return bytes_passed - unconsumed;
+}
+
+void
+frenzy::htmlparser::reset(frenzy::dom::Documentp doc)
+{
+  reset_stages();
+  tree.reset(doc);
+}
+
+void
+frenzy::htmlparser::reset(frenzy::dom::Elementp context,
+			  frenzy::dom::DocumentFragmentp fragment)
+{
+  reset_stages();
+  tree.reset(fragment, parser::fragmentcontext(context));
+}
+
+void
+frenzy::htmlparser::connect_stages()
+{
+  dec.attach_destination(boost::bind(&parser::input_preprocessor::pass_characters, &proc, _1));
+  proc.attach_destination(boost::bind(&htmlparser::pass_preprocessed, this, _1));
+  tree.couple_tokenizer(&tok);
+}
+
+void
+frenzy::htmlparser::reset_stages()
+{
+  bytes_passed = 0;
+  dec.reset();
+  proc.reset();
+  tok.reset();
+  if (preloader)
+    preloader->reset();
+  if (speculator)
+    speculator->reset();
+  if (pipeline)
+    pipeline->reset();
+}
+
+void
+frenzy::htmlparser::pass_preprocessed(const frenzy::urope& input)
+{
+  if (preloader)
+    preloader->pass_characters(input);
+
+  if (speculator)
+    speculator->pass_characters(input);
+  else if (pipeline)
+    pipeline->pass_characters(input);
+  else
+    tok.pass_characters(input);
+
+  // The tree is read between chunks. The tree constructor thread of
+  // the pipeline is idle when pass_characters() returns.
+  tree.flush();
+}
+
+void
+frenzy::htmlparser::element_closed(frenzy::parser::treesink::handle elem)
+{
+  // Elements closed by the token that halted the parser are not
+  // reported
+  if (tok.halted())
+    return;
+
+  dom::Elementp element = boost::static_pointer_cast<dom::Element>(parser::domsink::node(elem));
+
+  for (std::vector<watcher>::const_iterator it = watchers.begin();
+       it != watchers.end();
+       ++it)
+  {
+    if (it->predicate(element) && it->callback(element))
+    {
+      tok.halt();
+      return;
+    }
+  }
 }
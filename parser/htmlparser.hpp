@@ -14,11 +14,18 @@
 #ifndef FRENZY_HTMLPARSER_HPP
 #define FRENZY_HTMLPARSER_HPP
 
+#include <vector>
+#include <boost/function.hpp>
+#include <boost/scoped_ptr.hpp>
+
 #include "dom/pointers.hpp"
 #include "chardecoder.hpp"
 #include "input_preprocessor.hpp"
 #include "htmltokenizer.hpp"
 #include "treeconstructor.hpp"
+#include "preloadscanner.hpp"
+#include "speculativetokenizer.hpp"
+#include "tokenpipeline.hpp"
 
 namespace frenzy
 {
@@ -28,13 +35,28 @@ namespace frenzy
    * object, and bytes are passed to it with pass_bytes(). An empty
    * string of bytes passes an end-of-stream message, and is
    * equivalent to calling pass_eof().
+   *
+   * For parsing fragments, as with innerHTML, a htmlparser is
+   * created with the context element and a DocumentFragment that
+   * receives the parsed nodes.
   */
 
-  // TODO: Interface for fragment parsing.
-
   struct htmlparser
   {
-    htmlparser(dom::Documentp doc);
+    htmlparser(dom::Documentp doc, const parser::treeoptions& options = parser::treeoptions());
+    htmlparser(dom::Elementp context, dom::DocumentFragmentp fragment,
+	       const parser::treeoptions& options = parser::treeoptions());
+
+    // Parses the bytes as a fragment in the context of the given
+    // element. Returns a new DocumentFragment of the context
+    // element's document that contains the parsed nodes.
+    static dom::DocumentFragmentp parse_fragment(dom::Elementp context, const bytestring& str);
+
+    // Clears the parser for parsing a new bytestream to the given
+    // document or fragment. The parser stages are reused, so that a
+    // parser can be recycled for many documents.
+    void reset(dom::Documentp doc);
+    void reset(dom::Elementp context, dom::DocumentFragmentp fragment);
 
     void pass_bytes(bytestring str);
     void pass_eof();
@@ -42,11 +64,84 @@ namespace frenzy
     // Returns true if the parser has finished working.
     bool stopped() const;
 
+    // Runs a preload scanner over the input ahead of the tokenizer,
+    // and passes the resource references it finds to the given
+    // function. Must be called before passing any input.
+    void attach_preloader(boost::function<void (const parser::preload&)> dest);
+
+    // Tokenizes the input speculatively on the given number of
+    // threads, see speculative_tokenizer. Meant for large documents,
+    // as input is tokenized in batches of chunksize characters per
+    // thread. Must be called before passing any input. Throws
+    // std::logic_error if pipeline_tree_construction() was called.
+    void tokenize_in_parallel(size_t threads, size_t chunksize = 65536);
+
+    // Tokenizes on the calling thread and constructs the tree on a
+    // second thread, see token_pipeline. Must be called before
+    // passing any input. Throws std::logic_error if
+    // tokenize_in_parallel() was called.
+    void pipeline_tree_construction();
+
+    // Returns true for the elements a watch callback is called for
+    typedef boost::function<bool (dom::Elementp)> elementpredicate_t;
+    // Returns true to halt the parser
+    typedef boost::function<bool (dom::Elementp)> elementcallback_t;
+
+    // Calls the callback with each element that matches the
+    // predicate or the selector, see simpleselector, when tree
+    // construction has completed the element. Meant for extracting
+    // parts of a document without parsing all of it, like the title
+    // or the metadata in the head.
+    //
+    // If the callback returns true, the parser halts right after the
+    // token being processed. No more nodes are created, the input
+    // passed later is ignored and stopped() returns true. The
+    // elements still open are left incomplete.
+    //
+    // Not used together with tokenize_in_parallel() or
+    // pipeline_tree_construction(), as they tokenize ahead of tree
+    // construction.
+    void watch(const ustring& selector, elementcallback_t callback);
+    void watch_if(elementpredicate_t predicate, elementcallback_t callback);
+
+    // Returns true if a watch callback has halted the parser.
+    bool halted() const;
+
+    // Returns the number of bytes of input consumed by the tokenizer,
+    // so after halting, the length of the input up to the end of the
+    // token that halted the parser. Counted from the characters that
+    // are not consumed, encoded back to UTF-8, so a CR LF pair or an
+    // invalid byte sequence after that point makes the count off by
+    // the difference.
+    size_t bytes_consumed() const;
+
   private:
     parser::utf8_decoder dec;
     parser::input_preprocessor proc;
     parser::htmltokenizer tok;
     parser::treeconstructor tree;
+    boost::scoped_ptr<parser::preloadscanner> preloader;
+    boost::scoped_ptr<parser::speculative_tokenizer> speculator;
+    boost::scoped_ptr<parser::token_pipeline> pipeline;
+
+    // Attaches the stages to each other
+    void connect_stages();
+    // Resets the stages before the tree constructor
+    void reset_stages();
+
+    // Passes preprocessed characters to the preload scanner, if any,
+    // and then to the tokenizer.
+    void pass_preprocessed(const urope& input);
+
+    struct watcher
+    {
+      elementpredicate_t predicate;
+      elementcallback_t callback;
+    };
+    std::vector<watcher> watchers;
+    size_t bytes_passed;
+
+    void element_closed(parser::treesink::handle elem);
   };
 }
 
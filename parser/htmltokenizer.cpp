@@ -15,6 +15,8 @@
 
 #include "htmltokenizer.hpp"
 #include "htmlentitysearcher.hpp"
+#include "htmlnames.hpp"
+#include "util/stringlist.hpp"
 
 namespace
 {
@@ -45,11 +47,20 @@ namespace
   {
     return is_ascii_digit(u) || (u >= 0x41 && u <= 0x46) || (u >= 0x61 && u <= 0x66);
   }
+
+  // Elements with text content, for text_state_for()
+  const frenzy::stringlist rcdataelems =
+    frenzy::stringlist(frenzy::html::title) + frenzy::html::textarea;
+  const frenzy::stringlist rawtextelems =
+    frenzy::stringlist(frenzy::html::style) + frenzy::html::xmp + frenzy::html::iframe +
+    frenzy::html::noembed + frenzy::html::noframes + frenzy::html::noscript;
 }
 
 frenzy::parser::htmltokenizer::htmltokenizer()
   : incomplete(token::make_end_of_file()) // value unused before replacing
   , state(STATE_DATA)
+  , consumed_count(0)
+  , halted_flag(false)
 {
 
 }
@@ -57,16 +68,32 @@ frenzy::parser::htmltokenizer::htmltokenizer()
 void
 frenzy::parser::htmltokenizer::pass_characters(const frenzy::urope& input)
 {
+  if (halted_flag)
+    return;
+
   buffer.append(input);
   if (input.empty())
     buffer.push_back(eof);
 
-  while (call_state())
+  while (!halted_flag && call_state())
   {
     // Nothing
   }
 }
 
+void
+frenzy::parser::htmltokenizer::reset()
+{
+  completed_items.clear();
+  buffer.clear();
+  temporary_buffer.clear();
+  last_start_tag_name.clear();
+  incomplete = token::make_end_of_file();
+  state = STATE_DATA;
+  consumed_count = 0;
+  halted_flag = false;
+}
+
 frenzy::parser::htmltokenizer::tokensequence_t
 frenzy::parser::htmltokenizer::complete_tokens()
 {
@@ -138,6 +165,7 @@ frenzy::parser::htmltokenizer::consume()
 {
   current_input = buffer[0];
   buffer.pop_front();
+  ++consumed_count;
   return current_input;
 }
 
@@ -145,12 +173,14 @@ void
 frenzy::parser::htmltokenizer::consume(size_t howmany)
 {
   buffer.pop_front(howmany);
+  consumed_count += howmany;
 }
 
 void
 frenzy::parser::htmltokenizer::rewind(frenzy::uchar u)
 {
   buffer.push_front(u);
+  --consumed_count;
 }
 
 bool
@@ -429,7 +459,7 @@ frenzy::parser::htmltokenizer::try_consume_number(uchar& u)
 
 namespace
 {
-  frenzy::uchar filtering_table[] = {
+  const frenzy::uchar filtering_table[] = {
     0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, // 80-87
     0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F, // 88-8F
     0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, // 90-97
@@ -458,6 +488,89 @@ frenzy::parser::htmltokenizer::change_state(frenzy::parser::htmltokenizer::token
   state = s;
 }
 
+frenzy::parser::htmltokenizer::tokenizestate
+frenzy::parser::htmltokenizer::text_state_for(const frenzy::ustring& tagname)
+{
+  using namespace frenzy::html;
+
+  // HTML5 8.2.5.4.4 "in head" and 8.2.5.4.7 "in body". The
+  // scripting flag is considered enabled, as in the tree
+  // constructor.
+  if (rcdataelems.contains(tagname))
+    return STATE_RCDATA;
+  if (rawtextelems.contains(tagname))
+    return STATE_RAWTEXT;
+  if (tagname == script)
+    return STATE_SCRIPT_DATA;
+  if (tagname == plaintext)
+    return STATE_PLAINTEXT;
+
+  return STATE_DATA;
+}
+
+frenzy::parser::htmltokenizer::tokenizestate
+frenzy::parser::htmltokenizer::get_state() const
+{
+  return state;
+}
+
+size_t
+frenzy::parser::htmltokenizer::consumed() const
+{
+  return consumed_count;
+}
+
+void
+frenzy::parser::htmltokenizer::halt()
+{
+  halted_flag = true;
+}
+
+bool
+frenzy::parser::htmltokenizer::halted() const
+{
+  return halted_flag;
+}
+
+void
+frenzy::parser::htmltokenizer::resume()
+{
+  halted_flag = false;
+  buffer.clear();
+}
+
+const frenzy::urope&
+frenzy::parser::htmltokenizer::unconsumed() const
+{
+  return buffer;
+}
+
+bool
+frenzy::parser::htmltokenizer::at_boundary() const
+{
+  return state == STATE_DATA && buffer.empty();
+}
+
+void
+frenzy::parser::htmltokenizer::replay(const frenzy::parser::token& t,
+				      frenzy::parser::htmltokenizer::tokenizestate s)
+{
+  state = s;
+
+  if (t.type == TOKEN_START_TAG)
+    last_start_tag_name = t.tagname;
+
+  emit(t);
+}
+
+void
+frenzy::parser::htmltokenizer::restore(frenzy::parser::htmltokenizer::tokenizestate s,
+				       const frenzy::ustring& last_start_tag)
+{
+  state = s;
+  last_start_tag_name = last_start_tag;
+}
+
 bool
 frenzy::parser::htmltokenizer::call_state()
 {
@@ -2150,15 +2263,15 @@ frenzy::parser::htmltokenizer::state_bogus_comment()
   switch (next)
   {
   case 0x3E: // >
-    emit();
     state = STATE_DATA;
+    emit();
     return true;
   case 0x00: // NUL
     incomplete.comment.push_back(0xFFFD);
     return true;
   case eof:
-    emit();
     state = STATE_DATA;
+    emit();
     rewind(next);
     return true;
   default:
@@ -2508,9 +2621,9 @@ frenzy::parser::htmltokenizer::state_before_doctype_name()
   case 0x3E: // >
     // TODO: Should produce a parse error
     incomplete = token::make_doctype();
+    state = STATE_DATA;
     incomplete.force_quirks = true;
     emit();
-    state = STATE_DATA;
     return true;
   case eof:
     // TODO: Should produce a parse error
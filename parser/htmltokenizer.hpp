@@ -24,12 +24,14 @@
 namespace frenzy
 {
   /*
-   * Parser stages are constructed once _per_bytestream_. A
-   * constructed parser stage contains parser state that needs to be
-   * refreshed.
+   * Parser stages hold the parser state of one bytestream at a
+   * time. A stage is either constructed per bytestream, or reset()
+   * between bytestreams. Resetting clears the parser state but keeps
+   * the attached destination and the allocated buffers, so that
+   * parsing many documents doesn't construct the stages again.
    *
-   * Note that Javascript document.open() also requires new parser
-   * stage objects.
+   * Note that Javascript document.open() also requires fresh parser
+   * stages.
    *
    * Parser stage interface: pass_*() takes a sequence of input
    * datums. Any completed results are stored and can be fetched with
@@ -69,6 +71,7 @@ namespace frenzy
       htmltokenizer();
 
       void pass_characters(const urope& input);
+      void reset();
 
       typedef std::vector<token> tokensequence_t;
 
@@ -200,8 +203,44 @@ namespace frenzy
       // Used by the tree constructor when appropriate
       void change_state(tokenizestate state);
 
+      // Returns the state the tree constructor switches the tokenizer
+      // to after a start tag with the given name, when the start tag
+      // is processed in the common insertion modes. Returns
+      // STATE_DATA for elements that do not change the state. Meant
+      // for consumers that tokenize without a tree constructor.
+      static tokenizestate text_state_for(const ustring& tagname);
+
+      // For speculative tokenization, see speculative_tokenizer.
+      tokenizestate get_state() const;
+      // Returns the number of input characters consumed so far
+      size_t consumed() const;
+      // Returns true if the tokenizer is in the data state with no
+      // buffered input, that is, between tokens.
+      bool at_boundary() const;
+      // Passes a token tokenized elsewhere to the destination, as if
+      // it had been emitted in the given state.
+      void replay(const token& t, tokenizestate s);
+      // Continues as if the input before had been tokenized, ending
+      // between tokens in the given state, with the given name as the
+      // name of the last start tag. For continuing from a checkpoint,
+      // see incrementalparser.
+      void restore(tokenizestate s, const ustring& last_start_tag);
+
+      // Stops tokenizing after the token being emitted. The rest of
+      // the input stays unconsumed, and input passed later is ignored
+      // until reset().
+      void halt();
+      bool halted() const;
+      // Clears a halt. The input left unconsumed is dropped, and
+      // tokenizing continues with the input passed next.
+      void resume();
+      // Returns the input not consumed yet
+      const urope& unconsumed() const;
+
     private:
       tokenizestate state, prevstate; // prevstate is used by character reference parser
+      size_t consumed_count;
+      bool halted_flag;
 
       // Call the next appropriate state operation. Return value of false
       // means more input is needed to proceed.
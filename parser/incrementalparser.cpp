@@ -0,0 +1,981 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+
+#include <stdexcept>
+#include <boost/bind.hpp>
+
+#include "incrementalparser.hpp"
+#include "input_preprocessor.hpp"
+#include "dom/document.hpp"
+#include "dom/element.hpp"
+#include "dom/text.hpp"
+
+namespace
+{
+  using namespace frenzy;
+  using namespace frenzy::dom;
+
+  typedef std::map<Node*, Node*> nodemap_t;
+
+  // Characters passed to the tokenizer at a time, so that the text
+  // after a re-synchronization point is not copied
+  const size_t tokenize_chunk = 4096;
+
+  ustring decode(const bytestring& input)
+  {
+    parser::utf8_decoder dec;
+    parser::input_preprocessor proc;
+    dec.attach_destination(boost::bind(&parser::input_preprocessor::pass_characters, &proc, _1));
+    dec.pass_bytes(input);
+    if (!input.empty())
+      dec.pass_bytes(bytestring());
+
+    urope chars = proc.complete_characters();
+    ustring ret;
+    for (urope::const_iterator it = chars.begin(); it != chars.end(); ++it)
+    {
+      ret.push_back(*it);
+    }
+
+    return ret;
+  }
+
+  std::vector<Nodep> children(Nodep n)
+  {
+    std::vector<Nodep> ret;
+    for (Nodep child = n->get_firstChild(); child; child = child->get_nextSibling())
+    {
+      ret.push_back(child);
+    }
+
+    return ret;
+  }
+
+  bool is_text(Node* n)
+  {
+    return n && n->get_nodeType() == Node::TEXT_NODE;
+  }
+
+  // Returns the length of a text node, or 0 for other nodes
+  size_t text_length(Node* n)
+  {
+    return is_text(n) ? static_cast<Text*>(n)->get_length() : 0;
+  }
+
+  Node* lookup(const nodemap_t& map, Node* n)
+  {
+    nodemap_t::const_iterator it = map.find(n);
+    return it != map.end() ? it->second : n;
+  }
+
+  void add_with_ancestors(std::set<Node*>& nodes, Node* n)
+  {
+    while (n && nodes.insert(n).second)
+      n = n->get_parentNode().get();
+  }
+
+  // Returns true if the nodes can be updated to each other in place
+  bool same_kind(Nodep a, Nodep b)
+  {
+    if (a->get_nodeType() != b->get_nodeType() || a->get_nodeName() != b->get_nodeName())
+      return false;
+
+    if (a->get_nodeType() == Node::DOCUMENT_TYPE_NODE)
+    {
+      DocumentTypep da = dom_cast<DocumentType>(a);
+      DocumentTypep db = dom_cast<DocumentType>(b);
+      return da->get_publicId() == db->get_publicId() && da->get_systemId() == db->get_systemId();
+    }
+
+    return true;
+  }
+
+  bool same_attributes(Elementp a, Elementp b)
+  {
+    if (a->getAttributeSize() != b->getAttributeSize())
+      return false;
+
+    for (size_t i = 0; i < b->getAttributeSize(); ++i)
+    {
+      Attrp attr = b->getAttributeNodeByIndex(i);
+      if (!a->hasAttribute(attr->get_name()) ||
+	  *a->getAttribute(attr->get_name()) != attr->get_value())
+	return false;
+    }
+
+    return true;
+  }
+
+  bool equal_trees(Nodep a, Nodep b)
+  {
+    if (!same_kind(a, b) || a->get_nodeValue() != b->get_nodeValue())
+      return false;
+
+    if (a->get_nodeType() == Node::ELEMENT_NODE &&
+	!same_attributes(dom_cast<Element>(a), dom_cast<Element>(b)))
+      return false;
+
+    Nodep ca = a->get_firstChild();
+    Nodep cb = b->get_firstChild();
+    for (; ca && cb; ca = ca->get_nextSibling(), cb = cb->get_nextSibling())
+    {
+      if (!equal_trees(ca, cb))
+	return false;
+    }
+
+    return !ca && !cb;
+  }
+
+  // Maps the nodes of `fresh' to the nodes of the equal tree `live'
+  void keep_tree(Nodep live, Nodep fresh, nodemap_t& kept)
+  {
+    kept[fresh.get()] = live.get();
+
+    Nodep l = live->get_firstChild();
+    Nodep f = fresh->get_firstChild();
+    for (; l && f; l = l->get_nextSibling(), f = f->get_nextSibling())
+    {
+      keep_tree(l, f, kept);
+    }
+  }
+
+  void patch_range(Nodep live, const std::vector<Nodep>& oldc, const std::vector<Nodep>& newc,
+		   Nodep ref, nodemap_t& kept);
+
+  // Updates `live' to match `fresh', which is of the same kind
+  void patch(Nodep live, Nodep fresh, nodemap_t& kept)
+  {
+    kept[fresh.get()] = live.get();
+
+    switch (live->get_nodeType())
+    {
+    case Node::TEXT_NODE:
+    case Node::COMMENT_NODE:
+      if (live->get_nodeValue() != fresh->get_nodeValue())
+	dom_cast<CharacterData>(live)->set_data(dom_cast<CharacterData>(fresh)->get_data());
+      break;
+    case Node::ELEMENT_NODE:
+      {
+	Elementp l = dom_cast<Element>(live);
+	Elementp f = dom_cast<Element>(fresh);
+
+	for (size_t i = 0; i < f->getAttributeSize(); ++i)
+	{
+	  Attrp attr = f->getAttributeNodeByIndex(i);
+	  if (!l->hasAttribute(attr->get_name()) ||
+	      *l->getAttribute(attr->get_name()) != attr->get_value())
+	    l->setAttribute(attr->get_name(), attr->get_value());
+	}
+
+	std::vector<ustring> stale;
+	for (size_t i = 0; i < l->getAttributeSize(); ++i)
+	{
+	  ustring name = l->getAttributeNodeByIndex(i)->get_name();
+	  if (!f->hasAttribute(name))
+	    stale.push_back(name);
+	}
+	for (size_t i = 0; i < stale.size(); ++i)
+	{
+	  l->removeAttribute(stale[i]);
+	}
+
+	patch_range(live, children(live), children(fresh), Nodep(), kept);
+      }
+      break;
+    default:
+      break;
+    }
+  }
+
+  // Updates the children `oldc' of `live', which are followed by
+  // `ref', to match `newc', which are not in the document. Equal
+  // subtrees at both ends are kept as they are, then nodes of the
+  // same kind are updated in place, and the nodes left in the middle
+  // are replaced by moving the new nodes over. The new nodes that
+  // old nodes are kept for are mapped to them in `kept'.
+  void patch_range(Nodep live, const std::vector<Nodep>& oldc, const std::vector<Nodep>& newc,
+		   Nodep ref, nodemap_t& kept)
+  {
+    size_t head = 0;
+    while (head < oldc.size() && head < newc.size() && equal_trees(oldc[head], newc[head]))
+    {
+      keep_tree(oldc[head], newc[head], kept);
+      ++head;
+    }
+
+    size_t oldend = oldc.size();
+    size_t newend = newc.size();
+    while (oldend > head && newend > head && equal_trees(oldc[oldend - 1], newc[newend - 1]))
+    {
+      keep_tree(oldc[oldend - 1], newc[newend - 1], kept);
+      --oldend;
+      --newend;
+    }
+
+    while (head < oldend && head < newend && same_kind(oldc[head], newc[head]))
+    {
+      patch(oldc[head], newc[head], kept);
+      ++head;
+    }
+
+    size_t oldhead = head;
+    size_t newhead = head;
+    while (oldend > oldhead && newend > newhead && same_kind(oldc[oldend - 1], newc[newend - 1]))
+    {
+      patch(oldc[oldend - 1], newc[newend - 1], kept);
+      --oldend;
+      --newend;
+    }
+
+    // Removing first, as a document can only have one element child
+    if (oldend < oldc.size())
+      ref = oldc[oldend];
+    for (size_t i = oldhead; i < oldend; ++i)
+    {
+      live->removeChild(oldc[i]);
+    }
+    for (size_t i = newhead; i < newend; ++i)
+    {
+      live->insertBefore(newc[i], ref);
+    }
+  }
+
+}
+frenzy::incrementalparser::livesink::livesink(frenzy::dom::Documentp doc)
+  : domsink(doc)
+  , earlier(NULL)
+  , rearranged(false)
+  , moved_earlier(false)
+{
+}
+
+frenzy::dom::Node*
+frenzy::incrementalparser::livesink::marker(frenzy::parser::treesink::handle parent) const
+{
+  if (markers.empty())
+    return NULL;
+
+  nodemap_t::const_iterator it = markers.find(static_cast<dom::Node*>(parent));
+  return it != markers.end() ? it->second : NULL;
+}
+
+frenzy::dom::Node*
+frenzy::incrementalparser::livesink::last_child(frenzy::parser::treesink::handle parent) const
+{
+  if (dom::Node* m = marker(parent))
+    return m->get_previousSibling().get();
+
+  return static_cast<dom::Node*>(parent)->get_lastChild().get();
+}
+
+bool
+frenzy::incrementalparser::livesink::is_earlier(frenzy::parser::treesink::handle node) const
+{
+  return earlier && earlier->count(static_cast<dom::Node*>(node));
+}
+
+void
+frenzy::incrementalparser::livesink::append(frenzy::parser::treesink::handle parent,
+					    frenzy::parser::treesink::handle child)
+{
+  if (node(child)->get_parentNode())
+  {
+    rearranged = true;
+    moved_earlier = moved_earlier || is_earlier(child);
+  }
+
+  if (dom::Node* m = marker(parent))
+    domsink::insert_before(parent, child, m);
+  else
+    domsink::append(parent, child);
+}
+
+void
+frenzy::incrementalparser::livesink::insert_before(frenzy::parser::treesink::handle parent,
+						   frenzy::parser::treesink::handle child,
+						   frenzy::parser::treesink::handle sibling)
+{
+  rearranged = true;
+  moved_earlier = moved_earlier || is_earlier(child);
+  domsink::insert_before(parent, child, sibling);
+}
+
+void
+frenzy::incrementalparser::livesink::append_text(frenzy::parser::treesink::handle parent,
+						 const frenzy::ustring& text)
+{
+  if (dom::Node* m = marker(parent))
+    domsink::insert_text_before(parent, m, text);
+  else
+    domsink::append_text(parent, text);
+}
+
+void
+frenzy::incrementalparser::livesink::insert_text_before(frenzy::parser::treesink::handle parent,
+							frenzy::parser::treesink::handle sibling,
+							const frenzy::ustring& text)
+{
+  rearranged = true;
+  domsink::insert_text_before(parent, sibling, text);
+}
+
+void
+frenzy::incrementalparser::livesink::remove_from_parent(frenzy::parser::treesink::handle n)
+{
+  rearranged = true;
+  moved_earlier = moved_earlier || is_earlier(n);
+  domsink::remove_from_parent(n);
+}
+
+void
+frenzy::incrementalparser::livesink::reparent_children(frenzy::parser::treesink::handle n,
+						       frenzy::parser::treesink::handle newparent)
+{
+  rearranged = true;
+  moved_earlier = moved_earlier || is_earlier(n);
+
+  // Appending one by one, to go before the marker of newparent. The
+  // old nodes from the marker of n on stay.
+  dom::Nodep from = node(n);
+  dom::Node* m = marker(n);
+  for (dom::Nodep child = from->get_firstChild(); child && child.get() != m; child = from->get_firstChild())
+  {
+    append(newparent, child.get());
+  }
+}
+
+void
+frenzy::incrementalparser::livesink::add_attributes_if_missing(frenzy::parser::treesink::handle element,
+							       const frenzy::parser::treesink::attributes_t& attributes)
+{
+  rearranged = true;
+  domsink::add_attributes_if_missing(element, attributes);
+}
+
+void
+frenzy::incrementalparser::checkpoint::remap(const frenzy::incrementalparser::nodemap_t& map)
+{
+  if (map.empty())
+    return;
+
+  std::vector<parser::treesink::handle> handles = tree.handles();
+  for (size_t i = 0; i < handles.size(); ++i)
+  {
+    handles[i] = lookup(map, static_cast<dom::Node*>(handles[i]));
+  }
+  tree.set_handles(handles);
+
+  for (std::vector<target>::iterator it = targets.begin(); it != targets.end(); ++it)
+  {
+    it->node = lookup(map, it->node);
+    it->lastchild = lookup(map, it->lastchild);
+  }
+}
+
+frenzy::incrementalparser::record::record(frenzy::parser::token_type type)
+  : type(type)
+  , end(0)
+  , rearranges(false)
+{
+}
+
+frenzy::incrementalparser::incrementalparser(frenzy::dom::Documentp doc)
+  : doc(doc)
+  , sink(doc)
+  , tree(&sink)
+  , resumable(0)
+  , rearranged(false)
+  , base(0)
+  , tokenized(0)
+  , old_edit_end(0)
+  , new_edit_end(0)
+  , resuming(false)
+  , resync(0)
+  , scan(0)
+{
+  tree.couple_tokenizer(&tok);
+  // Recording the tokens as the tree constructor processes them
+  tok.attach_destination(boost::bind(&incrementalparser::process_token, this, _1));
+}
+
+void
+frenzy::incrementalparser::parse(const frenzy::bytestring& input)
+{
+  records.clear();
+  text.clear();
+  update(input);
+}
+
+void
+frenzy::incrementalparser::edit(size_t offset, size_t removed, const frenzy::bytestring& inserted)
+{
+  if (offset > bytes.size() || removed > bytes.size() - offset)
+    throw std::out_of_range("Edit range out of bounds");
+
+  update(bytes.substr(0, offset) + inserted + bytes.substr(offset + removed));
+}
+
+const frenzy::bytestring&
+frenzy::incrementalparser::input() const
+{
+  return bytes;
+}
+
+size_t
+frenzy::incrementalparser::tokenized_characters() const
+{
+  return tokenized;
+}
+
+void
+frenzy::incrementalparser::update(const frenzy::bytestring& input)
+{
+  ustring newtext = decode(input);
+
+  // The edited part is what is left between the common prefix and
+  // suffix of the old and the new text
+  size_t limit = std::min(text.size(), newtext.size());
+  size_t prefix = 0;
+  while (prefix < limit && text[prefix] == newtext[prefix])
+    ++prefix;
+
+  size_t suffix = 0;
+  while (suffix < limit - prefix &&
+	 text[text.size() - 1 - suffix] == newtext[newtext.size() - 1 - suffix])
+    ++suffix;
+
+  old_edit_end = text.size() - suffix;
+  new_edit_end = newtext.size() - suffix;
+
+  // Parsing again from scratch when it can't continue from a
+  // checkpoint, also when a node from before the checkpoint was
+  // moved
+  if (records.empty() || !resume(prefix, newtext))
+    reparse(newtext);
+
+  // Not keeping the nodes created, only the tree does
+  sink.reset(doc);
+
+  text = newtext;
+  bytes = input;
+}
+
+void
+frenzy::incrementalparser::reparse(const frenzy::ustring& newtext)
+{
+  dom::Documentp scratch = dom::Document::create();
+  sink.reset(scratch);
+  sink.markers.clear();
+  sink.earlier = NULL;
+  tok.reset();
+  tree.reset();
+  last_start_tag.clear();
+  newrecords.clear();
+  resuming = false;
+
+  initial = save();
+  tokenize(newtext, 0);
+
+  nodemap_t kept;
+  kept[scratch.get()] = doc.get();
+  patch_range(doc, children(doc), children(scratch), dom::Nodep(), kept);
+
+  records.swap(newrecords);
+  newrecords.clear();
+  resumable = 0;
+  for (size_t i = 0; i < records.size(); ++i)
+  {
+    if (records[i].rearranges)
+      resumable = i + 1;
+  }
+  drop_checkpoints();
+
+  // The checkpoints left refer to the scratch nodes the document
+  // kept its own nodes for
+  if (initial)
+    initial->remap(kept);
+  for (size_t i = 0; i < records.size(); ++i)
+  {
+    if (records[i].cp)
+      records[i].cp->remap(kept);
+  }
+}
+
+bool
+frenzy::incrementalparser::resume(size_t prefix, const frenzy::ustring& newtext)
+{
+  // The last checkpoint before the edit where the tree is still as
+  // it was, apart from the nodes appended after it
+  size_t from = 0;
+  size_t upper = records.size();
+  while (from < upper)
+  {
+    size_t middle = from + (upper - from) / 2;
+    if (records[middle].end <= prefix)
+      from = middle + 1;
+    else
+      upper = middle;
+  }
+
+  while (true)
+  {
+    if (from < resumable)
+      return false;
+
+    resumed = from > 0 ? records[from - 1].cp : initial;
+    if (resumed && can_resume(*resumed))
+      break;
+
+    if (from == 0)
+      return false;
+    --from;
+  }
+
+  std::vector<parser::treesink::handle> handles = resumed->tree.handles();
+  earlier.clear();
+  for (size_t i = 0; i < handles.size(); ++i)
+  {
+    add_with_ancestors(earlier, static_cast<dom::Node*>(handles[i]));
+  }
+
+  sink.reset(doc);
+  sink.markers.clear();
+  for (std::vector<checkpoint::target>::const_iterator it = resumed->targets.begin();
+       it != resumed->targets.end();
+       ++it)
+  {
+    add_with_ancestors(earlier, it->node);
+
+    dom::Nodep next = it->lastchild ? it->lastchild->get_nextSibling() : it->node->get_firstChild();
+    if (next)
+      sink.markers[it->node] = next.get();
+  }
+  sink.earlier = &earlier;
+  sink.moved_earlier = false;
+
+  tok.reset();
+  tree.restore(resumed->tree);
+  tok.restore(resumed->state, resumed->last_start_tag);
+  last_start_tag = resumed->last_start_tag;
+
+  newrecords.clear();
+  replaced.clear();
+  resuming = true;
+  resync = records.size();
+  scan = from;
+
+  tokenize(newtext, from > 0 ? records[from - 1].end : 0);
+  resuming = false;
+
+  if (sink.moved_earlier)
+    return false;
+
+  const checkpoint* now = resync < records.size() ? newrecords.back().cp.get() : NULL;
+  const checkpoint* old = resync < records.size() ? records[resync].cp.get() : NULL;
+
+  // The nodes the old tokens after the re-synchronization point
+  // appended to the old elements are taken out, to go to the new
+  // elements or the old ones kept for them
+  std::vector<std::vector<dom::Nodep> > tails(old ? old->targets.size() : 0);
+  for (size_t i = 0; i < tails.size(); ++i)
+  {
+    const checkpoint::target& o = old->targets[i];
+    if (earlier.count(o.node))
+      continue;
+
+    dom::Nodep next = o.lastchild ? o.lastchild->get_nextSibling() : o.node->get_firstChild();
+    while (next)
+    {
+      dom::Nodep following = next->get_nextSibling();
+      o.node->removeChild(next);
+      tails[i].push_back(next);
+      next = following;
+    }
+  }
+
+  // The old nodes between the checkpoint and the
+  // re-synchronization point are patched to match the new ones
+  // inserted before them
+  nodemap_t kept;
+  for (std::vector<checkpoint::target>::const_iterator it = resumed->targets.begin();
+       it != resumed->targets.end();
+       ++it)
+  {
+    dom::Nodep parent(it->node);
+    dom::Node* marker = sink.marker(it->node);
+
+    dom::Node* tail = NULL;
+    for (size_t i = 0; old && i < old->targets.size(); ++i)
+    {
+      const checkpoint::target& o = old->targets[i];
+      if (o.node == it->node)
+	tail = o.lastchild == it->lastchild ? marker : o.lastchild->get_nextSibling().get();
+    }
+
+    std::vector<dom::Nodep> newc;
+    for (dom::Nodep n = it->lastchild ? it->lastchild->get_nextSibling() : parent->get_firstChild();
+	 n && n.get() != marker;
+	 n = n->get_nextSibling())
+    {
+      newc.push_back(n);
+    }
+
+    std::vector<dom::Nodep> oldc;
+    for (dom::Nodep n(marker); n && n.get() != tail; n = n->get_nextSibling())
+    {
+      oldc.push_back(n);
+    }
+
+    if (newc.empty() && oldc.empty())
+      continue;
+
+    for (size_t i = 0; i < newc.size(); ++i)
+    {
+      parent->removeChild(newc[i]);
+    }
+    patch_range(parent, oldc, newc, dom::Nodep(tail), kept);
+  }
+
+  for (size_t i = 0; i < tails.size(); ++i)
+  {
+    dom::Nodep to(lookup(kept, now->targets[i].node));
+    for (size_t j = 0; j < tails[i].size(); ++j)
+    {
+      to->appendChild(tails[i][j]);
+    }
+  }
+
+  // The old checkpoints after the re-synchronization point refer to
+  // the new nodes, or the old nodes kept for them
+  size_t end = records.size();
+  if (old)
+  {
+    end = resync + 1;
+
+    // The old nodes created before the re-synchronization point are
+    // replaced by the new ones, or the old ones kept for them
+    nodemap_t moved;
+    for (nodemap_t::const_iterator it = replaced.begin(); it != replaced.end(); ++it)
+    {
+      moved[it->first] = lookup(kept, it->second);
+    }
+    bool remapping = false;
+    for (nodemap_t::const_iterator it = moved.begin(); it != moved.end(); ++it)
+    {
+      remapping = remapping || it->first != it->second;
+    }
+
+    std::vector<checkpoint::target> lastchildren(now->targets);
+    for (size_t i = 0; i < lastchildren.size(); ++i)
+    {
+      lastchildren[i].lastchild = lookup(kept, lastchildren[i].lastchild);
+      remapping = remapping ||
+	lastchildren[i].lastchild != old->targets[i].lastchild ||
+	lastchildren[i].length != old->targets[i].length;
+    }
+
+    for (size_t i = end; i < records.size(); ++i)
+    {
+      records[i].end = to_new(records[i].end);
+      if (!remapping || !records[i].cp)
+	continue;
+
+      // The nodes not appended to after the re-synchronization
+      // point have the new last children
+      std::vector<checkpoint::target>& targets = records[i].cp->targets;
+      std::vector<size_t> unchanged(targets.size(), lastchildren.size());
+      for (size_t t = 0; t < targets.size(); ++t)
+      {
+	for (size_t j = 0; j < lastchildren.size(); ++j)
+	{
+	  if (targets[t].node == old->targets[j].node &&
+	      targets[t].lastchild == old->targets[j].lastchild)
+	    unchanged[t] = j;
+	}
+      }
+
+      records[i].cp->remap(moved);
+      for (size_t t = 0; t < targets.size(); ++t)
+      {
+	if (unchanged[t] < lastchildren.size())
+	{
+	  targets[t].lastchild = lastchildren[unchanged[t]].lastchild;
+	  targets[t].length = lastchildren[unchanged[t]].length;
+	}
+      }
+    }
+  }
+
+  for (size_t i = 0; i < newrecords.size(); ++i)
+  {
+    if (newrecords[i].cp)
+      newrecords[i].cp->remap(kept);
+    if (newrecords[i].rearranges)
+      resumable = from + i + 1;
+  }
+
+  records.erase(records.begin() + from, records.begin() + end);
+  records.insert(records.begin() + from, newrecords.begin(), newrecords.end());
+  newrecords.clear();
+  if (resumable > from)
+    drop_checkpoints();
+
+  sink.markers.clear();
+  sink.earlier = NULL;
+  earlier.clear();
+  replaced.clear();
+  resumed.reset();
+  return true;
+}
+
+void
+frenzy::incrementalparser::tokenize(const frenzy::ustring& newtext, size_t start)
+{
+  base = start;
+  rearranged = false;
+  for (size_t pos = start; pos < newtext.size() && !tok.halted(); pos += tokenize_chunk)
+  {
+    tok.pass_characters(urope(newtext.substr(pos, tokenize_chunk)));
+  }
+  if (!tok.halted())
+    tok.pass_characters(urope());
+
+  tokenized = tok.consumed();
+}
+
+void
+frenzy::incrementalparser::process_token(const frenzy::parser::token& t)
+{
+  sink.rearranged = false;
+  tree.pass_token(t);
+  size_t end = base + tok.consumed();
+
+  if (t.type == parser::TOKEN_START_TAG)
+    last_start_tag = t.tagname;
+
+  if (t.type == parser::TOKEN_CHARACTER)
+  {
+    if (newrecords.empty() || newrecords.back().type != parser::TOKEN_CHARACTER)
+      newrecords.push_back(record(t.type));
+
+    record& r = newrecords.back();
+    r.end = end;
+    r.rearranges = r.rearranges || sink.rearranged;
+    rearranged = rearranged || r.rearranges;
+    return;
+  }
+
+  newrecords.push_back(record(t.type));
+  record& r = newrecords.back();
+  r.end = end;
+  if (t.type != parser::TOKEN_END_OF_FILE && !tree.stopped())
+    r.cp = save();
+  r.rearranges = sink.rearranged;
+  rearranged = rearranged || r.rearranges;
+
+  if (!resuming)
+    return;
+
+  // The document can't be patched, no use going on
+  if (sink.moved_earlier)
+  {
+    tok.halt();
+    return;
+  }
+
+  if (!r.cp || end < new_edit_end)
+    return;
+
+  // Looking for an old checkpoint at the same place in the unchanged
+  // text with the same state
+  size_t oldpos = end - new_edit_end + old_edit_end;
+  while (scan < records.size() && records[scan].end < oldpos)
+    ++scan;
+
+  for (size_t i = scan; i < records.size() && records[i].end == oldpos; ++i)
+  {
+    if (records[i].cp && same_state(*records[i].cp, *r.cp))
+    {
+      resync = i;
+      tok.halt();
+      return;
+    }
+  }
+}
+
+frenzy::incrementalparser::checkpointp
+frenzy::incrementalparser::save()
+{
+  checkpointp cp(new checkpoint);
+  tree.save(cp->tree);
+  cp->state = tok.get_state();
+  cp->last_start_tag = last_start_tag;
+
+  // Elements removed from the tree, like the formatting elements
+  // left in the body that a frameset replaces, can't be continued
+  // from
+  dom::Node* root = static_cast<dom::Node*>(sink.document());
+  if (rearranged || sink.rearranged)
+  {
+    std::vector<parser::treesink::handle> handles = cp->tree.handles();
+    for (size_t i = 0; i < handles.size(); ++i)
+    {
+      dom::Node* n = static_cast<dom::Node*>(handles[i]);
+      while (n && n != root)
+	n = n->get_parentNode().get();
+      if (handles[i] && !n)
+	return checkpointp();
+    }
+  }
+
+  std::vector<parser::treesink::handle> parents = cp->tree.parents();
+  parents.insert(parents.begin(), root);
+
+  cp->targets.resize(parents.size());
+  for (size_t i = 0; i < parents.size(); ++i)
+  {
+    checkpoint::target& t = cp->targets[i];
+    t.node = static_cast<dom::Node*>(parents[i]);
+    t.lastchild = sink.last_child(parents[i]);
+    t.length = text_length(t.lastchild);
+  }
+
+  return cp;
+}
+
+bool
+frenzy::incrementalparser::can_resume(const frenzy::incrementalparser::checkpoint& cp) const
+{
+  // No text was appended to the last children after the checkpoint
+  for (std::vector<checkpoint::target>::const_iterator it = cp.targets.begin();
+       it != cp.targets.end();
+       ++it)
+  {
+    if (is_text(it->lastchild) && text_length(it->lastchild) != it->length)
+      return false;
+  }
+
+  // Nor the html element, which the new nodes can't be inserted
+  // before
+  const checkpoint::target& root = cp.targets.front();
+  for (dom::Nodep n = root.lastchild ? root.lastchild->get_nextSibling() : doc->get_firstChild();
+       n;
+       n = n->get_nextSibling())
+  {
+    if (n->get_nodeType() == dom::Node::ELEMENT_NODE)
+      return false;
+  }
+
+  return true;
+}
+
+bool
+frenzy::incrementalparser::same_state(const frenzy::incrementalparser::checkpoint& old,
+				      const frenzy::incrementalparser::checkpoint& cp)
+{
+  // The text after the checkpoints is tokenized the same if the
+  // tokenizer is in the same state, including the last start tag
+  // name used by the text states
+  if (old.state != cp.state ||
+      (cp.state != parser::htmltokenizer::STATE_DATA && old.last_start_tag != cp.last_start_tag) ||
+      !old.tree.same_state(cp.tree) ||
+      old.targets.size() != cp.targets.size())
+    return false;
+
+  // The nodes from before the checkpoint parsing continued from are
+  // the same, and the old nodes created after it correspond to new
+  // ones one to one
+  std::vector<parser::treesink::handle> oldnodes = old.tree.handles();
+  std::vector<parser::treesink::handle> newnodes = cp.tree.handles();
+  for (size_t i = 0; i < old.targets.size(); ++i)
+  {
+    oldnodes.push_back(old.targets[i].node);
+    newnodes.push_back(cp.targets[i].node);
+  }
+
+  nodemap_t map;
+  nodemap_t back;
+  for (size_t i = 0; i < oldnodes.size(); ++i)
+  {
+    dom::Node* o = static_cast<dom::Node*>(oldnodes[i]);
+    dom::Node* n = static_cast<dom::Node*>(newnodes[i]);
+    if (!o || !n || earlier.count(o) || earlier.count(n))
+    {
+      if (o != n)
+	return false;
+      continue;
+    }
+
+    if ((map.count(o) && map[o] != n) || (back.count(n) && back[n] != o))
+      return false;
+    map[o] = n;
+    back[n] = o;
+  }
+
+  for (size_t i = 0; i < old.targets.size(); ++i)
+  {
+    const checkpoint::target& o = old.targets[i];
+
+    // The old tokens after the checkpoint appended no text to the
+    // last child
+    if (is_text(o.lastchild) && text_length(o.lastchild) != o.length)
+      return false;
+
+    dom::Node* tail;
+    if (earlier.count(o.node))
+    {
+      // The tail is after the old nodes appended after the
+      // checkpoint continued from
+      const checkpoint::target* from = NULL;
+      for (size_t j = 0; j < resumed->targets.size(); ++j)
+      {
+	if (resumed->targets[j].node == o.node)
+	  from = &resumed->targets[j];
+      }
+      if (!from)
+	return false;
+
+      tail = o.lastchild == from->lastchild ? sink.marker(o.node) : o.lastchild->get_nextSibling().get();
+    }
+    else
+      tail = o.lastchild ? o.lastchild->get_nextSibling().get() : o.node->get_firstChild().get();
+
+    // Text after the old last child would have been appended to the
+    // new one
+    if (is_text(tail) && is_text(cp.targets[i].lastchild))
+      return false;
+  }
+
+  replaced.swap(map);
+  return true;
+}
+
+void
+frenzy::incrementalparser::drop_checkpoints()
+{
+  // Parsing can't continue before the records that did not only
+  // append, as the tree before them has changed
+  if (resumable > 0)
+    initial.reset();
+  for (size_t i = 0; i + 1 < resumable; ++i)
+  {
+    records[i].cp.reset();
+  }
+}
+
+size_t
+frenzy::incrementalparser::to_new(size_t oldpos) const
+{
+  return oldpos - old_edit_end + new_edit_end;
+}
@@ -0,0 +1,222 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+
+#ifndef FRENZY_INCREMENTALPARSER_HPP
+#define FRENZY_INCREMENTALPARSER_HPP
+
+#include <map>
+#include <set>
+#include <vector>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include "dom/pointers.hpp"
+#include "chardecoder.hpp"
+#include "htmltokenizer.hpp"
+#include "treeconstructor.hpp"
+#include "treesink.hpp"
+
+namespace frenzy
+{
+  /*
+   * incrementalparser keeps a Document in sync with a buffer of HTML
+   * that is edited, as in a live preview. After an edit, the nodes
+   * outside the edited part keep their identity, and so their layout
+   * results.
+   *
+   * After each token other than a character, the state of the
+   * tokenizer and of tree construction is checkpointed, with the
+   * last child of each node tree construction can append to. On an
+   * edit, parsing continues from the last checkpoint before the
+   * edit, directly on the document: the nodes added after the
+   * checkpoint are left where they are, and the new nodes are
+   * inserted before them.
+   *
+   * When a new token ends at the same place in the unchanged text
+   * after the edit as an old checkpointed token did, and leaves the
+   * tokenizer and tree construction in the same state, with the
+   * newly created elements in place of the old ones, parsing has
+   * re-synchronized. The nodes that the old tokens after that point
+   * appended to the old elements are moved to the new ones, and only
+   * the old nodes between the two checkpoints are patched to match
+   * the new nodes with as few DOM mutations as possible. Subtrees
+   * equal to the new ones are left alone, nodes of the same kind are
+   * updated in place and the rest are replaced.
+   *
+   * Parsing can only continue from a checkpoint when the tokens
+   * after it just appended nodes and text, and created no html
+   * element. Otherwise, as before a misnested tag or table content
+   * moved out of a table, the whole input is parsed to a scratch
+   * document, and the document is patched to match it.
+   *
+   * The document must not be changed other than through the
+   * incremental parser.
+   */
+  struct incrementalparser : private boost::noncopyable
+  {
+    explicit incrementalparser(dom::Documentp doc);
+
+    // Parses the whole input and makes the document match it.
+    void parse(const bytestring& input);
+
+    // Replaces `removed' bytes at `offset' of the current input with
+    // `inserted' and updates the document. Throws std::out_of_range
+    // if the range is not within the current input.
+    void edit(size_t offset, size_t removed, const bytestring& inserted);
+
+    const bytestring& input() const;
+
+    // Returns the number of characters the tokenizer consumed in the
+    // last parse or edit.
+    size_t tokenized_characters() const;
+
+  private:
+    typedef std::map<dom::Node*, dom::Node*> nodemap_t;
+
+    dom::Documentp doc;
+    bytestring bytes;
+    // The input decoded and preprocessed
+    ustring text;
+
+    // Builds the tree to the document or to a scratch document, and
+    // tells when tree construction does something else than append
+    // new nodes and text.
+    struct livesink : parser::domsink
+    {
+      explicit livesink(dom::Documentp doc);
+
+      virtual void append(handle parent, handle child);
+      virtual void insert_before(handle parent, handle child, handle sibling);
+      virtual void append_text(handle parent, const ustring& text);
+      virtual void insert_text_before(handle parent, handle sibling, const ustring& text);
+      virtual void remove_from_parent(handle node);
+      virtual void reparent_children(handle node, handle newparent);
+      virtual void add_attributes_if_missing(handle element, const attributes_t& attributes);
+
+      // Nodes appended to the keys are inserted before the values,
+      // the first children left from the previous parse
+      nodemap_t markers;
+      // When continuing from a checkpoint, the nodes from before it
+      // that tree construction can refer to
+      const std::set<dom::Node*>* earlier;
+      // Set when tree construction does something else than append
+      bool rearranged;
+      // Set when a node from before the checkpoint is moved or
+      // removed
+      bool moved_earlier;
+
+      // Returns the marker of parent, or NULL
+      dom::Node* marker(handle parent) const;
+      // Returns the last child of parent before the marker
+      dom::Node* last_child(handle parent) const;
+
+    private:
+      bool is_earlier(handle node) const;
+    };
+
+    parser::htmltokenizer tok;
+    livesink sink;
+    parser::treeconstructor tree;
+
+    // The state after a token other than a character
+    struct checkpoint
+    {
+      parser::treeconstructor::checkpoint tree;
+      parser::htmltokenizer::tokenizestate state;
+      ustring last_start_tag;
+
+      // The document and the nodes tree construction can append to,
+      // with their last child and its length if it is a text node.
+      // The children after the last child were added after the
+      // checkpoint.
+      struct target
+      {
+	dom::Node* node;
+	dom::Node* lastchild;
+	size_t length;
+      };
+      std::vector<target> targets;
+
+      // Refers to the nodes the given nodes are mapped to instead
+      void remap(const nodemap_t& map);
+    };
+    typedef boost::shared_ptr<checkpoint> checkpointp;
+
+    // A token of the previous parse. Consecutive characters are kept
+    // as a single run.
+    struct record
+    {
+      parser::token_type type;
+      // The position in text after the token
+      size_t end;
+      // Set if tree construction did something else than append for
+      // the token
+      bool rearranges;
+      checkpointp cp;
+
+      explicit record(parser::token_type type);
+    };
+    typedef std::vector<record> records_t;
+    records_t records;
+    records_t newrecords;
+    // The state before the first token
+    checkpointp initial;
+    // The first record that parsing can continue before. The
+    // records before it did not only append to the tree.
+    size_t resumable;
+
+    ustring last_start_tag;
+    // Set once tree construction has done something else than append
+    // since tokenization started. The nodes a checkpoint refers to
+    // may then be out of the tree.
+    bool rearranged;
+    // Where the current tokenization started in the text
+    size_t base;
+    size_t tokenized;
+
+    // The edited part of the text, in the old and in the new text
+    size_t old_edit_end;
+    size_t new_edit_end;
+
+    // Set while continuing from a checkpoint
+    bool resuming;
+    // The old record parsing re-synchronized at, or the number of
+    // records
+    size_t resync;
+    // The first old record that can still be a re-synchronization
+    // point
+    size_t scan;
+    // The checkpoint parsing continued from
+    checkpointp resumed;
+    // The nodes from before the checkpoint that tree construction
+    // can refer to, see livesink
+    std::set<dom::Node*> earlier;
+    // The old nodes the re-synchronization point refers to, and the
+    // new nodes in their place
+    nodemap_t replaced;
+
+    void update(const bytestring& input);
+    void reparse(const ustring& newtext);
+    bool resume(size_t prefix, const ustring& newtext);
+    void tokenize(const ustring& newtext, size_t start);
+    void process_token(const parser::token& t);
+    checkpointp save();
+    bool can_resume(const checkpoint& cp) const;
+    bool same_state(const checkpoint& old, const checkpoint& cp);
+    void drop_checkpoints();
+    size_t to_new(size_t oldpos) const;
+  };
+}
+
+#endif
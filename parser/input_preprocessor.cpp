@@ -27,10 +27,25 @@ void
 frenzy::parser::input_preprocessor::pass_characters(const frenzy::urope& input)
 {
   std::for_each(input.begin(), input.end(), boost::bind(&input_preprocessor::process_one, this, _1));
+
+  // Nothing is passed for input that was only a BOM, as an empty
+  // result means end-of-file
+  if (result_buffer.empty() && !input.empty())
+    return;
+
   completed(result_buffer);
   result_buffer.clear();
 }
 
+void
+frenzy::parser::input_preprocessor::reset()
+{
+  completed_items.clear();
+  result_buffer.clear();
+  beginning = true;
+  prev_was_cr = false;
+}
+
 frenzy::urope
 frenzy::parser::input_preprocessor::complete_characters()
 {
@@ -22,12 +22,14 @@
 namespace frenzy
 {
   /*
-   * Parser stages are constructed once _per_bytestream_. A
-   * constructed parser stage contains parser state that needs to be
-   * refreshed.
+   * Parser stages hold the parser state of one bytestream at a
+   * time. A stage is either constructed per bytestream, or reset()
+   * between bytestreams. Resetting clears the parser state but keeps
+   * the attached destination and the allocated buffers, so that
+   * parsing many documents doesn't construct the stages again.
    *
-   * Note that Javascript document.open() also requires new parser
-   * stage objects.
+   * Note that Javascript document.open() also requires fresh parser
+   * stages.
    *
    * Parser stage interface: pass_*() takes a sequence of input
    * datums. Any completed results are stored and can be fetched with
@@ -60,6 +62,7 @@ namespace frenzy
       input_preprocessor();
 
       void pass_characters(const urope& input);
+      void reset();
 
       urope complete_characters();
       void attach_destination(boost::function<void (const urope&)> dest);
@@ -0,0 +1,32 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+#include "markup.hpp"
+#include "htmlnames.hpp"
+#include "util/stringlist.hpp"
+
+namespace
+{
+  const frenzy::stringlist voidelems =
+    frenzy::stringlist(frenzy::html::area) + frenzy::html::base + frenzy::html::br +
+    frenzy::html::col + frenzy::html::embed + frenzy::html::hr + frenzy::html::img +
+    frenzy::html::input + frenzy::html::keygen + frenzy::html::link +
+    frenzy::html::meta + frenzy::html::param + frenzy::html::source +
+    frenzy::html::track + frenzy::html::wbr;
+}
+
+bool
+frenzy::parser::is_void_element(const frenzy::ustring& name)
+{
+  return voidelems.contains(name);
+}
@@ -0,0 +1,72 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+#ifndef FRENZY_MARKUP_HPP
+#define FRENZY_MARKUP_HPP
+
+#include "util/unicode.hpp"
+#include "chardecoder.hpp"
+
+namespace frenzy
+{
+  namespace parser
+  {
+    // Facts of the HTML syntax and of the UTF-8 encoding shared by
+    // the stages that write HTML or count input bytes.
+
+    // HTML5 8.1.2 void elements, that have no end tag
+    bool is_void_element(const ustring& name);
+
+    // Returns the number of bytes in the UTF-8 encoding of a code
+    // point
+    inline size_t utf8_length(uchar c)
+    {
+      if (c < 0x80)
+	return 1;
+      if (c < 0x800)
+	return 2;
+      if (c < 0x10000)
+	return 3;
+      return 4;
+    }
+
+    // Appends the UTF-8 encoding of a code point
+    inline void append_utf8(bytestring& out, uchar c)
+    {
+      if (c < 0x80)
+      {
+	out.push_back(c);
+      }
+      else if (c < 0x800)
+      {
+	out.push_back(0xC0 | (c >> 6));
+	out.push_back(0x80 | (c & 0x3F));
+      }
+      else if (c < 0x10000)
+      {
+	out.push_back(0xE0 | (c >> 12));
+	out.push_back(0x80 | ((c >> 6) & 0x3F));
+	out.push_back(0x80 | (c & 0x3F));
+      }
+      else
+      {
+	out.push_back(0xF0 | (c >> 18));
+	out.push_back(0x80 | ((c >> 12) & 0x3F));
+	out.push_back(0x80 | ((c >> 6) & 0x3F));
+	out.push_back(0x80 | (c & 0x3F));
+      }
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,124 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+
+#include <stdexcept>
+#include <algorithm>
+#include <boost/bind.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/thread.hpp>
+
+#include "parsemany.hpp"
+#include "htmlparser.hpp"
+#include "dom/document.hpp"
+
+namespace
+{
+  // The inputs and results shared by the worker threads
+  struct parse_queue : private boost::noncopyable
+  {
+    parse_queue(const std::vector<frenzy::bytestring>& inputs,
+		const frenzy::parser::treeoptions& options)
+      : inputs(inputs)
+      , results(inputs.size())
+      , options(options)
+      , next(0)
+    {
+    }
+
+    const std::vector<frenzy::bytestring>& inputs;
+    // Each result is written by one thread only
+    std::vector<frenzy::dom::Documentp> results;
+    const frenzy::parser::treeoptions& options;
+    std::string error;
+
+    // Takes the index of the next input to parse. Returns false when
+    // all inputs have been taken.
+    bool take(size_t& idx)
+    {
+      boost::mutex::scoped_lock lock(mutex);
+      if (next == inputs.size())
+	return false;
+
+      idx = next++;
+      return true;
+    }
+
+    void failed(const std::string& what)
+    {
+      boost::mutex::scoped_lock lock(mutex);
+      if (error.empty())
+	error = what;
+    }
+
+  private:
+    boost::mutex mutex;
+    size_t next;
+  };
+
+  void parse_worker(parse_queue* queue)
+  {
+    size_t idx;
+    if (!queue->take(idx))
+      return;
+
+    frenzy::dom::Documentp doc = frenzy::dom::Document::create();
+    frenzy::htmlparser parser(doc, queue->options);
+
+    while (true)
+    {
+      try
+      {
+	if (!queue->inputs[idx].empty())
+	  parser.pass_bytes(queue->inputs[idx]);
+	parser.pass_eof();
+	queue->results[idx] = doc;
+      }
+      catch (const std::exception& e)
+      {
+	queue->failed(e.what());
+      }
+
+      if (!queue->take(idx))
+	return;
+
+      doc = frenzy::dom::Document::create();
+      parser.reset(doc);
+    }
+  }
+}
+
+std::vector<frenzy::dom::Documentp>
+frenzy::parse_many(const std::vector<frenzy::bytestring>& inputs, size_t threads,
+		   const frenzy::parser::treeoptions& options)
+{
+  if (threads == 0)
+    threads = std::max(boost::thread::hardware_concurrency(), 1u);
+  threads = std::min(threads, inputs.size());
+
+  parse_queue queue(inputs, options);
+
+  boost::thread_group workers;
+  for (size_t i = 1; i < threads; ++i)
+  {
+    workers.create_thread(boost::bind(&parse_worker, &queue));
+  }
+
+  parse_worker(&queue);
+  workers.join_all();
+
+  if (!queue.error.empty())
+    throw std::runtime_error("Parsing failed: " + queue.error);
+
+  return queue.results;
+}
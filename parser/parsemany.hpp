@@ -0,0 +1,44 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+
+#ifndef FRENZY_PARSEMANY_HPP
+#define FRENZY_PARSEMANY_HPP
+
+#include <vector>
+
+#include "dom/pointers.hpp"
+#include "chardecoder.hpp"
+#include "treeconstructor.hpp"
+
+namespace frenzy
+{
+  /*
+   * Parses each input to a new Document, on the given number of
+   * threads. A thread count of 0 uses one thread per hardware
+   * thread. The calling thread is one of the workers.
+   *
+   * Each thread constructs one htmlparser and resets it for every
+   * document it parses. Inputs are handed out one at a time, so
+   * documents of different sizes even out across the threads. The
+   * documents are returned in the order of the inputs.
+   *
+   * If parsing any input throws, the remaining inputs are still
+   * parsed, and a std::runtime_error is thrown after all threads
+   * have finished.
+   */
+  std::vector<dom::Documentp> parse_many(const std::vector<bytestring>& inputs, size_t threads,
+					 const parser::treeoptions& options = parser::treeoptions());
+}
+
+#endif
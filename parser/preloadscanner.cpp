@@ -0,0 +1,130 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+#include <boost/bind.hpp>
+
+#include "preloadscanner.hpp"
+#include "htmlnames.hpp"
+
+namespace
+{
+  // Attribute names
+  const frenzy::ustring href = "href";
+  const frenzy::ustring src = "src";
+}
+
+frenzy::parser::preload::preload(frenzy::parser::preload::preloadtype type,
+				 frenzy::ustring url)
+  : type(type)
+  , url(url)
+{
+}
+
+frenzy::parser::preloadscanner::preloadscanner()
+  : seen_base(false)
+{
+  tok.attach_destination(boost::bind(&preloadscanner::process_token, this, _1));
+}
+
+void
+frenzy::parser::preloadscanner::pass_characters(const frenzy::urope& input)
+{
+  tok.pass_characters(input);
+}
+
+void
+frenzy::parser::preloadscanner::reset()
+{
+  tok.reset();
+  completed_items.clear();
+  seen_base = false;
+}
+
+frenzy::parser::preloadscanner::preloadsequence_t
+frenzy::parser::preloadscanner::complete_preloads()
+{
+  preloadsequence_t ret;
+  ret.swap(completed_items);
+  return ret;
+}
+
+void
+frenzy::parser::preloadscanner::attach_destination(boost::function<void (const frenzy::parser::preload&)> dest)
+{
+  destination = dest;
+
+  for (preloadsequence_t::const_iterator it = completed_items.begin();
+       it != completed_items.end();
+       ++it)
+  {
+    destination(*it);
+  }
+
+  completed_items.clear();
+}
+
+void
+frenzy::parser::preloadscanner::process_token(const frenzy::parser::token& t)
+{
+  using namespace frenzy::html;
+
+  if (t.type != TOKEN_START_TAG)
+    return;
+
+  if (t.tagname == link)
+  {
+    emit(preload::PRELOAD_LINK, t, href);
+  }
+  else if (t.tagname == script)
+  {
+    emit(preload::PRELOAD_SCRIPT, t, src);
+  }
+  else if (t.tagname == img)
+  {
+    emit(preload::PRELOAD_IMAGE, t, src);
+  }
+  else if (t.tagname == base && !seen_base)
+  {
+    // Only the first base element with a href attribute counts
+    if (t.attributes.count(href))
+    {
+      seen_base = true;
+      emit(preload::PRELOAD_BASE, t, href);
+    }
+  }
+
+  htmltokenizer::tokenizestate s = htmltokenizer::text_state_for(t.tagname);
+  if (s != htmltokenizer::STATE_DATA)
+    tok.change_state(s);
+}
+
+void
+frenzy::parser::preloadscanner::emit(frenzy::parser::preload::preloadtype type,
+				     const frenzy::parser::token& t,
+				     const frenzy::ustring& attr)
+{
+  std::map<ustring, ustring>::const_iterator it = t.attributes.find(attr);
+  if (it == t.attributes.end() || it->second.empty())
+    return;
+
+  preload p(type, it->second);
+
+  if (destination)
+  {
+    destination(p);
+  }
+  else
+  {
+    completed_items.push_back(p);
+  }
+}
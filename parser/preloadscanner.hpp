@@ -0,0 +1,91 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+#ifndef FRENZY_PRELOADSCANNER_HPP
+#define FRENZY_PRELOADSCANNER_HPP
+
+#include <vector>
+#include <boost/function.hpp>
+#include <boost/noncopyable.hpp>
+
+#include "util/unicode.hpp"
+#include "htmltokenizer.hpp"
+
+namespace frenzy
+{
+  namespace parser
+  {
+    /*
+     * A resource reference found by the preload scanner.
+     */
+    struct preload
+    {
+      enum preloadtype
+      {
+	PRELOAD_BASE, // <base href>
+	PRELOAD_LINK, // <link href>
+	PRELOAD_SCRIPT, // <script src>
+	PRELOAD_IMAGE // <img src>
+      };
+
+      preloadtype type;
+      // The attribute value as written, not resolved against the
+      // base URL.
+      ustring url;
+
+      preload(preloadtype type, ustring url);
+    };
+
+    /*
+     * The preload scanner is a secondary tokenizer pass over the
+     * preprocessed input. It reports resource references as soon as
+     * their tags are tokenized, so that fetching them can start
+     * before tree construction reaches them. No DOM nodes are
+     * created.
+     *
+     * There is no tree constructor to change the tokenizer state, so
+     * the scanner switches to the text states itself based on the
+     * start tag name. This is speculative: the result can differ from
+     * the real parse in unusual markup, which only costs a wasted or
+     * missed preload.
+     *
+     * Follows the parser stage interface: input is passed with
+     * pass_characters(), and completed preloads are either stored
+     * for complete_preloads() or passed to the attached destination.
+     */
+    struct preloadscanner : private boost::noncopyable
+    {
+      preloadscanner();
+
+      void pass_characters(const urope& input);
+      void reset();
+
+      typedef std::vector<preload> preloadsequence_t;
+
+      preloadsequence_t complete_preloads();
+      void attach_destination(boost::function<void (const preload&)> dest);
+
+    private:
+      htmltokenizer tok;
+      bool seen_base;
+
+      preloadsequence_t completed_items;
+      boost::function<void (const preload&)> destination;
+
+      void process_token(const token& t);
+      void emit(preload::preloadtype type, const token& t, const ustring& attr);
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,95 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+
+#include "pullparser.hpp"
+
+frenzy::pullevent::pullevent()
+  : type(TEXT)
+  , self_closing(false)
+{
+}
+
+frenzy::pullparser::pullparser(frenzy::pullparser::source_t source)
+  : source(source)
+  , stream(*this)
+{
+}
+
+frenzy::pullparser::status
+frenzy::pullparser::next(frenzy::pullevent& event)
+{
+  while (events.empty())
+  {
+    if (stream.stopped())
+      return FINISHED;
+
+    bytestring chunk;
+    if (!source(chunk))
+      return WOULD_BLOCK;
+
+    if (chunk.empty())
+      stream.pass_eof();
+    else
+      stream.pass_bytes(chunk);
+  }
+
+  event = events.front();
+  events.pop_front();
+  return EVENT;
+}
+
+void
+frenzy::pullparser::doctype(const frenzy::parser::token& t)
+{
+  events.push_back(pullevent());
+  events.back().type = pullevent::DOCTYPE;
+  if (t.doctype_name)
+    events.back().name = *t.doctype_name;
+}
+
+void
+frenzy::pullparser::start_tag(const frenzy::ustring& name,
+			      const frenzy::tokenhandler::attributes_t& attributes,
+			      bool self_closing)
+{
+  events.push_back(pullevent());
+  events.back().type = pullevent::START_TAG;
+  events.back().name = name;
+  events.back().attributes = attributes;
+  events.back().self_closing = self_closing;
+}
+
+void
+frenzy::pullparser::end_tag(const frenzy::ustring& name)
+{
+  events.push_back(pullevent());
+  events.back().type = pullevent::END_TAG;
+  events.back().name = name;
+}
+
+void
+frenzy::pullparser::comment(const frenzy::ustring& data)
+{
+  events.push_back(pullevent());
+  events.back().type = pullevent::COMMENT;
+  events.back().data = data;
+}
+
+void
+frenzy::pullparser::text(const frenzy::ustring& data)
+{
+  events.push_back(pullevent());
+  events.back().type = pullevent::TEXT;
+  events.back().data = data;
+}
@@ -0,0 +1,97 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+
+#ifndef FRENZY_PULLPARSER_HPP
+#define FRENZY_PULLPARSER_HPP
+
+#include <deque>
+#include <boost/function.hpp>
+#include <boost/noncopyable.hpp>
+
+#include "tokenstream.hpp"
+
+namespace frenzy
+{
+  /*
+   * An event of a pullparser. The fields that are not used by the
+   * event type are empty.
+   */
+  struct pullevent
+  {
+    enum eventtype
+    {
+      DOCTYPE,
+      START_TAG,
+      END_TAG,
+      COMMENT,
+      TEXT
+    };
+
+    eventtype type;
+    // Tag or doctype name
+    ustring name;
+    tokenhandler::attributes_t attributes;
+    bool self_closing;
+    // Comment or text
+    ustring data;
+
+    pullevent();
+  };
+
+  /*
+   * A pull interface to the events of a tokenstream, for callers that
+   * drive their own I/O. The consumer asks for the next event, and
+   * the parser asks the byte source for input only when it has no
+   * events left. So the parser never holds more than the events of
+   * one chunk, and the source isn't read faster than the consumer
+   * handles the events.
+   *
+   * The source may also not have bytes available yet, for example
+   * when reading a socket from an event loop. Then next() returns
+   * WOULD_BLOCK, and the consumer calls it again when the source is
+   * ready. The parser stages are resumable state machines, so no
+   * coroutines or threads are needed for this.
+   */
+  struct pullparser : private tokenhandler, private boost::noncopyable
+  {
+    // Returns false if no bytes are available yet. Otherwise stores
+    // the next chunk of bytes, or an empty bytestring at end-of-file,
+    // and returns true.
+    typedef boost::function<bool (bytestring&)> source_t;
+
+    explicit pullparser(source_t source);
+
+    enum status
+    {
+      EVENT, // An event was stored
+      WOULD_BLOCK, // The source has no bytes available
+      FINISHED // All events have been returned
+    };
+
+    status next(pullevent& event);
+
+  private:
+    source_t source;
+    tokenstream stream;
+    std::deque<pullevent> events;
+
+    virtual void doctype(const parser::token& t);
+    virtual void start_tag(const ustring& name, const attributes_t& attributes, bool self_closing);
+    virtual void end_tag(const ustring& name);
+    virtual void comment(const ustring& data);
+    virtual void text(const ustring& data);
+  };
+}
+
+#endif
@@ -0,0 +1,477 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+
+#include <stdexcept>
+#include <boost/bind.hpp>
+
+#include "rewriter.hpp"
+#include "markup.hpp"
+#include "htmlnames.hpp"
+
+namespace
+{
+  using frenzy::parser::append_utf8;
+
+  void append_ascii(frenzy::bytestring& out, const char* str)
+  {
+    while (*str)
+      out.push_back(*str++);
+  }
+}
+
+frenzy::rewriteelement::rewriteelement(const frenzy::parser::token& t)
+  : tagname(t.tagname)
+  , attrs(t.attributes)
+  , self_closing(t.self_closing)
+  , replace_content(false)
+  , removed(false)
+  , unwrapped(false)
+{
+}
+
+const frenzy::ustring&
+frenzy::rewriteelement::name() const
+{
+  return tagname;
+}
+
+const frenzy::rewriteelement::attributes_t&
+frenzy::rewriteelement::attributes() const
+{
+  return attrs;
+}
+
+bool
+frenzy::rewriteelement::has_attribute(const frenzy::ustring& attr) const
+{
+  return attrs.find(attr) != attrs.end();
+}
+
+frenzy::ustring
+frenzy::rewriteelement::get_attribute(const frenzy::ustring& attr) const
+{
+  attributes_t::const_iterator it = attrs.find(attr);
+  if (it == attrs.end())
+    return ustring();
+
+  return it->second;
+}
+
+void
+frenzy::rewriteelement::set_attribute(const frenzy::ustring& attr, const frenzy::ustring& value)
+{
+  attrs[attr] = value;
+}
+
+void
+frenzy::rewriteelement::remove_attribute(const frenzy::ustring& attr)
+{
+  attrs.erase(attr);
+}
+
+void
+frenzy::rewriteelement::before(const frenzy::ustring& markup)
+{
+  markup_before.append(markup);
+}
+
+void
+frenzy::rewriteelement::after(const frenzy::ustring& markup)
+{
+  markup_after.append(markup);
+}
+
+void
+frenzy::rewriteelement::prepend(const frenzy::ustring& markup)
+{
+  markup_prepend.append(markup);
+}
+
+void
+frenzy::rewriteelement::append(const frenzy::ustring& markup)
+{
+  markup_append.append(markup);
+}
+
+void
+frenzy::rewriteelement::set_content(const frenzy::ustring& markup)
+{
+  markup_prepend = markup;
+  markup_append.clear();
+  replace_content = true;
+}
+
+void
+frenzy::rewriteelement::remove()
+{
+  removed = true;
+}
+
+void
+frenzy::rewriteelement::unwrap()
+{
+  unwrapped = true;
+}
+
+frenzy::rewriter::rewriter(frenzy::rewriter::destination_t destination)
+  : destination(destination)
+  , suppressing(0)
+  , eof(false)
+  , textstate(parser::htmltokenizer::STATE_DATA)
+  , foreign_depth(0)
+{
+  dec.attach_destination(boost::bind(&parser::input_preprocessor::pass_characters, &proc, _1));
+  proc.attach_destination(boost::bind(&parser::htmltokenizer::pass_characters, &tok, _1));
+  tok.attach_destination(boost::bind(&rewriter::process_token, this, _1));
+}
+
+void
+frenzy::rewriter::on(const frenzy::ustring& str, frenzy::rewriter::handler_t handler)
+{
+  handlers.push_back(std::make_pair(simpleselector(str), handler));
+}
+
+void
+frenzy::rewriter::pass_bytes(const frenzy::bytestring& str)
+{
+  dec.pass_bytes(str);
+  flush();
+}
+
+void
+frenzy::rewriter::pass_eof()
+{
+  dec.pass_bytes(bytestring());
+  flush();
+}
+
+bool
+frenzy::rewriter::stopped() const
+{
+  return eof;
+}
+
+void
+frenzy::rewriter::flush()
+{
+  if (output.empty())
+    return;
+
+  bytestring out;
+  out.swap(output);
+  destination(out);
+}
+
+void
+frenzy::rewriter::process_token(const frenzy::parser::token& t)
+{
+  switch (t.type)
+  {
+  case parser::TOKEN_CHARACTER:
+    if (!suppressing)
+      write_text(t.character);
+    break;
+  case parser::TOKEN_DOCTYPE:
+    if (!suppressing)
+    {
+      append_ascii(output, "<!DOCTYPE");
+      if (t.doctype_name)
+      {
+	output.push_back(' ');
+	write(*t.doctype_name);
+      }
+      if (t.public_identifier)
+      {
+	append_ascii(output, " PUBLIC \"");
+	write(*t.public_identifier);
+	output.push_back('"');
+      }
+      if (t.system_identifier)
+      {
+	append_ascii(output, t.public_identifier ? " \"" : " SYSTEM \"");
+	write(*t.system_identifier);
+	output.push_back('"');
+      }
+      output.push_back('>');
+    }
+    break;
+  case parser::TOKEN_START_TAG:
+    start_tag(t);
+    break;
+  case parser::TOKEN_END_TAG:
+    end_tag(t);
+    break;
+  case parser::TOKEN_COMMENT:
+    if (!suppressing)
+    {
+      append_ascii(output, "<!--");
+      write(t.comment);
+      append_ascii(output, "-->");
+    }
+    break;
+  case parser::TOKEN_END_OF_FILE:
+    // Elements still open end with the document
+    while (!open.empty())
+    {
+      openelement& e = open.back();
+      if (e.suppress_content)
+	--suppressing;
+      if (!suppressing)
+      {
+	write(e.markup_append);
+	write(e.markup_after);
+      }
+      open.pop_back();
+    }
+    eof = true;
+    break;
+  default:
+    throw std::logic_error("Unknown token type");
+  }
+}
+
+void
+frenzy::rewriter::start_tag(const frenzy::parser::token& t)
+{
+  using namespace frenzy::html;
+
+  for (std::vector<openelement>::iterator it = open.begin();
+       it != open.end();
+       ++it)
+  {
+    if (it->tagname == t.tagname)
+      ++it->nesting;
+  }
+
+  bool foreign = foreign_depth > 0 || t.tagname == svg || t.tagname == math;
+  bool has_end = !parser::is_void_element(t.tagname) && !(foreign && t.self_closing);
+
+  if (suppressing)
+  {
+    switch_state(t);
+    return;
+  }
+
+  rewriteelement el(t);
+  for (size_t i = 0; i < handlers.size(); ++i)
+  {
+    if (handlers[i].first.matches(t.tagname, t.attributes))
+      handlers[i].second(el);
+  }
+
+  write(el.markup_before);
+  if (!el.removed && !el.unwrapped)
+    write_start_tag(el.tagname, el.attrs, el.self_closing);
+
+  if (!has_end)
+  {
+    write(el.markup_after);
+    switch_state(t);
+    return;
+  }
+
+  if (!el.removed)
+    write(el.markup_prepend);
+
+  openelement e;
+  e.tagname = t.tagname;
+  e.nesting = 0;
+  e.suppress_content = el.removed || el.replace_content;
+  e.suppress_end_tag = el.removed || el.unwrapped;
+  if (!el.removed)
+    e.markup_append = el.markup_append;
+  e.markup_after = el.markup_after;
+
+  if (e.suppress_content || e.suppress_end_tag ||
+      !e.markup_append.empty() || !e.markup_after.empty())
+  {
+    if (e.suppress_content)
+      ++suppressing;
+    open.push_back(e);
+  }
+
+  switch_state(t);
+}
+
+void
+frenzy::rewriter::end_tag(const frenzy::parser::token& t)
+{
+  if (foreign_depth > 0 && t.tagname == foreign_root)
+    --foreign_depth;
+  textstate = parser::htmltokenizer::STATE_DATA;
+
+  // The open elements with the same name either contain the
+  // element that ends, or are it
+  size_t ending = open.size();
+  for (size_t i = 0; i < open.size(); ++i)
+  {
+    if (open[i].tagname != t.tagname)
+      continue;
+
+    if (open[i].nesting > 0)
+      --open[i].nesting;
+    else
+      ending = i;
+  }
+
+  bool end_tag_written = false;
+
+  // Elements opened inside the ending one end with it
+  while (ending < open.size())
+  {
+    openelement& e = open.back();
+    bool last = open.size() == ending + 1;
+
+    if (e.suppress_content)
+      --suppressing;
+
+    if (!suppressing)
+    {
+      write(e.markup_append);
+      if (last && !e.suppress_end_tag)
+      {
+	append_ascii(output, "</");
+	write(t.tagname);
+	output.push_back('>');
+      }
+      write(e.markup_after);
+    }
+
+    open.pop_back();
+    end_tag_written = last;
+  }
+
+  if (!end_tag_written && !suppressing)
+  {
+    append_ascii(output, "</");
+    write(t.tagname);
+    output.push_back('>');
+  }
+}
+
+void
+frenzy::rewriter::switch_state(const frenzy::parser::token& t)
+{
+  using namespace frenzy::html;
+
+  // As in tokenstream
+  if (foreign_depth == 0 && (t.tagname == svg || t.tagname == math))
+  {
+    if (!t.self_closing)
+    {
+      foreign_root = t.tagname;
+      foreign_depth = 1;
+    }
+  }
+  else if (foreign_depth > 0)
+  {
+    if (t.tagname == foreign_root && !t.self_closing)
+      ++foreign_depth;
+  }
+  else
+  {
+    parser::htmltokenizer::tokenizestate s = parser::htmltokenizer::text_state_for(t.tagname);
+    if (s != parser::htmltokenizer::STATE_DATA)
+    {
+      tok.change_state(s);
+      textstate = s;
+    }
+  }
+}
+
+void
+frenzy::rewriter::write(const frenzy::ustring& str)
+{
+  for (ustring::const_iterator it = str.begin();
+       it != str.end();
+       ++it)
+  {
+    append_utf8(output, *it);
+  }
+}
+
+void
+frenzy::rewriter::write_text(frenzy::uchar c)
+{
+  // HTML5 8.4 "Serializing HTML fragments". Text in raw text
+  // elements is written as is.
+  if (textstate != parser::htmltokenizer::STATE_DATA &&
+      textstate != parser::htmltokenizer::STATE_RCDATA)
+  {
+    append_utf8(output, c);
+    return;
+  }
+
+  switch (c)
+  {
+  case '&':
+    append_ascii(output, "&amp;");
+    break;
+  case '<':
+    append_ascii(output, "&lt;");
+    break;
+  case '>':
+    append_ascii(output, "&gt;");
+    break;
+  case 0xA0:
+    append_ascii(output, "&nbsp;");
+    break;
+  default:
+    append_utf8(output, c);
+  }
+}
+
+void
+frenzy::rewriter::write_start_tag(const frenzy::ustring& name,
+				  const frenzy::rewriteelement::attributes_t& attributes,
+				  bool self_closing)
+{
+  output.push_back('<');
+  write(name);
+
+  for (rewriteelement::attributes_t::const_iterator it = attributes.begin();
+       it != attributes.end();
+       ++it)
+  {
+    output.push_back(' ');
+    write(it->first);
+    append_ascii(output, "=\"");
+
+    for (ustring::const_iterator c = it->second.begin();
+	 c != it->second.end();
+	 ++c)
+    {
+      switch (*c)
+      {
+      case '&':
+	append_ascii(output, "&amp;");
+	break;
+      case '"':
+	append_ascii(output, "&quot;");
+	break;
+      case 0xA0:
+	append_ascii(output, "&nbsp;");
+	break;
+      default:
+	append_utf8(output, *c);
+      }
+    }
+
+    output.push_back('"');
+  }
+
+  if (self_closing)
+    output.push_back('/');
+  output.push_back('>');
+}
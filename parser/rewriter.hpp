@@ -0,0 +1,154 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+#ifndef FRENZY_REWRITER_HPP
+#define FRENZY_REWRITER_HPP
+
+#include <map>
+#include <vector>
+#include <boost/function.hpp>
+#include <boost/noncopyable.hpp>
+
+#include "chardecoder.hpp"
+#include "input_preprocessor.hpp"
+#include "htmltokenizer.hpp"
+#include "selector.hpp"
+
+namespace frenzy
+{
+  /*
+   * An element passed to a rewriter handler. The handler can change
+   * the attributes of the start tag, insert markup around and inside
+   * the element, or drop it.
+   *
+   * Inserted content is markup, and is written to the output as
+   * is. The element ends at the matching end tag in the input, or
+   * at the end of the document, as no tree construction is done.
+   * Content inside a void or self-closing element can't be changed.
+   */
+  struct rewriteelement : private boost::noncopyable
+  {
+    typedef std::map<ustring, ustring> attributes_t;
+
+    const ustring& name() const;
+    const attributes_t& attributes() const;
+    bool has_attribute(const ustring& attr) const;
+    // Returns an empty string if the attribute is missing
+    ustring get_attribute(const ustring& attr) const;
+    void set_attribute(const ustring& attr, const ustring& value);
+    void remove_attribute(const ustring& attr);
+
+    void before(const ustring& markup);
+    void after(const ustring& markup);
+    void prepend(const ustring& markup);
+    void append(const ustring& markup);
+    // Replaces the content of the element
+    void set_content(const ustring& markup);
+
+    // Drops the element with its content
+    void remove();
+    // Drops the start and end tags but keeps the content
+    void unwrap();
+
+  private:
+    friend struct rewriter;
+
+    rewriteelement(const parser::token& t);
+
+    ustring tagname;
+    attributes_t attrs;
+    bool self_closing;
+
+    ustring markup_before, markup_after, markup_prepend, markup_append;
+    bool replace_content;
+    bool removed;
+    bool unwrapped;
+  };
+
+  /*
+   * rewriter transforms a document token by token, without building
+   * a DOM. Handlers are registered for simple selectors, see
+   * simpleselector, and are called for each matching start tag.
+   * Everything else is written to the output as it was tokenized,
+   * re-serialized as UTF-8.
+   *
+   * The input goes through the same stages as with htmlparser, and
+   * the tokenizer state changes for elements like script, style and
+   * textarea are applied as in tokenstream. The output of each chunk
+   * is passed to the destination before pass_bytes() returns, so the
+   * memory used does not depend on the document size, only on the
+   * number of matched elements open at the same time. Tokenization
+   * normalizes the markup: attribute values are quoted, character
+   * references are re-escaped only where needed, and the attributes
+   * of a tag are written in sorted order.
+   */
+  struct rewriter : private boost::noncopyable
+  {
+    typedef boost::function<void (const bytestring&)> destination_t;
+    typedef boost::function<void (rewriteelement&)> handler_t;
+
+    explicit rewriter(destination_t destination);
+
+    // Throws std::runtime_error if the selector is invalid
+    void on(const ustring& selector, handler_t handler);
+
+    void pass_bytes(const bytestring& str);
+    void pass_eof();
+
+    // Returns true after end-of-file has been passed
+    bool stopped() const;
+
+  private:
+    // A matched element whose end tag is not seen yet
+    struct openelement
+    {
+      ustring tagname;
+      // Open elements of the same name inside this one
+      size_t nesting;
+      ustring markup_append, markup_after;
+      bool suppress_content;
+      bool suppress_end_tag;
+    };
+
+    parser::utf8_decoder dec;
+    parser::input_preprocessor proc;
+    parser::htmltokenizer tok;
+
+    destination_t destination;
+    std::vector<std::pair<simpleselector, handler_t> > handlers;
+    std::vector<openelement> open;
+    // Number of entries in `open' that suppress their content
+    size_t suppressing;
+    bool eof;
+
+    // Output of the chunk being processed
+    bytestring output;
+
+    // The state text is tokenized in, for escaping
+    parser::htmltokenizer::tokenizestate textstate;
+    size_t foreign_depth;
+    ustring foreign_root;
+
+    void flush();
+    void process_token(const parser::token& t);
+    void start_tag(const parser::token& t);
+    void end_tag(const parser::token& t);
+    void switch_state(const parser::token& t);
+
+    void write(const ustring& str);
+    void write_text(uchar c);
+    void write_start_tag(const ustring& name, const rewriteelement::attributes_t& attributes, bool self_closing);
+  };
+}
+
+#endif
@@ -0,0 +1,219 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+
+#include <stdexcept>
+
+#include "selector.hpp"
+#include "dom/element.hpp"
+
+namespace
+{
+  const frenzy::ustring idattr = "id";
+  const frenzy::ustring classattr = "class";
+
+  bool is_space(frenzy::uchar c)
+  {
+    return c == 0x09 || c == 0x0A || c == 0x0C || c == 0x0D || c == 0x20;
+  }
+
+  // Returns true if the whitespace separated list contains `token'
+  bool contains_token(const frenzy::ustring& list, const frenzy::ustring& token)
+  {
+    size_t i = 0;
+    while (i < list.size())
+    {
+      while (i < list.size() && is_space(list[i]))
+	++i;
+
+      size_t start = i;
+      while (i < list.size() && !is_space(list[i]))
+	++i;
+
+      if (i > start && list.substr(start, i - start) == token)
+	return true;
+    }
+
+    return false;
+  }
+
+  bool is_name_char(frenzy::uchar c)
+  {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+      c == '-' || c == '_' || c >= 0x80;
+  }
+
+  // Reads a name from `str' at `pos', lowercasing ASCII letters if
+  // asked to
+  frenzy::ustring read_name(const frenzy::ustring& str, size_t& pos, bool lowercase)
+  {
+    frenzy::ustring ret;
+    while (pos < str.size() && is_name_char(str[pos]))
+    {
+      frenzy::uchar c = str[pos++];
+      if (lowercase && c >= 'A' && c <= 'Z')
+	c += 0x20;
+      ret.push_back(c);
+    }
+
+    if (ret.empty())
+      throw std::runtime_error("Invalid selector");
+
+    return ret;
+  }
+
+  struct get_from_map
+  {
+    get_from_map(const frenzy::simpleselector::attributes_t& attributes)
+      : attributes(attributes)
+    {
+    }
+
+    boost::optional<frenzy::ustring> operator()(const frenzy::ustring& name) const
+    {
+      frenzy::simpleselector::attributes_t::const_iterator it = attributes.find(name);
+      if (it == attributes.end())
+	return boost::none;
+
+      return it->second;
+    }
+
+    const frenzy::simpleselector::attributes_t& attributes;
+  };
+
+  struct get_from_element
+  {
+    get_from_element(frenzy::dom::Elementp element)
+      : element(element)
+    {
+    }
+
+    boost::optional<frenzy::ustring> operator()(const frenzy::ustring& name) const
+    {
+      return element->getAttribute(name);
+    }
+
+    frenzy::dom::Elementp element;
+  };
+}
+
+frenzy::simpleselector::simpleselector(const frenzy::ustring& str)
+{
+  size_t pos = 0;
+
+  if (str.empty())
+    throw std::runtime_error("Invalid selector");
+
+  if (str[pos] == '*')
+    ++pos;
+  else if (is_name_char(str[pos]))
+    type = read_name(str, pos, true);
+
+  while (pos < str.size())
+  {
+    uchar c = str[pos++];
+
+    if (c == '.')
+    {
+      classes.push_back(read_name(str, pos, false));
+    }
+    else if (c == '#')
+    {
+      ids.push_back(read_name(str, pos, false));
+    }
+    else if (c == '[')
+    {
+      ustring attr = read_name(str, pos, true);
+      boost::optional<ustring> value;
+
+      if (pos < str.size() && str[pos] == '=')
+      {
+	++pos;
+	if (pos < str.size() && (str[pos] == '"' || str[pos] == '\''))
+	{
+	  uchar quote = str[pos++];
+	  ustring v;
+	  while (pos < str.size() && str[pos] != quote)
+	    v.push_back(str[pos++]);
+	  if (pos == str.size())
+	    throw std::runtime_error("Invalid selector");
+	  ++pos;
+	  value = v;
+	}
+	else
+	{
+	  value = read_name(str, pos, false);
+	}
+      }
+
+      if (pos == str.size() || str[pos] != ']')
+	throw std::runtime_error("Invalid selector");
+      ++pos;
+
+      attributes.push_back(std::make_pair(attr, value));
+    }
+    else
+    {
+      throw std::runtime_error("Invalid selector");
+    }
+  }
+}
+
+template <typename GetAttribute>
+bool
+frenzy::simpleselector::matches_with(const frenzy::ustring& name, GetAttribute get) const
+{
+  if (!type.empty() && type != name)
+    return false;
+
+  boost::optional<ustring> value;
+
+  for (size_t i = 0; i < ids.size(); ++i)
+  {
+    value = get(idattr);
+    if (!value || *value != ids[i])
+      return false;
+  }
+
+  for (size_t i = 0; i < classes.size(); ++i)
+  {
+    value = get(classattr);
+    if (!value || !contains_token(*value, classes[i]))
+      return false;
+  }
+
+  for (size_t i = 0; i < attributes.size(); ++i)
+  {
+    value = get(attributes[i].first);
+    if (!value)
+      return false;
+
+    if (attributes[i].second && *value != *attributes[i].second)
+      return false;
+  }
+
+  return true;
+}
+
+bool
+frenzy::simpleselector::matches(const frenzy::ustring& name,
+				const frenzy::simpleselector::attributes_t& attributes) const
+{
+  return matches_with(name, get_from_map(attributes));
+}
+
+bool
+frenzy::simpleselector::matches(frenzy::dom::Elementp element) const
+{
+  return matches_with(element->get_localName(), get_from_element(element));
+}
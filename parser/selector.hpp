@@ -0,0 +1,57 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+
+#ifndef FRENZY_SELECTOR_HPP
+#define FRENZY_SELECTOR_HPP
+
+#include <map>
+#include <vector>
+#include <boost/optional.hpp>
+
+#include "util/unicode.hpp"
+#include "dom/pointers.hpp"
+
+namespace frenzy
+{
+  /*
+   * A compound selector of a type or *, and any number of .class,
+   * #id, [attr] and [attr=value] parts, like "a[href]" or
+   * "div.note". Combinators are not supported, so a selector can be
+   * matched against an element without looking at the rest of the
+   * tree. Type and attribute names are matched ASCII
+   * case-insensitively, as for HTML elements.
+   */
+  struct simpleselector
+  {
+    typedef std::map<ustring, ustring> attributes_t;
+
+    // Throws std::runtime_error if the selector is invalid
+    explicit simpleselector(const ustring& str);
+
+    // Matches a start tag token with the given name and attributes
+    bool matches(const ustring& name, const attributes_t& attributes) const;
+    bool matches(dom::Elementp element) const;
+
+  private:
+    ustring type;
+    std::vector<ustring> classes;
+    std::vector<ustring> ids;
+    std::vector<std::pair<ustring, boost::optional<ustring> > > attributes;
+
+    template <typename GetAttribute>
+    bool matches_with(const ustring& name, GetAttribute get) const;
+  };
+}
+
+#endif
@@ -0,0 +1,333 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <unistd.h>
+#include <boost/bind.hpp>
+#include <boost/ref.hpp>
+
+#include "serializer.hpp"
+#include "markup.hpp"
+#include "htmlnames.hpp"
+#include "util/stringlist.hpp"
+#include "dom/node.hpp"
+#include "dom/element.hpp"
+#include "dom/document.hpp"
+#include "dom/text.hpp"
+
+namespace
+{
+  // Elements whose text is written without escaping. noscript is
+  // not included, as there is no scripting.
+  const frenzy::stringlist rawtextelems =
+    frenzy::stringlist(frenzy::html::style) + frenzy::html::script + frenzy::html::xmp +
+    frenzy::html::iframe + frenzy::html::noembed + frenzy::html::noframes +
+    frenzy::html::plaintext;
+
+  // Elements where the parser drops a newline right after the start
+  // tag, so one is written to keep a leading newline of the content
+  const frenzy::stringlist newlineelems =
+    frenzy::stringlist(frenzy::html::pre) + frenzy::html::textarea + frenzy::html::listing;
+
+  void append_to(frenzy::bytestring& out, const frenzy::bytestring& chunk)
+  {
+    out.append(chunk);
+  }
+
+  struct fdsink
+  {
+    fdsink(int fd)
+      : fd(fd)
+    {}
+
+    void operator()(const frenzy::bytestring& chunk) const
+    {
+      size_t done = 0;
+      while (done < chunk.size())
+      {
+	ssize_t n = ::write(fd, chunk.data() + done, chunk.size() - done);
+	if (n < 0)
+	{
+	  if (errno == EINTR)
+	    continue;
+	  throw std::runtime_error(std::string("write: ") + std::strerror(errno));
+	}
+
+	done += n;
+      }
+    }
+
+    int fd;
+  };
+}
+
+frenzy::serializer::serializer(frenzy::serializer::destination_t destination, size_t chunksize)
+  : destination(destination)
+  , chunksize(chunksize)
+{
+}
+
+void
+frenzy::serializer::write_node(frenzy::dom::Nodep node)
+{
+  dom::Node::nodeType type = node->get_nodeType();
+  if (type == dom::Node::DOCUMENT_NODE || type == dom::Node::DOCUMENT_FRAGMENT_NODE)
+  {
+    write_children(node);
+    return;
+  }
+
+  if (write_start(node))
+  {
+    write_children(node);
+    write_end_tag(static_cast<dom::Element*>(node.get())->get_localName());
+  }
+}
+
+void
+frenzy::serializer::write_children(frenzy::dom::Nodep node)
+{
+  dom::Nodep n = node->get_firstChild();
+  while (n)
+  {
+    if (write_start(n))
+    {
+      n = n->get_firstChild();
+      continue;
+    }
+
+    // Climb to the next sibling, ending the elements on the way
+    while (!n->get_nextSibling())
+    {
+      n = n->get_parentNode();
+      if (n == node)
+	return;
+
+      write_end_tag(static_cast<dom::Element*>(n.get())->get_localName());
+    }
+
+    n = n->get_nextSibling();
+  }
+}
+
+void
+frenzy::serializer::flush()
+{
+  if (buffer.empty())
+    return;
+
+  destination(buffer);
+  buffer.clear();
+}
+
+bool
+frenzy::serializer::write_start(frenzy::dom::Nodep n)
+{
+  switch (n->get_nodeType())
+  {
+  case dom::Node::ELEMENT_NODE:
+  {
+    const dom::Element* e = static_cast<dom::Element*>(n.get());
+    const ustring& name = e->get_localName();
+
+    buffer.push_back('<');
+    write(name, ESCAPE_NONE);
+
+    const dom::Element::attributes_t& attributes = e->get_attributeMap();
+    for (dom::Element::attributes_t::const_iterator it = attributes.begin();
+	 it != attributes.end();
+	 ++it)
+    {
+      buffer.push_back(' ');
+      write(it->first, ESCAPE_NONE);
+      write_ascii("=\"");
+      // The value is the data of the text children of the attribute
+      for (dom::Nodep t = it->second->get_firstChild(); t; t = t->get_nextSibling())
+	write(static_cast<dom::CharacterData*>(t.get())->get_data(), ESCAPE_ATTRIBUTE);
+      buffer.push_back('"');
+    }
+
+    buffer.push_back('>');
+
+    if (parser::is_void_element(name))
+      return false;
+
+    dom::Nodep first = n->get_firstChild();
+    if (!first)
+    {
+      write_end_tag(name);
+      return false;
+    }
+
+    if (first->get_nodeType() == dom::Node::TEXT_NODE && newlineelems.contains(name))
+    {
+      const ustring& data = static_cast<dom::CharacterData*>(first.get())->get_data();
+      if (!data.empty() && data[0] == '\n')
+	buffer.push_back('\n');
+    }
+
+    return true;
+  }
+
+  case dom::Node::TEXT_NODE:
+  case dom::Node::CDATA_SECTION_NODE:
+  {
+    escapemode mode = ESCAPE_TEXT;
+    dom::Nodep parent = n->get_parentNode();
+    if (parent && parent->get_nodeType() == dom::Node::ELEMENT_NODE &&
+	rawtextelems.contains(static_cast<dom::Element*>(parent.get())->get_localName()))
+    {
+      mode = ESCAPE_NONE;
+    }
+
+    write(static_cast<dom::CharacterData*>(n.get())->get_data(), mode);
+    break;
+  }
+
+  case dom::Node::COMMENT_NODE:
+    write_ascii("<!--");
+    write(static_cast<dom::CharacterData*>(n.get())->get_data(), ESCAPE_NONE);
+    write_ascii("-->");
+    break;
+
+  case dom::Node::DOCUMENT_TYPE_NODE:
+    write_ascii("<!DOCTYPE ");
+    write(static_cast<dom::DocumentType*>(n.get())->get_name(), ESCAPE_NONE);
+    buffer.push_back('>');
+    break;
+
+  case dom::Node::ATTRIBUTE_NODE:
+    // Attributes are written with their element
+    break;
+
+  default:
+    // No node of the other types exists: this DOM creates no
+    // processing instruction, entity or notation nodes, and documents
+    // and fragments are never children
+    break;
+  }
+
+  if (buffer.size() >= chunksize)
+    flush();
+
+  return false;
+}
+
+void
+frenzy::serializer::write_end_tag(const frenzy::ustring& name)
+{
+  write_ascii("</");
+  write(name, ESCAPE_NONE);
+  buffer.push_back('>');
+
+  if (buffer.size() >= chunksize)
+    flush();
+}
+
+void
+frenzy::serializer::write(const frenzy::ustring& str, frenzy::serializer::escapemode mode)
+{
+  ustring::const_iterator it = str.begin();
+  ustring::const_iterator end = str.end();
+
+  while (it != end)
+  {
+    // Copy the run of ASCII characters that need no escaping
+    ustring::const_iterator run = it;
+    while (run != end && *run < 0x80)
+    {
+      uchar c = *run;
+      if (mode != ESCAPE_NONE && c == '&')
+	break;
+      if (mode == ESCAPE_TEXT && (c == '<' || c == '>'))
+	break;
+      if (mode == ESCAPE_ATTRIBUTE && c == '"')
+	break;
+      ++run;
+    }
+
+    if (run != it)
+    {
+      size_t offset = buffer.size();
+      buffer.resize(offset + (run - it));
+      for (byte* out = &buffer[offset]; it != run; ++it, ++out)
+	*out = *it;
+
+      if (it == end)
+	break;
+    }
+
+    uchar c = *it++;
+    if (mode == ESCAPE_NONE)
+    {
+      parser::append_utf8(buffer, c);
+      continue;
+    }
+
+    switch (c)
+    {
+    case '&':
+      write_ascii("&amp;");
+      break;
+    case '<':
+      write_ascii("&lt;");
+      break;
+    case '>':
+      write_ascii("&gt;");
+      break;
+    case '"':
+      write_ascii("&quot;");
+      break;
+    case 0xA0:
+      write_ascii("&nbsp;");
+      break;
+    default:
+      parser::append_utf8(buffer, c);
+      break;
+    }
+  }
+}
+
+void
+frenzy::serializer::write_ascii(const char* str)
+{
+  buffer.append(reinterpret_cast<const byte*>(str), std::strlen(str));
+}
+
+frenzy::bytestring
+frenzy::outer_html(frenzy::dom::Nodep node)
+{
+  bytestring ret;
+  serializer out(boost::bind(&append_to, boost::ref(ret), _1));
+  out.write_node(node);
+  out.flush();
+  return ret;
+}
+
+frenzy::bytestring
+frenzy::inner_html(frenzy::dom::Nodep node)
+{
+  bytestring ret;
+  serializer out(boost::bind(&append_to, boost::ref(ret), _1));
+  out.write_children(node);
+  out.flush();
+  return ret;
+}
+
+frenzy::serializer::destination_t
+frenzy::fd_destination(int fd)
+{
+  return fdsink(fd);
+}
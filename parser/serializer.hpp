@@ -0,0 +1,86 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+#ifndef FRENZY_SERIALIZER_HPP
+#define FRENZY_SERIALIZER_HPP
+
+#include <boost/function.hpp>
+#include <boost/noncopyable.hpp>
+
+#include "dom/pointers.hpp"
+#include "chardecoder.hpp"
+
+namespace frenzy
+{
+  /*
+   * HTML5 8.4 "Serializing HTML fragments"
+   *
+   * Writes a DOM subtree out as HTML, encoded to UTF-8 directly into
+   * an output buffer. The buffer is passed to the destination each
+   * time it reaches the chunk size, and by flush(), so the memory
+   * used does not depend on the document size. Text is escaped a
+   * run at a time: a run of characters that need no escaping is
+   * copied in one go.
+   *
+   * Elements are written with their local names and attributes in
+   * the order the element keeps them. Text in raw text elements like
+   * script and style is written as is, and void elements have no end
+   * tag. The walk is iterative, so deep trees don't exhaust the
+   * stack.
+   */
+  struct serializer : private boost::noncopyable
+  {
+    typedef boost::function<void (const bytestring&)> destination_t;
+
+    explicit serializer(destination_t destination, size_t chunksize = 65536);
+
+    // Writes the node and its descendants, as outerHTML. Documents
+    // and fragments write their children only.
+    void write_node(dom::Nodep node);
+    // Writes the descendants of the node, as innerHTML
+    void write_children(dom::Nodep node);
+
+    // Passes the buffered output to the destination
+    void flush();
+
+  private:
+    enum escapemode
+    {
+      ESCAPE_NONE,
+      ESCAPE_TEXT,
+      ESCAPE_ATTRIBUTE
+    };
+
+    destination_t destination;
+    size_t chunksize;
+    bytestring buffer;
+
+    // Writes the start of a node. Returns true if the node is an
+    // element with children to write before its end tag.
+    bool write_start(dom::Nodep n);
+    void write_end_tag(const ustring& name);
+
+    void write(const ustring& str, escapemode mode);
+    void write_ascii(const char* str);
+  };
+
+  // Serializes to a bytestring
+  bytestring outer_html(dom::Nodep node);
+  bytestring inner_html(dom::Nodep node);
+
+  // A destination that writes to a blocking file descriptor. Write
+  // errors throw std::runtime_error. The descriptor is not closed.
+  serializer::destination_t fd_destination(int fd);
+}
+
+#endif
@@ -0,0 +1,227 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+
+#include <vector>
+#include <stdexcept>
+#include <boost/bind.hpp>
+#include <boost/thread.hpp>
+
+#include "speculativetokenizer.hpp"
+
+struct frenzy::parser::speculative_tokenizer::speculation
+{
+  std::vector<token> tokens;
+  // For each token, the characters consumed from the chunk when
+  // the token was emitted, the tokenizer state at that time, and
+  // the state after switching to the text states.
+  std::vector<size_t> ends;
+  std::vector<htmltokenizer::tokenizestate> emitstates;
+  std::vector<htmltokenizer::tokenizestate> afterstates;
+  // True if the tokenizer was between tokens at the end of the chunk
+  bool clean;
+
+  speculation()
+    : clean(false)
+  {
+  }
+
+  void record(htmltokenizer* tok, const token& t)
+  {
+    tokens.push_back(t);
+    ends.push_back(tok->consumed());
+    emitstates.push_back(tok->get_state());
+
+    if (t.type == TOKEN_START_TAG)
+    {
+      htmltokenizer::tokenizestate s = htmltokenizer::text_state_for(t.tagname);
+      if (s != htmltokenizer::STATE_DATA)
+	tok->change_state(s);
+    }
+
+    afterstates.push_back(tok->get_state());
+  }
+};
+
+namespace
+{
+  // Joins the worker threads also when leaving by an exception, as
+  // they refer to the pending input
+  struct join_guard
+  {
+    join_guard(boost::thread_group& group)
+      : group(group)
+    {
+    }
+
+    ~join_guard()
+    {
+      group.join_all();
+    }
+
+    boost::thread_group& group;
+  };
+}
+
+frenzy::parser::speculative_tokenizer::speculative_tokenizer(frenzy::parser::htmltokenizer& tok,
+							     size_t threads, size_t chunksize)
+  : tok(tok)
+  , threads(std::max(threads, size_t(1)))
+  , chunksize(std::max(chunksize, size_t(1)))
+{
+}
+
+void
+frenzy::parser::speculative_tokenizer::pass_characters(const frenzy::urope& input)
+{
+  if (input.empty())
+  {
+    run_batch();
+    tok.pass_characters(input);
+    return;
+  }
+
+  for (urope::const_iterator it = input.begin(); it != input.end(); ++it)
+  {
+    pending.push_back(*it);
+  }
+
+  if (pending.size() >= threads * chunksize)
+    run_batch();
+}
+
+void
+frenzy::parser::speculative_tokenizer::reset()
+{
+  pending.clear();
+}
+
+void
+frenzy::parser::speculative_tokenizer::run_batch()
+{
+  if (pending.empty())
+    return;
+
+  std::vector<size_t> bounds(1, 0);
+  for (size_t i = 1; i < threads; ++i)
+  {
+    size_t pos = split_point(std::max(pending.size() * i / threads, bounds.back() + 1));
+    if (pos >= pending.size())
+      break;
+
+    bounds.push_back(pos);
+  }
+  bounds.push_back(pending.size());
+
+  std::vector<speculation> results(bounds.size() - 1);
+  std::vector<boost::thread*> workers;
+  boost::thread_group group;
+
+  {
+    join_guard guard(group);
+
+    for (size_t i = 1; i < results.size(); ++i)
+    {
+      workers.push_back(group.create_thread(boost::bind(&speculative_tokenizer::speculate,
+							boost::cref(pending),
+							bounds[i], bounds[i + 1],
+							&results[i])));
+    }
+
+    // The first chunk is tokenized for real while the workers run
+    tok.pass_characters(urope(pending.substr(bounds[0], bounds[1])));
+
+    for (size_t i = 1; i < results.size(); ++i)
+    {
+      workers[i - 1]->join();
+      replay(results[i], bounds[i], bounds[i + 1]);
+    }
+  }
+
+  pending.clear();
+}
+
+size_t
+frenzy::parser::speculative_tokenizer::split_point(size_t pos) const
+{
+  for (size_t i = std::max(pos, size_t(1)); i < pending.size(); ++i)
+  {
+    if (pending[i - 1] == 0x3E && pending[i] != 0x3C) // > followed by not <
+      return i;
+  }
+
+  return pending.size();
+}
+
+void
+frenzy::parser::speculative_tokenizer::replay(const speculation& spec, size_t begin, size_t end)
+{
+  if (!tok.at_boundary())
+  {
+    // The chunk doesn't start between tokens
+    tok.pass_characters(urope(pending.substr(begin, end - begin)));
+    return;
+  }
+
+  // Tokens are replayed up to a point where the real tokenizer can
+  // continue from. That is after a token other than a character,
+  // which are emitted after consuming their last character, or the
+  // end of the chunk if the worker tokenizer was between tokens.
+  size_t count = spec.tokens.size();
+  if (!spec.clean || (count > 0 && spec.ends.back() != end - begin))
+  {
+    while (count > 0 && spec.tokens[count - 1].type == TOKEN_CHARACTER)
+      --count;
+  }
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    tok.replay(spec.tokens[i], spec.emitstates[i]);
+
+    if (tok.get_state() != spec.afterstates[i])
+    {
+      // The tree constructor switched the tokenizer differently. It
+      // only does that for start tags.
+      if (spec.tokens[i].type == TOKEN_CHARACTER)
+	throw std::logic_error("Mis-speculation on a character token");
+
+      count = i + 1;
+      break;
+    }
+  }
+
+  size_t resume = begin + (count > 0 ? spec.ends[count - 1] : 0);
+  if (resume < end)
+    tok.pass_characters(urope(pending.substr(resume, end - resume)));
+}
+
+void
+frenzy::parser::speculative_tokenizer::speculate(const frenzy::ustring& input,
+						 size_t begin, size_t end,
+						 frenzy::parser::speculative_tokenizer::speculation* result)
+{
+  htmltokenizer tok;
+  tok.attach_destination(boost::bind(&speculation::record, result, &tok, _1));
+
+  try
+  {
+    tok.pass_characters(urope(input.substr(begin, end - begin)));
+    result->clean = tok.at_boundary();
+  }
+  catch (const std::exception&)
+  {
+    // The tokens so far are still usable. The real tokenizer
+    // continues after them and throws again if it must.
+    result->clean = false;
+  }
+}
@@ -0,0 +1,83 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+
+#ifndef FRENZY_SPECULATIVETOKENIZER_HPP
+#define FRENZY_SPECULATIVETOKENIZER_HPP
+
+#include <boost/noncopyable.hpp>
+
+#include "util/unicode.hpp"
+#include "htmltokenizer.hpp"
+
+namespace frenzy
+{
+  namespace parser
+  {
+    /*
+     * Speculative tokenization of large documents on several threads.
+     *
+     * The input is collected into batches, and a batch is split into
+     * chunks after a '>' that is followed by text. The first chunk is
+     * passed to the real tokenizer, and the other chunks are
+     * tokenized on worker threads at the same time. The worker
+     * tokenizers assume that their chunk starts in the data state,
+     * and switch to the text states after start tags like the tree
+     * constructor does in the common insertion modes.
+     *
+     * The tokens of the worker tokenizers are then replayed to the
+     * tree constructor in order, through the real tokenizer. A chunk
+     * is replayed only if the real tokenizer is between tokens at the
+     * start of the chunk, and every replayed token must leave the
+     * tokenizer in the state the worker tokenizer was in. On a
+     * mis-speculation the rest of the chunk is tokenized again by the
+     * real tokenizer, starting after the last replayed token. The
+     * tokens reaching the tree constructor are identical to
+     * sequential tokenization.
+     *
+     * Follows the parser stage interface for input. The output goes
+     * to the destination of the given tokenizer, which must be
+     * coupled to a tree constructor.
+     */
+    struct speculative_tokenizer : private boost::noncopyable
+    {
+      // Input is tokenized in batches of chunksize characters per
+      // thread. Smaller inputs are tokenized when end-of-file is
+      // passed.
+      speculative_tokenizer(htmltokenizer& tok, size_t threads, size_t chunksize = 65536);
+
+      void pass_characters(const urope& input);
+      void reset();
+
+    private:
+      htmltokenizer& tok;
+      size_t threads;
+      size_t chunksize;
+
+      ustring pending;
+
+      // Tokenizes the pending input
+      void run_batch();
+      // Returns the position after the first '>' followed by text at
+      // or after pos, or the end of the pending input if there is none
+      size_t split_point(size_t pos) const;
+
+      // The tokens of one chunk from a worker tokenizer
+      struct speculation;
+      void replay(const speculation& spec, size_t begin, size_t end);
+      static void speculate(const ustring& input, size_t begin, size_t end, speculation* result);
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,207 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+
+#include <stdexcept>
+#include <boost/bind.hpp>
+#include <boost/thread.hpp>
+
+#include "tokenpipeline.hpp"
+
+namespace
+{
+  // Tokens that fit in the ring before the tokenizer waits for the
+  // tree constructor
+  const size_t ringsize = 1024;
+}
+
+frenzy::parser::token_pipeline::token_pipeline(frenzy::parser::htmltokenizer& tok)
+  : tok(tok)
+  , started(false)
+  , ring(ringsize)
+  , pushed(0)
+  , processed(0)
+  , failed(false)
+  , producing(false)
+  , stopping(false)
+{
+  front.attach_destination(boost::bind(&token_pipeline::push, this, _1));
+}
+
+frenzy::parser::token_pipeline::~token_pipeline()
+{
+  if (consumer)
+    stop();
+}
+
+void
+frenzy::parser::token_pipeline::pass_characters(const frenzy::urope& input)
+{
+  if (!started)
+  {
+    front.change_state(tok.get_state());
+    started = true;
+  }
+
+  if (!consumer)
+    consumer.reset(new boost::thread(boost::bind(&token_pipeline::consume, this)));
+
+  set_producing(true);
+  try
+  {
+    front.pass_characters(input);
+  }
+  catch (...)
+  {
+    drain();
+    set_producing(false);
+    throw;
+  }
+  drain();
+  set_producing(false);
+
+  check_failed();
+
+  // The end of file
+  if (input.empty())
+    stop();
+}
+
+void
+frenzy::parser::token_pipeline::reset()
+{
+  if (consumer)
+    stop();
+
+  front.reset();
+  // Tokens are left over if tree construction failed
+  ring.reset();
+  started = false;
+  pushed = 0;
+  processed.store(0);
+  failed.store(false);
+  error.clear();
+}
+
+void
+frenzy::parser::token_pipeline::set_producing(bool value)
+{
+  {
+    boost::lock_guard<boost::mutex> lock(idle_mutex);
+    producing.store(value, boost::memory_order_release);
+  }
+
+  if (value)
+    idle.notify_one();
+}
+
+void
+frenzy::parser::token_pipeline::stop()
+{
+  {
+    boost::lock_guard<boost::mutex> lock(idle_mutex);
+    stopping = true;
+  }
+
+  idle.notify_one();
+  consumer->join();
+  consumer.reset();
+  stopping = false;
+}
+
+void
+frenzy::parser::token_pipeline::push(const frenzy::parser::token& t)
+{
+  queued_token q(t, front.get_state());
+  while (!ring.push(q))
+  {
+    check_failed();
+    boost::this_thread::yield();
+  }
+  ++pushed;
+
+  if (t.type == TOKEN_START_TAG &&
+      htmltokenizer::text_state_for(t.tagname) != htmltokenizer::STATE_DATA)
+  {
+    // The tree constructor decides the state to continue in
+    wait_for_tree();
+    front.change_state(tok.get_state());
+  }
+}
+
+void
+frenzy::parser::token_pipeline::wait_for_tree()
+{
+  while (processed.load(boost::memory_order_acquire) != pushed)
+  {
+    check_failed();
+    boost::this_thread::yield();
+  }
+}
+
+void
+frenzy::parser::token_pipeline::drain()
+{
+  while (!failed.load(boost::memory_order_acquire) &&
+	 processed.load(boost::memory_order_acquire) != pushed)
+  {
+    boost::this_thread::yield();
+  }
+}
+
+void
+frenzy::parser::token_pipeline::check_failed()
+{
+  if (failed.load(boost::memory_order_acquire))
+    throw std::runtime_error("Tree construction failed: " + error);
+}
+
+void
+frenzy::parser::token_pipeline::consume()
+{
+  try
+  {
+    while (true)
+    {
+      if (ring.consume_one(boost::bind(&token_pipeline::process, this, _1)))
+	continue;
+
+      if (producing.load(boost::memory_order_acquire))
+      {
+	boost::this_thread::yield();
+	continue;
+      }
+
+      // Between inputs. All tokens pushed so far are processed
+      // before producing is cleared.
+      boost::unique_lock<boost::mutex> lock(idle_mutex);
+      while (!producing.load(boost::memory_order_relaxed) && !stopping)
+	idle.wait(lock);
+
+      if (stopping)
+	return;
+    }
+  }
+  catch (const std::exception& e)
+  {
+    error = e.what();
+    failed.store(true, boost::memory_order_release);
+  }
+}
+
+void
+frenzy::parser::token_pipeline::process(frenzy::parser::token_pipeline::queued_token& q)
+{
+  tok.replay(q.t, q.state);
+  processed.fetch_add(1, boost::memory_order_release);
+}
@@ -0,0 +1,129 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+
+#ifndef FRENZY_TOKENPIPELINE_HPP
+#define FRENZY_TOKENPIPELINE_HPP
+
+#include <string>
+#include <boost/noncopyable.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/atomic.hpp>
+#include <boost/lockfree/spsc_queue.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+#include "util/unicode.hpp"
+#include "token.hpp"
+#include "htmltokenizer.hpp"
+
+namespace frenzy
+{
+  namespace parser
+  {
+    /*
+     * Runs tokenization and tree construction on two threads. The
+     * input is tokenized on the calling thread by a tokenizer of the
+     * pipeline, which pushes the tokens to a lock-free
+     * single-producer single-consumer ring. A second thread pops the
+     * tokens and replays them through the given tokenizer, which is
+     * coupled to the tree constructor.
+     *
+     * The tree constructor switches the tokenizer to the text states
+     * after some start tags. After a start tag that can cause a
+     * switch (see htmltokenizer::text_state_for()), the tokenizing
+     * thread waits until the tree constructor has processed it and
+     * continues in the state the tree constructor left. These tags
+     * are rare enough that the threads mostly run in parallel.
+     *
+     * The tree constructor thread is started by the first input and
+     * kept until the end of file, reset() or destruction, sleeping
+     * while there is no input. Input is often passed in small chunks
+     * as it arrives.
+     *
+     * Follows the parser stage interface for input. When
+     * pass_characters() returns, all tokens of the input have been
+     * processed by the tree constructor, so the tree can be read
+     * between calls. If tree construction throws, pass_characters()
+     * throws a std::runtime_error.
+     */
+    struct token_pipeline : private boost::noncopyable
+    {
+      explicit token_pipeline(htmltokenizer& tok);
+      ~token_pipeline();
+
+      void pass_characters(const urope& input);
+      void reset();
+
+    private:
+      htmltokenizer& tok;
+      htmltokenizer front;
+      // False until the state of the front tokenizer is taken from
+      // tok, which a fragment parse has set to the context's state
+      bool started;
+
+      struct queued_token
+      {
+	queued_token()
+	  : t(token::make_end_of_file())
+	  , state(htmltokenizer::STATE_DATA)
+	{
+	}
+
+	queued_token(const token& t, htmltokenizer::tokenizestate state)
+	  : t(t)
+	  , state(state)
+	{
+	}
+
+	token t;
+	// The state of the front tokenizer when emitting the token
+	htmltokenizer::tokenizestate state;
+      };
+
+      boost::lockfree::spsc_queue<queued_token> ring;
+      // Written by the tokenizing thread only
+      size_t pushed;
+      // Written by the tree constructor thread only
+      boost::atomic<size_t> processed;
+      boost::atomic<bool> failed;
+      std::string error;
+
+      boost::scoped_ptr<boost::thread> consumer;
+      // True while pass_characters() runs. Changed with the mutex
+      // held, so that the tree constructor thread can sleep between
+      // inputs.
+      boost::atomic<bool> producing;
+      bool stopping;
+      boost::mutex idle_mutex;
+      boost::condition_variable idle;
+
+      // On the tokenizing thread
+      void set_producing(bool value);
+      void stop();
+      void push(const token& t);
+      void wait_for_tree();
+      // Waits until the tokens are processed or tree construction
+      // failed, without throwing
+      void drain();
+      void check_failed();
+
+      // On the tree constructor thread
+      void consume();
+      void process(queued_token& q);
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,158 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+
+#include <stdexcept>
+#include <boost/bind.hpp>
+
+#include "tokenstream.hpp"
+#include "htmlnames.hpp"
+
+frenzy::tokenhandler::~tokenhandler()
+{
+}
+
+void
+frenzy::tokenhandler::doctype(const frenzy::parser::token&)
+{
+}
+
+void
+frenzy::tokenhandler::start_tag(const frenzy::ustring&,
+				const frenzy::tokenhandler::attributes_t&,
+				bool)
+{
+}
+
+void
+frenzy::tokenhandler::end_tag(const frenzy::ustring&)
+{
+}
+
+void
+frenzy::tokenhandler::comment(const frenzy::ustring&)
+{
+}
+
+void
+frenzy::tokenhandler::text(const frenzy::ustring&)
+{
+}
+
+void
+frenzy::tokenhandler::end_of_file()
+{
+}
+
+frenzy::tokenstream::tokenstream(frenzy::tokenhandler& handler)
+  : tree(&sink)
+  , handler(handler)
+  , eof(false)
+  , foreign_depth(0)
+{
+  dec.attach_destination(boost::bind(&parser::input_preprocessor::pass_characters, &proc, _1));
+  proc.attach_destination(boost::bind(&parser::htmltokenizer::pass_characters, &tok, _1));
+  tree.couple_tokenizer(&tok);
+  // Seeing the tokens before the tree constructor
+  tok.attach_destination(boost::bind(&tokenstream::process_token, this, _1));
+}
+
+void
+frenzy::tokenstream::pass_bytes(frenzy::bytestring str)
+{
+  dec.pass_bytes(str);
+}
+
+void
+frenzy::tokenstream::pass_eof()
+{
+  dec.pass_bytes(bytestring());
+}
+
+bool
+frenzy::tokenstream::stopped() const
+{
+  return eof;
+}
+
+void
+frenzy::tokenstream::flush_text()
+{
+  if (text.empty())
+    return;
+
+  handler.text(text);
+  text.clear();
+}
+
+void
+frenzy::tokenstream::process_token(const frenzy::parser::token& t)
+{
+  using namespace frenzy::html;
+
+  // The tree constructor switches the tokenizer state as it sees the
+  // token, before the next characters are tokenized
+  if (t.type == parser::TOKEN_START_TAG && foreign_depth == 0 &&
+      (t.tagname == svg || t.tagname == math))
+  {
+    if (!t.self_closing)
+    {
+      foreign_root = t.tagname;
+      foreign_depth = 1;
+    }
+  }
+  else if (t.type == parser::TOKEN_START_TAG && foreign_depth > 0)
+  {
+    if (t.tagname == foreign_root && !t.self_closing)
+      ++foreign_depth;
+  }
+  else if (t.type == parser::TOKEN_END_TAG && foreign_depth > 0)
+  {
+    if (t.tagname == foreign_root)
+      --foreign_depth;
+  }
+  else if (foreign_depth == 0 || t.type == parser::TOKEN_END_OF_FILE)
+  {
+    tree.pass_token(t);
+  }
+
+  if (t.type == parser::TOKEN_CHARACTER)
+  {
+    text.push_back(t.character);
+    return;
+  }
+
+  flush_text();
+
+  switch (t.type)
+  {
+  case parser::TOKEN_DOCTYPE:
+    handler.doctype(t);
+    break;
+  case parser::TOKEN_START_TAG:
+    handler.start_tag(t.tagname, t.attributes, t.self_closing);
+    break;
+  case parser::TOKEN_END_TAG:
+    handler.end_tag(t.tagname);
+    break;
+  case parser::TOKEN_COMMENT:
+    handler.comment(t.comment);
+    break;
+  case parser::TOKEN_END_OF_FILE:
+    eof = true;
+    handler.end_of_file();
+    break;
+  default:
+    throw std::logic_error("Unknown token type");
+  }
+}
@@ -0,0 +1,98 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+
+#ifndef FRENZY_TOKENSTREAM_HPP
+#define FRENZY_TOKENSTREAM_HPP
+
+#include <map>
+
+#include "chardecoder.hpp"
+#include "input_preprocessor.hpp"
+#include "htmltokenizer.hpp"
+#include "treesink.hpp"
+#include "treeconstructor.hpp"
+
+namespace frenzy
+{
+  /*
+   * Receives the events of a tokenstream. All functions do nothing
+   * by default, so a handler only needs to override the events it is
+   * interested in.
+   */
+  struct tokenhandler
+  {
+    typedef std::map<ustring, ustring> attributes_t;
+
+    virtual ~tokenhandler();
+
+    virtual void doctype(const parser::token& t);
+    virtual void start_tag(const ustring& name, const attributes_t& attributes, bool self_closing);
+    virtual void end_tag(const ustring& name);
+    virtual void comment(const ustring& data);
+    // Consecutive characters are passed as a single run. A run is
+    // never split by a chunk boundary in the input.
+    virtual void text(const ustring& data);
+    virtual void end_of_file();
+  };
+
+  /*
+   * tokenstream is an alternative to htmlparser for callers that only
+   * need tag, attribute and text events. The input goes through the
+   * same decoder, preprocessor and tokenizer stages as with
+   * htmlparser, but no DOM nodes are created.
+   *
+   * The tokenizer state changes for elements like script, style,
+   * title, textarea and plaintext are made by a tree constructor
+   * that builds no tree, so that they depend on the insertion mode
+   * as when parsing to a DOM, for example inside select and table.
+   * The tree constructor doesn't know SVG and MathML yet, so their
+   * content is kept from it; there the elements don't switch the
+   * tokenizer state. The events are what the markup says, the
+   * implied tags and other changes of tree construction are not
+   * seen.
+   */
+  struct tokenstream
+  {
+    tokenstream(tokenhandler& handler);
+
+    void pass_bytes(bytestring str);
+    void pass_eof();
+
+    // Returns true after end-of-file has been passed to the handler.
+    bool stopped() const;
+
+  private:
+    parser::utf8_decoder dec;
+    parser::input_preprocessor proc;
+    parser::htmltokenizer tok;
+    parser::nullsink sink;
+    parser::treeconstructor tree;
+
+    tokenhandler& handler;
+    bool eof;
+
+    // Pending characters, passed on as one run
+    ustring text;
+    void flush_text();
+
+    // Depth of open svg and math elements. Their content is not
+    // passed to the tree constructor.
+    size_t foreign_depth;
+    ustring foreign_root;
+
+    void process_token(const parser::token& t);
+  };
+}
+
+#endif
@@ -19,9 +19,8 @@
 
 #include "treeconstructor.hpp"
 #include "htmlnames.hpp"
-#include "dom/element.hpp"
-#include "dom/text.hpp"
 #include "dom/pointers.hpp"
+#include "dom/element.hpp"
 #include "util/stringlist.hpp"
 
 using namespace frenzy::html;
@@ -38,38 +37,9 @@ namespace
   const frenzy::stringlist tablescope =
     frenzy::stringlist(html) + table;
 
-  bool has_element_in_specific_scope(const std::vector<frenzy::dom::Elementp>& stack, const frenzy::stringlist& scope, frenzy::ustring name)
+  bool is_whitespace(frenzy::uchar u)
   {
-    for (std::vector<frenzy::dom::Elementp>::const_reverse_iterator it = stack.rbegin();
-	 it != stack.rend();
-	 ++it)
-    {
-      frenzy::ustring t = (*it)->get_localName();
-      if (t == name)
-	return true;
-      
-      if (scope.contains(t))
-	return false;
-    }
-    
-    throw std::logic_error("Should not be reached: No html element in stack");
-  }
-
-  bool has_element_in_specific_scope(const std::vector<frenzy::dom::Elementp>& stack, const frenzy::stringlist& scope, frenzy::stringlist names)
-  {
-    for (std::vector<frenzy::dom::Elementp>::const_reverse_iterator it = stack.rbegin();
-	 it != stack.rend();
-	 ++it)
-    {
-      frenzy::ustring t = (*it)->get_localName();
-      if (names.contains(t))
-	return true;
-      
-      if (scope.contains(t))
-	return false;
-    }
-    
-    throw std::logic_error("Should not be reached: No html element in stack");
+    return u == 0x09 || u == 0x0A || u == 0x0C || u == 0x0D || u == 0x20;
   }
 
   // TODO: MathML and SVG names
@@ -83,30 +53,408 @@ namespace
     object + ol + p + param + plaintext + pre + script + section + frenzy::html::select + source +
     style + summary + table + tbody + td + textarea + tfoot + th + thead + title +
     tr + track + ul + wbr + xmp;
+
+  // The element name lists used by the tree construction rules. They
+  // are initialized with the other globals of this file, before any
+  // tree constructor runs, and only read afterwards, so tree
+  // constructors on different threads can share them.
+  using frenzy::stringlist;
+
+  // HTML5 8.2.5.2
+  const stringlist impliedendtags =
+    stringlist(dd) + dt + li + option + optgroup + p + rp + rt;
+
+  // HTML5 8.2.5.4.2 and 8.2.5.4.3
+  const stringlist headbodyhtmlbr = stringlist(head) + body + frenzy::html::html + br;
+
+  // HTML5 8.2.5.4.4 - 8.2.5.4.6
+  const stringlist headvoidelems =
+    stringlist(base) + basefont + bgsound + command + frenzy::html::link;
+  const stringlist noscriptheadelems =
+    stringlist(basefont) + bgsound + frenzy::html::link + meta + noframes + style;
+  const stringlist afterheadelems =
+    stringlist(base) + basefont + bgsound + frenzy::html::link +
+    meta + noframes + script + style + title;
+
+  // HTML5 8.2.5.4.7 "in body"
+  const stringlist inheadelems =
+    stringlist(base) + basefont + bgsound + command +
+    frenzy::html::link + meta + noframes + script + style + title;
+  const stringlist blockelems =
+    stringlist(address) + article + aside + blockquote + center +
+    details + dialog + dir + frenzy::html::div + dl + fieldset + figcaption +
+    figure + footer + header + hgroup + menu + nav + ol + p +
+    section + summary + ul;
+  const stringlist blockendtags =
+    stringlist(address) + article + aside + blockquote + button +
+    center + details + dialog + dir + frenzy::html::div + dl + fieldset +
+    figcaption + figure + footer + header + hgroup + listing +
+    menu + nav + ol + pre + section + summary + ul;
+  const stringlist headings =
+    stringlist(h1) + h2 + h3 + h4 + h5 + h6;
+  const stringlist addressdivp = stringlist(address) + frenzy::html::div + p;
+  const stringlist formattingelems =
+    stringlist(b) + big + code + em + font + i + s + small + strike + strong + tt + u;
+  const stringlist adoptionagencyelems =
+    stringlist(a) + b + big + code + em + font + i + nobr + s + small + strike + strong + tt + u;
+  const stringlist voidinlineelems = stringlist(area) + br + embed + img + keygen + wbr;
+  const stringlist ignoredinbody =
+    stringlist(caption) + col + colgroup + frame + head +
+    tbody + td + tfoot + th + thead + tr;
+  const stringlist eofallowedopen =
+    stringlist(dd) + dt + li + p + tbody + td + tfoot + th + thead + tr + body + frenzy::html::html;
+  const stringlist preformattedelems = stringlist(pre) + listing + plaintext;
+
+  // HTML5 8.2.5.4.9 - 8.2.5.4.17, tables
+  const stringlist tablestructure =
+    stringlist(table) + tbody + tfoot + thead + tr;
+  const stringlist tablecells = stringlist(td) + th;
+  const stringlist tableparts =
+    stringlist(caption) + col + colgroup + tbody + td + tfoot + th + thead + tr;
+  const stringlist tablecontext = stringlist(table) + frenzy::html::html;
+  const stringlist tablebodycontext =
+    stringlist(tbody) + tfoot + thead + frenzy::html::html;
+  const stringlist tablerowcontext =
+    stringlist(tr) + frenzy::html::html;
+  const stringlist tableignoredendtags =
+    stringlist(body) + caption + col + colgroup + frenzy::html::html + tbody + td + tfoot + th + thead + tr;
+  const stringlist captionignoredendtags =
+    stringlist(body) + col + colgroup + tbody + td + tfoot + th + thead + tr;
+  const stringlist tablebodyclosers =
+    stringlist(caption) + col + colgroup + tbody + tfoot + thead;
+  const stringlist tablebodyignoredendtags =
+    stringlist(body) + caption + col + colgroup + frenzy::html::html + td + th + tr;
+  const stringlist rowclosers =
+    stringlist(caption) + col + colgroup + tbody + tfoot + thead + tr;
+  const stringlist rowignoredendtags =
+    stringlist(body) + caption + col + colgroup + frenzy::html::html + td + th;
+  const stringlist cellignoredendtags =
+    stringlist(body) + caption + col + colgroup + frenzy::html::html;
+  const stringlist selectintableclosers =
+    stringlist(caption) + table + tbody + tfoot + thead + tr + td + th;
+
+  // Tokens processed between telling the sink which nodes are still
+  // referred to
+  const size_t min_release_interval = 1024;
+
+  // HTML5 8.2.5 "HTML integration point" and "MathML text
+  // integration point", SVG and MathML elements with HTML content.
+  const stringlist integrationpoints =
+    stringlist("foreignObject") + "desc" + title +
+    "mi" + "mo" + "mn" + "ms" + "mtext" + "annotation-xml";
+}
+
+frenzy::parser::fragmentcontext::fragmentcontext(const frenzy::ustring& name)
+  : name(name)
+  , foreign(false)
+  , form(NULL)
+{
+}
+
+frenzy::parser::fragmentcontext::fragmentcontext(frenzy::dom::Elementp element)
+  : name(element->get_localName())
+  , foreign(false)
+  , form(NULL)
+{
+  using namespace frenzy::html;
+
+  // The elements have no namespace, so an element is taken to be
+  // foreign by the nearest svg or math element of the element and
+  // its ancestors, unless an integration point comes first.
+  bool decided = false;
+  for (dom::Elementp e = element; e; e = dom_cast<dom::Element>(e->get_parentNode()))
+  {
+    const ustring& n = e->get_localName();
+
+    if (!form && n == frenzy::html::form)
+      form = e.get();
+
+    if (decided)
+      continue;
+
+    if (n == svg || n == math)
+    {
+      foreign = true;
+      decided = true;
+    }
+    else if (e != element && integrationpoints.contains(n))
+      decided = true;
+  }
+}
+
+frenzy::parser::treeoptions::treeoptions()
+  : drop_comments(false)
+  , drop_whitespace(false)
+{
+}
+
+frenzy::parser::treeconstructor::treeconstructor(frenzy::dom::Documentp document,
+						 const frenzy::parser::treeoptions& options)
+  : ownsink(new domsink(document))
+  , sink(ownsink.get())
+  , tok(NULL)
+  , options(options)
+  , fragment(false)
+  , current_form(NULL)
+  , head_element(NULL)
+  , frameset_ok(true)
+  , ignore_next_lf(false)
+  , force_foster_parent(false)
+  , stop(false)
+  , pending_parent(NULL)
+  , pending_sibling(NULL)
+  , text_parent(NULL)
+  , text_sibling(NULL)
+  , tokens_since_release(0)
+  , release_interval(min_release_interval)
+  , state(STATE_INITIAL)
+{
+}
+
+frenzy::parser::treeconstructor::treeconstructor(frenzy::parser::treesink* sink,
+						 const frenzy::parser::treeoptions& options)
+  : sink(sink)
+  , tok(NULL)
+  , options(options)
+  , fragment(false)
+  , current_form(NULL)
+  , head_element(NULL)
+  , frameset_ok(true)
+  , ignore_next_lf(false)
+  , force_foster_parent(false)
+  , stop(false)
+  , pending_parent(NULL)
+  , pending_sibling(NULL)
+  , text_parent(NULL)
+  , text_sibling(NULL)
+  , tokens_since_release(0)
+  , release_interval(min_release_interval)
+  , state(STATE_INITIAL)
+{
+}
+
+frenzy::parser::treeconstructor::treeconstructor(frenzy::dom::DocumentFragmentp documentfragment,
+						 const frenzy::parser::fragmentcontext& context,
+						 const frenzy::parser::treeoptions& options)
+  : ownsink(new domsink(documentfragment))
+  , sink(ownsink.get())
+  , tok(NULL)
+  , options(options)
+  , fragment(true)
+  , context(context)
+  , current_form(NULL)
+  , head_element(NULL)
+  , frameset_ok(true)
+  , ignore_next_lf(false)
+  , force_foster_parent(false)
+  , stop(false)
+  , pending_parent(NULL)
+  , pending_sibling(NULL)
+  , text_parent(NULL)
+  , text_sibling(NULL)
+  , tokens_since_release(0)
+  , release_interval(min_release_interval)
+  , state(STATE_INITIAL)
+{
+  start_fragment();
 }
 
-frenzy::parser::treeconstructor::treeconstructor(frenzy::dom::Documentp document)
-  : doc(document)
+frenzy::parser::treeconstructor::treeconstructor(frenzy::parser::treesink* sink,
+						 const frenzy::parser::fragmentcontext& context,
+						 const frenzy::parser::treeoptions& options)
+  : sink(sink)
   , tok(NULL)
+  , options(options)
+  , fragment(true)
+  , context(context)
+  , current_form(NULL)
+  , head_element(NULL)
   , frameset_ok(true)
   , ignore_next_lf(false)
   , force_foster_parent(false)
   , stop(false)
+  , pending_parent(NULL)
+  , pending_sibling(NULL)
+  , text_parent(NULL)
+  , text_sibling(NULL)
+  , tokens_since_release(0)
+  , release_interval(min_release_interval)
   , state(STATE_INITIAL)
 {
+  start_fragment();
+}
+
+void
+frenzy::parser::treeconstructor::start_fragment()
+{
+  // HTML5 8.4. The root element is not created, the nodes go
+  // directly to the sink's root. It has the name html for the
+  // purposes of the tree construction rules.
+  open_elements.push_back(open_element(sink->document(), html::html));
+  current_form = context.form;
+
+  reset_insertion_mode();
 }
 
 void
 frenzy::parser::treeconstructor::couple_tokenizer(frenzy::parser::htmltokenizer* tokenizer)
 {
   tok = tokenizer;
-  tok->attach_destination(boost::bind(&treeconstructor::process_token, this, _1));
+  tok->attach_destination(boost::bind(&treeconstructor::receive_token, this, _1));
+
+  if (fragment)
+    set_context_tokenizer_state();
+}
+
+void
+frenzy::parser::treeconstructor::pass_token(const frenzy::parser::token& t)
+{
+  receive_token(t);
+}
+
+void
+frenzy::parser::treeconstructor::receive_token(const frenzy::parser::token& t)
+{
+  bool was_stopped = stop;
+  process_token(t);
+
+  // Between tokens only the members refer to nodes
+  if (++tokens_since_release >= release_interval || (stop && !was_stopped))
+    release_unreferenced();
+}
+
+void
+frenzy::parser::treeconstructor::release_unreferenced()
+{
+  std::vector<handle> referenced;
+  referenced.reserve(open_elements.size() + active_formatting_list.size() + skipping.size() + 6);
+
+  for (open_elements_t::const_iterator it = open_elements.begin(); it != open_elements.end(); ++it)
+    referenced.push_back(it->node);
+  for (std::vector<active_formatting>::const_iterator it = active_formatting_list.begin();
+       it != active_formatting_list.end();
+       ++it)
+  {
+    referenced.push_back(it->element());
+  }
+  referenced.insert(referenced.end(), skipping.begin(), skipping.end());
+  referenced.push_back(current_form);
+  referenced.push_back(head_element);
+  referenced.push_back(pending_parent);
+  referenced.push_back(pending_sibling);
+  referenced.push_back(text_parent);
+  referenced.push_back(text_sibling);
+
+  // Markers and ghosts have no node in the sink
+  std::vector<handle>::iterator end = referenced.begin();
+  for (std::vector<handle>::iterator it = referenced.begin(); it != referenced.end(); ++it)
+  {
+    if (*it && !is_ghost(*it))
+      *end++ = *it;
+  }
+  referenced.erase(end, referenced.end());
+
+  std::sort(referenced.begin(), referenced.end());
+  referenced.erase(std::unique(referenced.begin(), referenced.end()), referenced.end());
+
+  sink->release(referenced);
+
+  // Releasing costs about as much as there are references, so it is
+  // done less often while there are many
+  tokens_since_release = 0;
+  release_interval = std::max(min_release_interval, 2 * referenced.size());
+}
+
+void
+frenzy::parser::treeconstructor::flush()
+{
+  if (!drops_pending_whitespace())
+    flush_text();
+}
+
+void
+frenzy::parser::treeconstructor::set_context_tokenizer_state()
+{
+  // The names of the raw text elements mean nothing in foreign
+  // content
+  if (context.foreign)
+    return;
+
+  htmltokenizer::tokenizestate s = htmltokenizer::text_state_for(context.name);
+  if (s != htmltokenizer::STATE_DATA)
+    tok->change_state(s);
+}
+
+void
+frenzy::parser::treeconstructor::reset(frenzy::dom::Documentp document)
+{
+  if (ownsink)
+    ownsink->reset(document);
+  else
+    ownsink.reset(new domsink(document));
+
+  sink = ownsink.get();
+  fragment = false;
+  context = fragmentcontext();
+  reset();
+}
+
+void
+frenzy::parser::treeconstructor::reset(frenzy::dom::DocumentFragmentp documentfragment,
+				       const frenzy::parser::fragmentcontext& newcontext)
+{
+  if (ownsink)
+    ownsink->reset(documentfragment);
+  else
+    ownsink.reset(new domsink(documentfragment));
+
+  sink = ownsink.get();
+  fragment = true;
+  context = newcontext;
+  reset();
+}
+
+void
+frenzy::parser::treeconstructor::reset()
+{
+  // clear() keeps the capacity of the vectors
+  open_elements.clear();
+  active_formatting_list.clear();
+  pending_table_characters.clear();
+  pending_text.clear();
+  ghosts.clear();
+  ghoststorage.clear();
+  skipping.clear();
+
+  current_form = NULL;
+  head_element = NULL;
+  frameset_ok = true;
+  ignore_next_lf = false;
+  force_foster_parent = false;
+  stop = false;
+  pending_parent = NULL;
+  pending_sibling = NULL;
+  text_parent = NULL;
+  text_sibling = NULL;
+  state = STATE_INITIAL;
+  tokens_since_release = 0;
+  release_interval = min_release_interval;
+
+  if (fragment)
+  {
+    start_fragment();
+    if (tok)
+      set_context_tokenizer_state();
+  }
 }
 
 frenzy::dom::Documentp
 frenzy::parser::treeconstructor::document()
 {
-  return doc;
+  if (!ownsink)
+    return dom::Documentp();
+
+  return ownsink->get_document();
 }
 
 bool
@@ -115,117 +463,319 @@ frenzy::parser::treeconstructor::stopped() const
   return stop;
 }
 
-frenzy::dom::Elementp
-frenzy::parser::treeconstructor::current_node()
+void
+frenzy::parser::treeconstructor::attach_close_listener(boost::function<void (frenzy::parser::treesink::handle)> listener)
+{
+  close_listener = listener;
+}
+
+void
+frenzy::parser::treeconstructor::save(frenzy::parser::treeconstructor::checkpoint& cp)
+{
+  // Elements whose content is not created are not checkpointed
+  assert(ghosts.empty() && skipping.empty());
+  // Table text is buffered only until the next token other than a
+  // character, and the buffer is cleared when starting again
+  assert(state != STATE_IN_TABLE_TEXT);
+
+  flush();
+
+  cp.open_elements = open_elements;
+  cp.active_formatting_list = active_formatting_list;
+  cp.state = state;
+  cp.origstate = origstate;
+  cp.head_element = head_element;
+  cp.current_form = current_form;
+  cp.frameset_ok = frameset_ok;
+  cp.ignore_next_lf = ignore_next_lf;
+  cp.force_foster_parent = force_foster_parent;
+  cp.stop = stop;
+  cp.pending_text = pending_text;
+  cp.pending_parent = pending_parent;
+  cp.pending_sibling = pending_sibling;
+  cp.text_parent = text_parent;
+  cp.text_sibling = text_sibling;
+}
+
+void
+frenzy::parser::treeconstructor::restore(const frenzy::parser::treeconstructor::checkpoint& cp)
+{
+  reset();
+
+  open_elements = cp.open_elements;
+  active_formatting_list = cp.active_formatting_list;
+  state = cp.state;
+  origstate = cp.origstate;
+  head_element = cp.head_element;
+  current_form = cp.current_form;
+  frameset_ok = cp.frameset_ok;
+  ignore_next_lf = cp.ignore_next_lf;
+  force_foster_parent = cp.force_foster_parent;
+  stop = cp.stop;
+  pending_text = cp.pending_text;
+  pending_parent = cp.pending_parent;
+  pending_sibling = cp.pending_sibling;
+  text_parent = cp.text_parent;
+  text_sibling = cp.text_sibling;
+}
+
+frenzy::parser::treeconstructor::checkpoint::checkpoint()
+  : state(STATE_INITIAL)
+  , origstate(STATE_INITIAL)
+  , head_element(NULL)
+  , current_form(NULL)
+  , frameset_ok(true)
+  , ignore_next_lf(false)
+  , force_foster_parent(false)
+  , stop(false)
+  , pending_parent(NULL)
+  , pending_sibling(NULL)
+  , text_parent(NULL)
+  , text_sibling(NULL)
 {
-  return open_elements.back();
+}
+
+std::vector<frenzy::parser::treesink::handle>
+frenzy::parser::treeconstructor::checkpoint::handles() const
+{
+  std::vector<handle> ret;
+  ret.reserve(open_elements.size() + active_formatting_list.size() + 6);
+
+  for (open_elements_t::const_iterator it = open_elements.begin(); it != open_elements.end(); ++it)
+    ret.push_back(it->node);
+  for (std::vector<active_formatting>::const_iterator it = active_formatting_list.begin();
+       it != active_formatting_list.end();
+       ++it)
+  {
+    if (!it->is_marker())
+      ret.push_back(it->element());
+  }
+  ret.push_back(head_element);
+  ret.push_back(current_form);
+  ret.push_back(pending_parent);
+  ret.push_back(pending_sibling);
+  ret.push_back(text_parent);
+  ret.push_back(text_sibling);
+
+  return ret;
+}
+
+void
+frenzy::parser::treeconstructor::checkpoint::set_handles(const std::vector<frenzy::parser::treesink::handle>& handles)
+{
+  std::vector<handle>::const_iterator h = handles.begin();
+
+  for (open_elements_t::iterator it = open_elements.begin(); it != open_elements.end(); ++it)
+    it->node = *h++;
+  for (std::vector<active_formatting>::iterator it = active_formatting_list.begin();
+       it != active_formatting_list.end();
+       ++it)
+  {
+    if (!it->is_marker())
+      *it = active_formatting(*h++, it->gettoken());
+  }
+  head_element = *h++;
+  current_form = *h++;
+  pending_parent = *h++;
+  pending_sibling = *h++;
+  text_parent = *h++;
+  text_sibling = *h++;
+}
+
+std::vector<frenzy::parser::treesink::handle>
+frenzy::parser::treeconstructor::checkpoint::parents() const
+{
+  std::vector<handle> ret;
+  ret.reserve(open_elements.size() + 1);
+
+  for (open_elements_t::const_iterator it = open_elements.begin(); it != open_elements.end(); ++it)
+    ret.push_back(it->node);
+  // The head element is pushed back to the stack in "after head"
+  if (head_element && std::find(ret.begin(), ret.end(), head_element) == ret.end())
+    ret.push_back(head_element);
+
+  return ret;
 }
 
 bool
-frenzy::parser::treeconstructor::open_elements_contains(frenzy::dom::Elementp elem) const
+frenzy::parser::treeconstructor::checkpoint::same_state(const frenzy::parser::treeconstructor::checkpoint& other) const
 {
-  return std::find(open_elements.begin(), open_elements.end(), elem) != open_elements.end();
+  if (state != other.state || origstate != other.origstate ||
+      frameset_ok != other.frameset_ok || ignore_next_lf != other.ignore_next_lf ||
+      force_foster_parent != other.force_foster_parent || stop != other.stop ||
+      pending_text != other.pending_text ||
+      open_elements.size() != other.open_elements.size() ||
+      active_formatting_list.size() != other.active_formatting_list.size())
+    return false;
+
+  for (size_t i = 0; i < open_elements.size(); ++i)
+  {
+    if (open_elements[i].name != other.open_elements[i].name)
+      return false;
+  }
+
+  // Formatting elements are recreated from their tokens
+  for (size_t i = 0; i < active_formatting_list.size(); ++i)
+  {
+    const active_formatting& a = active_formatting_list[i];
+    const active_formatting& b = other.active_formatting_list[i];
+    if (a.is_marker() != b.is_marker())
+      return false;
+
+    if (!a.is_marker() &&
+	(a.gettoken().tagname != b.gettoken().tagname ||
+	 a.gettoken().attributes != b.gettoken().attributes))
+      return false;
+  }
+
+  return true;
+}
+
+frenzy::parser::treesink::handle
+frenzy::parser::treeconstructor::current_node() const
+{
+  return open_elements.back().node;
+}
+
+const frenzy::ustring&
+frenzy::parser::treeconstructor::current_name() const
+{
+  return open_elements.back().name;
+}
+
+bool
+frenzy::parser::treeconstructor::open_elements_contains(frenzy::parser::treesink::handle elem) const
+{
+  for (open_elements_t::const_iterator it = open_elements.begin();
+       it != open_elements.end();
+       ++it)
+  {
+    if (it->node == elem)
+      return true;
+  }
+
+  return false;
 }
 
 void
-frenzy::parser::treeconstructor::remove_from_open_elements(frenzy::dom::Elementp elem)
+frenzy::parser::treeconstructor::remove_from_open_elements(frenzy::parser::treesink::handle elem,
+							   bool closes)
 {
-  std::vector<dom::Elementp>::iterator it = std::find(open_elements.begin(), open_elements.end(), elem);
-  if (it != open_elements.end())
+  for (open_elements_t::iterator it = open_elements.begin();
+       it != open_elements.end();
+       ++it)
   {
-    open_elements.erase(it);
+    if (it->node == elem)
+    {
+      open_elements.erase(it);
+      if (closes)
+	element_closed(elem);
+      return;
+    }
   }
 }
 
+void
+frenzy::parser::treeconstructor::pop_current_node()
+{
+  handle elem = current_node();
+  open_elements.pop_back();
+  element_closed(elem);
+}
+
+void
+frenzy::parser::treeconstructor::element_closed(frenzy::parser::treesink::handle elem)
+{
+  if (close_listener && !is_ghost(elem))
+    close_listener(elem);
+}
+
 void
 frenzy::parser::treeconstructor::clear_open_elements_to_context(frenzy::stringlist ctx)
 {
-  while (!ctx.contains(current_node()->get_localName()))
+  while (!ctx.contains(current_name()))
   {
-    open_elements.pop_back();
+    pop_current_node();
   }
 }
 
-void
-frenzy::parser::treeconstructor::foster_parent(frenzy::dom::Nodep elem)
+frenzy::parser::treeconstructor::open_elements_t::const_reverse_iterator
+frenzy::parser::treeconstructor::last_table() const
 {
-  std::vector<dom::Elementp>::reverse_iterator lasttable;
+  open_elements_t::const_reverse_iterator lasttable;
   for (lasttable = open_elements.rbegin();
        lasttable != open_elements.rend();
        ++lasttable)
   {
-    if ((*lasttable)->get_localName() == table)
+    if (lasttable->name == table)
       break;
   }
 
+  return lasttable;
+}
+
+void
+frenzy::parser::treeconstructor::foster_parent(frenzy::parser::treesink::handle elem)
+{
+  open_elements_t::const_reverse_iterator lasttable = last_table();
+
   if (lasttable == open_elements.rend())
   {
     assert(!open_elements.empty());
-    open_elements[0]->appendChild(elem);
+    append_node(open_elements[0].node, elem);
     return;
   }
 
-  if (dom::Nodep parent = (*lasttable)->get_parentNode())
+  if (handle parent = parent_element(lasttable->node))
   {
-    if (parent->get_nodeType() == dom::Node::ELEMENT_NODE)
-    {
-      parent->insertBefore(elem, *lasttable);
-      return;
-    }
+    insert_node_before(parent, elem, lasttable->node);
+    return;
   }
 
   ++lasttable;
-  (*lasttable)->appendChild(elem);
+  append_node(lasttable->node, elem);
 }
 
 void
 frenzy::parser::treeconstructor::foster_parent(frenzy::uchar u)
 {
-  std::vector<dom::Elementp>::reverse_iterator lasttable;
-  for (lasttable = open_elements.rbegin();
-       lasttable != open_elements.rend();
-       ++lasttable)
-  {
-    if ((*lasttable)->get_localName() == table)
-      break;
-  }
+  open_elements_t::const_reverse_iterator lasttable = last_table();
 
   if (lasttable == open_elements.rend())
   {
     assert(!open_elements.empty());
-    append_character(u, open_elements[0]);
+    append_character(u, open_elements[0].node);
     return;
   }
 
-  if (dom::Nodep parent = (*lasttable)->get_parentNode())
+  if (handle parent = parent_element(lasttable->node))
   {
-    if (parent->get_nodeType() == dom::Node::ELEMENT_NODE)
-    {
-      if (dom::Nodep prevchild = (*lasttable)->get_previousSibling())
-      {
-	if (prevchild->get_nodeType() == dom::Node::TEXT_NODE)
-	{
-	  dom_cast<dom::Text>(prevchild)->appendData(u);
-	  return;
-	}
-      }
-      dom::Textp t = doc->createTextNode(u);
-      parent->insertBefore(t, *lasttable);
-      return;
-    }
+    queue_text(parent, lasttable->node, u);
+    return;
   }
 
   ++lasttable;
-  append_character(u, *lasttable);
+  append_character(u, lasttable->node);
 }
 
-frenzy::dom::Elementp
+void
+frenzy::parser::treeconstructor::stop_parsing()
+{
+  flush_text();
+  stop = true;
+
+  // The root of a fragment is not an element
+  while (open_elements.size() > (fragment ? 1u : 0u))
+    pop_current_node();
+}
+
+frenzy::parser::treesink::handle
 frenzy::parser::treeconstructor::insert_element_for(frenzy::parser::token t)
 {
-  dom::Elementp ret = create_element_for(t);
+  handle ret = create_element_for(t, skips_children(current_node()));
 
   insert_node(ret);
-  open_elements.push_back(ret);
+  open_elements.push_back(open_element(ret, t.tagname));
 
   // TODO: Handle form owner stuff
   
@@ -233,29 +783,33 @@ frenzy::parser::treeconstructor::insert_element_for(frenzy::parser::token t)
 }
 
 void
-frenzy::parser::treeconstructor::insert_node(frenzy::dom::Nodep node)
+frenzy::parser::treeconstructor::insert_node(frenzy::parser::treesink::handle node)
 {
-  static const stringlist tagnames =
-    stringlist(table) + tbody + tfoot + thead + tr;
-  if (force_foster_parent && tagnames.contains(current_node()->get_localName()))
+  if (force_foster_parent && tablestructure.contains(current_name()))
   {
     return foster_parent(node);
   }
 
-  current_node()->appendChild(node);
+  append_node(current_node(), node);
 }
 
-frenzy::dom::Elementp
-frenzy::parser::treeconstructor::create_element_for(frenzy::parser::token t)
+frenzy::parser::treesink::handle
+frenzy::parser::treeconstructor::create_element_for(const frenzy::parser::token& t, bool ghost)
 {
   assert(t.type == TOKEN_START_TAG);
 
-  dom::Elementp ret = doc->createElement(t.tagname);
-  for (std::map<ustring, ustring>::const_iterator it = t.attributes.begin();
-       it != t.attributes.end();
-       ++it)
+  if (ghost)
+  {
+    ghoststorage.push_back(0);
+    handle ret = &ghoststorage.back();
+    ghosts.insert(ret);
+    return ret;
+  }
+
+  handle ret = sink->create_element(t.tagname, t.attributes);
+  if (options.skip_children.contains(t.tagname))
   {
-    ret->setAttribute(it->first, it->second);
+    skipping.insert(ret);
   }
 
   return ret;
@@ -264,9 +818,7 @@ frenzy::parser::treeconstructor::create_element_for(frenzy::parser::token t)
 void
 frenzy::parser::treeconstructor::insert_character(frenzy::uchar u)
 {
-  static const stringlist tagnames =
-    stringlist(table) + tbody + tfoot + thead + tr;
-  if (force_foster_parent && tagnames.contains(current_node()->get_localName()))
+  if (force_foster_parent && tablestructure.contains(current_name()))
   {
     return foster_parent(u);
   }
@@ -275,24 +827,202 @@ frenzy::parser::treeconstructor::insert_character(frenzy::uchar u)
 }
 
 void
-frenzy::parser::treeconstructor::append_character(frenzy::uchar u, frenzy::dom::Elementp elem)
+frenzy::parser::treeconstructor::append_character(frenzy::uchar u, frenzy::parser::treesink::handle elem)
+{
+  queue_text(elem, NULL, u);
+}
+
+void
+frenzy::parser::treeconstructor::insert_comment(const frenzy::parser::token& t)
+{
+  if (options.drop_comments || skips_children(current_node()))
+    return;
+
+  insert_node(sink->create_comment(t.comment));
+}
+
+void
+frenzy::parser::treeconstructor::append_comment(const frenzy::parser::token& t,
+						frenzy::parser::treesink::handle parent)
+{
+  if (options.drop_comments || skips_children(parent))
+    return;
+
+  append_node(parent, sink->create_comment(t.comment));
+}
+
+void
+frenzy::parser::treeconstructor::append_node(frenzy::parser::treesink::handle parent,
+					     frenzy::parser::treesink::handle child)
 {
-  if (elem->hasChildNodes())
+  flush_text();
+
+  if (is_ghost(child))
+    return;
+
+  if (skips_children(parent))
   {
-    dom::Nodep lastchild = elem->get_lastChild();
-    if (lastchild->get_nodeType() == dom::Node::TEXT_NODE)
-    {
-      dom_cast<dom::Text>(lastchild)->appendData(u);
-      return;
-    }
+    // A created node that is moved to content that is not created
+    sink->remove_from_parent(child);
+    return;
+  }
+
+  sink->append(parent, child);
+  text_parent = NULL;
+}
+
+void
+frenzy::parser::treeconstructor::insert_node_before(frenzy::parser::treesink::handle parent,
+						    frenzy::parser::treesink::handle child,
+						    frenzy::parser::treesink::handle sibling)
+{
+  flush_text();
+
+  if (is_ghost(child))
+    return;
+
+  if (skips_children(parent))
+  {
+    sink->remove_from_parent(child);
+    return;
+  }
+
+  sink->insert_before(parent, child, sibling);
+  text_parent = NULL;
+}
+
+void
+frenzy::parser::treeconstructor::remove_node(frenzy::parser::treesink::handle node)
+{
+  flush_text();
+
+  if (is_ghost(node))
+    return;
+
+  sink->remove_from_parent(node);
+  text_parent = NULL;
+}
+
+void
+frenzy::parser::treeconstructor::reparent_children(frenzy::parser::treesink::handle node,
+						   frenzy::parser::treesink::handle newparent)
+{
+  flush_text();
+
+  // Ghosts have no children in the sink to move, and there is
+  // nowhere to move them to
+  if (skips_children(node) || is_ghost(newparent))
+    return;
+
+  sink->reparent_children(node, newparent);
+  text_parent = NULL;
+}
+
+void
+frenzy::parser::treeconstructor::add_attributes_if_missing(frenzy::parser::treesink::handle elem,
+							   const frenzy::parser::token& t)
+{
+  if (is_ghost(elem))
+    return;
+
+  sink->add_attributes_if_missing(elem, t.attributes);
+}
+
+frenzy::parser::treesink::handle
+frenzy::parser::treeconstructor::parent_element(frenzy::parser::treesink::handle node)
+{
+  if (is_ghost(node))
+    return NULL;
+
+  return sink->get_parent(node);
+}
+
+void
+frenzy::parser::treeconstructor::queue_text(frenzy::parser::treesink::handle parent,
+					    frenzy::parser::treesink::handle sibling,
+					    frenzy::uchar u)
+{
+  if (!pending_text.empty() && (parent != pending_parent || sibling != pending_sibling))
+  {
+    flush_text();
   }
 
-  dom::Textp t = doc->createTextNode(u);
-  elem->appendChild(t);
+  pending_parent = parent;
+  pending_sibling = sibling;
+  pending_text.push_back(u);
 }
 
 void
-frenzy::parser::treeconstructor::push_active_formatting(frenzy::dom::Elementp elem, frenzy::parser::token t)
+frenzy::parser::treeconstructor::flush_text()
+{
+  if (pending_text.empty())
+    return;
+
+  if (!skips_children(pending_parent) && !drops_pending_whitespace())
+  {
+    if (pending_sibling)
+      sink->insert_text_before(pending_parent, pending_sibling, pending_text);
+    else
+      sink->append_text(pending_parent, pending_text);
+
+    text_parent = pending_parent;
+    text_sibling = pending_sibling;
+  }
+
+  pending_text.clear();
+}
+
+bool
+frenzy::parser::treeconstructor::drops_pending_whitespace() const
+{
+  if (!options.drop_whitespace
+      || (pending_parent == text_parent && pending_sibling == text_sibling)
+      || preformatted())
+    return false;
+
+  for (ustring::const_iterator it = pending_text.begin();
+       it != pending_text.end();
+       ++it)
+  {
+    if (!is_whitespace(*it))
+      return false;
+  }
+
+  return true;
+}
+
+bool
+frenzy::parser::treeconstructor::preformatted() const
+{
+  // Elements with text content only
+  if (state == STATE_TEXT)
+    return true;
+
+  for (open_elements_t::const_reverse_iterator it = open_elements.rbegin();
+       it != open_elements.rend();
+       ++it)
+  {
+    if (preformattedelems.contains(it->name))
+      return true;
+  }
+
+  return false;
+}
+
+bool
+frenzy::parser::treeconstructor::is_ghost(frenzy::parser::treesink::handle node) const
+{
+  return !ghosts.empty() && ghosts.count(node);
+}
+
+bool
+frenzy::parser::treeconstructor::skips_children(frenzy::parser::treesink::handle node) const
+{
+  return !skipping.empty() && (skipping.count(node) || ghosts.count(node));
+}
+
+void
+frenzy::parser::treeconstructor::push_active_formatting(frenzy::parser::treesink::handle elem, frenzy::parser::token t)
 {
   active_formatting_list.push_back(active_formatting(elem, t));
 }
@@ -334,7 +1064,7 @@ frenzy::parser::treeconstructor::reconstruct_active_formatting()
   for (; entry != active_formatting_list.end(); ++entry)
   {
     token t = entry->gettoken();
-    dom::Elementp elem = insert_element_for(t);
+    handle elem = insert_element_for(t);
     *entry = active_formatting(elem, t);
   }
 }
@@ -351,7 +1081,7 @@ frenzy::parser::treeconstructor::clear_active_formatting_up_to_last_marker()
   }
 }
 
-frenzy::dom::Elementp
+frenzy::parser::treesink::handle
 frenzy::parser::treeconstructor::find_active_formatting_after_last_marker(frenzy::ustring name)
 {
   for (std::vector<active_formatting>::const_reverse_iterator it = active_formatting_list.rbegin();
@@ -359,17 +1089,17 @@ frenzy::parser::treeconstructor::find_active_formatting_after_last_marker(frenzy
        ++it)
   {
     if (it->is_marker())
-      return dom::Elementp();
+      return NULL;
 
-    if (it->element()->get_localName() == name)
+    if (it->gettoken().tagname == name)
       return it->element();
   }
 
-  return dom::Elementp();
+  return NULL;
 }
 
 void
-frenzy::parser::treeconstructor::remove_from_active_formatting(frenzy::dom::Elementp elem)
+frenzy::parser::treeconstructor::remove_from_active_formatting(frenzy::parser::treesink::handle elem)
 {
   for (std::vector<active_formatting>::iterator it = active_formatting_list.begin();
        it != active_formatting_list.end();
@@ -387,68 +1117,101 @@ bool
 frenzy::parser::treeconstructor::needs_implied_end_tag(frenzy::ustring name) const
 {
   // HTML5 8.2.5.2
-  static const stringlist list =
-    stringlist(dd) + dt + li + option + optgroup + p + rp + rt;
-
-  return list.contains(name);
+  return impliedendtags.contains(name);
 }
 
 void
 frenzy::parser::treeconstructor::generate_implied_end_tags()
 {
-  while (needs_implied_end_tag(current_node()->get_localName()))
+  while (needs_implied_end_tag(current_name()))
   {
-    open_elements.pop_back();
+    pop_current_node();
   }
 }
 
 void
 frenzy::parser::treeconstructor::generate_implied_end_tags_except(frenzy::ustring name)
 {
-  while (current_node()->get_localName() != name && needs_implied_end_tag(current_node()->get_localName()))
+  while (current_name() != name && needs_implied_end_tag(current_name()))
   {
-    open_elements.pop_back();
+    pop_current_node();
   }
 }
 
+bool
+frenzy::parser::treeconstructor::has_element_in_specific_scope(const frenzy::stringlist& scope,
+							       const frenzy::ustring& name) const
+{
+  for (open_elements_t::const_reverse_iterator it = open_elements.rbegin();
+       it != open_elements.rend();
+       ++it)
+  {
+    if (it->name == name)
+      return true;
+
+    if (scope.contains(it->name))
+      return false;
+  }
+
+  throw std::logic_error("Should not be reached: No html element in stack");
+}
+
+bool
+frenzy::parser::treeconstructor::has_element_in_specific_scope(const frenzy::stringlist& scope,
+							       const frenzy::stringlist& names) const
+{
+  for (open_elements_t::const_reverse_iterator it = open_elements.rbegin();
+       it != open_elements.rend();
+       ++it)
+  {
+    if (names.contains(it->name))
+      return true;
+
+    if (scope.contains(it->name))
+      return false;
+  }
+
+  throw std::logic_error("Should not be reached: No html element in stack");
+}
+
 bool
 frenzy::parser::treeconstructor::has_element_in_scope(frenzy::stringlist names) const
 {
-  return has_element_in_specific_scope(open_elements, elemscope, names);
+  return has_element_in_specific_scope(elemscope, names);
 }
 
 bool
 frenzy::parser::treeconstructor::has_element_in_scope(frenzy::ustring name) const
 {
-  return has_element_in_specific_scope(open_elements, elemscope, name);
+  return has_element_in_specific_scope(elemscope, name);
 }
 
 bool
 frenzy::parser::treeconstructor::has_element_in_button_scope(frenzy::ustring name) const
 {
-  return has_element_in_specific_scope(open_elements, buttonscope, name);
+  return has_element_in_specific_scope(buttonscope, name);
 }
 
 bool
 frenzy::parser::treeconstructor::has_element_in_list_scope(frenzy::ustring name) const
 {
-  return has_element_in_specific_scope(open_elements, listscope, name);
+  return has_element_in_specific_scope(listscope, name);
 }
 
 bool
 frenzy::parser::treeconstructor::has_element_in_table_scope(frenzy::ustring name) const
 {
-  return has_element_in_specific_scope(open_elements, tablescope, name);
+  return has_element_in_specific_scope(tablescope, name);
 }
 
 bool
 frenzy::parser::treeconstructor::has_element_in_select_scope(frenzy::ustring name) const
 {
-  for (std::vector<frenzy::dom::Elementp>::const_reverse_iterator it = open_elements.rbegin();
+  for (open_elements_t::const_reverse_iterator it = open_elements.rbegin();
        it != open_elements.rend();
        ++it)
   {
-    frenzy::ustring t = (*it)->get_localName();
+    frenzy::ustring t = it->name;
     if (t == name)
       return true;
     
@@ -468,40 +1231,37 @@ frenzy::parser::treeconstructor::is_special(frenzy::ustring name)
 void
 frenzy::parser::treeconstructor::reset_insertion_mode()
 {
-  // TODO: This needs to be the proper member variable when fragment
-  // parsing is implemented
-  dom::Elementp mockcontext;
-
   bool last = false;
 
-  std::vector<dom::Elementp>::const_iterator it = open_elements.end();
-  --it;
+  open_elements_t::const_iterator node = open_elements.end();
+  --node;
 
   while (true)
   {
-    dom::Elementp node = *it;
-
-    if (it == open_elements.begin())
+    if (node == open_elements.begin())
     {
       last = true;
-      node = mockcontext;
     }
     
-    ustring name = node->get_localName();
+    if (last && fragment && context.foreign)
+    {
+      // An SVG or MathML name is not an HTML element
+      state = STATE_IN_BODY;
+      return;
+    }
+
+    const ustring& name = (last && fragment) ? context.name : node->name;
 
     // A special case
-    static const stringlist tdth = stringlist(td) + th;
-    if (!last && tdth.contains(name))
+    if (!last && tablecells.contains(name))
     {
       state = STATE_IN_CELL;
       return;
     }
     
-    static const std::map<ustring, parserstate> mapping = get_reset_mapping();
-    
-    std::map<ustring, parserstate>::const_iterator it = mapping.find(name);
+    std::map<ustring, parserstate>::const_iterator it = reset_mapping.find(name);
 
-    if (it != mapping.end())
+    if (it != reset_mapping.end())
     {
       state = it->second;
       return;
@@ -513,7 +1273,7 @@ frenzy::parser::treeconstructor::reset_insertion_mode()
       return;
     }
 
-    --it;
+    --node;
   }
 }
 
@@ -538,12 +1298,20 @@ frenzy::parser::treeconstructor::get_reset_mapping()
   return ret;
 }
 
+const std::map<frenzy::ustring, frenzy::parser::treeconstructor::parserstate>
+frenzy::parser::treeconstructor::reset_mapping = frenzy::parser::treeconstructor::get_reset_mapping();
+
 void
 frenzy::parser::treeconstructor::process_token(const frenzy::parser::token& t)
 {
   if (stop)
     return;
 
+  if (t.type != TOKEN_CHARACTER)
+  {
+    flush_text();
+  }
+
   bool was_ignore = ignore_next_lf;
   ignore_next_lf = false;
 
@@ -641,7 +1409,7 @@ frenzy::parser::treeconstructor::state_initial(const token& t)
     }
     break;
   case TOKEN_COMMENT:
-    doc->appendChild(doc->createComment(t.comment));
+    append_comment(t, sink->document());
     return;
   case TOKEN_DOCTYPE:
     // TODO: Parse errors depending on the doctype token contents
@@ -670,7 +1438,7 @@ frenzy::parser::treeconstructor::state_before_html(const token& t)
     // Ignore the token
     return;
   case TOKEN_COMMENT:
-    doc->appendChild(doc->createComment(t.comment));
+    append_comment(t, sink->document());
     return;
   case TOKEN_CHARACTER:
     switch (t.character)
@@ -689,9 +1457,9 @@ frenzy::parser::treeconstructor::state_before_html(const token& t)
   case TOKEN_START_TAG:
     if (t.tagname == html::html)
     {
-      dom::Elementp elem = create_element_for(t);
-      doc->appendChild(elem);
-      open_elements.push_back(elem);
+      handle elem = create_element_for(t, false);
+      append_node(sink->document(), elem);
+      open_elements.push_back(open_element(elem, html::html));
       // TODO: Run the application cache selection here, as per 5.7.5
       // depending on the element's manifest attribute
       state = STATE_BEFORE_HEAD;
@@ -700,8 +1468,7 @@ frenzy::parser::treeconstructor::state_before_html(const token& t)
     break;
   case TOKEN_END_TAG:
     {
-      static const stringlist tagnames = stringlist(head) + body + html::html + br;
-      if (tagnames.contains(t.tagname))
+      if (headbodyhtmlbr.contains(t.tagname))
       {
 	break;
       }
@@ -714,9 +1481,9 @@ frenzy::parser::treeconstructor::state_before_html(const token& t)
     break;
   }
 
-  dom::Elementp elem = create_element_for(token::make_start_tag(html::html));
-  doc->appendChild(elem);
-  open_elements.push_back(elem);
+  handle elem = create_element_for(token::make_start_tag(html::html), false);
+  append_node(sink->document(), elem);
+  open_elements.push_back(open_element(elem, html::html));
   // TODO: Application cache selection with no manifest
   state = STATE_BEFORE_HEAD;
   process_token(t);
@@ -742,7 +1509,7 @@ frenzy::parser::treeconstructor::state_before_head(const token& t)
     }
     break;
   case TOKEN_COMMENT:
-    insert_node(doc->createComment(t.comment));
+    insert_comment(t);
     return;
   case TOKEN_DOCTYPE:
     // TODO: Should produce a parse error
@@ -754,7 +1521,7 @@ frenzy::parser::treeconstructor::state_before_head(const token& t)
 
     if (t.tagname == head)
     {
-      dom::Elementp h = insert_element_for(t);
+      handle h = insert_element_for(t);
       head_element = h;
       state = STATE_IN_HEAD;
       return;
@@ -763,8 +1530,7 @@ frenzy::parser::treeconstructor::state_before_head(const token& t)
     break;
   case TOKEN_END_TAG:
     {
-      static const stringlist tagnames = stringlist(head) + body + html::html + br;
-      if (tagnames.contains(t.tagname))
+      if (headbodyhtmlbr.contains(t.tagname))
       {
 	break;
       }
@@ -802,7 +1568,7 @@ frenzy::parser::treeconstructor::state_in_head(const token& t)
     }
     break;
   case TOKEN_COMMENT:
-    insert_node(doc->createComment(t.comment));
+    insert_comment(t);
     return;
   case TOKEN_DOCTYPE:
     // TODO: Should produce a parse error
@@ -813,11 +1579,10 @@ frenzy::parser::treeconstructor::state_in_head(const token& t)
       return state_in_body(t);
 
     {
-      static const stringlist tagnames = stringlist(base) + basefont + bgsound + command + html::link;
-      if (tagnames.contains(t.tagname))
+      if (headvoidelems.contains(t.tagname))
       {
 	insert_element_for(t);
-	open_elements.pop_back();
+	pop_current_node();
 	// TODO: Acknowledge self-closing flag
 	return;
       }
@@ -826,7 +1591,7 @@ frenzy::parser::treeconstructor::state_in_head(const token& t)
     if (t.tagname == meta)
     {
       insert_element_for(t);
-      open_elements.pop_back();
+      pop_current_node();
       // TODO: Acknowledge self-closing flag
       // TODO: Change character encoding if confidence tentative and appropriate attributes are set
       return;
@@ -863,11 +1628,11 @@ frenzy::parser::treeconstructor::state_in_head(const token& t)
 
     if (t.tagname == script)
     {
-      dom::Elementp scr = create_element_for(t);
+      handle scr = create_element_for(t, skips_children(current_node()));
       // TODO: Mark scr as parser-inserted and set its force-async to false
       // TODO: If parser created for fragment parsing, mark scr as already-started
-      current_node()->appendChild(scr);
-      open_elements.push_back(scr);
+      append_node(current_node(), scr);
+      open_elements.push_back(open_element(scr, t.tagname));
       tok->change_state(htmltokenizer::STATE_SCRIPT_DATA);
       origstate = state;
       state = STATE_TEXT;
@@ -885,7 +1650,7 @@ frenzy::parser::treeconstructor::state_in_head(const token& t)
   case TOKEN_END_TAG:
     if (t.tagname == head)
     {
-      open_elements.pop_back();
+      pop_current_node();
       state = STATE_AFTER_HEAD;
       return;
     }
@@ -925,9 +1690,7 @@ frenzy::parser::treeconstructor::state_in_head_noscript(const token& t)
     }
 
     {
-      static const stringlist tagnames =
-	stringlist(basefont) + bgsound + html::link + meta + noframes + style;
-      if (tagnames.contains(t.tagname))
+      if (noscriptheadelems.contains(t.tagname))
       {
 	return state_in_head(t);
       }
@@ -944,11 +1707,11 @@ frenzy::parser::treeconstructor::state_in_head_noscript(const token& t)
   case TOKEN_END_TAG:
     if (t.tagname == noscript)
     {
-      assert(current_node()->get_localName() == noscript);
+      assert(current_name() == noscript);
 
-      open_elements.pop_back();
+      pop_current_node();
 
-      assert(current_node()->get_localName() == head);
+      assert(current_name() == head);
 
       state = STATE_IN_HEAD;
       return;
@@ -1007,7 +1770,7 @@ frenzy::parser::treeconstructor::state_after_head(const token& t)
     }
     break;
   case TOKEN_COMMENT:
-    insert_node(doc->createComment(t.comment));
+    insert_comment(t);
     return;
   case TOKEN_DOCTYPE:
     // TODO: Should produce a parse error
@@ -1033,15 +1796,12 @@ frenzy::parser::treeconstructor::state_after_head(const token& t)
     }
 
     {
-      static const stringlist tagnames =
-	stringlist(base) + basefont + bgsound + html::link +
-	meta + noframes + script + style + title;
-      if (tagnames.contains(t.tagname))
+      if (afterheadelems.contains(t.tagname))
       {
 	// TODO: Should produce a parse error
-	open_elements.push_back(head_element);
+	open_elements.push_back(open_element(head_element, head));
 	state_in_head(t);
-	remove_from_open_elements(head_element);
+	remove_from_open_elements(head_element, false);
 	return;
       }
     }
@@ -1103,7 +1863,7 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
     }
     break;
   case TOKEN_COMMENT:
-    insert_node(doc->createComment(t.comment));
+    insert_comment(t);
     return;
   case TOKEN_DOCTYPE:
     // TODO: Should produce a parse error
@@ -1113,26 +1873,17 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
     if (t.tagname == html::html)
     {
       // TODO: Should produce a parse error
-      dom::Elementp top = open_elements.front();
-
-      for (std::map<ustring, ustring>::const_iterator it = t.attributes.begin();
-	   it != t.attributes.end();
-	   ++it)
+      // When parsing a fragment, the root is not an html element
+      if (!fragment)
       {
-	if (!top->hasAttribute(it->first))
-	{
-	  top->setAttribute(it->first, it->second);
-	}
+	add_attributes_if_missing(open_elements.front().node, t);
       }
 
       return;
     }
 
     {
-      static const stringlist tagnames =
-	stringlist(base) + basefont + bgsound + command +
-	html::link + meta + noframes + script + style + title;
-      if (tagnames.contains(t.tagname))
+      if (inheadelems.contains(t.tagname))
       {
 	return state_in_head(t);
       }
@@ -1141,7 +1892,7 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
     if (t.tagname == body)
     {
       // TODO: Should produce a parse error
-      if (open_elements.size() == 1 || open_elements[1]->get_localName() != body)
+      if (open_elements.size() == 1 || open_elements[1].name != body)
       {
 	// Ignore the token
 	return;
@@ -1149,16 +1900,7 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
 
       frameset_ok = false;
 
-      dom::Elementp body = open_elements[1];
-      for (std::map<ustring, ustring>::const_iterator it = t.attributes.begin();
-	   it != t.attributes.end();
-	   ++it)
-      {
-	if (!body->hasAttribute(it->first))
-	{
-	  body->setAttribute(it->first, it->second);
-	}
-      }
+      add_attributes_if_missing(open_elements[1].node, t);
       
       return;
     }
@@ -1166,7 +1908,7 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
     if (t.tagname == frameset)
     {
       // TODO: Should produce a parse error
-      if (open_elements.size() == 1 || open_elements[1]->get_localName() != body)
+      if (open_elements.size() == 1 || open_elements[1].name != body)
       {
 	// Ignore the token
 	return;
@@ -1178,13 +1920,9 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
 	return;
       }
 
-      dom::Elementp body = open_elements[1];
-      if (dom::Nodep p = body->get_parentNode())
-      {
-	p->removeChild(body);
-      }
+      remove_node(open_elements[1].node);
 
-      open_elements.resize(1);
+      open_elements.erase(open_elements.begin() + 1, open_elements.end());
       insert_element_for(t);
       state = STATE_IN_FRAMESET;
 
@@ -1192,12 +1930,7 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
     }
 
     {
-      static const stringlist tagnames =
-	stringlist(address) + article + aside + blockquote + center +
-	details + dialog + dir + html::div + dl + fieldset + figcaption +
-	figure + footer + header + hgroup + menu + nav + ol + p +
-	section + summary + ul;
-      if (tagnames.contains(t.tagname))
+      if (blockelems.contains(t.tagname))
       {
 	if (has_element_in_button_scope(p))
 	{
@@ -1211,9 +1944,7 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
     }
 
     {
-      static const stringlist tagnames =
-	stringlist(h1) + h2 + h3 + h4 + h5 + h6;
-      if (tagnames.contains(t.tagname))
+      if (headings.contains(t.tagname))
       {
 	if (has_element_in_button_scope(p))
 	{
@@ -1221,12 +1952,10 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
 	  process_token(token::make_end_tag(p));
 	}
 	
-	dom::Elementp current = current_node();
-	ustring name = current->get_localName();
-	if (tagnames.contains(name))
+	if (headings.contains(current_name()))
 	{
 	  // TODO: Should produce a parse error
-	  open_elements.pop_back();
+	  pop_current_node();
 	}
 	
 	insert_element_for(t);
@@ -1264,7 +1993,7 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
 	process_token(token::make_end_tag(p));
       }
 
-      dom::Elementp elem = insert_element_for(t);
+      handle elem = insert_element_for(t);
       current_form = elem;
       return;
     }
@@ -1273,11 +2002,11 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
     {
       frameset_ok = false;
 
-      for (std::vector<dom::Elementp>::const_reverse_iterator it = open_elements.rbegin();
+      for (open_elements_t::const_reverse_iterator it = open_elements.rbegin();
 	   it != open_elements.rend();
 	   ++it)
       {
-	ustring name = (*it)->get_localName();
+	ustring name = it->name;
 	
 	if (name == t.tagname)
 	{
@@ -1286,8 +2015,7 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
 	  break;
 	}
 	
-	static const stringlist exclude = stringlist(address) + html::div + p;
-	if (is_special(name) && !exclude.contains(name))
+	if (is_special(name) && !addressdivp.contains(name))
 	{
 	  break;
 	}
@@ -1308,11 +2036,11 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
     {
       frameset_ok = false;
       
-      for (std::vector<dom::Elementp>::const_reverse_iterator it = open_elements.rbegin();
+      for (open_elements_t::const_reverse_iterator it = open_elements.rbegin();
 	   it != open_elements.rend();
 	   ++it)
       {
-	ustring name = (*it)->get_localName();
+	ustring name = it->name;
 	if (name == dd || name == dt)
 	{
 	  // Process implied end tag
@@ -1370,7 +2098,7 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
 
     if (t.tagname == a)
     {
-      if (dom::Elementp elem = find_active_formatting_after_last_marker(t.tagname))
+      if (handle elem = find_active_formatting_after_last_marker(t.tagname))
       {
 	// TODO: Should produce a parse error
 	// Process implied </a>
@@ -1382,19 +2110,17 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
 
       reconstruct_active_formatting();
 
-      dom::Elementp elem = insert_element_for(t);
+      handle elem = insert_element_for(t);
       push_active_formatting(elem, t);
       return;
     }
 
     {
-      static const stringlist tagnames =
-	stringlist(b) + big + code + em + font + i + s + small + strike + strong + tt + u;
-      if (tagnames.contains(t.tagname))
+      if (formattingelems.contains(t.tagname))
       {
 	reconstruct_active_formatting();
 	
-	dom::Elementp elem = insert_element_for(t);
+	handle elem = insert_element_for(t);
 	push_active_formatting(elem, t);
 	
 	return;
@@ -1412,7 +2138,7 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
 	reconstruct_active_formatting();
       }
 
-      dom::Elementp elem = insert_element_for(t);
+      handle elem = insert_element_for(t);
       push_active_formatting(elem, t);
       return;
     }
@@ -1444,13 +2170,12 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
     }
     
     {
-      static const stringlist tagnames = stringlist(area) + br + embed + img + keygen + wbr;
-      if (tagnames.contains(t.tagname))
+      if (voidinlineelems.contains(t.tagname))
       {
 	reconstruct_active_formatting();
 	
 	insert_element_for(t);
-	open_elements.pop_back();
+	pop_current_node();
 	
 	// TODO: Acknowledge self-closing flag
 	frameset_ok = false;
@@ -1463,7 +2188,7 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
       reconstruct_active_formatting();
       
       insert_element_for(t);
-      open_elements.pop_back();
+      pop_current_node();
 
       // TODO: Acknowledge self-closing flag
 
@@ -1482,7 +2207,7 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
 	|| t.tagname == track)
     {
       insert_element_for(t);
-      open_elements.pop_back();
+      pop_current_node();
       // TODO: Acknowledge self-closing flag
       return;
     }
@@ -1496,7 +2221,7 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
       }
 
       insert_element_for(t);
-      open_elements.pop_back();
+      pop_current_node();
       // TODO: Acknowledge self-closing flag
       frameset_ok = false;
       return;
@@ -1596,7 +2321,7 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
     if (t.tagname == optgroup
 	|| t.tagname == option)
     {
-      if (current_node()->get_localName() == option)
+      if (current_name() == option)
       {
 	// Process implied </option>
 	process_token(token::make_end_tag(option));
@@ -1615,7 +2340,7 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
 	generate_implied_end_tags();
       }
       
-      if (current_node()->get_localName() != ruby)
+      if (current_name() != ruby)
       {
 	// TODO: Should produce a parse error
       }
@@ -1637,10 +2362,7 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
     }
 
     {
-      static const stringlist tagnames =
-	stringlist(caption) + col + colgroup + frame + head +
-	tbody + td + tfoot + th + thead + tr;
-      if (tagnames.contains(t.tagname))
+      if (ignoredinbody.contains(t.tagname))
       {
 	// TODO: Should produce a parse error
 	// Ignore the token
@@ -1687,12 +2409,7 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
     }
 
     {
-      static const stringlist tagnames =
-	stringlist(address) + article + aside + blockquote + button +
-	center + details + dialog + dir + html::div + dl + fieldset +
-	figcaption + figure + footer + header + hgroup + listing +
-	menu + nav + ol + pre + section + summary + ul;
-      if (tagnames.contains(t.tagname))
+      if (blockendtags.contains(t.tagname))
       {
 	if (!has_element_in_scope(t.tagname))
 	{
@@ -1702,16 +2419,16 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
 	}
 	
 	generate_implied_end_tags();
-	if (current_node()->get_localName() != t.tagname)
+	if (current_name() != t.tagname)
 	{
 	  // TODO: Should produce a parse error
 	}
 	
-	while (current_node()->get_localName() != t.tagname)
+	while (current_name() != t.tagname)
 	{
-	  open_elements.pop_back();
+	  pop_current_node();
 	}
-	open_elements.pop_back();
+	pop_current_node();
 	
 	return;
       }
@@ -1719,8 +2436,8 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
 
     if (t.tagname == form)
     {
-      dom::Elementp node;
-      node.swap(current_form);
+      handle node = current_form;
+      current_form = NULL;
 
       if (!node || !has_element_in_scope(t.tagname))
       {
@@ -1751,16 +2468,16 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
       }
 
       generate_implied_end_tags_except(t.tagname);
-      if (current_node()->get_localName() != t.tagname)
+      if (current_name() != t.tagname)
       {
 	// TODO: Should produce a parse error
       }
 
-      while (current_node()->get_localName() != t.tagname)
+      while (current_name() != t.tagname)
       {
-	open_elements.pop_back();
+	pop_current_node();
       }
-      open_elements.pop_back();
+      pop_current_node();
 
       return;
     }
@@ -1776,16 +2493,16 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
 
       generate_implied_end_tags_except(t.tagname);
 
-      if (current_node()->get_localName() != t.tagname)
+      if (current_name() != t.tagname)
       {
 	// TODO: Should produce a parse error
       }
 
-      while (current_node()->get_localName() != t.tagname)
+      while (current_name() != t.tagname)
       {
-	open_elements.pop_back();
+	pop_current_node();
       }
-      open_elements.pop_back();
+      pop_current_node();
       
       return;
     }
@@ -1802,26 +2519,24 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
       
       generate_implied_end_tags_except(t.tagname);
       
-      if (current_node()->get_localName() != t.tagname)
+      if (current_name() != t.tagname)
       {
 	// TODO: Should produce a parse error
       }
       
-      while (current_node()->get_localName() != t.tagname)
+      while (current_name() != t.tagname)
       {
-	open_elements.pop_back();
+	pop_current_node();
       }
-      open_elements.pop_back();
+      pop_current_node();
       
       return;
     }
 
     {
-      static const stringlist tagnames =
-	stringlist(h1) + h2 + h3 + h4 + h5 + h6;
-      if (tagnames.contains(t.tagname))
+      if (headings.contains(t.tagname))
       {
-	if (!has_element_in_scope(tagnames))
+	if (!has_element_in_scope(headings))
 	{
 	  // TODO: Should produce a parse error
 	  // Ignore the token
@@ -1830,52 +2545,50 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
 
 	generate_implied_end_tags();
 	
-	if (current_node()->get_localName() != t.tagname)
+	if (current_name() != t.tagname)
 	{
 	  // TODO: Should produce a parse error
 	}
 	
-	while (current_node()->get_localName() != t.tagname)
+	while (current_name() != t.tagname)
 	{
-	  open_elements.pop_back();
+	  pop_current_node();
 	}
-	open_elements.pop_back();
+	pop_current_node();
 	
 	return;
       }
     }
 
     {
-      static const stringlist tagnames =
-	stringlist(a) + b + big + code + em + font + i + nobr + s + small + strike + strong + tt + u;
-      if (tagnames.contains(t.tagname))
+      if (adoptionagencyelems.contains(t.tagname))
       {
 	// Magic number '8' is from the spec
 	for (size_t i = 0; i < 8; ++i)
 	{
-	  dom::Elementp elem = find_active_formatting_after_last_marker(t.tagname);
+	  handle elem = find_active_formatting_after_last_marker(t.tagname);
 
 	  if (!elem)
 	  {
 	    // TODO: Same code as "any other end tag". Possibly refactor.
-	    for (std::vector<dom::Elementp>::const_reverse_iterator it = open_elements.rbegin();
+	    for (open_elements_t::const_reverse_iterator it = open_elements.rbegin();
 		 it != open_elements.rend();
 		 ++it)
 	    {
-	      ustring name = (*it)->get_localName();
+	      ustring name = it->name;
 	      if (name == t.tagname)
 	      {
 		generate_implied_end_tags_except(t.tagname);
-		if (current_node()->get_localName() != t.tagname)
+		if (current_name() != t.tagname)
 		{
 		  // TODO: Should produce a parse error
 		}
 		
-		while (current_node()->get_localName() != t.tagname)
+		while (current_name() != t.tagname)
 		{
-		  open_elements.pop_back();
+		  pop_current_node();
 		}
-		open_elements.pop_back();
+		pop_current_node();
 		return;
 	      }
 	      
@@ -1904,7 +2617,7 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
 	  size_t elempos = 0;
 	  for (; elempos < open_elements.size(); ++elempos)
 	  {
-	    if (open_elements[elempos] == elem)
+	    if (open_elements[elempos].node == elem)
 	      break;
 	  }
 
@@ -1930,14 +2643,14 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
 	  size_t furthestblock = elempos + 1;
 	  for (; furthestblock < open_elements.size(); ++furthestblock)
 	  {
-	    if (is_special(open_elements[furthestblock]->get_localName()))
+	    if (is_special(open_elements[furthestblock].name))
 	      break;
 	  }
 	  if (furthestblock >= open_elements.size())
 	  {
 	    while (current_node() != elem)
-	      open_elements.pop_back();
-	    open_elements.pop_back();
+	      pop_current_node();
+	    pop_current_node();
 
 	    remove_from_active_formatting(elem);
 	    return;
@@ -1966,12 +2679,13 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
 	    size_t nodeinactive = 0;
 	    for (; nodeinactive < active_formatting_list.size(); ++nodeinactive)
 	    {
-	      if (active_formatting_list[nodeinactive].element() == open_elements[node])
+	      if (active_formatting_list[nodeinactive].element() == open_elements[node].node)
 		break;
 	    }
 
 	    if (nodeinactive >= active_formatting_list.size())
 	    {
+	      element_closed(open_elements[node - 1].node);
 	      open_elements.erase(open_elements.begin() + node - 1);
 	      continue;
 	    }
@@ -1982,10 +2696,10 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
 	    }
 	    
 	    token newelemtoken = active_formatting_list[nodeinactive].gettoken();
-	    dom::Elementp newelem = create_element_for(newelemtoken);
+	    handle newelem = create_element_for(newelemtoken, is_ghost(open_elements[node].node));
 	    
 	    active_formatting_list[nodeinactive] = active_formatting(newelem, newelemtoken);
-	    open_elements[node] = newelem;
+	    open_elements[node] = open_element(newelem, newelemtoken.tagname);
 	    
 	    if (lastnode == furthestblock)
 	    {
@@ -1993,7 +2707,7 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
 	    }
 
 	    assert(lastnode < open_elements.size());
-	    open_elements[node]->appendChild(open_elements[lastnode]);
+	    append_node(open_elements[node].node, open_elements[lastnode].node);
 	    
 	    lastnode = node;
 	  }
@@ -2002,26 +2716,19 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
 	  assert(lastnode < open_elements.size());
 	  assert(furthestblock < open_elements.size());
 
-	  static const stringlist tagnames =
-	    stringlist(table) + tbody + tfoot + thead + tr;
-	  if (tagnames.contains(open_elements[commonancestor]->get_localName()))
+	  if (tablestructure.contains(open_elements[commonancestor].name))
 	  {
-	    foster_parent(open_elements[lastnode]);
+	    foster_parent(open_elements[lastnode].node);
 	  }
 	  else
 	  {
-	    open_elements[commonancestor]->appendChild(open_elements[lastnode]);
+	    append_node(open_elements[commonancestor].node, open_elements[lastnode].node);
 	  }
 
-	  dom::Elementp anothernewelem = create_element_for(elemtoken);
+	  handle anothernewelem = create_element_for(elemtoken, is_ghost(elem));
 
-	  dom::NodeListp children = open_elements[furthestblock]->get_childNodes();
-	  for (size_t i = 0; i < children->get_length(); ++i)
-	  {
-	    dom::Nodep child = children->item(i);
-	    anothernewelem->appendChild(child);
-	  }
-	  open_elements[furthestblock]->appendChild(anothernewelem);
+	  reparent_children(open_elements[furthestblock].node, anothernewelem);
+	  append_node(open_elements[furthestblock].node, anothernewelem);
 
 	  assert(bookmark <= active_formatting_list.size());
 
@@ -2029,7 +2736,7 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
 	  active_formatting_list.insert(active_formatting_list.begin() + bookmark, active_formatting(anothernewelem, elemtoken));
 	  remove_from_active_formatting(elem);
 
-	  open_elements.insert(open_elements.begin() + furthestblock + 1, anothernewelem);
+	  open_elements.insert(open_elements.begin() + furthestblock + 1, open_element(anothernewelem, elemtoken.tagname));
 	  remove_from_open_elements(elem);
 	}
 
@@ -2050,16 +2757,16 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
       
       generate_implied_end_tags();
       
-      if (current_node()->get_localName() != t.tagname)
+      if (current_name() != t.tagname)
       {
 	// TODO: Should produce a parse error
       }
       
-      while (current_node()->get_localName() != t.tagname)
+      while (current_name() != t.tagname)
       {
-	open_elements.pop_back();
+	pop_current_node();
       }
-      open_elements.pop_back();
+      pop_current_node();
       
       clear_active_formatting_up_to_last_marker();
       
@@ -2074,24 +2781,24 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
       return;
     }
 
-    for (std::vector<dom::Elementp>::const_reverse_iterator it = open_elements.rbegin();
+    for (open_elements_t::const_reverse_iterator it = open_elements.rbegin();
 	 it != open_elements.rend();
 	 ++it)
     {
-      ustring name = (*it)->get_localName();
+      ustring name = it->name;
       if (name == t.tagname)
       {
 	generate_implied_end_tags_except(t.tagname);
-	if (current_node()->get_localName() != t.tagname)
+	if (current_name() != t.tagname)
 	{
 	  // TODO: Should produce a parse error
 	}
 	
-	while (current_node()->get_localName() != t.tagname)
+	while (current_name() != t.tagname)
 	{
-	  open_elements.pop_back();
+	  pop_current_node();
 	}
-	open_elements.pop_back();
+	pop_current_node();
 	return;
       }
       
@@ -2106,21 +2813,18 @@ frenzy::parser::treeconstructor::state_in_body(const token& t)
     return;
   case TOKEN_END_OF_FILE:
     {
-      static const stringlist tagnames =
-	stringlist(dd) + dt + li + p + tbody + td + tfoot + th + thead + tr + body + html::html;
-
-      for (std::vector<dom::Elementp>::const_iterator it = open_elements.begin();
+      for (open_elements_t::const_iterator it = open_elements.begin();
 	   it != open_elements.end();
 	   ++it)
       {
-	if (!tagnames.contains((*it)->get_localName()))
+	if (!eofallowedopen.contains(it->name))
 	{
 	  // TODO: Should produce a parse error
 	}
       }
     }
 
-    stop = true;
+    stop_parsing();
     return;
   }
 
@@ -2138,12 +2842,12 @@ frenzy::parser::treeconstructor::state_text(const token& t)
     return;
   case TOKEN_END_OF_FILE:
     // TODO: Should produce a parse error
-    if (current_node()->get_localName() == script)
+    if (current_name() == script)
     {
       // TODO: Mark current_node() as 'already started'
     }
 
-    open_elements.pop_back();
+    pop_current_node();
     state = origstate;
     return process_token(t);
   case TOKEN_END_TAG:
@@ -2151,12 +2855,12 @@ frenzy::parser::treeconstructor::state_text(const token& t)
     {
       // TODO: Implement
       // This is where the script gets executed etc.
-      open_elements.pop_back();
+      pop_current_node();
       state = origstate;
       return;
     }
 
-    open_elements.pop_back();
+    pop_current_node();
     state = origstate;
     return;
   default:
@@ -2168,16 +2872,12 @@ frenzy::parser::treeconstructor::state_text(const token& t)
 void
 frenzy::parser::treeconstructor::state_in_table(const token& t)
 {
-  static const stringlist tablecontext = stringlist(table) + html::html;
-
   switch (t.type)
   {
   case TOKEN_CHARACTER:
     {
-      ustring currentname = current_node()->get_localName();
-      static const stringlist tagnames =
-	stringlist(table) + tbody + tfoot + thead + tr;
-      if (tagnames.contains(currentname))
+      ustring currentname = current_name();
+      if (tablestructure.contains(currentname))
       {
 	pending_table_characters.clear();
 	origstate = state;
@@ -2187,7 +2887,7 @@ frenzy::parser::treeconstructor::state_in_table(const token& t)
     }
     break;
   case TOKEN_COMMENT:
-    insert_node(doc->createComment(t.comment));
+    insert_comment(t);
     return;
   case TOKEN_DOCTYPE:
     // TODO: Should produce a parse error
@@ -2268,7 +2968,7 @@ frenzy::parser::treeconstructor::state_in_table(const token& t)
 
       // TODO: Should produce a parse error
       insert_element_for(t);
-      open_elements.pop_back();
+      pop_current_node();
       // TODO: Acknowledge self-closing flag
       return;
     }
@@ -2282,9 +2982,9 @@ frenzy::parser::treeconstructor::state_in_table(const token& t)
 	return;
       }
 
-      dom::Elementp elem = insert_element_for(t);
+      handle elem = insert_element_for(t);
       current_form = elem;
-      open_elements.pop_back();
+      pop_current_node();
       return;
     }
 
@@ -2299,20 +2999,18 @@ frenzy::parser::treeconstructor::state_in_table(const token& t)
 	return;
       }
 
-      while (current_node()->get_localName() != table)
+      while (current_name() != table)
       {
-	open_elements.pop_back();
+	pop_current_node();
       }
-      open_elements.pop_back();
+      pop_current_node();
 
       reset_insertion_mode();
       return;
     }
 
     {
-      static const stringlist tagnames =
-	stringlist(body) + caption + col + colgroup + html::html + tbody + td + tfoot + th + thead + tr;
-      if (tagnames.contains(t.tagname))
+      if (tableignoredendtags.contains(t.tagname))
       {
 	// TODO: Should produce a parse error
 	// Ignore the token
@@ -2322,12 +3020,12 @@ frenzy::parser::treeconstructor::state_in_table(const token& t)
 
     break;
   case TOKEN_END_OF_FILE:
-    if (current_node()->get_localName() != html::html)
+    if (current_name() != html::html)
     {
       // TODO: Should produce a parse error
     }
 
-    stop = true;
+    stop_parsing();
     return;
   default:
     break;
@@ -2416,16 +3114,16 @@ frenzy::parser::treeconstructor::state_in_caption(const token& t)
 
       generate_implied_end_tags();
       
-      if (current_node()->get_localName() != caption)
+      if (current_name() != caption)
       {
 	// TODO: Should produce a parse error
       }
 
-      while (current_node()->get_localName() != caption)
+      while (current_name() != caption)
       {
-	open_elements.pop_back();
+	pop_current_node();
       }
-      open_elements.pop_back();
+      pop_current_node();
 
       clear_active_formatting_up_to_last_marker();
 
@@ -2448,9 +3146,7 @@ frenzy::parser::treeconstructor::state_in_caption(const token& t)
     }
 
     {
-      static const stringlist tagnames =
-	stringlist(body) + col + colgroup + tbody + td + tfoot + th + thead + tr;
-      if (tagnames.contains(t.tagname))
+      if (captionignoredendtags.contains(t.tagname))
       {
 	// TODO: Should produce a parse error
 	// Ignore the token
@@ -2461,9 +3157,7 @@ frenzy::parser::treeconstructor::state_in_caption(const token& t)
     break;
   case TOKEN_START_TAG:
     {
-      static const stringlist tagnames =
-	stringlist(caption) + col + colgroup + tbody + td + tfoot + th + thead + tr;
-      if (tagnames.contains(t.tagname))
+      if (tableparts.contains(t.tagname))
       {
 	// TODO: Should produce a parse error
 	// Process implied </caption>
@@ -2506,7 +3200,7 @@ frenzy::parser::treeconstructor::state_in_column_group(const token& t)
     }
     break;
   case TOKEN_COMMENT:
-    insert_node(doc->createComment(t.comment));
+    insert_comment(t);
     return;
   case TOKEN_DOCTYPE:
     // TODO: Should produce a parse error
@@ -2521,7 +3215,7 @@ frenzy::parser::treeconstructor::state_in_column_group(const token& t)
     if (t.tagname == col)
     {
       insert_element_for(t);
-      open_elements.pop_back();
+      pop_current_node();
       // TODO: Acknowledge self-closing flag
       return;
     }
@@ -2530,16 +3224,16 @@ frenzy::parser::treeconstructor::state_in_column_group(const token& t)
   case TOKEN_END_TAG:
     if (t.tagname == colgroup)
     {
-      if (current_node()->get_localName() == html::html)
+      if (current_name() == html::html)
       {
 	// TODO: Should produce a parse error
 	// Ignore the token
 	return;
       }
 
-      assert(current_node()->get_localName() == colgroup);
+      assert(current_name() == colgroup);
       
-      open_elements.pop_back();
+      pop_current_node();
       state = STATE_IN_TABLE;
       return;
     }
@@ -2553,9 +3247,9 @@ frenzy::parser::treeconstructor::state_in_column_group(const token& t)
 
     break;
   case TOKEN_END_OF_FILE:
-    if (current_node()->get_localName() == html::html)
+    if (current_name() == html::html)
     {
-      stop = true;
+      stop_parsing();
       return;
     }
 
@@ -2577,9 +3271,6 @@ frenzy::parser::treeconstructor::state_in_column_group(const token& t)
 void
 frenzy::parser::treeconstructor::state_in_table_body(const token& t)
 {
-  static const stringlist tablebodycontext =
-    stringlist(tbody) + tfoot + thead + html::html;
-
   switch (t.type)
   {
   case TOKEN_START_TAG:
@@ -2600,9 +3291,7 @@ frenzy::parser::treeconstructor::state_in_table_body(const token& t)
     }
 
     {
-      static const stringlist tagnames =
-	stringlist(caption) + col + colgroup + tbody + tfoot + thead;
-      if (tagnames.contains(t.tagname))
+      if (tablebodyclosers.contains(t.tagname))
       {
 	if (!has_element_in_table_scope(tbody) &&
 	    !has_element_in_table_scope(thead) &&
@@ -2615,7 +3304,7 @@ frenzy::parser::treeconstructor::state_in_table_body(const token& t)
 
 	clear_open_elements_to_context(tablebodycontext);
 	// Process implied end tag
-	process_token(token::make_end_tag(current_node()->get_localName()));
+	process_token(token::make_end_tag(current_name()));
 	return process_token(t);
       }
     }
@@ -2634,7 +3323,7 @@ frenzy::parser::treeconstructor::state_in_table_body(const token& t)
       }
       
       clear_open_elements_to_context(tablebodycontext);
-      open_elements.pop_back();
+      pop_current_node();
       state = STATE_IN_TABLE;
       return;
     }
@@ -2652,14 +3341,12 @@ frenzy::parser::treeconstructor::state_in_table_body(const token& t)
       
       clear_open_elements_to_context(tablebodycontext);
       // Process implied end tag
-      process_token(token::make_end_tag(current_node()->get_localName()));
+      process_token(token::make_end_tag(current_name()));
       return process_token(t);
     }
 
     {
-      static const stringlist tagnames =
-	stringlist(body) + caption + col + colgroup + html::html + td + th + tr;
-      if (tagnames.contains(t.tagname))
+      if (tablebodyignoredendtags.contains(t.tagname))
       {
 	// TODO: Should produce a parse error
 	// Ignore the token
@@ -2678,9 +3365,6 @@ frenzy::parser::treeconstructor::state_in_table_body(const token& t)
 void
 frenzy::parser::treeconstructor::state_in_row(const token& t)
 {
-  static const stringlist tablerowcontext =
-    stringlist(tr) + html::html;
-
   switch (t.type)
   {
   case TOKEN_START_TAG:
@@ -2694,9 +3378,7 @@ frenzy::parser::treeconstructor::state_in_row(const token& t)
     }
 
     {
-      static const stringlist tagnames =
-	stringlist(caption) + col + colgroup + tbody + tfoot + thead + tr;
-      if (tagnames.contains(t.tagname))
+      if (rowclosers.contains(t.tagname))
       {
 	// Process implied </tr>
 	parserstate oldstate = state;
@@ -2722,7 +3404,7 @@ frenzy::parser::treeconstructor::state_in_row(const token& t)
       }
 
       clear_open_elements_to_context(tablerowcontext);
-      open_elements.pop_back();
+      pop_current_node();
       state = STATE_IN_TABLE_BODY;
       return;
     }
@@ -2757,9 +3439,7 @@ frenzy::parser::treeconstructor::state_in_row(const token& t)
     }
 
     {
-      static const stringlist tagnames =
-	stringlist(body) + caption + col + colgroup + html::html + td + th;
-      if (tagnames.contains(t.tagname))
+      if (rowignoredendtags.contains(t.tagname))
       {
 	// TODO: Should produce a parse error
 	// Ignore the token
@@ -2781,9 +3461,7 @@ frenzy::parser::treeconstructor::state_in_cell(const token& t)
   {
   case TOKEN_START_TAG:
     {
-      static const stringlist tagnames =
-	stringlist(caption) + col + colgroup + tbody + td + tfoot + th + thead + tr;
-      if (tagnames.contains(t.tagname))
+      if (tableparts.contains(t.tagname))
       {
 	if (!has_element_in_table_scope(td) &&
 	    !has_element_in_table_scope(th))
@@ -2822,16 +3500,16 @@ frenzy::parser::treeconstructor::state_in_cell(const token& t)
 
       generate_implied_end_tags();
       
-      if (current_node()->get_localName() != t.tagname)
+      if (current_name() != t.tagname)
       {
 	// TODO: Should produce a parse error
       }
       
-      while (current_node()->get_localName() != t.tagname)
+      while (current_name() != t.tagname)
       {
-	open_elements.pop_back();
+	pop_current_node();
       }
-      open_elements.pop_back();
+      pop_current_node();
 
       clear_active_formatting_up_to_last_marker();
       state = STATE_IN_ROW;
@@ -2839,9 +3517,7 @@ frenzy::parser::treeconstructor::state_in_cell(const token& t)
     }
 
     {
-      static const stringlist tagnames =
-	stringlist(body) + caption + col + colgroup + html::html;
-      if (tagnames.contains(t.tagname))
+      if (cellignoredendtags.contains(t.tagname))
       {
 	// TODO: Should produce a parse error
 	// Ignore the token
@@ -2850,9 +3526,7 @@ frenzy::parser::treeconstructor::state_in_cell(const token& t)
     }
 
     {
-      static const stringlist tagnames =
-	stringlist(table) + tbody + tfoot + thead + tr;
-      if (tagnames.contains(t.tagname))
+      if (tablestructure.contains(t.tagname))
       {
 	if (!has_element_in_table_scope(t.tagname))
 	{
@@ -2902,7 +3576,7 @@ frenzy::parser::treeconstructor::state_in_select(const token& t)
     insert_character(t.character);
     return;
   case TOKEN_COMMENT:
-    insert_node(doc->createComment(t.comment));
+    insert_comment(t);
     return;
   case TOKEN_DOCTYPE:
     // TODO: Should produce a parse error
@@ -2916,7 +3590,7 @@ frenzy::parser::treeconstructor::state_in_select(const token& t)
 
     if (t.tagname == option)
     {
-      if (current_node()->get_localName() == option)
+      if (current_name() == option)
       {
 	// Process implied </option>
 	process_token(token::make_end_tag(option));
@@ -2928,7 +3602,7 @@ frenzy::parser::treeconstructor::state_in_select(const token& t)
 
     if (t.tagname == optgroup)
     {
-      ustring current = current_node()->get_localName();
+      ustring current = current_name();
       if (current == option)
       {
 	// Process implied </option>
@@ -2977,16 +3651,16 @@ frenzy::parser::treeconstructor::state_in_select(const token& t)
     if (t.tagname == optgroup)
     {
       assert(open_elements.size() >= 2);
-      if (open_elements[open_elements.size() - 1]->get_localName() == option
-	  && open_elements[open_elements.size() - 2]->get_localName() == optgroup)
+      if (open_elements[open_elements.size() - 1].name == option
+	  && open_elements[open_elements.size() - 2].name == optgroup)
       {
 	// Process implied </option>
 	process_token(token::make_end_tag(option));
       }
 
-      if (current_node()->get_localName() == optgroup)
+      if (current_name() == optgroup)
       {
-	open_elements.pop_back();
+	pop_current_node();
       }
       else
       {
@@ -2997,9 +3671,9 @@ frenzy::parser::treeconstructor::state_in_select(const token& t)
 
     if (t.tagname == option)
     {
-      if (current_node()->get_localName() == option)
+      if (current_name() == option)
       {
-	open_elements.pop_back();
+	pop_current_node();
       }
       else
       {
@@ -3017,11 +3691,11 @@ frenzy::parser::treeconstructor::state_in_select(const token& t)
 	return;
       }
 
-      while (current_node()->get_localName() != html::select)
+      while (current_name() != html::select)
       {
-	open_elements.pop_back();
+	pop_current_node();
       }
-      open_elements.pop_back();
+      pop_current_node();
 
       reset_insertion_mode();
       return;
@@ -3029,12 +3703,12 @@ frenzy::parser::treeconstructor::state_in_select(const token& t)
 
     break;
   case TOKEN_END_OF_FILE:
-    if (current_node()->get_localName() != html::html)
+    if (current_name() != html::html)
     {
       // TODO: Should produce a parse error
     }
 
-    stop = true;
+    stop_parsing();
     return;
   default:
     break;
@@ -3047,10 +3721,7 @@ frenzy::parser::treeconstructor::state_in_select(const token& t)
 void
 frenzy::parser::treeconstructor::state_in_select_in_table(const token& t)
 {
-  static const stringlist tagnames =
-    stringlist(caption) + table + tbody + tfoot + thead + tr + td + th;
-
-  if (t.type == TOKEN_START_TAG && tagnames.contains(t.tagname))
+  if (t.type == TOKEN_START_TAG && selectintableclosers.contains(t.tagname))
   {
     // TODO: Should produce a parse error
     // Process implied </select>
@@ -3058,7 +3729,7 @@ frenzy::parser::treeconstructor::state_in_select_in_table(const token& t)
     return process_token(t);
   }
 
-  if (t.type == TOKEN_END_TAG && tagnames.contains(t.tagname))
+  if (t.type == TOKEN_END_TAG && selectintableclosers.contains(t.tagname))
   {
     // TODO: Should produce a parse error
     if (has_element_in_table_scope(t.tagname))
@@ -3095,7 +3766,7 @@ frenzy::parser::treeconstructor::state_after_body(const token& t)
     break;
   case TOKEN_COMMENT:
     assert(!open_elements.empty());
-    open_elements.front()->appendChild(doc->createComment(t.comment));
+    append_comment(t, open_elements.front().node);
     return;
   case TOKEN_DOCTYPE:
     // TODO: Should produce a parse error
@@ -3110,14 +3781,19 @@ frenzy::parser::treeconstructor::state_after_body(const token& t)
   case TOKEN_END_TAG:
     if (t.tagname == html::html)
     {
-      // TODO: If the parser was created for fragment parsing, should
-      // 1) produce a parse error 2) ignore the token instead of this.
+      if (fragment)
+      {
+	// TODO: Should produce a parse error
+	// Ignore the token
+	return;
+      }
+
       state = STATE_AFTER_AFTER_BODY;
       return;
     }
     break;
   case TOKEN_END_OF_FILE:
-    stop = true;
+    stop_parsing();
     return;
   default:
     break;
@@ -3148,7 +3824,7 @@ frenzy::parser::treeconstructor::state_in_frameset(const token& t)
     }
     break;
   case TOKEN_COMMENT:
-    insert_node(doc->createComment(t.comment));
+    insert_comment(t);
     return;
   case TOKEN_DOCTYPE:
     // TODO: Should produce a parse error
@@ -3169,7 +3845,7 @@ frenzy::parser::treeconstructor::state_in_frameset(const token& t)
     if (t.tagname == frame)
     {
       insert_element_for(t);
-      open_elements.pop_back();
+      pop_current_node();
       // TODO: Acknowledge self-closing flag
       return;
     }
@@ -3183,17 +3859,16 @@ frenzy::parser::treeconstructor::state_in_frameset(const token& t)
   case TOKEN_END_TAG:
     if (t.tagname == frameset)
     {
-      if (current_node()->get_localName() == html::html)
+      if (current_name() == html::html)
       {
 	// TODO: Should produce a parse error
 	// Ignore the token
 	return;
       }
       
-      open_elements.pop_back();
+      pop_current_node();
       
-      if (true // parser not created for fragment parsing
-	  && current_node()->get_localName() != frameset)
+      if (!fragment && current_name() != frameset)
       {
 	state = STATE_AFTER_FRAMESET;
       }
@@ -3203,12 +3878,12 @@ frenzy::parser::treeconstructor::state_in_frameset(const token& t)
 
     break;
   case TOKEN_END_OF_FILE:
-    if (current_node()->get_localName() != html::html)
+    if (current_name() != html::html)
     {
       // TODO: Should produce a parse error
     }
 
-    stop = true;
+    stop_parsing();
     return;
   default:
     break;
@@ -3238,7 +3913,7 @@ frenzy::parser::treeconstructor::state_after_frameset(const token& t)
     }
     break;
   case TOKEN_COMMENT:
-    insert_node(doc->createComment(t.comment));
+    insert_comment(t);
     return;
   case TOKEN_DOCTYPE:
     // TODO: Should produce a parse error
@@ -3265,7 +3940,7 @@ frenzy::parser::treeconstructor::state_after_frameset(const token& t)
 
     break;
   case TOKEN_END_OF_FILE:
-    stop = true;
+    stop_parsing();
     return;
   default:
     break;
@@ -3281,7 +3956,7 @@ frenzy::parser::treeconstructor::state_after_after_body(const token& t)
   switch (t.type)
   {
   case TOKEN_COMMENT:
-    doc->appendChild(doc->createComment(t.comment));
+    append_comment(t, sink->document());
     return;
   case TOKEN_DOCTYPE:
     return state_in_body(t);
@@ -3305,7 +3980,7 @@ frenzy::parser::treeconstructor::state_after_after_body(const token& t)
     }
     break;
   case TOKEN_END_OF_FILE:
-    stop = true;
+    stop_parsing();
     return;
   default:
     break;
@@ -3322,7 +3997,7 @@ frenzy::parser::treeconstructor::state_after_after_frameset(const token& t)
   switch (t.type)
   {
   case TOKEN_COMMENT:
-    doc->appendChild(doc->createComment(t.comment));
+    append_comment(t, sink->document());
     return;
   case TOKEN_DOCTYPE:
     return state_in_body(t);
@@ -3352,7 +4027,7 @@ frenzy::parser::treeconstructor::state_after_after_frameset(const token& t)
     }
     break;
   case TOKEN_END_OF_FILE:
-    stop = true;
+    stop_parsing();
     return;
   default:
     break;
@@ -15,23 +15,30 @@
 #define FRENZY_TREECONSTRUCTOR_HPP
 
 #include <map>
+#include <set>
+#include <deque>
 #include <vector>
+#include <boost/function.hpp>
+#include <boost/scoped_ptr.hpp>
 
 #include "util/unicode.hpp"
 #include "util/stringlist.hpp"
 #include "dom/document.hpp"
 #include "token.hpp"
 #include "htmltokenizer.hpp"
+#include "treesink.hpp"
 
 namespace frenzy
 {
   /*
-   * Parser stages are constructed once _per_bytestream_. A
-   * constructed parser stage contains parser state that needs to be
-   * refreshed.
+   * Parser stages hold the parser state of one bytestream at a
+   * time. A stage is either constructed per bytestream, or reset()
+   * between bytestreams. Resetting clears the parser state but keeps
+   * the attached destination and the allocated buffers, so that
+   * parsing many documents doesn't construct the stages again.
    *
-   * Note that Javascript document.open() also requires new parser
-   * stage objects.
+   * Note that Javascript document.open() also requires fresh parser
+   * stages.
    *
    * The tree constructor stage interface is different from the
    * previous stages. The tree constructor requires a coupled
@@ -39,11 +46,62 @@ namespace frenzy
    * sometimes modify the tokenizer state. Also the result of tree
    * construction is not an item that is passed around, but instead
    * the tree constructor takes a Document object to modify when
-   * constructed.
+   * constructed, or a treesink that builds some other kind of tree.
    */
 
   namespace parser
   {
+    /*
+     * Options for leaving nodes out of the constructed tree. The
+     * insertion modes and the stack of open elements work the same
+     * regardless, only the nodes are not created.
+     */
+    struct treeoptions
+    {
+      // By default all nodes are created
+      treeoptions();
+
+      // Comments are not created.
+      bool drop_comments;
+
+      // Text nodes that would contain only whitespace are not
+      // created. Whitespace is kept inside pre, listing and plaintext
+      // elements, in elements with text content only (like textarea,
+      // title, script and style), and when it is appended to an
+      // existing text node.
+      bool drop_whitespace;
+
+      // The content of the elements with these names is not
+      // created. The elements themselves are.
+      stringlist skip_children;
+    };
+
+    /*
+     * HTML5 8.4 "Parsing HTML fragments"
+     *
+     * The context element of a fragment, as far as tree construction
+     * needs it: the name, whether the element is an SVG or MathML
+     * element, and the form element pointer to start with.
+     */
+    struct fragmentcontext
+    {
+      // An HTML element with the given local name and no form
+      // element ancestor
+      fragmentcontext(const ustring& name = ustring());
+      // Takes the name from the element. The element is in foreign
+      // content when it is, or is inside, an svg or math element
+      // with no HTML integration point in between. The form is the
+      // nearest form element of the element and its ancestors, which
+      // the domsink takes as its handle.
+      fragmentcontext(dom::Elementp element);
+
+      ustring name;
+      bool foreign;
+      // A handle of the sink the fragment is constructed through,
+      // or NULL
+      treesink::handle form;
+    };
+
     /*
      * HTML5 8.2.5 "Tree construction"
      *
@@ -52,59 +110,213 @@ namespace frenzy
      */
     struct treeconstructor : private boost::noncopyable
     {
-      treeconstructor(dom::Documentp document);
+      // Constructs the tree to the given document.
+      treeconstructor(dom::Documentp document, const treeoptions& options = treeoptions());
+      // Constructs the tree through the given sink, which must
+      // outlive the tree constructor.
+      treeconstructor(treesink* sink, const treeoptions& options = treeoptions());
+
+      // HTML5 8.4 "Parsing HTML fragments"
+      // Constructs the nodes of a fragment, as for innerHTML, to the
+      // given document fragment. No html element is created; the
+      // fragment takes its place as the root of the stack of open
+      // elements.
+      treeconstructor(dom::DocumentFragmentp fragment, const fragmentcontext& context,
+		      const treeoptions& options = treeoptions());
+      // Constructs a fragment through the given sink. The nodes are
+      // appended to the sink's document().
+      treeconstructor(treesink* sink, const fragmentcontext& context,
+		      const treeoptions& options = treeoptions());
 
       // TODO: Rething interface, really want to take tokenizer by a naked pointer?
-      // Calls attach_destination on the tokenizer
+      // Calls attach_destination on the tokenizer. When parsing a
+      // fragment, also sets the tokenizer state for the context
+      // element.
       void couple_tokenizer(htmltokenizer* tokenizer);
 
+      // Processes a token as if it came from the coupled tokenizer.
+      // For callers that attach their own destination to the coupled
+      // tokenizer, to see the tokens before tree construction.
+      void pass_token(const token& t);
+
+      // Passes the text of the character tokens processed so far to
+      // the sink. Text is otherwise collected until the next change
+      // to the tree, so this is called at the end of each input chunk
+      // to have the tree complete between chunks. Whitespace that
+      // treeoptions::drop_whitespace may still drop waits for the
+      // rest of its run.
+      void flush();
+
+      // Clears the parser state and starts constructing the tree to
+      // the given document or fragment, as if newly constructed. The
+      // coupled tokenizer stays coupled, and must be reset before the
+      // tree constructor.
+      void reset(dom::Documentp document);
+      void reset(dom::DocumentFragmentp fragment, const fragmentcontext& context);
+      // As above, but keeps constructing through the same sink, which
+      // the caller resets.
+      void reset();
+
       // TODO: Rethink interface on this
+      // Returns a NULL pointer when constructing through a sink.
       dom::Documentp document();
 
       // Returns true when parsing has stopped.
       bool stopped() const;
 
+      // Calls the given function with each element when it is popped
+      // off the stack of open elements, that is, when the element is
+      // complete. The elements still open at end-of-file are popped
+      // when parsing stops. Not called for elements left out of the
+      // tree by treeoptions::skip_children.
+      void attach_close_listener(boost::function<void (treesink::handle)> listener);
+
+      // Saves the state between two tokens other than characters, to
+      // continue from later. The text of the character tokens is
+      // passed to the sink first, as with flush(). Not for trees
+      // that leave out nodes with treeoptions::skip_children.
+      struct checkpoint;
+      void save(checkpoint& cp);
+      // Continues from a saved state, as after the tokens before it.
+      // The elements the state refers to must be in the sink as they
+      // were when the state was saved, and the coupled tokenizer is
+      // restored separately.
+      void restore(const checkpoint& cp);
+
     private:
-      dom::Documentp doc;
+      typedef treesink::handle handle;
+
+      boost::scoped_ptr<domsink> ownsink;
+      treesink* sink;
       htmltokenizer* tok;
+      treeoptions options;
+
+      // The context element when parsing a fragment
+      bool fragment;
+      fragmentcontext context;
+      void start_fragment();
+      // Sets the tokenizer state for the context element
+      void set_context_tokenizer_state();
+
+      // The stack of open elements. The element names are kept here
+      // so that the sink doesn't need to be asked for them.
+      struct open_element
+      {
+	open_element(handle node, const ustring& name)
+	  : node(node)
+	  , name(name)
+	{
+	}
 
-      std::vector<dom::Elementp> open_elements;
-      dom::Elementp current_node();
-      bool open_elements_contains(dom::Elementp elem) const;
-      void remove_from_open_elements(dom::Elementp elem);
+	handle node;
+	ustring name;
+      };
+      typedef std::vector<open_element> open_elements_t;
+
+      open_elements_t open_elements;
+      handle current_node() const;
+      const ustring& current_name() const;
+      bool open_elements_contains(handle elem) const;
+      // Pass false as `closes' if the element was already closed
+      // once, like the head element that is pushed back temporarily.
+      void remove_from_open_elements(handle elem, bool closes = true);
+      void pop_current_node();
+      boost::function<void (handle)> close_listener;
+      void element_closed(handle elem);
       // Pop elements until a particular context
       void clear_open_elements_to_context(stringlist ctx);
       // Insert the given node to the proper 'foster parent' in the
       // proper position according to HTML5 8.2.5.3
-      void foster_parent(dom::Nodep elem);
+      void foster_parent(handle elem);
       // Insert the character to the proper 'foster parent' in the
       // proper position
       void foster_parent(uchar u);
-      dom::Elementp current_form;
-      dom::Elementp head_element;
+      // Returns the position of the last table in the stack of open
+      // elements, or the end of the stack if there is none
+      open_elements_t::const_reverse_iterator last_table() const;
+      handle current_form;
+      handle head_element;
       std::vector<token> pending_table_characters;
       bool frameset_ok;
       bool ignore_next_lf;
       bool force_foster_parent;
       bool stop;
 
+      // HTML5 8.2.6 "Stop parsing"
+      void stop_parsing();
+
       // As per 8.2.5.1 insert an element to the proper place (current
       // node or foster parent) and returns the created element
-      dom::Elementp insert_element_for(token t);
+      handle insert_element_for(token t);
       // Insert the given node to the proper place (current node or foster parent)
-      void insert_node(dom::Nodep node);
-      // Creates an appropriate element
-      dom::Elementp create_element_for(token t);
+      void insert_node(handle node);
+      // Creates an appropriate element. A ghost element is not
+      // created in the sink, see below.
+      handle create_element_for(const token& t, bool ghost);
       // Inserts the character to the proper element (current element
       // or foster parent)
       void insert_character(uchar u);
-      void append_character(uchar u, dom::Elementp elem);
+      void append_character(uchar u, handle elem);
+      // Insert a comment to the proper place, or append it to the
+      // given parent
+      void insert_comment(const token& t);
+      void append_comment(const token& t, handle parent);
+
+      // All changes to the tree go through these, so that the nodes
+      // left out by the options are handled in one place.
+      void append_node(handle parent, handle child);
+      void insert_node_before(handle parent, handle child, handle sibling);
+      void remove_node(handle node);
+      void reparent_children(handle node, handle newparent);
+      void add_attributes_if_missing(handle elem, const token& t);
+      handle parent_element(handle node);
+
+      // Characters are collected and passed to the sink as one string
+      // when something else is done to the tree. pending_parent and
+      // pending_sibling tell where the text goes, as in
+      // treesink::insert_text_before().
+      ustring pending_text;
+      handle pending_parent;
+      handle pending_sibling;
+      // Where the last text went, if nothing has been added to the
+      // tree after it. Text passed to the same place is appended to
+      // the same text node.
+      handle text_parent;
+      handle text_sibling;
+      void queue_text(handle parent, handle sibling, uchar u);
+      void flush_text();
+      // True if the pending text is whitespace that is not created
+      bool drops_pending_whitespace() const;
+      // True if whitespace is significant in the current node
+      bool preformatted() const;
+
+      // Elements whose content is not created, as per
+      // treeoptions::skip_children, are ghosts. They are on the stack
+      // of open elements like other elements, but have no node in the
+      // sink. The handles point to ghoststorage so that they are
+      // unique.
+      std::set<handle> ghosts;
+      std::deque<char> ghoststorage;
+      // Real elements with skip_children names
+      std::set<handle> skipping;
+
+      // Tokens come in through receive_token(), which tells the sink
+      // to release the nodes no longer referred to now and then, so
+      // that the nodes of a long document are not all kept by the
+      // sink.
+      void receive_token(const token& t);
+      size_t tokens_since_release;
+      size_t release_interval;
+      void release_unreferenced();
+      bool is_ghost(handle node) const;
+      // True if nodes added to the given parent are not created
+      bool skips_children(handle node) const;
 
       // Object in the list of "active formatting elements", represents either an element or a list marker
       struct active_formatting
       {
 	// Construct as an element.
-	active_formatting(dom::Elementp elem, token t)
+	active_formatting(handle elem, token t)
 	  : elem(elem)
 	  , t(t)
 	{
@@ -113,7 +325,7 @@ namespace frenzy
 
 	// Construct as a marker
 	active_formatting()
-	  : elem()
+	  : elem(NULL)
 	  , t(token::make_end_of_file())
 	{}
 
@@ -123,18 +335,18 @@ namespace frenzy
 	  return !elem;
 	}
 
-	dom::Elementp element() const
+	handle element() const
 	{
 	  return elem;
 	}
 
-	token gettoken() const
+	const token& gettoken() const
 	{
 	  return t;
 	}
 
       private:
-	dom::Elementp elem;
+	handle elem;
 	token t;
       };
 
@@ -142,7 +354,7 @@ namespace frenzy
 
       // Push either an element or a list marker to the list of active
       // formatting elements.
-      void push_active_formatting(dom::Elementp elem, token t);
+      void push_active_formatting(handle elem, token t);
       void push_active_formatting_marker();
       // Reconstruct the active formatting list and insert any needed
       // new elements to the document according to HTML5 8.2.3.3
@@ -151,16 +363,18 @@ namespace frenzy
       // Returns the element that's in the active formatting list
       // after the last marker (or beginning of list if no markers
       // present). Returns a NULL handle if not found.
-      dom::Elementp find_active_formatting_after_last_marker(ustring name);
+      handle find_active_formatting_after_last_marker(ustring name);
       // Remove the given element from the list of active formatting
       // elements.
-      void remove_from_active_formatting(dom::Elementp elem);
+      void remove_from_active_formatting(handle elem);
 
       // Pop elements from the stack of open elements as per HTML5 8.2.5.2
       bool needs_implied_end_tag(ustring name) const;
       void generate_implied_end_tags();
       void generate_implied_end_tags_except(ustring name);
 
+      bool has_element_in_specific_scope(const stringlist& scope, const ustring& name) const;
+      bool has_element_in_specific_scope(const stringlist& scope, const stringlist& names) const;
       bool has_element_in_scope(stringlist names) const;
       bool has_element_in_scope(ustring name) const;
       bool has_element_in_button_scope(ustring name) const;
@@ -199,6 +413,9 @@ namespace frenzy
       // Change the parser state according to HTML5 8.2.3.1
       void reset_insertion_mode();
       static std::map<ustring, parserstate> get_reset_mapping();
+      // Initialized before main() like the other tables of the tree
+      // constructor, and read-only after that.
+      static const std::map<ustring, parserstate> reset_mapping;
 
       void process_token(const token& t);
 
@@ -225,6 +442,57 @@ namespace frenzy
       void state_after_after_body(const token& t);
       void state_after_after_frameset(const token& t);
     };
+
+    /*
+     * The tree construction state saved by treeconstructor::save():
+     * the insertion mode, the stack of open elements, the list of
+     * active formatting elements and the other elements tree
+     * construction refers to. The elements are referred to by their
+     * handles, which can be compared to and replaced with the nodes
+     * of another tree with the same content.
+     */
+    struct treeconstructor::checkpoint
+    {
+      checkpoint();
+
+      // The elements the state refers to, NULL where there is none:
+      // the open elements, the active formatting elements, the head
+      // and form elements, and where text was last inserted
+      std::vector<treesink::handle> handles() const;
+      // Replaces the handles, given in the order handles() returns
+      // them
+      void set_handles(const std::vector<treesink::handle>& handles);
+      // The elements tree construction may append children to when
+      // continuing from the state: the open elements and the head
+      // element
+      std::vector<treesink::handle> parents() const;
+
+      // True if tree construction continues the same way from both
+      // states, given that the handles at the same places of
+      // handles() refer to the same nodes or to nodes with the same
+      // content.
+      bool same_state(const checkpoint& other) const;
+
+    private:
+      friend struct treeconstructor;
+
+      open_elements_t open_elements;
+      std::vector<active_formatting> active_formatting_list;
+      parserstate state;
+      parserstate origstate;
+      handle head_element;
+      handle current_form;
+      bool frameset_ok;
+      bool ignore_next_lf;
+      bool force_foster_parent;
+      bool stop;
+      // Whitespace that treeoptions::drop_whitespace may still drop
+      ustring pending_text;
+      handle pending_parent;
+      handle pending_sibling;
+      handle text_parent;
+      handle text_sibling;
+    };
   }
 }
 
@@ -0,0 +1,329 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+
+#include <algorithm>
+
+#include "treesink.hpp"
+#include "dom/document.hpp"
+#include "dom/element.hpp"
+#include "dom/text.hpp"
+
+frenzy::parser::treesink::~treesink()
+{
+}
+
+void
+frenzy::parser::treesink::release(const std::vector<frenzy::parser::treesink::handle>&)
+{
+}
+
+frenzy::parser::domsink::domsink(frenzy::dom::Documentp document)
+  : doc(document)
+  , root(document)
+{
+}
+
+frenzy::parser::domsink::domsink(frenzy::dom::DocumentFragmentp fragment)
+  : doc(fragment->get_ownerDocument())
+  , root(fragment)
+{
+}
+
+void
+frenzy::parser::domsink::reset(frenzy::dom::Documentp document)
+{
+  doc = document;
+  root = document;
+  created.clear();
+}
+
+void
+frenzy::parser::domsink::reset(frenzy::dom::DocumentFragmentp fragment)
+{
+  doc = fragment->get_ownerDocument();
+  root = fragment;
+  created.clear();
+}
+
+frenzy::parser::treesink::handle
+frenzy::parser::domsink::document()
+{
+  return root.get();
+}
+
+frenzy::parser::treesink::handle
+frenzy::parser::domsink::create_element(const frenzy::ustring& name,
+					const frenzy::parser::treesink::attributes_t& attributes)
+{
+  dom::Elementp elem = doc->createElement(name);
+  for (attributes_t::const_iterator it = attributes.begin();
+       it != attributes.end();
+       ++it)
+  {
+    elem->setAttribute(it->first, it->second);
+  }
+
+  return keep(elem);
+}
+
+frenzy::parser::treesink::handle
+frenzy::parser::domsink::create_comment(const frenzy::ustring& data)
+{
+  return keep(doc->createComment(data));
+}
+
+void
+frenzy::parser::domsink::append(frenzy::parser::treesink::handle parent,
+				frenzy::parser::treesink::handle child)
+{
+  node(parent)->appendChild(node(child));
+}
+
+void
+frenzy::parser::domsink::insert_before(frenzy::parser::treesink::handle parent,
+				       frenzy::parser::treesink::handle child,
+				       frenzy::parser::treesink::handle sibling)
+{
+  node(parent)->insertBefore(node(child), node(sibling));
+}
+
+void
+frenzy::parser::domsink::append_text(frenzy::parser::treesink::handle parent,
+				     const frenzy::ustring& text)
+{
+  dom::Nodep p = node(parent);
+
+  dom::Nodep lastchild = p->get_lastChild();
+  if (lastchild && lastchild->get_nodeType() == dom::Node::TEXT_NODE)
+  {
+    dom_cast<dom::Text>(lastchild)->appendData(text);
+    return;
+  }
+
+  p->appendChild(doc->createTextNode(text));
+}
+
+void
+frenzy::parser::domsink::insert_text_before(frenzy::parser::treesink::handle parent,
+					    frenzy::parser::treesink::handle sibling,
+					    const frenzy::ustring& text)
+{
+  dom::Nodep sib = node(sibling);
+
+  dom::Nodep prevchild = sib->get_previousSibling();
+  if (prevchild && prevchild->get_nodeType() == dom::Node::TEXT_NODE)
+  {
+    dom_cast<dom::Text>(prevchild)->appendData(text);
+    return;
+  }
+
+  node(parent)->insertBefore(doc->createTextNode(text), sib);
+}
+
+frenzy::parser::treesink::handle
+frenzy::parser::domsink::get_parent(frenzy::parser::treesink::handle n)
+{
+  dom::Nodep parent = node(n)->get_parentNode();
+  if (!parent)
+    return NULL;
+
+  // The fragment is the root in place of the html element
+  if (parent->get_nodeType() != dom::Node::ELEMENT_NODE
+      && parent->get_nodeType() != dom::Node::DOCUMENT_FRAGMENT_NODE)
+    return NULL;
+
+  return parent.get();
+}
+
+void
+frenzy::parser::domsink::remove_from_parent(frenzy::parser::treesink::handle n)
+{
+  dom::Nodep child = node(n);
+  if (dom::Nodep parent = child->get_parentNode())
+  {
+    parent->removeChild(child);
+  }
+}
+
+void
+frenzy::parser::domsink::reparent_children(frenzy::parser::treesink::handle n,
+					   frenzy::parser::treesink::handle newparent)
+{
+  dom::Nodep from = node(n);
+  dom::Nodep to = node(newparent);
+
+  while (dom::Nodep child = from->get_firstChild())
+  {
+    to->appendChild(child);
+  }
+}
+
+void
+frenzy::parser::domsink::add_attributes_if_missing(frenzy::parser::treesink::handle element,
+						   const frenzy::parser::treesink::attributes_t& attributes)
+{
+  dom::Elementp elem = dom_cast<dom::Element>(node(element));
+
+  for (attributes_t::const_iterator it = attributes.begin();
+       it != attributes.end();
+       ++it)
+  {
+    if (!elem->hasAttribute(it->first))
+    {
+      elem->setAttribute(it->first, it->second);
+    }
+  }
+}
+
+void
+frenzy::parser::domsink::release(const std::vector<frenzy::parser::treesink::handle>& referenced)
+{
+  std::vector<dom::Nodep>::iterator kept = created.begin();
+  for (std::vector<dom::Nodep>::iterator it = created.begin(); it != created.end(); ++it)
+  {
+    if (std::binary_search(referenced.begin(), referenced.end(), it->get()))
+    {
+      std::swap(*kept, *it);
+      ++kept;
+    }
+  }
+
+  created.erase(kept, created.end());
+}
+
+frenzy::dom::Documentp
+frenzy::parser::domsink::get_document() const
+{
+  return doc;
+}
+
+frenzy::parser::treesink::handle
+frenzy::parser::domsink::keep(frenzy::dom::Nodep n)
+{
+  created.push_back(n);
+  return n.get();
+}
+
+frenzy::dom::Nodep
+frenzy::parser::domsink::node(frenzy::parser::treesink::handle h)
+{
+  return static_cast<dom::Node*>(h)->shared_from_this();
+}
+
+frenzy::parser::nullsink::nullsink()
+  : root(0)
+{
+}
+
+frenzy::parser::treesink::handle
+frenzy::parser::nullsink::document()
+{
+  return &root;
+}
+
+frenzy::parser::treesink::handle
+frenzy::parser::nullsink::create_element(const frenzy::ustring&,
+					 const frenzy::parser::treesink::attributes_t&)
+{
+  return allocate();
+}
+
+frenzy::parser::treesink::handle
+frenzy::parser::nullsink::create_comment(const frenzy::ustring&)
+{
+  return allocate();
+}
+
+void
+frenzy::parser::nullsink::append(frenzy::parser::treesink::handle,
+				 frenzy::parser::treesink::handle)
+{
+}
+
+void
+frenzy::parser::nullsink::insert_before(frenzy::parser::treesink::handle,
+					frenzy::parser::treesink::handle,
+					frenzy::parser::treesink::handle)
+{
+}
+
+void
+frenzy::parser::nullsink::append_text(frenzy::parser::treesink::handle,
+				      const frenzy::ustring&)
+{
+}
+
+void
+frenzy::parser::nullsink::insert_text_before(frenzy::parser::treesink::handle,
+					     frenzy::parser::treesink::handle,
+					     const frenzy::ustring&)
+{
+}
+
+frenzy::parser::treesink::handle
+frenzy::parser::nullsink::get_parent(frenzy::parser::treesink::handle)
+{
+  return NULL;
+}
+
+void
+frenzy::parser::nullsink::remove_from_parent(frenzy::parser::treesink::handle)
+{
+}
+
+void
+frenzy::parser::nullsink::reparent_children(frenzy::parser::treesink::handle,
+					    frenzy::parser::treesink::handle)
+{
+}
+
+void
+frenzy::parser::nullsink::add_attributes_if_missing(frenzy::parser::treesink::handle,
+						    const frenzy::parser::treesink::attributes_t&)
+{
+}
+
+void
+frenzy::parser::nullsink::release(const std::vector<frenzy::parser::treesink::handle>& referenced)
+{
+  std::vector<handle>::iterator kept = live.begin();
+  for (std::vector<handle>::iterator it = live.begin(); it != live.end(); ++it)
+  {
+    if (std::binary_search(referenced.begin(), referenced.end(), *it))
+      *kept++ = *it;
+    else
+      unused.push_back(*it);
+  }
+
+  live.erase(kept, live.end());
+}
+
+frenzy::parser::treesink::handle
+frenzy::parser::nullsink::allocate()
+{
+  handle ret;
+  if (unused.empty())
+  {
+    storage.push_back(0);
+    ret = &storage.back();
+  }
+  else
+  {
+    ret = unused.back();
+    unused.pop_back();
+  }
+
+  live.push_back(ret);
+  return ret;
+}
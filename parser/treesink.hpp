@@ -0,0 +1,176 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+
+#ifndef FRENZY_TREESINK_HPP
+#define FRENZY_TREESINK_HPP
+
+#include <map>
+#include <deque>
+#include <vector>
+#include <boost/noncopyable.hpp>
+
+#include "util/unicode.hpp"
+#include "dom/pointers.hpp"
+
+namespace frenzy
+{
+  namespace parser
+  {
+    /*
+     * The tree constructor builds the tree through a treesink. The
+     * sink owns the nodes and decides how they are represented; the
+     * tree constructor only refers to them with opaque handles and
+     * does all of the HTML5 tree construction and error recovery
+     * itself.
+     *
+     * A handle is any non-NULL pointer the sink chooses, for example
+     * a pointer into a node arena. NULL means "no node". Handles must
+     * stay valid, even if the node has been removed from the tree,
+     * until the tree constructor calls release().
+     *
+     * Element names are not asked from the sink. The tree constructor
+     * keeps the names of the open elements itself.
+     */
+    struct treesink
+    {
+      typedef void* handle;
+      typedef std::map<ustring, ustring> attributes_t;
+
+      virtual ~treesink() = 0;
+
+      // The root of the tree. This is the document node, or the node
+      // that receives the parsed nodes when parsing a fragment.
+      virtual handle document() = 0;
+
+      // Creates nodes that are not yet in the tree.
+      virtual handle create_element(const ustring& name, const attributes_t& attributes) = 0;
+      virtual handle create_comment(const ustring& data) = 0;
+
+      // Appends child as the last child of parent. If child already
+      // has a parent, it is removed from there first.
+      virtual void append(handle parent, handle child) = 0;
+      // Inserts child to parent before sibling, which is a child of
+      // parent. Moves child like append().
+      virtual void insert_before(handle parent, handle child, handle sibling) = 0;
+
+      // Appends text as the last child of parent. If the last child
+      // is a text node, the text is appended to it instead.
+      virtual void append_text(handle parent, const ustring& text) = 0;
+      // Inserts text to parent before sibling. If the node before
+      // sibling is a text node, the text is appended to it instead.
+      virtual void insert_text_before(handle parent, handle sibling, const ustring& text) = 0;
+
+      // Returns the parent element of node, or NULL if node doesn't
+      // have a parent or the parent is not an element. When parsing
+      // a fragment, document() counts as an element.
+      virtual handle get_parent(handle node) = 0;
+      // Removes node from its parent, if it has one.
+      virtual void remove_from_parent(handle node) = 0;
+      // Moves all children of node to newparent, appending them after
+      // the existing children of newparent.
+      virtual void reparent_children(handle node, handle newparent) = 0;
+
+      // Sets the attributes the element doesn't have yet.
+      virtual void add_attributes_if_missing(handle element, const attributes_t& attributes) = 0;
+
+      // Called now and then with the sorted handles that the tree
+      // constructor still refers to. The handles of the other nodes
+      // are not used again, until get_parent() returns them, so the
+      // sink can free the nodes that are not in the tree. Does
+      // nothing by default.
+      virtual void release(const std::vector<handle>& referenced);
+    };
+
+    /*
+     * The tree sink that builds a DOM tree to a dom::Document, or to
+     * a dom::DocumentFragment when parsing a fragment.
+     */
+    struct domsink : treesink, private boost::noncopyable
+    {
+      domsink(dom::Documentp document);
+      // The nodes are created for the fragment's owner document.
+      domsink(dom::DocumentFragmentp fragment);
+
+      // Starts building to another document or fragment. The handles
+      // to the previous nodes become invalid.
+      void reset(dom::Documentp document);
+      void reset(dom::DocumentFragmentp fragment);
+
+      virtual handle document();
+      virtual handle create_element(const ustring& name, const attributes_t& attributes);
+      virtual handle create_comment(const ustring& data);
+      virtual void append(handle parent, handle child);
+      virtual void insert_before(handle parent, handle child, handle sibling);
+      virtual void append_text(handle parent, const ustring& text);
+      virtual void insert_text_before(handle parent, handle sibling, const ustring& text);
+      virtual handle get_parent(handle node);
+      virtual void remove_from_parent(handle node);
+      virtual void reparent_children(handle node, handle newparent);
+      virtual void add_attributes_if_missing(handle element, const attributes_t& attributes);
+      virtual void release(const std::vector<handle>& referenced);
+
+      dom::Documentp get_document() const;
+
+      // Returns the node of a handle created by a domsink
+      static dom::Nodep node(handle h);
+
+    private:
+      dom::Documentp doc;
+      dom::Nodep root;
+
+      // Keeps the created nodes alive until they are released, also
+      // after they have been removed from the tree. The nodes in the
+      // tree are kept alive by their parents.
+      std::vector<dom::Nodep> created;
+
+      handle keep(dom::Nodep node);
+    };
+
+    /*
+     * A tree sink that builds no tree, for running tree construction
+     * only for the tokenizer state changes it makes. The handles
+     * point to bytes that are reused once released, and no element
+     * has a parent.
+     */
+    struct nullsink : treesink, private boost::noncopyable
+    {
+      nullsink();
+
+      virtual handle document();
+      virtual handle create_element(const ustring& name, const attributes_t& attributes);
+      virtual handle create_comment(const ustring& data);
+      virtual void append(handle parent, handle child);
+      virtual void insert_before(handle parent, handle child, handle sibling);
+      virtual void append_text(handle parent, const ustring& text);
+      virtual void insert_text_before(handle parent, handle sibling, const ustring& text);
+      virtual handle get_parent(handle node);
+      virtual void remove_from_parent(handle node);
+      virtual void reparent_children(handle node, handle newparent);
+      virtual void add_attributes_if_missing(handle element, const attributes_t& attributes);
+      virtual void release(const std::vector<handle>& referenced);
+
+    private:
+      char root;
+      std::deque<char> storage;
+      // The handles given out and not released, and the released
+      // handles to give out again
+      std::vector<handle> live;
+      std::vector<handle> unused;
+
+      handle allocate();
+    };
+  }
+}
+
+#endif
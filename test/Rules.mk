@@ -8,7 +8,7 @@ d		:= $(dir)
 TESTER_SOURCES += $(call filelist,tester.cpp test_helpers.cpp)
 
 # Test case files
-TESTER_SOURCES += $(call filelist,test_htmlentitysearcher.cpp test_htmltokenizer.cpp test_preprocessor.cpp test_treeconstructor.cpp test_unicode.cpp test_utf8_decoder.cpp test_dom.cpp test_vector.cpp test_htmlparser.cpp)
+TESTER_SOURCES += $(call filelist,test_htmlentitysearcher.cpp test_htmltokenizer.cpp test_preprocessor.cpp test_treeconstructor.cpp test_unicode.cpp test_utf8_decoder.cpp test_dom.cpp test_vector.cpp test_htmlparser.cpp test_preloadscanner.cpp test_tokenstream.cpp test_speculativetokenizer.cpp test_tokenpipeline.cpp test_fdinput.cpp test_pullparser.cpp test_rewriter.cpp test_incrementalparser.cpp test_serializer.cpp)
 
 dir := $(d)/w3domts
 include $(dir)/Rules.mk
@@ -12,12 +12,15 @@
  */
 
 #define BOOST_TEST_DYN_LINK
+#include <algorithm>
 #include <boost/test/unit_test.hpp>
 
 #include "dom/node.hpp"
 #include "dom/document.hpp"
 #include "dom/element.hpp"
 #include "dom/htmlelement.hpp"
+#include "dom/text.hpp"
+#include "dom/arena.hpp"
 #include "dom/pointers.hpp"
 #include "test_helpers.hpp"
 
@@ -301,4 +304,462 @@ BOOST_AUTO_TEST_CASE(create_element_proper_types)
   BOOST_CHECK(dom_cast<HTMLUnknownElement>(doc->createElement("foobarquz")));
 }
 
+BOOST_AUTO_TEST_CASE(parent_died)
+{
+  Documentp doc = Document::create();
+
+  Elementp parent = doc->createElement("div");
+  Elementp first = doc->createElement("p");
+  Elementp second = doc->createElement("p");
+  parent->appendChild(first);
+  parent->appendChild(second);
+
+  BOOST_CHECK_EQUAL(first->get_nextSibling(), second);
+  BOOST_CHECK_EQUAL(second->get_previousSibling(), first);
+
+  parent->removeChild(first);
+
+  BOOST_CHECK(!first->get_parentNode());
+  BOOST_CHECK(!first->get_nextSibling());
+  BOOST_CHECK(!second->get_previousSibling());
+
+  Elementwp wparent = parent;
+  parent.reset();
+
+  BOOST_CHECK(wparent.expired());
+  BOOST_CHECK(!second->get_parentNode());
+  BOOST_CHECK_EQUAL(second->get_ownerDocument(), doc);
+}
+
+BOOST_AUTO_TEST_CASE(wide_node)
+{
+  Documentp doc = Document::create();
+  Elementp parent = doc->createElement("div");
+
+  // Inserting in the middle of a wide node. The benchmark times
+  // this with more children.
+  Nodep first = parent->appendChild(doc->createTextNode("first"));
+  Nodep middle = parent->appendChild(doc->createTextNode("middle"));
+  Nodep last = parent->appendChild(doc->createTextNode("last"));
+  const int count = 1000;
+  for (int i = 0; i < count; ++i)
+  {
+    parent->insertBefore(doc->createTextNode("x"), middle);
+  }
+
+  BOOST_CHECK_EQUAL(parent->get_firstChild(), first);
+  BOOST_CHECK_EQUAL(parent->get_lastChild(), last);
+  BOOST_CHECK_EQUAL(middle->get_nextSibling(), last);
+
+  int n = 0;
+  bool inserted = true;
+  for (Nodep c = first->get_nextSibling(); c != middle; c = c->get_nextSibling())
+  {
+    inserted = inserted && c->get_nodeValue() == ustring("x");
+    ++n;
+  }
+  BOOST_CHECK(inserted);
+  BOOST_CHECK_EQUAL(n, count);
+
+  Nodep before = middle->get_previousSibling();
+  parent->removeChild(middle);
+  BOOST_CHECK_EQUAL(before->get_nextSibling(), last);
+  BOOST_CHECK_EQUAL(last->get_previousSibling(), before);
+  BOOST_CHECK(!middle->get_previousSibling());
+  BOOST_CHECK(!middle->get_nextSibling());
+}
+
+BOOST_AUTO_TEST_CASE(live_nodelist)
+{
+  Documentp doc = Document::create();
+  Elementp root = doc->createElement("div");
+  doc->appendChild(root);
+
+  for (int i = 0; i < 1000; ++i)
+  {
+    Elementp p = doc->createElement(i % 2 ? "p" : "span");
+    root->appendChild(p);
+  }
+
+  NodeListp ps = doc->getElementsByTagName("p");
+  NodeListp children = root->get_childNodes();
+
+  size_t count = 0;
+  for (size_t i = 0; i < ps->get_length(); ++i)
+  {
+    BOOST_REQUIRE_EQUAL(ps->item(i), root->get_childNodes()->item(2 * i + 1));
+    ++count;
+  }
+  BOOST_CHECK_EQUAL(count, 500);
+  BOOST_CHECK_EQUAL(children->get_length(), 1000);
+  BOOST_CHECK(!ps->item(500));
+
+  // The lists see changes to the tree
+  Elementp last = doc->createElement("p");
+  root->appendChild(last);
+  BOOST_CHECK_EQUAL(ps->get_length(), 501);
+  BOOST_CHECK_EQUAL(ps->item(500), last);
+  BOOST_CHECK_EQUAL(children->get_length(), 1001);
+
+  Nodep first = ps->item(0);
+  root->removeChild(first);
+  BOOST_CHECK_EQUAL(ps->get_length(), 500);
+  BOOST_CHECK(ps->item(0) != first);
+  BOOST_CHECK_EQUAL(children->item(0)->get_nodeName(), "SPAN");
+
+  // Changes made while a subtree is detached count too
+  Elementp nested = doc->createElement("p");
+  first->appendChild(nested);
+  root->appendChild(first);
+  BOOST_CHECK_EQUAL(ps->item(500), first);
+  BOOST_CHECK_EQUAL(ps->item(501), nested);
+  first->removeChild(nested);
+  BOOST_CHECK_EQUAL(ps->get_length(), 501);
+}
+
+BOOST_AUTO_TEST_CASE(tag_index)
+{
+  Documentp doc = Document::create();
+  Elementp root = doc->createElement("div");
+  doc->appendChild(root);
+
+  Elementp a = doc->createElement("div");
+  Elementp b = doc->createElement("div");
+  root->appendChild(a);
+  root->appendChild(b);
+  for (int i = 0; i < 10; ++i)
+  {
+    a->appendChild(doc->createElement("p"));
+    b->appendChild(doc->createElement("p"));
+  }
+
+  NodeListp all = doc->getElementsByTagName("p");
+  NodeListp ina = a->getElementsByTagName("p");
+  NodeListp inb = b->getElementsByTagName("p");
+  BOOST_CHECK_EQUAL(all->get_length(), 20);
+  BOOST_CHECK_EQUAL(ina->get_length(), 10);
+  BOOST_CHECK_EQUAL(ina->item(0), a->get_firstChild());
+  BOOST_CHECK_EQUAL(inb->item(9), b->get_lastChild());
+  BOOST_CHECK_EQUAL(all->item(10), b->get_firstChild());
+  BOOST_CHECK_EQUAL(doc->getElementsByTagName("div")->get_length(), 3);
+  BOOST_CHECK_EQUAL(doc->getElementsByTagName("span")->get_length(), 0);
+
+  // Moving a subtree keeps tree order
+  root->insertBefore(b, a);
+  BOOST_CHECK_EQUAL(all->item(0), b->get_firstChild());
+  BOOST_CHECK_EQUAL(all->item(10), a->get_firstChild());
+  b->appendChild(a);
+  BOOST_CHECK_EQUAL(inb->get_length(), 20);
+  BOOST_CHECK_EQUAL(inb->item(10), a->get_firstChild());
+  BOOST_CHECK_EQUAL(ina->get_length(), 10);
+
+  // Detached subtrees are still searched
+  root->removeChild(b);
+  BOOST_CHECK_EQUAL(all->get_length(), 0);
+  BOOST_CHECK_EQUAL(inb->get_length(), 20);
+  BOOST_CHECK_EQUAL(ina->item(9), a->get_lastChild());
+  a->removeChild(a->get_firstChild());
+  BOOST_CHECK_EQUAL(inb->get_length(), 19);
+
+  root->appendChild(b);
+  BOOST_CHECK_EQUAL(all->get_length(), 19);
+  BOOST_CHECK_EQUAL(all->item(18), a->get_lastChild());
+
+  // Elements outliving their document leave its tree
+  doc.reset();
+  BOOST_CHECK_EQUAL(a->getElementsByTagName("p")->get_length(), 9);
+  b->removeChild(a);
+  BOOST_CHECK_EQUAL(inb->get_length(), 10);
+}
+
+BOOST_AUTO_TEST_CASE(element_by_id)
+{
+  Documentp doc = Document::create();
+  Elementp root = doc->createElement("div");
+  doc->appendChild(root);
+
+  Elementp a = doc->createElement("p");
+  Elementp b = doc->createElement("p");
+  a->setAttribute("id", "x");
+  BOOST_CHECK(!doc->getElementById("x"));
+  root->appendChild(a);
+  BOOST_CHECK_EQUAL(doc->getElementById("x"), a);
+
+  // Duplicates resolve in tree order
+  b->setAttribute("id", "x");
+  root->insertBefore(b, a);
+  BOOST_CHECK_EQUAL(doc->getElementById("x"), b);
+  root->appendChild(b);
+  BOOST_CHECK_EQUAL(doc->getElementById("x"), a);
+  root->removeChild(a);
+  BOOST_CHECK_EQUAL(doc->getElementById("x"), b);
+
+  // Attribute changes
+  b->setAttribute("id", "y");
+  BOOST_CHECK(!doc->getElementById("x"));
+  BOOST_CHECK_EQUAL(doc->getElementById("y"), b);
+  b->getAttributeNode("id")->set_value("z");
+  BOOST_CHECK_EQUAL(doc->getElementById("z"), b);
+  dom_cast<Text>(b->getAttributeNode("id")->get_firstChild())->set_data("w");
+  BOOST_CHECK_EQUAL(doc->getElementById("w"), b);
+  BOOST_CHECK(!doc->getElementById("z"));
+  b->getAttributeNode("id")->get_firstChild()->set_nodeValue(ustring("u"));
+  BOOST_CHECK_EQUAL(doc->getElementById("u"), b);
+  BOOST_CHECK(!doc->getElementById("w"));
+  b->setAttribute("id", "w");
+  b->removeAttribute("id");
+  BOOST_CHECK(!doc->getElementById("w"));
+
+  Attrp attr = doc->createAttribute("id");
+  attr->set_value("v");
+  b->setAttributeNode(attr);
+  BOOST_CHECK_EQUAL(doc->getElementById("v"), b);
+  b->removeAttributeNode(attr);
+  BOOST_CHECK(!doc->getElementById("v"));
+
+  // Subtrees
+  a->appendChild(b);
+  b->setAttribute("id", "nested");
+  BOOST_CHECK(!doc->getElementById("nested"));
+  root->appendChild(a);
+  BOOST_CHECK_EQUAL(doc->getElementById("nested"), b);
+  BOOST_CHECK_EQUAL(doc->getElementById("x"), a);
+
+  // A clone has attributes of its own
+  Elementp clone = dom_cast<Element>(a->cloneNode(false));
+  BOOST_CHECK(clone->getAttributeNode("id") != a->getAttributeNode("id"));
+  BOOST_CHECK(clone->getAttributeNode("id")->get_ownerElement() == clone);
+  clone->setAttribute("id", "copy");
+  BOOST_CHECK(*a->getAttribute("id") == "x");
+  root->appendChild(clone);
+  BOOST_CHECK_EQUAL(doc->getElementById("copy"), clone);
+  BOOST_CHECK_EQUAL(doc->getElementById("x"), a);
+
+  doc->removeChild(root);
+  BOOST_CHECK(!doc->getElementById("nested"));
+  BOOST_CHECK(!doc->getElementById(""));
+}
+
+BOOST_AUTO_TEST_CASE(class_index)
+{
+  Documentp doc = Document::create();
+  Elementp root = doc->createElement("div");
+  doc->appendChild(root);
+
+  Elementp a = doc->createElement("p");
+  Elementp b = doc->createElement("p");
+  Elementp c = doc->createElement("p");
+  a->setAttribute("class", "x y");
+  b->setAttribute("class", " y\tz ");
+  c->setAttribute("class", "x");
+  root->appendChild(a);
+  root->appendChild(b);
+  a->appendChild(c);
+
+  NodeListp xs = doc->getElementsByClassName("x");
+  NodeListp xy = doc->getElementsByClassName("y x");
+  BOOST_CHECK_EQUAL(xs->get_length(), 2);
+  BOOST_CHECK_EQUAL(xs->item(0), a);
+  BOOST_CHECK_EQUAL(xs->item(1), c);
+  BOOST_CHECK_EQUAL(xy->get_length(), 1);
+  BOOST_CHECK_EQUAL(doc->getElementsByClassName("y")->item(1), b);
+  BOOST_CHECK_EQUAL(doc->getElementsByClassName("x w")->get_length(), 0);
+  BOOST_CHECK_EQUAL(doc->getElementsByClassName(" ")->get_length(), 0);
+  BOOST_CHECK_EQUAL(a->getElementsByClassName("x")->item(0), c);
+
+  // Attribute changes
+  c->setAttribute("class", "y x");
+  BOOST_CHECK_EQUAL(xy->get_length(), 2);
+  dom_cast<Text>(a->getAttributeNode("class")->get_firstChild())->set_data("z");
+  BOOST_CHECK_EQUAL(xy->item(0), c);
+  BOOST_CHECK_EQUAL(xs->get_length(), 1);
+  c->removeAttribute("class");
+  BOOST_CHECK_EQUAL(xs->get_length(), 0);
+
+  // Moves, detached subtrees and other documents
+  c->setAttribute("class", "x");
+  root->insertBefore(a, b);
+  root->insertBefore(b, a);
+  BOOST_CHECK_EQUAL(doc->getElementsByClassName("z")->item(0), b);
+  root->removeChild(a);
+  BOOST_CHECK_EQUAL(xs->get_length(), 0);
+  BOOST_CHECK_EQUAL(a->getElementsByClassName("x")->item(0), c);
+
+  Documentp other = Document::create();
+  other->appendChild(a);
+  BOOST_CHECK_EQUAL(other->getElementsByClassName("x")->item(0), c);
+  BOOST_CHECK_EQUAL(other->getElementsByClassName("z")->item(0), a);
+
+  // Clones
+  Elementp clone = dom_cast<Element>(b->cloneNode(false));
+  clone->setAttribute("class", "w");
+  root->appendChild(clone);
+  BOOST_CHECK_EQUAL(doc->getElementsByClassName("w")->item(0), clone);
+  BOOST_CHECK_EQUAL(doc->getElementsByClassName("z")->get_length(), 1);
+  BOOST_CHECK_EQUAL(doc->getElementsByClassName("z")->item(0), b);
+}
+
+namespace
+{
+  struct counter
+  {
+    counter(int& count)
+      : count(count)
+    {}
+
+    void operator()(Nodep)
+    {
+      ++count;
+    }
+
+    int& count;
+  };
+}
+
+BOOST_AUTO_TEST_CASE(mutation_signals)
+{
+  Documentp doc = Document::create();
+  Elementp parent = doc->createElement("div");
+  Elementp child = doc->createElement("p");
+
+  int added = 0, removed = 0, inserted = 0, left = 0;
+  parent->on_child_added(counter(added));
+  parent->on_child_removed(counter(removed));
+  child->on_inserted_to(counter(inserted));
+  boost::signals2::connection c = child->on_removed_from(counter(left));
+
+  parent->appendChild(child);
+  parent->appendChild(doc->createElement("p"));
+  parent->removeChild(child);
+  BOOST_CHECK_EQUAL(added, 2);
+  BOOST_CHECK_EQUAL(removed, 1);
+  BOOST_CHECK_EQUAL(inserted, 1);
+  BOOST_CHECK_EQUAL(left, 1);
+
+  c.disconnect();
+  parent->appendChild(child);
+  parent->removeChild(child);
+  BOOST_CHECK_EQUAL(inserted, 2);
+  BOOST_CHECK_EQUAL(left, 1);
+}
+
+namespace
+{
+  bool document_order(Nodep a, Nodep b)
+  {
+    return a->compareDocumentPosition(b) & Node::DOCUMENT_POSITION_FOLLOWING;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(document_position)
+{
+  Documentp doc = Document::create();
+  Elementp root = doc->createElement("div");
+  doc->appendChild(root);
+
+  // Nested lists, with leaves inserted repeatedly before the same
+  // node. The benchmark times sorting a larger tree.
+  std::vector<Nodep> nodes;
+  bool contained = true;
+  for (int i = 0; i < 10; ++i)
+  {
+    Elementp list = doc->createElement("ul");
+    root->appendChild(list);
+    Elementp last = doc->createElement("li");
+    list->appendChild(last);
+    for (int j = 0; j < 9; ++j)
+    {
+      list->insertBefore(doc->createElement("li"), last);
+      // Ask between inserts to keep the labels up to date
+      contained = contained && root->contains(last);
+    }
+  }
+  BOOST_CHECK(contained);
+
+  for (Nodep n = root; n; n = n->get_nextInTreeOrder(root))
+    nodes.push_back(n);
+  BOOST_REQUIRE_EQUAL(nodes.size(), 111);
+
+  bool ordered = true;
+  for (size_t i = 1; i < nodes.size(); ++i)
+  {
+    ordered = ordered && document_order(nodes[i - 1], nodes[i]);
+    ordered = ordered && !document_order(nodes[i], nodes[i - 1]);
+  }
+  BOOST_CHECK(ordered);
+
+  // Sorting into document order
+  std::vector<Nodep> shuffled(nodes);
+  for (size_t i = 0; i < shuffled.size(); ++i)
+    std::swap(shuffled[i], shuffled[(i * 7919) % shuffled.size()]);
+  std::sort(shuffled.begin(), shuffled.end(), &document_order);
+  BOOST_CHECK(shuffled == nodes);
+
+  Nodep list = root->get_firstChild();
+  Nodep item = list->get_firstChild();
+  BOOST_CHECK_EQUAL(list->compareDocumentPosition(item),
+		    Node::DOCUMENT_POSITION_CONTAINED_BY | Node::DOCUMENT_POSITION_FOLLOWING);
+  BOOST_CHECK_EQUAL(item->compareDocumentPosition(root),
+		    Node::DOCUMENT_POSITION_CONTAINS | Node::DOCUMENT_POSITION_PRECEDING);
+  BOOST_CHECK_EQUAL(item->compareDocumentPosition(item), 0);
+  BOOST_CHECK(list->contains(list));
+  BOOST_CHECK(!item->contains(list));
+  BOOST_CHECK(!list->contains(root->get_lastChild()->get_firstChild()));
+
+  // Detached subtrees
+  root->removeChild(list);
+  BOOST_CHECK(list->contains(item));
+  BOOST_CHECK_EQUAL(list->compareDocumentPosition(item),
+		    Node::DOCUMENT_POSITION_CONTAINED_BY | Node::DOCUMENT_POSITION_FOLLOWING);
+  BOOST_CHECK_EQUAL(item->compareDocumentPosition(item->get_nextSibling()),
+		    Node::DOCUMENT_POSITION_FOLLOWING);
+  BOOST_CHECK(list->compareDocumentPosition(root) & Node::DOCUMENT_POSITION_DISCONNECTED);
+  BOOST_CHECK(!root->contains(item));
+}
+
+BOOST_AUTO_TEST_CASE(node_arena)
+{
+  Elementp elem;
+
+  {
+    Documentp doc = Document::create();
+    nodearena* arena = doc->get_arena().get();
+
+    elem = doc->createElement("div");
+    elem->setAttribute("class", "foo");
+    elem->appendChild(doc->createTextNode("text"));
+    elem->appendChild(doc->createComment("comment"));
+
+    BOOST_CHECK_EQUAL(nodearena::arena_of(elem.get()), arena);
+    BOOST_CHECK_EQUAL(nodearena::arena_of(elem->getAttributeNode("class").get()), arena);
+    BOOST_CHECK_EQUAL(nodearena::arena_of(elem->get_firstChild().get()), arena);
+    BOOST_CHECK_EQUAL(nodearena::arena_of(elem->get_lastChild().get()), arena);
+
+    Nodep clone = elem->cloneNode();
+    BOOST_CHECK_EQUAL(nodearena::arena_of(clone.get()), arena);
+    BOOST_CHECK_EQUAL(nodearena::arena_of(clone->get_firstChild().get()), arena);
+
+    BOOST_CHECK(!nodearena::arena_of(Text::create("heap").get()));
+
+    // Freed nodes are reused
+    for (int i = 0; i < 1000; ++i)
+    {
+      doc->createElement("p");
+    }
+    size_t reserved = doc->get_arena()->bytes_reserved();
+    for (int i = 0; i < 1000; ++i)
+    {
+      doc->createElement("p");
+    }
+    BOOST_CHECK_EQUAL(doc->get_arena()->bytes_reserved(), reserved);
+  }
+
+  // The nodes keep the arena alive after the document is gone
+  BOOST_CHECK(!elem->get_ownerDocument());
+  BOOST_CHECK(elem->getAttribute("class") == ustring("foo"));
+  BOOST_CHECK(elem->get_firstChild()->get_nodeValue() == ustring("text"));
+  elem->removeChild(elem->get_lastChild());
+  BOOST_CHECK(elem->get_firstChild() == elem->get_lastChild());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
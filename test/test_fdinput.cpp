@@ -0,0 +1,198 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <cstdio>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <boost/bind.hpp>
+
+#include "parser/fdinput.hpp"
+#include "parser/htmlparser.hpp"
+#include "dom/document.hpp"
+#include "dom/element.hpp"
+#include "test_helpers.hpp"
+
+using namespace frenzy;
+using namespace frenzy::dom;
+using namespace frenzy::test_helpers;
+
+namespace
+{
+  // A socket pair standing in for a server connection. The server
+  // end is written to by the test.
+  struct connection
+  {
+    connection()
+    {
+      int fds[2];
+      BOOST_REQUIRE(socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+      client = fds[0];
+      server = fds[1];
+    }
+
+    ~connection()
+    {
+      close(client);
+      if (server >= 0)
+	close(server);
+    }
+
+    void send(const std::string& str)
+    {
+      BOOST_REQUIRE_EQUAL(write(server, str.data(), str.size()), ssize_t(str.size()));
+    }
+
+    void hang_up()
+    {
+      close(server);
+      server = -1;
+    }
+
+    int client;
+    int server;
+  };
+
+  struct recorder
+  {
+    void receive(const bytestring& bytes)
+    {
+      chunks.push_back(bytes);
+    }
+
+    std::vector<bytestring> chunks;
+  };
+}
+
+BOOST_AUTO_TEST_SUITE(fdinput_tests)
+
+BOOST_AUTO_TEST_CASE(feeds_parser)
+{
+  connection conn;
+  Documentp doc(Document::create());
+  htmlparser parser(doc);
+
+  fdinput input;
+  input.add(conn.client, parser);
+
+  // Nothing has arrived
+  BOOST_CHECK_EQUAL(input.poll(0), 1);
+  BOOST_CHECK(!doc->get_documentElement());
+
+  // Parsing starts before the rest of the document arrives
+  conn.send("<html><body><p>Hel");
+  BOOST_CHECK_EQUAL(input.poll(1000), 1);
+  BOOST_REQUIRE(doc->get_documentElement());
+  BOOST_CHECK(!parser.stopped());
+
+  conn.send("lo</p></body></html>");
+  conn.hang_up();
+  input.run();
+
+  BOOST_CHECK(parser.stopped());
+  assert_node_and_children(doc->get_documentElement(),
+			   elem("html")
+			   + elem("head")
+			   + (elem("body")
+			      + (elem("p")
+				 + txt("Hello"))));
+}
+
+BOOST_AUTO_TEST_CASE(bounded_chunks)
+{
+  connection conn;
+  recorder rec;
+
+  fdinput input(4);
+  input.add(conn.client, boost::bind(&recorder::receive, &rec, _1));
+
+  // One chunk per poll, the rest waits in the socket
+  conn.send("0123456789");
+  input.poll(1000);
+  BOOST_REQUIRE_EQUAL(rec.chunks.size(), 1);
+  BOOST_CHECK(rec.chunks[0] == bstr("0123"));
+
+  // A paused source is not read
+  input.pause(conn.client);
+  BOOST_CHECK_EQUAL(input.poll(0), 1);
+  BOOST_CHECK_EQUAL(rec.chunks.size(), 1);
+
+  input.resume(conn.client);
+  conn.hang_up();
+  input.run();
+
+  BOOST_REQUIRE_EQUAL(rec.chunks.size(), 4);
+  BOOST_CHECK(rec.chunks[1] == bstr("4567"));
+  BOOST_CHECK(rec.chunks[2] == bstr("89"));
+  // End-of-file
+  BOOST_CHECK(rec.chunks[3].empty());
+
+  // The original flags are restored
+  BOOST_CHECK(!(fcntl(conn.client, F_GETFL) & O_NONBLOCK));
+}
+
+BOOST_AUTO_TEST_CASE(paused_hang_up)
+{
+  connection conn;
+  recorder rec;
+
+  fdinput input;
+  input.add(conn.client, boost::bind(&recorder::receive, &rec, _1));
+  BOOST_CHECK(fcntl(conn.client, F_GETFL) & O_NONBLOCK);
+
+  // The hang-up of a paused source doesn't wake poll(), it waits the
+  // whole timeout
+  input.pause(conn.client);
+  conn.hang_up();
+
+  timeval start, end;
+  gettimeofday(&start, NULL);
+  BOOST_CHECK_EQUAL(input.poll(100), 1);
+  gettimeofday(&end, NULL);
+  long elapsed = (end.tv_sec - start.tv_sec) * 1000 + (end.tv_usec - start.tv_usec) / 1000;
+  BOOST_CHECK_GE(elapsed, 90);
+  BOOST_CHECK(rec.chunks.empty());
+
+  input.resume(conn.client);
+  input.run();
+  BOOST_REQUIRE_EQUAL(rec.chunks.size(), 1);
+  BOOST_CHECK(rec.chunks[0].empty());
+}
+
+BOOST_AUTO_TEST_CASE(regular_file)
+{
+  FILE* file = tmpfile();
+  BOOST_REQUIRE(file);
+  std::string content = "<p>From a file";
+  BOOST_REQUIRE_EQUAL(fwrite(content.data(), 1, content.size(), file), content.size());
+  fflush(file);
+  rewind(file);
+
+  recorder rec;
+  fdinput input(8);
+  input.add(fileno(file), boost::bind(&recorder::receive, &rec, _1));
+  input.run();
+  fclose(file);
+
+  BOOST_REQUIRE_EQUAL(rec.chunks.size(), 3);
+  BOOST_CHECK(rec.chunks[0] == bstr("<p>From "));
+  BOOST_CHECK(rec.chunks[1] == bstr("a file"));
+  BOOST_CHECK(rec.chunks[2].empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -202,3 +202,42 @@ frenzy::test_helpers::assert_node_and_children(frenzy::dom::Nodep n,
     assert_node_and_children(c, expected.children[i], depth + 1);
   }
 }
+
+namespace
+{
+  void outline(frenzy::dom::Nodep n, std::vector<frenzy::ustring>& out)
+  {
+    out.push_back(n->get_nodeName());
+    if (n->get_nodeType() == frenzy::dom::Node::TEXT_NODE ||
+	n->get_nodeType() == frenzy::dom::Node::COMMENT_NODE)
+      out.push_back(frenzy::dom_cast<frenzy::dom::CharacterData>(n)->get_data());
+
+    if (n->get_nodeType() == frenzy::dom::Node::ELEMENT_NODE)
+    {
+      frenzy::dom::Elementp elem = frenzy::dom_cast<frenzy::dom::Element>(n);
+      for (size_t i = 0; i < elem->getAttributeSize(); ++i)
+      {
+	frenzy::dom::Attrp attr = elem->getAttributeNodeByIndex(i);
+	frenzy::ustring a = attr->get_name();
+	a.push_back('=');
+	a.append(attr->get_value());
+	out.push_back(a);
+      }
+    }
+
+    frenzy::dom::NodeListp nl = n->get_childNodes();
+    for (size_t i = 0; i < nl->get_length(); ++i)
+    {
+      outline(nl->item(i), out);
+    }
+    out.push_back(frenzy::ustring());
+  }
+}
+
+std::vector<frenzy::ustring>
+frenzy::test_helpers::outline(frenzy::dom::Nodep n)
+{
+  std::vector<ustring> ret;
+  ::outline(n, ret);
+  return ret;
+}
@@ -231,6 +231,11 @@ namespace frenzy
     mocknode txt(std::string text);
     
     void assert_node_and_children(dom::Nodep n, mocknode expected, size_t depth = 0);
+
+    // Returns the node names, attributes, text and comments of the
+    // tree in document order, with empty strings closing the child
+    // lists. For comparing trees built in different ways.
+    std::vector<ustring> outline(dom::Nodep n);
   }
   
   // Printing for boost.test macros
@@ -14,9 +14,15 @@
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
 
+#include <vector>
+#include <boost/bind.hpp>
+
 #include "parser/htmlparser.hpp"
+#include "parser/parsemany.hpp"
 #include "dom/document.hpp"
 #include "dom/element.hpp"
+#include "dom/graphics.hpp"
+#include "dom/text.hpp"
 #include "test_helpers.hpp"
 
 using namespace frenzy;
@@ -25,6 +31,24 @@ using namespace frenzy::test_helpers;
 
 namespace
 {
+  // Watch callbacks for the watched_elements test
+  bool record_and_stop(std::vector<ustring>& found, const ustring& attr, Elementp elem)
+  {
+    found.push_back(*elem->getAttribute(attr));
+    return true;
+  }
+
+  bool record(std::vector<ustring>& found, Elementp elem)
+  {
+    found.push_back(elem->get_localName());
+    return false;
+  }
+
+  bool has_no_attributes(Elementp elem)
+  {
+    return elem->getAttributeSize() == 0;
+  }
+
   // Helper function for testing the parser
   void parser_test(std::string inputstr, mocknode expected)
   {
@@ -47,6 +71,69 @@ namespace
 
     assert_node_and_children(root, expected);
   }
+
+  // Graphics stubs that record which texts have been laid out
+  struct stub_translation : graphics::translation
+  {
+    virtual void position(vec2 p) { pos = p; }
+    virtual vec2 position() { return pos; }
+    virtual void relative_to(boost::shared_ptr<graphics::translation> t) { parent = t; }
+    virtual boost::shared_ptr<graphics::translation> relative_to() { return parent; }
+
+    vec2 pos;
+    boost::shared_ptr<graphics::translation> parent;
+  };
+
+  struct stub_text : graphics::text
+  {
+    stub_text(std::vector<ustring>& log)
+      : log(log)
+    {
+    }
+
+    virtual void data(ustring str) { log.push_back(str); }
+    virtual vec2 autowrap(vec) { return vec2(10, 10); }
+
+    std::vector<ustring>& log;
+  };
+
+  struct stub_factory : graphics::factory
+  {
+    virtual vec page_width() { return 800; }
+
+    virtual boost::shared_ptr<graphics::translation> create_translation()
+    {
+      return boost::shared_ptr<graphics::translation>(new stub_translation());
+    }
+
+    virtual boost::shared_ptr<graphics::text> create_text(boost::shared_ptr<graphics::translation>)
+    {
+      return boost::shared_ptr<graphics::text>(new stub_text(log));
+    }
+
+    std::vector<ustring> log;
+  };
+
+  // Parses the input as a fragment with a context element of the
+  // given name. The children of the expected node are compared to
+  // the nodes in the resulting fragment.
+  void fragment_test(std::string context, std::string inputstr, mocknode expected)
+  {
+    Documentp doc(Document::create());
+    Elementp contextelem = doc->createElement(context);
+
+    DocumentFragmentp fragment = htmlparser::parse_fragment(contextelem, bstr(inputstr));
+
+    BOOST_CHECK(fragment->get_ownerDocument() == doc);
+    BOOST_CHECK(!doc->get_documentElement());
+
+    NodeListp nl = fragment->get_childNodes();
+    BOOST_REQUIRE_EQUAL(nl->get_length(), expected.children.size());
+    for (size_t i = 0; i < nl->get_length(); ++i)
+    {
+      assert_node_and_children(nl->item(i), expected.children[i]);
+    }
+  }
 }
 
 BOOST_AUTO_TEST_SUITE(htmlparser_tests)
@@ -69,4 +156,289 @@ BOOST_AUTO_TEST_CASE(with_text)
 		    + txt("Hello world"))));
 }
 
+BOOST_AUTO_TEST_CASE(text_between_chunks)
+{
+  Documentp doc(Document::create());
+  htmlparser parser(doc);
+
+  // The text at the end of a chunk is in the tree before more input
+  // arrives
+  parser.pass_bytes(bstr("<p>abc"));
+  Nodep p = doc->get_documentElement()->get_lastChild()->get_firstChild();
+  BOOST_REQUIRE(p && p->get_firstChild());
+  BOOST_CHECK(dom_cast<Text>(p->get_firstChild())->get_data() == "abc");
+
+  parser.pass_bytes(bstr("def"));
+  BOOST_CHECK(dom_cast<Text>(p->get_firstChild())->get_data() == "abcdef");
+  BOOST_CHECK(p->get_firstChild() == p->get_lastChild());
+
+  parser.pass_eof();
+  assert_node_and_children(p, elem("p") + txt("abcdef"));
+
+  // Whitespace that may be dropped waits for the rest of the run
+  parser::treeoptions options;
+  options.drop_whitespace = true;
+  doc = Document::create();
+  htmlparser lean(doc, options);
+  lean.pass_bytes(bstr("<p> "));
+  lean.pass_bytes(bstr(" x"));
+  lean.pass_eof();
+  p = doc->get_documentElement()->get_lastChild()->get_firstChild();
+  assert_node_and_children(p, elem("p") + txt("  x"));
+}
+
+BOOST_AUTO_TEST_CASE(progressive_layout)
+{
+  Documentp doc(Document::create());
+  boost::shared_ptr<stub_factory> fact(new stub_factory());
+  doc->graphicsfactory(fact);
+
+  htmlparser parser(doc);
+
+  parser.pass_bytes(bstr("<html><body><p>Hello</p><p>"));
+  doc->layout_document();
+
+  BOOST_REQUIRE_EQUAL(fact->log.size(), 1);
+  BOOST_CHECK(fact->log[0] == ustring("Hello"));
+  BOOST_CHECK(!doc->is_dirty());
+
+  // Nothing changed, nothing is laid out
+  doc->layout_document();
+  BOOST_CHECK_EQUAL(fact->log.size(), 1);
+
+  // Only the new text is laid out
+  parser.pass_bytes(bstr("world</p></body></html>"));
+  parser.pass_eof();
+  BOOST_CHECK(parser.stopped());
+  BOOST_CHECK(doc->is_dirty());
+  doc->layout_document();
+
+  BOOST_REQUIRE_EQUAL(fact->log.size(), 2);
+  BOOST_CHECK(fact->log[1] == ustring("world"));
+
+  // Changes through nodeValue are laid out as well
+  Nodep world = doc->get_documentElement()->get_lastChild()->get_lastChild()->get_firstChild();
+  world->set_nodeValue(ustring("there"));
+  BOOST_CHECK(doc->is_dirty());
+  doc->layout_document();
+
+  BOOST_REQUIRE_EQUAL(fact->log.size(), 3);
+  BOOST_CHECK(fact->log[2] == ustring("there"));
+}
+
+BOOST_AUTO_TEST_CASE(fragments)
+{
+  fragment_test("div", "<p>a</p>b",
+		elem("div")
+		+ (elem("p")
+		   + txt("a"))
+		+ txt("b"));
+
+  // No html, head or body elements are created
+  fragment_test("div", "<html><head><title>x</title></head><body>y</body></html>",
+		elem("div")
+		+ (elem("title")
+		   + txt("x"))
+		+ txt("y"));
+
+  // The context selects the tokenizer state
+  fragment_test("textarea", "<p>a</p>",
+		elem("textarea")
+		+ txt("<p>a</p>"));
+
+  // ... and the insertion mode
+  fragment_test("tr", "<td>a</td><td>b",
+		elem("tr")
+		+ (elem("td")
+		   + txt("a"))
+		+ (elem("td")
+		   + txt("b")));
+
+  fragment_test("table", "<tr><td>a",
+		elem("table")
+		+ (elem("tbody")
+		   + (elem("tr")
+		      + (elem("td")
+			 + txt("a")))));
+}
+
+BOOST_AUTO_TEST_CASE(fragment_context_ancestors)
+{
+  Documentp doc(Document::create());
+  Elementp svg = doc->createElement("svg");
+  Elementp title = doc->createElement("title");
+  svg->appendChild(title);
+
+  // An SVG title is not an RCDATA element
+  DocumentFragmentp fragment = htmlparser::parse_fragment(title, bstr("<b>x</b>"));
+  BOOST_REQUIRE_EQUAL(fragment->get_childNodes()->get_length(), 1);
+  assert_node_and_children(fragment->get_firstChild(),
+			   elem("b")
+			   + txt("x"));
+
+  // ... but the content of an HTML integration point is HTML
+  Elementp foreignobject = doc->createElement("foreignObject");
+  Elementp textarea = doc->createElement("textarea");
+  svg->appendChild(foreignobject);
+  foreignobject->appendChild(textarea);
+
+  fragment = htmlparser::parse_fragment(textarea, bstr("<b>x</b>"));
+  BOOST_REQUIRE_EQUAL(fragment->get_childNodes()->get_length(), 1);
+  assert_node_and_children(fragment->get_firstChild(), txt("<b>x</b>"));
+
+  // The form element pointer starts at the nearest form ancestor,
+  // so a form start tag is ignored
+  Elementp form = doc->createElement("form");
+  Elementp div = doc->createElement("div");
+  form->appendChild(div);
+
+  fragment = htmlparser::parse_fragment(div, bstr("<form><p>a</p></form>b"));
+  BOOST_REQUIRE_EQUAL(fragment->get_childNodes()->get_length(), 2);
+  assert_node_and_children(fragment->get_firstChild(),
+			   elem("p")
+			   + txt("a"));
+  assert_node_and_children(fragment->get_lastChild(), txt("b"));
+
+  // ... also when the context is the form itself
+  fragment = htmlparser::parse_fragment(form, bstr("<form>a"));
+  BOOST_REQUIRE_EQUAL(fragment->get_childNodes()->get_length(), 1);
+  assert_node_and_children(fragment->get_firstChild(), txt("a"));
+}
+
+BOOST_AUTO_TEST_CASE(reset_parser)
+{
+  Documentp doc1(Document::create());
+  htmlparser parser(doc1);
+
+  // Leave the previous parse in the middle of a tag and a
+  // multibyte character
+  parser.pass_bytes(bstr("<title>\xc3"));
+  parser.pass_bytes(bstr("\xa4</title><p class"));
+
+  Documentp doc2(Document::create());
+  parser.reset(doc2);
+  parser.pass_bytes(bstr("<p>a</p>"));
+  parser.pass_eof();
+  BOOST_CHECK(parser.stopped());
+
+  assert_node_and_children(doc2->get_documentElement(),
+			   elem("html")
+			   + elem("head")
+			   + (elem("body")
+			      + (elem("p")
+				 + txt("a"))));
+
+  // The first document is left as it was
+  Elementp html1 = doc1->get_documentElement();
+  BOOST_REQUIRE(html1);
+  BOOST_CHECK_EQUAL(html1->get_childNodes()->get_length(), 1);
+
+  // Reset to a fragment and back
+  Elementp context = doc2->createElement("textarea");
+  DocumentFragmentp fragment = doc2->createDocumentFragment();
+  parser.reset(context, fragment);
+  parser.pass_bytes(bstr("<p>b"));
+  parser.pass_eof();
+  BOOST_REQUIRE_EQUAL(fragment->get_childNodes()->get_length(), 1);
+  assert_node_and_children(fragment->get_childNodes()->item(0), txt("<p>b"));
+
+  Documentp doc3(Document::create());
+  parser.reset(doc3);
+  parser.pass_bytes(bstr("<textarea><p>c"));
+  parser.pass_eof();
+  BOOST_CHECK(parser.stopped());
+
+  assert_node_and_children(doc3->get_documentElement(),
+			   elem("html")
+			   + elem("head")
+			   + (elem("body")
+			      + (elem("textarea")
+				 + txt("<p>c"))));
+}
+
+BOOST_AUTO_TEST_CASE(parse_many_documents)
+{
+  std::vector<bytestring> inputs;
+  for (size_t i = 0; i < 40; ++i)
+  {
+    // Vary the sizes and structures, so that the parsers of the
+    // threads go through different states before being reset
+    std::string input = "<table><tr><td>" + std::string(i % 7, 'x');
+    if (i % 3 == 0)
+      input = "<title>" + input;
+    inputs.push_back(bstr(input + "<p>" + char('a' + i % 26)));
+  }
+
+  std::vector<Documentp> docs = parse_many(inputs, 4);
+  BOOST_REQUIRE_EQUAL(docs.size(), inputs.size());
+
+  for (size_t i = 0; i < docs.size(); ++i)
+  {
+    Documentp expected(Document::create());
+    htmlparser parser(expected);
+    parser.pass_bytes(inputs[i]);
+    parser.pass_eof();
+
+    BOOST_REQUIRE(docs[i]);
+    BOOST_CHECK(outline(docs[i]) == outline(expected));
+  }
+
+  BOOST_CHECK(parse_many(std::vector<bytestring>(), 4).empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_CASE(watched_elements)
+{
+  const std::string head =
+    "<!DOCTYPE html><html><head><title>T</title>"
+    "<meta name=a content=b><link rel=canonical href=x>";
+  const std::string input = head + "<link rel=canonical href=y></head><body><p>\xc3\xa4</p></body></html>";
+
+  // Stop at the first match, in chunks of different sizes
+  for (size_t chunksize = 1; chunksize <= input.size(); chunksize *= 4)
+  {
+    Documentp doc(Document::create());
+    htmlparser parser(doc);
+
+    std::vector<ustring> found;
+    parser.watch("link[rel=canonical]", boost::bind(record_and_stop, boost::ref(found), "href", _1));
+
+    for (size_t i = 0; i < input.size() && !parser.stopped(); i += chunksize)
+      parser.pass_bytes(bstr(input.substr(i, chunksize)));
+
+    BOOST_CHECK(parser.halted());
+    BOOST_CHECK(parser.stopped());
+    BOOST_CHECK_EQUAL(parser.bytes_consumed(), head.size());
+    BOOST_REQUIRE_EQUAL(found.size(), 1);
+    BOOST_CHECK(found[0] == "x");
+
+    // Nothing after the link is created
+    parser.pass_eof();
+    assert_node_and_children(doc->get_documentElement(),
+			     elem("html")
+			     + (elem("head")
+				+ (elem("title")
+				   + txt("T"))
+				+ elem("meta", attr("name", "a") + attr("content", "b"))
+				+ elem("link", attr("rel", "canonical") + attr("href", "x"))));
+  }
+
+  // Elements are reported when complete, including the ones closed
+  // by end-of-file, and without halting the whole document is parsed
+  Documentp doc(Document::create());
+  htmlparser parser(doc);
+
+  std::vector<ustring> found;
+  parser.watch_if(has_no_attributes, boost::bind(record, boost::ref(found), _1));
+  parser.pass_bytes(bstr("<p>a<b>b</p>c<table><td>d</table><div>"));
+  parser.pass_eof();
+
+  BOOST_CHECK(parser.stopped());
+  BOOST_CHECK(!parser.halted());
+
+  const char* expected[] = { "head", "b", "p", "td", "tr", "tbody", "table", "div", "b", "body", "html" };
+  BOOST_REQUIRE_EQUAL(found.size(), sizeof(expected) / sizeof(expected[0]));
+  for (size_t i = 0; i < found.size(); ++i)
+    BOOST_CHECK(found[i] == expected[i]);
+}
@@ -0,0 +1,232 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+#include <sstream>
+
+#include "parser/incrementalparser.hpp"
+#include "parser/htmlparser.hpp"
+#include "dom/document.hpp"
+#include "dom/element.hpp"
+#include "dom/text.hpp"
+#include "test_helpers.hpp"
+
+using namespace frenzy;
+using namespace frenzy::dom;
+using namespace frenzy::test_helpers;
+
+namespace
+{
+  std::vector<ustring> full_parse(const std::string& input)
+  {
+    Documentp doc(Document::create());
+    htmlparser parser(doc);
+    parser.pass_bytes(bstr(input));
+    parser.pass_eof();
+
+    return outline(doc);
+  }
+
+  // Replaces the first occurrence of `find' in the current input
+  struct replacement
+  {
+    const char* find;
+    const char* replace;
+  };
+
+  void check_replacements(const std::string& input, const replacement* edits, size_t count)
+  {
+    Documentp doc(Document::create());
+    incrementalparser parser(doc);
+    parser.parse(bstr(input));
+    BOOST_CHECK(outline(doc) == full_parse(input));
+
+    std::string current = input;
+    for (size_t i = 0; i < count; ++i)
+    {
+
+      std::string find(edits[i].find);
+      size_t pos = current.find(find);
+      BOOST_REQUIRE(pos != std::string::npos);
+
+      parser.edit(pos, find.size(), bstr(edits[i].replace));
+      current.replace(pos, find.size(), edits[i].replace);
+
+      BOOST_CHECK(parser.input() == bstr(current));
+      BOOST_CHECK(outline(doc) == full_parse(current));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(incremental_edits)
+{
+  const std::string input =
+    "<!DOCTYPE html><html><head><title>T</title><script>var a = '<p>';</script></head>"
+    "<body><p class=a>one</p><p>two &amp; three</p><div><span>four</span></div>"
+    "<p>five</p></body></html>";
+
+  const replacement edits[] = {
+    { "two", "TWO" },
+    // The rest of the document becomes text, and back
+    { "<p>five", "<textarea><p>five" },
+    { "<textarea>", "" },
+    { "class=a", "class=b id=x" },
+    // Attributes without a value
+    { "<div>", "<div a>" },
+    { "<div a>", "<div b>" },
+    { "<div b>", "<div b c=\"\">" },
+    { "<div b c=\"\">", "<div>" },
+    // Foster parenting changes the tree around the edit
+    { "<div>", "<table><div>" },
+    { "<table>", "" },
+    { "var a", "</script><p>x</p><script>var a" },
+    { "four", "<!--four" },
+    { "<!--four", "four" },
+    { "one", "o\r\nne \xc3\xa4" },
+    { "\xc3\xa4", "&auml; &amp" },
+    { "</body></html>", "" },
+    { "<!DOCTYPE html>", "" },
+    { "<html>", "<html><frameset>" }
+  };
+
+  check_replacements(input, edits, sizeof(edits) / sizeof(edits[0]));
+}
+
+BOOST_AUTO_TEST_CASE(incremental_bogus_comments)
+{
+  // Bogus comments and DOCTYPEs without a name are checkpoints
+  // before the edits
+  const std::string input =
+    "<!DOCTYPE><p>a<?php echo 1 ?> b</p><p></ x>c<!x>d</p>";
+
+  const replacement edits[] = {
+    { " b", " bc" },
+    { "c<!x>", "cc<!x>" },
+    { "d", "<?x" },
+    { "<?x", "d" }
+  };
+
+  check_replacements(input, edits, sizeof(edits) / sizeof(edits[0]));
+}
+
+BOOST_AUTO_TEST_CASE(incremental_keeps_nodes)
+{
+  std::ostringstream str;
+  str << "<!DOCTYPE html><html><body>";
+  for (size_t i = 0; i < 200; ++i)
+    str << "<p class=\"item\">paragraph " << i << "</p>\n";
+  str << "</body></html>";
+  const std::string input = str.str();
+
+  Documentp doc(Document::create());
+  incrementalparser parser(doc);
+  parser.parse(bstr(input));
+
+  Elementp body = dom_cast<Element>(doc->get_documentElement()->get_lastChild());
+  std::vector<Nodep> before;
+  for (Nodep n = body->get_firstChild(); n; n = n->get_nextSibling())
+    before.push_back(n);
+
+  Nodep text100 = before[200]->get_firstChild();
+  BOOST_REQUIRE(text100);
+
+  const std::string find = "paragraph 100";
+  parser.edit(input.find(find), find.size(), bstr("paragraph one hundred"));
+
+  std::string edited = input;
+  edited.replace(edited.find(find), find.size(), "paragraph one hundred");
+  BOOST_CHECK(outline(doc) == full_parse(edited));
+
+  // Only the text around the edit is tokenized again
+  BOOST_CHECK_LT(parser.tokenized_characters(), 100u);
+
+  // All nodes keep their identity, the edited text node is updated
+  // in place
+  std::vector<Nodep> after;
+  for (Nodep n = body->get_firstChild(); n; n = n->get_nextSibling())
+    after.push_back(n);
+  BOOST_CHECK(before == after);
+  BOOST_CHECK(before[200]->get_firstChild() == text100);
+  BOOST_CHECK(dom_cast<Text>(text100)->get_data() == "paragraph one hundred");
+
+  // A new element is inserted without replacing its siblings
+  parser.edit(input.find("<p"), 0, bstr("<h1>title</h1>"));
+  std::vector<Nodep> inserted;
+  for (Nodep n = body->get_firstChild(); n; n = n->get_nextSibling())
+    inserted.push_back(n);
+  BOOST_REQUIRE_EQUAL(inserted.size(), before.size() + 1);
+  BOOST_CHECK(std::equal(before.begin(), before.end(), inserted.begin() + 1));
+
+  BOOST_CHECK_THROW(parser.edit(parser.input().size() + 1, 0, bstr("x")), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(incremental_keeps_open_elements)
+{
+  // The edits are inside elements that stay open after them
+  std::ostringstream str;
+  str << "<!DOCTYPE html><html><body><div id=outer><section><b>";
+  for (size_t i = 0; i < 200; ++i)
+    str << "<div class=item><p>item " << i << "</div>\n";
+  str << "</section></div></body></html>";
+  const std::string input = str.str();
+
+  Documentp doc(Document::create());
+  incrementalparser parser(doc);
+  parser.parse(bstr(input));
+  BOOST_CHECK(outline(doc) == full_parse(input));
+
+  Elementp outer = doc->getElementById("outer");
+  BOOST_REQUIRE(outer);
+  Nodep section = outer->get_firstChild();
+  Nodep bold = section->get_firstChild();
+  BOOST_REQUIRE(bold);
+  std::vector<Nodep> before;
+  for (Nodep n = bold->get_firstChild(); n; n = n->get_nextSibling())
+    before.push_back(n);
+
+  std::string current = input;
+  const replacement edits[] = {
+    { "<div class=item><p>item 100", "<div class=changed><p>item 100" },
+    { "item 150", "<i>item</i> 150" },
+    { "<i>item</i>", "item" }
+  };
+
+  for (size_t i = 0; i < sizeof(edits) / sizeof(edits[0]); ++i)
+  {
+    std::string find(edits[i].find);
+    size_t pos = current.find(find);
+    BOOST_REQUIRE(pos != std::string::npos);
+
+    parser.edit(pos, find.size(), bstr(edits[i].replace));
+    current.replace(pos, find.size(), edits[i].replace);
+    BOOST_CHECK(outline(doc) == full_parse(current));
+
+    // Tree construction continues from the open elements around
+    // the edit, not from the start
+    BOOST_CHECK_LT(parser.tokenized_characters(), 200u);
+  }
+
+  // The open elements and the siblings of the edited elements are
+  // the same nodes
+  BOOST_CHECK(doc->getElementById("outer") == outer);
+  BOOST_CHECK(outer->get_firstChild() == section);
+  BOOST_CHECK(section->get_firstChild() == bold);
+  std::vector<Nodep> after;
+  for (Nodep n = bold->get_firstChild(); n; n = n->get_nextSibling())
+    after.push_back(n);
+  BOOST_CHECK(before == after);
+}
@@ -0,0 +1,109 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+#include <boost/bind.hpp>
+
+#include "parser/preloadscanner.hpp"
+#include "parser/htmlparser.hpp"
+#include "dom/document.hpp"
+#include "test_helpers.hpp"
+
+using namespace frenzy;
+using namespace frenzy::parser;
+using namespace frenzy::test_helpers;
+
+namespace
+{
+  // Stub fetcher that records requested urls
+  struct fetcher
+  {
+    void fetch(const preload& p)
+    {
+      types.push_back(p.type);
+      urls.push_back(std::string(p.url.begin(), p.url.end()));
+    }
+
+    std::vector<preload::preloadtype> types;
+    std::vector<std::string> urls;
+  };
+}
+
+BOOST_AUTO_TEST_SUITE(preloadscanner_tests)
+
+BOOST_AUTO_TEST_CASE(finds_resources)
+{
+  preloadscanner scanner;
+  fetcher f;
+  scanner.attach_destination(boost::bind(&fetcher::fetch, &f, _1));
+
+  scanner.pass_characters(ustring("<html><head><base href=\"http://x/\"><base href=y>"
+				  "<link rel=stylesheet href=a.css>"
+				  "<script src=b.js></script></head>"
+				  "<body><img src='c.png'><img alt=none></body></html>"));
+  scanner.pass_characters(urope());
+
+  BOOST_REQUIRE_EQUAL(f.urls.size(), 4);
+  BOOST_CHECK_EQUAL(f.types[0], preload::PRELOAD_BASE);
+  BOOST_CHECK_EQUAL(f.urls[0], "http://x/");
+  BOOST_CHECK_EQUAL(f.types[1], preload::PRELOAD_LINK);
+  BOOST_CHECK_EQUAL(f.urls[1], "a.css");
+  BOOST_CHECK_EQUAL(f.types[2], preload::PRELOAD_SCRIPT);
+  BOOST_CHECK_EQUAL(f.urls[2], "b.js");
+  BOOST_CHECK_EQUAL(f.types[3], preload::PRELOAD_IMAGE);
+  BOOST_CHECK_EQUAL(f.urls[3], "c.png");
+}
+
+BOOST_AUTO_TEST_CASE(text_states)
+{
+  preloadscanner scanner;
+
+  // Markup inside script, style, title and textarea is not scanned
+  scanner.pass_characters(ustring("<script>document.write('<img src=a>')</script>"
+				  "<style><img src=b></style>"
+				  "<title><img src=c></title>"
+				  "<textarea><img src=d></textarea>"
+				  "<img src=e>"));
+  scanner.pass_characters(urope());
+
+  preloadscanner::preloadsequence_t preloads = scanner.complete_preloads();
+  BOOST_REQUIRE_EQUAL(preloads.size(), 1);
+  BOOST_CHECK(preloads[0].url == ustring("e"));
+}
+
+BOOST_AUTO_TEST_CASE(ahead_of_tree_construction)
+{
+  dom::Documentp doc(dom::Document::create());
+  htmlparser parser(doc);
+  fetcher f;
+  parser.attach_preloader(boost::bind(&fetcher::fetch, &f, _1));
+
+  // The image is reported as soon as its tag has been passed in
+  parser.pass_bytes(bstr("<html><body><p>Text<img src=a.png><p"));
+
+  BOOST_REQUIRE_EQUAL(f.urls.size(), 1);
+  BOOST_CHECK_EQUAL(f.urls[0], "a.png");
+
+  parser.pass_bytes(bstr("><img src=b.png>"));
+  parser.pass_eof();
+  BOOST_CHECK(parser.stopped());
+
+  BOOST_REQUIRE_EQUAL(f.urls.size(), 2);
+  BOOST_CHECK_EQUAL(f.urls[1], "b.png");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,122 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+#include <boost/bind.hpp>
+
+#include "parser/pullparser.hpp"
+#include "test_helpers.hpp"
+
+using namespace frenzy;
+using namespace frenzy::test_helpers;
+
+namespace
+{
+  std::string str(const ustring& u)
+  {
+    return std::string(u.begin(), u.end());
+  }
+
+  // A source that has the chunks available one at a time. An empty
+  // string in the list means no bytes are available at that point.
+  struct chunksource
+  {
+    chunksource(const std::vector<std::string>& chunks)
+      : chunks(chunks)
+      , pulled(0)
+    {
+    }
+
+    bool read(bytestring& chunk)
+    {
+      if (pulled == chunks.size())
+      {
+	chunk.clear();
+	return true;
+      }
+
+      std::string next = chunks[pulled++];
+      if (next.empty())
+	return false;
+
+      chunk = bstr(next);
+      return true;
+    }
+
+    std::vector<std::string> chunks;
+    size_t pulled;
+  };
+
+  // Serializes an event to a string for easy comparison
+  std::string event_string(const pullevent& e)
+  {
+    switch (e.type)
+    {
+    case pullevent::DOCTYPE:
+      return "<!" + str(e.name) + ">";
+    case pullevent::START_TAG:
+      return "<" + str(e.name) + (e.self_closing ? "/>" : ">");
+    case pullevent::END_TAG:
+      return "</" + str(e.name) + ">";
+    case pullevent::COMMENT:
+      return "{" + str(e.data) + "}";
+    case pullevent::TEXT:
+      return "[" + str(e.data) + "]";
+    }
+
+    return "?";
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(pullparser_tests)
+
+BOOST_AUTO_TEST_CASE(pulls_on_demand)
+{
+  std::vector<std::string> chunks;
+  chunks.push_back("<!DOCTYPE html><p class=x>a");
+  chunks.push_back("");
+  chunks.push_back("b</p><!--c--><br/>");
+  chunks.push_back("<script>if (a<b) {}</script>");
+
+  chunksource source(chunks);
+  pullparser parser(boost::bind(&chunksource::read, &source, _1));
+  pullevent e;
+
+  // Only the first chunk is read for the first events
+  BOOST_REQUIRE_EQUAL(parser.next(e), pullparser::EVENT);
+  BOOST_CHECK_EQUAL(event_string(e), "<!html>");
+  BOOST_CHECK_EQUAL(source.pulled, 1);
+
+  BOOST_REQUIRE_EQUAL(parser.next(e), pullparser::EVENT);
+  BOOST_CHECK_EQUAL(event_string(e), "<p>");
+  BOOST_CHECK(e.attributes[ustring("class")] == ustring("x"));
+
+  // The text run is not complete, and no bytes are available
+  BOOST_CHECK_EQUAL(parser.next(e), pullparser::WOULD_BLOCK);
+
+  std::string rest;
+  while (parser.next(e) == pullparser::EVENT)
+  {
+    rest += event_string(e);
+  }
+  BOOST_CHECK_EQUAL(rest, "[ab]</p>{c}<br/><script>[if (a<b) {}]</script>");
+
+  BOOST_CHECK_EQUAL(parser.next(e), pullparser::FINISHED);
+  BOOST_CHECK_EQUAL(parser.next(e), pullparser::FINISHED);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,166 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/bind.hpp>
+
+#include "parser/rewriter.hpp"
+#include "test_helpers.hpp"
+
+using namespace frenzy;
+using namespace frenzy::test_helpers;
+
+namespace
+{
+  void collect(std::string& out, const bytestring& chunk)
+  {
+    out.append(chunk.begin(), chunk.end());
+  }
+
+  // Passes the input to the rewriter in chunks of the given size
+  std::string rewrite(rewriter& rw, std::string& out, const std::string& input, size_t chunksize)
+  {
+    for (size_t i = 0; i < input.size(); i += chunksize)
+      rw.pass_bytes(bstr(input.substr(i, chunksize)));
+    rw.pass_eof();
+
+    BOOST_CHECK(rw.stopped());
+    return out;
+  }
+
+  void set_target(rewriteelement& e)
+  {
+    e.set_attribute("target", "_blank");
+  }
+
+  void drop(rewriteelement& e)
+  {
+    e.remove();
+  }
+
+  void unwrap(rewriteelement& e)
+  {
+    e.unwrap();
+  }
+
+  void wrap(rewriteelement& e)
+  {
+    e.before("[");
+    e.prepend("(");
+    e.append(")");
+    e.after("]");
+  }
+
+  void replace(rewriteelement& e)
+  {
+    e.set_content("<b>new</b>");
+  }
+
+  void mark(rewriteelement& e)
+  {
+    e.set_attribute("data-seen", e.get_attribute("id"));
+  }
+
+  void nothing(rewriteelement&)
+  {
+  }
+}
+
+BOOST_AUTO_TEST_CASE(rewriter_passthrough)
+{
+  const std::string input =
+    "<!DOCTYPE html><html><head><title>a &amp; b</title>"
+    "<script>if (a < b && c) x();</script>"
+    "<style>p > a {}</style></head>"
+    "<body><p class=x>1 &lt; 2 &#169;<!-- c --></p>"
+    "<textarea><p>&amp;</textarea>"
+    "<svg><title>t</title><path d=\"M0\"/></svg></body></html>";
+  const std::string expected =
+    "<!DOCTYPE html><html><head><title>a &amp; b</title>"
+    "<script>if (a < b && c) x();</script>"
+    "<style>p > a {}</style></head>"
+    "<body><p class=\"x\">1 &lt; 2 \xC2\xA9<!-- c --></p>"
+    "<textarea>&lt;p&gt;&amp;</textarea>"
+    "<svg><title>t</title><path d=\"M0\"/></svg></body></html>";
+
+  for (size_t chunksize = 1; chunksize <= input.size(); chunksize *= 3)
+  {
+    std::string out;
+    rewriter rw(boost::bind(collect, boost::ref(out), _1));
+    BOOST_CHECK_EQUAL(rewrite(rw, out, input, chunksize), expected);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(rewriter_handlers)
+{
+  {
+    std::string out;
+    rewriter rw(boost::bind(collect, boost::ref(out), _1));
+    rw.on("a[href]", set_target);
+    BOOST_CHECK_EQUAL(rewrite(rw, out, "<a href=x>1</a><a name=y>2</a>", 4),
+		      "<a href=\"x\" target=\"_blank\">1</a><a name=\"y\">2</a>");
+  }
+
+  {
+    std::string out;
+    rewriter rw(boost::bind(collect, boost::ref(out), _1));
+    rw.on("div.ad", drop);
+    rw.on("script", drop);
+    BOOST_CHECK_EQUAL(rewrite(rw, out,
+			      "<div class='x ad'>a<div>b</div>c<p>d</div>e"
+			      "<script>document.write('</div>')</script>f", 5),
+		      "e"
+		      "f");
+  }
+
+  {
+    std::string out;
+    rewriter rw(boost::bind(collect, boost::ref(out), _1));
+    rw.on("span", unwrap);
+    rw.on("#w", wrap);
+    rw.on("img", wrap);
+    BOOST_CHECK_EQUAL(rewrite(rw, out, "<p id=w>x<span>y</span><img src=z></p>", 2),
+		      "[<p id=\"w\">(xy[<img src=\"z\">])</p>]");
+  }
+
+  {
+    std::string out;
+    rewriter rw(boost::bind(collect, boost::ref(out), _1));
+    rw.on("ul", replace);
+    rw.on("LI[id]", mark);
+    rw.on("*", nothing);
+    BOOST_CHECK_EQUAL(rewrite(rw, out, "<ul><li id=1>x</ul><ul><ul></ul></ul><li id=2>y", 7),
+		      "<ul><b>new</b></ul><ul><b>new</b></ul><li data-seen=\"2\" id=\"2\">y");
+  }
+
+  {
+    // Elements without an end tag in the input end with the document
+    std::string out;
+    rewriter rw(boost::bind(collect, boost::ref(out), _1));
+    rw.on("p", wrap);
+    BOOST_CHECK_EQUAL(rewrite(rw, out, "<div>x<p>y", 3),
+		      "<div>x[<p>(y)]");
+  }
+
+  {
+    std::string out;
+    rewriter rw(boost::bind(collect, boost::ref(out), _1));
+    BOOST_CHECK_THROW(rw.on("", nothing), std::runtime_error);
+    BOOST_CHECK_THROW(rw.on("a b", nothing), std::runtime_error);
+    BOOST_CHECK_THROW(rw.on("a[href", nothing), std::runtime_error);
+    BOOST_CHECK_NO_THROW(rw.on("a[href='x y'].c#d", nothing));
+  }
+}
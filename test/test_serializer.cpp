@@ -0,0 +1,149 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <unistd.h>
+#include <boost/bind.hpp>
+
+#include "parser/serializer.hpp"
+#include "parser/htmlparser.hpp"
+#include "dom/document.hpp"
+#include "dom/element.hpp"
+#include "dom/text.hpp"
+#include "test_helpers.hpp"
+
+using namespace frenzy;
+using namespace frenzy::dom;
+using namespace frenzy::test_helpers;
+
+namespace
+{
+  Documentp parse(const bytestring& input)
+  {
+    Documentp doc(Document::create());
+    htmlparser parser(doc);
+    parser.pass_bytes(input);
+    parser.pass_eof();
+
+    BOOST_REQUIRE(parser.stopped());
+    return doc;
+  }
+
+  void collect(std::vector<bytestring>& out, const bytestring& chunk)
+  {
+    out.push_back(chunk);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(serializer_tests)
+
+BOOST_AUTO_TEST_CASE(serialize)
+{
+  Documentp doc = parse(bstr("<p class='a\"'>x &amp; y<br>z &lt;&nbsp;"
+			     "\xc3\xa4</p><script>if (a < b && c) {}</script><!--c-->"));
+  // The parser doesn't create doctype nodes yet
+  doc->insertBefore(DocumentType::create("html", "", ""), doc->get_firstChild());
+
+  BOOST_CHECK(outer_html(doc) ==
+	      bstr("<!DOCTYPE html><html><head></head><body>"
+		   "<p class=\"a&quot;\">x &amp; y<br>z &lt;&nbsp;\xc3\xa4</p>"
+		   "<script>if (a < b && c) {}</script><!--c--></body></html>"));
+
+  Nodep p = doc->getElementsByTagName("p")->item(0);
+  BOOST_CHECK(inner_html(p) == bstr("x &amp; y<br>z &lt;&nbsp;\xc3\xa4"));
+  BOOST_CHECK(outer_html(p->get_firstChild()) == bstr("x &amp; y"));
+}
+
+BOOST_AUTO_TEST_CASE(leading_newline)
+{
+  Documentp doc = parse(bstr("<pre>\n\nx</pre><textarea>\ny</textarea>"));
+  Nodep body = doc->getElementsByTagName("body")->item(0);
+
+  BOOST_CHECK(inner_html(body) == bstr("<pre>\n\nx</pre><textarea>y</textarea>"));
+}
+
+BOOST_AUTO_TEST_CASE(round_trip)
+{
+  const char* inputs[] = {
+    "<!DOCTYPE html><title>a &amp; b</title><p>One<p>Two<table><tr><td>x</table>",
+    "<ul><li>a<li>b</ul><pre>\n\nnewline</pre><textarea>\n<b></textarea>",
+    "<style>p > a { }</style><script>x = '<p>' && 1</script><img src=x alt='\"'>",
+    "<div id=a class='b c' title='&lt;&amp;&gt;'>\xe2\x82\xac\xc2\xa0<!--x--></div>",
+    "<select><option>1<option selected>2</select><svg></svg>"
+  };
+
+  for (size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); ++i)
+  {
+    Documentp doc = parse(bstr(inputs[i]));
+    bytestring html = outer_html(doc);
+    Documentp again = parse(html);
+
+    BOOST_CHECK(outline(again) == outline(doc));
+    BOOST_CHECK(outer_html(again) == html);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(chunks)
+{
+  Documentp doc = Document::create();
+  Elementp root = doc->createElement("div");
+  doc->appendChild(root);
+  for (int i = 0; i < 1000; ++i)
+  {
+    Elementp p = doc->createElement("p");
+    p->appendChild(doc->createTextNode("text & more"));
+    root->appendChild(p);
+  }
+
+  std::vector<bytestring> chunks;
+  serializer out(boost::bind(&collect, boost::ref(chunks), _1), 1024);
+  out.write_node(root);
+  out.flush();
+
+  bytestring joined;
+  for (size_t i = 0; i < chunks.size(); ++i)
+  {
+    BOOST_CHECK_LT(chunks[i].size(), 1100);
+    joined.append(chunks[i]);
+  }
+  BOOST_CHECK_GT(chunks.size(), 20);
+  BOOST_CHECK(joined == outer_html(root));
+}
+
+BOOST_AUTO_TEST_CASE(fd_sink)
+{
+  Documentp doc = parse(bstr("<p>Hello"));
+  bytestring expected = outer_html(doc);
+
+  int fds[2];
+  BOOST_REQUIRE_EQUAL(pipe(fds), 0);
+
+  serializer out(fd_destination(fds[1]));
+  out.write_node(doc);
+  out.flush();
+  close(fds[1]);
+
+  bytestring got;
+  byte buf[256];
+  ssize_t n;
+  while ((n = read(fds[0], buf, sizeof(buf))) > 0)
+    got.append(buf, n);
+  close(fds[0]);
+
+  BOOST_CHECK(got == expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,141 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+#include <boost/bind.hpp>
+
+#include "parser/speculativetokenizer.hpp"
+#include "parser/htmlparser.hpp"
+#include "dom/document.hpp"
+#include "test_helpers.hpp"
+
+using namespace frenzy;
+using namespace frenzy::dom;
+using namespace frenzy::parser;
+using namespace frenzy::test_helpers;
+
+namespace
+{
+  const std::string inputs[] = {
+    "<table><tr><td>1</td><td>2</td></tr><tr><td>3</td><td>4</td></tr></table>",
+    // '>' in places where a chunk can't start
+    "<p title='a>b'>x</p><!-- c > d -->y<p title=\"e>f\">z</p>",
+    "<script>if (a > b) { c = '<td>'; }</script><p>after</p>",
+    "<style>p > a { color: red }</style><p>after</p>",
+    "<textarea><td>x</td> > </textarea><p>after</p>",
+    "<title>a > b</title><p>after</p>",
+    // The tree constructor doesn't switch to the text states here
+    "<select><textarea>x</textarea><option>a > b</option></select><p>c</p>",
+    "<svg><title>a > b</title><style>c > d</style></svg><p>e</p>",
+    "<p>a &amp; b &lt; c > d &gt; e</p><p>f</p>",
+    "<p>before<plaintext><p>a > b</p>"
+  };
+
+  std::string large_input()
+  {
+    std::string ret = "<!DOCTYPE html><html><body><table>";
+    for (size_t i = 0; i < 300; ++i)
+    {
+      ret += "<tr><td class=\"c\">" + std::string(i % 13, 'x') + "</td><td>" + inputs[i % 10] + "</td></tr>";
+    }
+    ret += "</table></body></html>";
+    return ret;
+  }
+
+  // Parses the input sequentially and speculatively with small
+  // chunks, and checks that the trees are the same.
+  void compare_parse(const std::string& input, size_t threads, size_t chunksize)
+  {
+    Documentp expected(Document::create());
+    htmlparser sequential(expected);
+    sequential.pass_bytes(bstr(input));
+    sequential.pass_eof();
+
+    Documentp doc(Document::create());
+    htmlparser parser(doc);
+    parser.tokenize_in_parallel(threads, chunksize);
+    // Several batches
+    for (size_t i = 0; i < input.size(); i += 100)
+    {
+      parser.pass_bytes(bstr(input.substr(i, 100)));
+    }
+    parser.pass_eof();
+
+    BOOST_CHECK(parser.stopped());
+    BOOST_CHECK(outline(doc) == outline(expected));
+  }
+
+  struct token_recorder
+  {
+    void record(const token& t)
+    {
+      tokens.push_back(t);
+    }
+
+    std::vector<token> tokens;
+  };
+}
+
+BOOST_AUTO_TEST_SUITE(speculativetokenizer_tests)
+
+BOOST_AUTO_TEST_CASE(same_tokens)
+{
+  // Without a tree constructor nothing switches the real tokenizer
+  // to the text states, so every speculation past a text element
+  // start tag fails.
+  for (size_t i = 0; i < 10; ++i)
+  {
+    htmltokenizer seqtok;
+    token_recorder expected;
+    seqtok.attach_destination(boost::bind(&token_recorder::record, &expected, _1));
+    seqtok.pass_characters(urope(ustring(inputs[i])));
+    seqtok.pass_characters(urope());
+
+    htmltokenizer tok;
+    token_recorder result;
+    tok.attach_destination(boost::bind(&token_recorder::record, &result, _1));
+    speculative_tokenizer spec(tok, 3, 4);
+    spec.pass_characters(urope(ustring(inputs[i])));
+    spec.pass_characters(urope());
+
+    BOOST_REQUIRE_EQUAL(result.tokens.size(), expected.tokens.size());
+    for (size_t j = 0; j < result.tokens.size(); ++j)
+    {
+      BOOST_CHECK_EQUAL(result.tokens[j].type, expected.tokens[j].type);
+      BOOST_CHECK(result.tokens[j].tagname == expected.tokens[j].tagname);
+      if (expected.tokens[j].type == TOKEN_CHARACTER)
+	BOOST_CHECK(result.tokens[j].character == expected.tokens[j].character);
+      BOOST_CHECK(result.tokens[j].attributes == expected.tokens[j].attributes);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(same_tree)
+{
+  for (size_t i = 0; i < 10; ++i)
+  {
+    compare_parse(inputs[i], 4, 8);
+  }
+
+  std::string input = large_input();
+  compare_parse(input, 2, 50);
+  compare_parse(input, 4, 1000);
+  compare_parse(input, 8, 7);
+  compare_parse(input, 1, 100);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,139 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <stdexcept>
+
+#include "parser/htmlparser.hpp"
+#include "dom/document.hpp"
+#include "dom/element.hpp"
+#include "test_helpers.hpp"
+
+using namespace frenzy;
+using namespace frenzy::dom;
+using namespace frenzy::test_helpers;
+
+namespace
+{
+  const std::string inputs[] = {
+    "<table><tr><td>1</td><td>2</td></tr><tr><td>3</td><td>4</td></tr></table>",
+    "<script>if (a < b) { c = '<td>'; }</script><p>after</p>",
+    "<style>p > a { color: red }</style><xmp><p></xmp><p>after</p>",
+    "<textarea><td>x</td></textarea><title><b></title><p>after</p>",
+    // No switch to the text states here
+    "<select><textarea>x</textarea><option>a</option></select><p>c</p>",
+    "<svg><title><b>a</b></title><style><i>c</i></style></svg><p>e</p>",
+    "<p>before<plaintext><p>a</p>"
+  };
+  const size_t inputcount = sizeof(inputs) / sizeof(inputs[0]);
+
+  // Passes the input in chunks of the given size
+  void pass_in_chunks(htmlparser& parser, const std::string& input, size_t chunksize)
+  {
+    for (size_t i = 0; i < input.size(); i += chunksize)
+    {
+      parser.pass_bytes(bstr(input.substr(i, chunksize)));
+    }
+    parser.pass_eof();
+  }
+
+  std::vector<ustring> sequential_outline(const std::string& input)
+  {
+    Documentp doc(Document::create());
+    htmlparser parser(doc);
+    pass_in_chunks(parser, input, input.size());
+    return outline(doc);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(tokenpipeline_tests)
+
+BOOST_AUTO_TEST_CASE(same_tree)
+{
+  std::string large;
+  for (size_t i = 0; i < 200; ++i)
+  {
+    large += inputs[i % (inputcount - 1)];
+  }
+
+  for (size_t i = 0; i <= inputcount; ++i)
+  {
+    const std::string& input = i < inputcount ? inputs[i] : large;
+
+    Documentp doc(Document::create());
+    htmlparser parser(doc);
+    parser.pipeline_tree_construction();
+    pass_in_chunks(parser, input, 5);
+
+    BOOST_CHECK(parser.stopped());
+    BOOST_CHECK(outline(doc) == sequential_outline(input));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(reset_to_fragment)
+{
+  Documentp doc(Document::create());
+  htmlparser parser(doc);
+  parser.pipeline_tree_construction();
+  pass_in_chunks(parser, "<p>a<textarea>b", 3);
+
+  // The pipeline starts in the state of the context element
+  Elementp context = doc->createElement("textarea");
+  DocumentFragmentp fragment = doc->createDocumentFragment();
+  parser.reset(context, fragment);
+  pass_in_chunks(parser, "<p>c</p>", 3);
+
+  BOOST_REQUIRE_EQUAL(fragment->get_childNodes()->get_length(), 1);
+  assert_node_and_children(fragment->get_childNodes()->item(0), txt("<p>c</p>"));
+}
+
+BOOST_AUTO_TEST_CASE(exclusive_with_speculation)
+{
+  // Both would drive the same tree constructor
+  Documentp doc(Document::create());
+  htmlparser pipelined(doc);
+  pipelined.pipeline_tree_construction();
+  BOOST_CHECK_THROW(pipelined.tokenize_in_parallel(2), std::logic_error);
+
+  htmlparser speculative(doc);
+  speculative.tokenize_in_parallel(2);
+  BOOST_CHECK_THROW(speculative.pipeline_tree_construction(), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(input_without_eof)
+{
+  // The tree is complete between inputs, and the tree constructor
+  // thread is stopped by reset() and destruction without an end of
+  // file
+  Documentp doc(Document::create());
+  Documentp second(Document::create());
+  {
+    htmlparser parser(doc);
+    parser.pipeline_tree_construction();
+    const std::string input = "<p>a<b>b</b><script>c</script>";
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+      parser.pass_bytes(bstr(input.substr(i, 1)));
+    }
+    BOOST_CHECK_EQUAL(doc->getElementsByTagName("b")->get_length(), 1);
+
+    parser.reset(second);
+    parser.pass_bytes(bstr("<p>d<p>e"));
+  }
+  BOOST_CHECK_EQUAL(second->getElementsByTagName("p")->get_length(), 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
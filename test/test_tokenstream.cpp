@@ -0,0 +1,134 @@
+/* 
+ * Copyright 2013 by Nomovok Ltd.
+ * 
+ * Contact: info@nomovok.com
+ * 
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ * 
+ */
+
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+
+#include "parser/tokenstream.hpp"
+#include "test_helpers.hpp"
+
+using namespace frenzy;
+using namespace frenzy::test_helpers;
+
+namespace
+{
+  std::string str(const ustring& u)
+  {
+    return std::string(u.begin(), u.end());
+  }
+
+  // Serializes the events to a string for easy comparison
+  struct recorder : tokenhandler
+  {
+    virtual void start_tag(const ustring& name, const attributes_t& attributes, bool self_closing)
+    {
+      out += "<" + str(name);
+      for (attributes_t::const_iterator it = attributes.begin();
+	   it != attributes.end();
+	   ++it)
+      {
+	out += " " + str(it->first) + "=" + str(it->second);
+      }
+      out += self_closing ? "/>" : ">";
+    }
+
+    virtual void end_tag(const ustring& name)
+    {
+      out += "</" + str(name) + ">";
+    }
+
+    virtual void comment(const ustring& data)
+    {
+      out += "{" + str(data) + "}";
+    }
+
+    virtual void text(const ustring& data)
+    {
+      out += "[" + str(data) + "]";
+    }
+
+    virtual void end_of_file()
+    {
+      out += "EOF";
+    }
+
+    std::string out;
+  };
+
+  std::string tokenstream_test(std::string input1, std::string input2 = std::string())
+  {
+    recorder r;
+    tokenstream stream(r);
+
+    stream.pass_bytes(bstr(input1));
+    if (!input2.empty())
+      stream.pass_bytes(bstr(input2));
+    BOOST_CHECK(!stream.stopped());
+    stream.pass_eof();
+    BOOST_CHECK(stream.stopped());
+
+    return r.out;
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(tokenstream_tests)
+
+BOOST_AUTO_TEST_CASE(events)
+{
+  BOOST_CHECK_EQUAL(tokenstream_test("<p class=x>Hello <b>world</b><!--c--><br/>"),
+		    "<p class=x>[Hello ]<b>[world]</b>{c}<br/>EOF");
+}
+
+BOOST_AUTO_TEST_CASE(text_runs_span_chunks)
+{
+  BOOST_CHECK_EQUAL(tokenstream_test("<p>Hel", "lo</p>"),
+		    "<p>[Hello]</p>EOF");
+}
+
+BOOST_AUTO_TEST_CASE(text_states)
+{
+  BOOST_CHECK_EQUAL(tokenstream_test("<title>a<b></title><script>if (a<b) x='</p>';</script>"),
+		    "<title>[a<b>]</title><script>[if (a<b) x='</p>';]</script>EOF");
+  BOOST_CHECK_EQUAL(tokenstream_test("<textarea>&amp;<p></textarea><style><p></style>"),
+		    "<textarea>[&<p>]</textarea><style>[<p>]</style>EOF");
+  BOOST_CHECK_EQUAL(tokenstream_test("<plaintext><p></plaintext>"),
+		    "<plaintext>[<p></plaintext>]EOF");
+}
+
+BOOST_AUTO_TEST_CASE(insertion_modes)
+{
+  // Elements ignored in select don't switch the tokenizer state
+  BOOST_CHECK_EQUAL(tokenstream_test("<select><title><b></title><option>x</select>"),
+		    "<select><title><b></title><option>[x]</select>EOF");
+  // ... but a textarea closes the select
+  BOOST_CHECK_EQUAL(tokenstream_test("<select><textarea><b></textarea>"),
+		    "<select><textarea>[<b>]</textarea>EOF");
+  // Foster parented plaintext
+  BOOST_CHECK_EQUAL(tokenstream_test("<table><plaintext><tr>"),
+		    "<table><plaintext>[<tr>]EOF");
+  // Elements ignored after a frameset
+  BOOST_CHECK_EQUAL(tokenstream_test("<frameset></frameset><textarea><b>"),
+		    "<frameset></frameset><textarea><b>EOF");
+}
+
+BOOST_AUTO_TEST_CASE(foreign_content)
+{
+  // style inside svg is not raw text
+  BOOST_CHECK_EQUAL(tokenstream_test("<svg><style><a></a></style></svg><style><a></style>"),
+		    "<svg><style><a></a></style></svg><style>[<a>]</style>EOF");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -15,12 +15,15 @@
 #include <boost/test/unit_test.hpp>
 
 #include <map>
+#include <deque>
 #include <string>
 #include <vector>
+#include <algorithm>
 
 #include <boost/bind.hpp>
 
 #include "parser/treeconstructor.hpp"
+#include "parser/htmlnames.hpp"
 #include "dom/node.hpp"
 #include "dom/element.hpp"
 #include "dom/text.hpp"
@@ -64,6 +67,215 @@ namespace
 
     assert_node_and_children(root, expected);
   }
+
+  std::string str(const ustring& u)
+  {
+    return std::string(u.begin(), u.end());
+  }
+
+  // A tree sink that builds to its own node arena, for testing the
+  // sink interface
+  struct arenasink : treesink
+  {
+    struct arenanode
+    {
+      std::string name; // Element name, or empty for text and comments
+      std::string data; // Text or comment data
+      bool comment;
+      arenanode* parent;
+      std::vector<arenanode*> children;
+    };
+
+    std::deque<arenanode> arena;
+
+    arenanode* make(std::string name, std::string data, bool comment)
+    {
+      arenanode n;
+      n.name = name;
+      n.data = data;
+      n.comment = comment;
+      n.parent = NULL;
+      arena.push_back(n);
+      return &arena.back();
+    }
+
+    static arenanode* get(handle h)
+    {
+      return static_cast<arenanode*>(h);
+    }
+
+    void detach(arenanode* n)
+    {
+      if (!n->parent)
+	return;
+
+      std::vector<arenanode*>& c = n->parent->children;
+      c.erase(std::find(c.begin(), c.end(), n));
+      n->parent = NULL;
+    }
+
+    void insert(arenanode* parent, arenanode* child, arenanode* sibling)
+    {
+      detach(child);
+      child->parent = parent;
+      std::vector<arenanode*>& c = parent->children;
+      c.insert(sibling ? std::find(c.begin(), c.end(), sibling) : c.end(), child);
+    }
+
+    arenasink()
+    {
+      make("#document", "", false);
+    }
+
+    virtual handle document()
+    {
+      return &arena.front();
+    }
+
+    virtual handle create_element(const ustring& name, const attributes_t& attributes)
+    {
+      std::string data;
+      for (attributes_t::const_iterator it = attributes.begin();
+	   it != attributes.end();
+	   ++it)
+      {
+	data += " " + str(it->first) + "=" + str(it->second);
+      }
+      return make(str(name), data, false);
+    }
+
+    virtual handle create_comment(const ustring& data)
+    {
+      return make("", str(data), true);
+    }
+
+    virtual void append(handle parent, handle child)
+    {
+      insert(get(parent), get(child), NULL);
+    }
+
+    virtual void insert_before(handle parent, handle child, handle sibling)
+    {
+      insert(get(parent), get(child), get(sibling));
+    }
+
+    virtual void append_text(handle parent, const ustring& text)
+    {
+      std::vector<arenanode*>& c = get(parent)->children;
+      if (!c.empty() && c.back()->name.empty() && !c.back()->comment)
+	c.back()->data += str(text);
+      else
+	insert(get(parent), make("", str(text), false), NULL);
+    }
+
+    virtual void insert_text_before(handle parent, handle sibling, const ustring& text)
+    {
+      std::vector<arenanode*>& c = get(parent)->children;
+      std::vector<arenanode*>::iterator it = std::find(c.begin(), c.end(), get(sibling));
+      if (it != c.begin() && (*(it - 1))->name.empty() && !(*(it - 1))->comment)
+	(*(it - 1))->data += str(text);
+      else
+	insert(get(parent), make("", str(text), false), get(sibling));
+    }
+
+    virtual handle get_parent(handle node)
+    {
+      arenanode* p = get(node)->parent;
+      if (!p || p->name.empty() || p == &arena.front())
+	return NULL;
+      return p;
+    }
+
+    virtual void remove_from_parent(handle node)
+    {
+      detach(get(node));
+    }
+
+    virtual void reparent_children(handle node, handle newparent)
+    {
+      while (!get(node)->children.empty())
+	insert(get(newparent), get(node)->children.front(), NULL);
+    }
+
+    virtual void add_attributes_if_missing(handle element, const attributes_t& attributes)
+    {
+      for (attributes_t::const_iterator it = attributes.begin();
+	   it != attributes.end();
+	   ++it)
+      {
+	std::string attr = " " + str(it->first) + "=";
+	if (get(element)->data.find(attr) == std::string::npos)
+	  get(element)->data += attr + str(it->second);
+      }
+    }
+
+    static std::string serialize(const arenanode* n)
+    {
+      if (n->comment)
+	return "<!--" + n->data + "-->";
+      if (n->name.empty())
+	return n->data;
+
+      std::string ret = "<" + n->name + n->data + ">";
+      for (size_t i = 0; i < n->children.size(); ++i)
+	ret += serialize(n->children[i]);
+      return ret + "</" + n->name + ">";
+    }
+
+    std::string serialize()
+    {
+      std::string ret;
+      for (size_t i = 0; i < arena.front().children.size(); ++i)
+	ret += serialize(arena.front().children[i]);
+      return ret;
+    }
+  };
+
+  // A DOM sink that counts the releases, or ignores them to keep all
+  // of the created nodes
+  struct releasingsink : domsink
+  {
+    releasingsink(Documentp doc, bool ignore)
+      : domsink(doc)
+      , ignore(ignore)
+      , releases(0)
+      , most_referenced(0)
+    {
+    }
+
+    virtual void release(const std::vector<handle>& referenced)
+    {
+      if (ignore)
+	return;
+
+      ++releases;
+      most_referenced = std::max(most_referenced, referenced.size());
+      domsink::release(referenced);
+    }
+
+    bool ignore;
+    size_t releases;
+    size_t most_referenced;
+  };
+
+  // Helper function for testing tree construction through a custom
+  // sink
+  void sink_test(std::string inputstr, std::string expected,
+		 const treeoptions& options = treeoptions())
+  {
+    arenasink sink;
+    htmltokenizer tok;
+    treeconstructor tree(&sink, options);
+
+    tree.couple_tokenizer(&tok);
+
+    tok.pass_characters(urope(inputstr));
+    tok.pass_characters(urope());
+
+    BOOST_CHECK(tree.stopped());
+    BOOST_CHECK(!tree.document());
+    BOOST_CHECK_EQUAL(sink.serialize(), expected);
+  }
 }
 
 BOOST_AUTO_TEST_SUITE(meta_mocknode_tests)
@@ -378,4 +590,85 @@ BOOST_AUTO_TEST_CASE(text_node_combining_with_foster_parenting)
 			  + txt(" ")))));
 }
 
+BOOST_AUTO_TEST_CASE(custom_sink)
+{
+  sink_test("<!--c--><p class=x>Hello</p>",
+	    "<!--c--><html><head></head><body><p class=x>Hello</p></body></html>");
+
+  // Attributes of a later <html> and <body> are added if missing
+  sink_test("<body a=1><html b=2><body a=3 c=4>",
+	    "<html b=2><head></head><body a=1 c=4></body></html>");
+
+  // Adoption agency
+  sink_test("<b>1<p>2</b>3</p>",
+	    "<html><head></head><body><b>1</b><p><b>2</b>3</p></body></html>");
+
+  // Foster parenting
+  sink_test("A<table><tr><td>B</td></tr>C<em>D</em></table>",
+	    "<html><head></head><body>AC<em>D</em><table><tbody><tr><td>B</td></tr></tbody></table></body></html>");
+}
+
+BOOST_AUTO_TEST_CASE(lean_options)
+{
+  treeoptions options;
+  sink_test("<!--a--><p>x<!--b-->y</p>",
+	    "<!--a--><html><head></head><body><p>x<!--b-->y</p></body></html>",
+	    options);
+
+  options.drop_comments = true;
+  sink_test("<!--a--><p>x<!--b-->y</p>",
+	    "<html><head></head><body><p>xy</p></body></html>",
+	    options);
+
+  options = treeoptions();
+  options.drop_whitespace = true;
+  sink_test("<html> <head> <title> </title> </head>\n<body>\n <p> x <b>y</b> </p>"
+	    "<pre> <b> </b></pre> <textarea> </textarea></body></html>",
+	    "<html><head><title> </title></head><body><p> x <b>y</b></p>"
+	    "<pre> <b> </b></pre><textarea> </textarea></body></html>",
+	    options);
+
+  options = treeoptions();
+  options.skip_children = stringlist(html::script) + html::div;
+  sink_test("<script>x<y</script><div>a<p>b</p><!--c--><table><tr><td>d</table></div>"
+	    "<p>e</p><div><b>f</div>g</b>",
+	    "<html><head><script></script></head><body><div></div>"
+	    "<p>e</p><div></div><b>g</b></body></html>",
+	    options);
+}
+
+BOOST_AUTO_TEST_CASE(released_nodes)
+{
+  // Adoption agency and foster parenting remove and move nodes while
+  // the tree constructor refers to them
+  std::string input;
+  for (int i = 0; i < 500; ++i)
+    input += "<b>1<p>2</b>3</p><table><tr><td>a</td></tr><i>b</i></table><a>c<div>d</a>e</div>";
+
+  Documentp released(Document::create());
+  Documentp kept(Document::create());
+  releasingsink releasing(released, false);
+  releasingsink keeping(kept, true);
+
+  htmltokenizer tok1;
+  htmltokenizer tok2;
+  treeconstructor tree1(&releasing);
+  treeconstructor tree2(&keeping);
+  tree1.couple_tokenizer(&tok1);
+  tree2.couple_tokenizer(&tok2);
+
+  tok1.pass_characters(urope(input));
+  tok1.pass_characters(urope());
+  tok2.pass_characters(urope(input));
+  tok2.pass_characters(urope());
+
+  BOOST_CHECK(tree1.stopped());
+  BOOST_CHECK(tree2.stopped());
+  BOOST_CHECK(outline(released) == outline(kept));
+
+  // Only the few nodes the tree constructor refers to are kept
+  BOOST_CHECK(releasing.releases > 1);
+  BOOST_CHECK(releasing.most_referenced < 100);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
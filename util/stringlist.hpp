@@ -28,17 +28,22 @@ namespace frenzy
 
   struct stringlist
   {
-    stringlist(ustring str)
+    // An empty list
+    stringlist()
+    {
+    }
+
+    stringlist(const ustring& str)
     {
       strings.insert(str);
     }
 
-    bool contains(ustring str) const
+    bool contains(const ustring& str) const
     {
       return strings.find(str) != strings.end();
     }
 
-    stringlist& add(ustring str)
+    stringlist& add(const ustring& str)
     {
       strings.insert(str);
       return *this;
@@ -48,7 +53,7 @@ namespace frenzy
     std::set<ustring> strings;
   };
 
-  inline stringlist operator+(stringlist lhs, ustring str)
+  inline stringlist operator+(stringlist lhs, const ustring& str)
   {
     return lhs.add(str);
   }